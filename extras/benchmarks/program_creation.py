@@ -0,0 +1,54 @@
+"""
+Program creation time against the number of active uniforms.
+
+Program members are reflected lazily, creating a program only records the
+member names and locations. The Python objects are created on first access.
+This script reports the creation time and the cost of touching every member.
+"""
+import time
+
+import moderngl
+
+ctx = moderngl.create_context(standalone=True)
+
+
+def source(num_uniforms):
+    declarations = '\n'.join('uniform vec4 u%d;' % i for i in range(num_uniforms))
+    total = ' + '.join('u%d' % i for i in range(num_uniforms))
+    return '''
+        #version 330
+
+        %s
+
+        void main() {
+            gl_Position = %s;
+        }
+    ''' % (declarations, total)
+
+
+def measure(num_uniforms, repeat=10):
+    vertex_shader = source(num_uniforms)
+
+    create = 0.0
+    access = 0.0
+
+    for _ in range(repeat):
+        start = time.perf_counter()
+        program = ctx.program(vertex_shader=vertex_shader)
+        create += time.perf_counter() - start
+
+        start = time.perf_counter()
+        for name in program:
+            program[name]
+        access += time.perf_counter() - start
+
+        program.release()
+
+    return create / repeat, access / repeat
+
+
+print('%10s %16s %20s' % ('uniforms', 'create (ms)', 'access all (ms)'))
+
+for num_uniforms in (16, 64, 256, 1024):
+    create, access = measure(num_uniforms)
+    print('%10d %16.3f %20.3f' % (num_uniforms, create * 1000.0, access * 1000.0))
@@ -1,20 +1,29 @@
 """ModernGL: High performance rendering for Python 3."""
 
 from .error import *  # noqa
+from .brick_volume import *  # noqa
 from .buffer import *  # noqa
 from .compute_shader import *  # noqa
 from .conditional_render import *  # noqa
 from .context import *  # noqa
+from .frame_capture import *  # noqa
 from .framebuffer import *  # noqa
+from .pixel_format import *  # noqa
 from .program import *  # noqa
 from .program_members import *  # noqa
 from .query import *  # noqa
+from .render_target_pool import *  # noqa
 from .renderbuffer import *  # noqa
+from .residency import *  # noqa
 from .scope import *  # noqa
 from .texture import *  # noqa
 from .texture_3d import *  # noqa
 from .texture_array import *  # noqa
+from .texture_atlas import *  # noqa
+from .texture_buffer import *  # noqa
 from .texture_cube import *  # noqa
+from .uniform_stream import *  # noqa
+from .upload_queue import *  # noqa
 from .vertex_array import *  # noqa
 from .sampler import *  # noqa
 
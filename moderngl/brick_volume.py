@@ -0,0 +1,172 @@
+from typing import Iterable, Optional, Tuple
+
+from moderngl.mgl import InvalidObject  # type: ignore
+
+from .texture_3d import Texture3D
+
+__all__ = ['BrickVolume']
+
+
+class BrickVolume:
+    """
+    A BrickVolume streams the bricks of a volume too large for the GPU from a raw file.
+
+    The volume is split into bricks of ``brick_size`` texels along every axis. Only the bricks
+    requested with :py:meth:`request` are loaded into the slots of the :py:attr:`cache` texture.
+    The file is memory mapped, so only the pages of the loaded bricks are read from the disk
+    and the volume can be larger than the host memory too.
+
+    The :py:attr:`indirection` texture has a ``u2`` texel for every brick. The ``xyz`` of the
+    texel is the slot of the brick in the cache and ``w`` is 1 when the brick is resident.
+    Every slot stores ``border`` texels of the neighbouring bricks around the brick, the
+    cache can be sampled with linear filtering within a brick.
+
+    .. code-block:: glsl
+
+        uniform sampler3D cache;
+        uniform usampler3D indirection;
+
+        // texel is the position in the volume in texels
+        ivec3 brick = ivec3(texel) / brick_size;
+        uvec4 entry = texelFetch(indirection, brick, 0);
+        if (entry.w != 0u) {
+            vec3 local = texel - vec3(brick * brick_size);
+            vec3 slot = vec3(entry.xyz) * float(brick_size + 2 * border) + float(border);
+            value = texture(cache, (slot + local) / vec3(textureSize(cache, 0)));
+        }
+
+    The raw file holds the texels of the first level in x, y, z order after ``offset`` bytes,
+    without padding between the rows.
+
+    A BrickVolume object cannot be instantiated directly, it requires a context.
+    Use :py:meth:`Context.brick_volume` to create one.
+    """
+
+    __slots__ = ['mglo', '_cache', '_indirection', '_size', '_brick_size', '_border', '_grid', 'ctx', 'extra']
+
+    def __init__(self):
+        self.mglo = None  #: Internal representation for debug purposes only.
+        self._cache = None
+        self._indirection = None
+        self._size = None
+        self._brick_size = None
+        self._border = None
+        self._grid = None
+        self.ctx = None  #: The context this object belongs to
+        self.extra = None  #: Any - Attribute for storing user defined objects
+        raise TypeError()
+
+    def __repr__(self):
+        return '<BrickVolume: %dx%dx%d>' % self._size
+
+    def __hash__(self) -> int:
+        return id(self)
+
+    def __del__(self) -> None:
+        if not hasattr(self, "ctx"):
+            return
+
+        if self.ctx.gc_mode == "auto":
+            self.release()
+        elif self.ctx.gc_mode == "context_gc":
+            self.ctx.objects.append(self.mglo)
+
+    @property
+    def cache(self) -> Texture3D:
+        """Texture3D: The texture holding the resident bricks."""
+        return self._cache
+
+    @property
+    def indirection(self) -> Texture3D:
+        """Texture3D: The texture holding the slot of every brick."""
+        return self._indirection
+
+    @property
+    def size(self) -> Tuple[int, int, int]:
+        """tuple: The size of the volume."""
+        return self._size
+
+    @property
+    def brick_size(self) -> int:
+        """int: The size of a brick along every axis."""
+        return self._brick_size
+
+    @property
+    def border(self) -> int:
+        """int: The number of neighbouring texels stored around the bricks."""
+        return self._border
+
+    @property
+    def grid(self) -> Tuple[int, int, int]:
+        """tuple: The number of bricks along every axis, the size of the indirection texture."""
+        return self._grid
+
+    @property
+    def resident(self) -> int:
+        """int: The number of bricks in the cache."""
+        return self.mglo.resident
+
+    @property
+    def uploads(self) -> int:
+        """int: The number of bricks loaded so far."""
+        return self.mglo.uploads
+
+    @property
+    def evictions(self) -> int:
+        """int: The number of bricks evicted from the cache so far."""
+        return self.mglo.evictions
+
+    @property
+    def misses(self) -> int:
+        """int: The number of bricks the last :py:meth:`request` could not load."""
+        return self.mglo.misses
+
+    def request(self, bricks: Iterable[Tuple[int, int, int]], max_uploads: Optional[int] = None) -> int:
+        """
+        Make the visible bricks resident, from the highest to the lowest priority.
+
+        The bricks are given in priority order, usually sorted front to back from the
+        camera. The resident bricks are kept, the missing ones take the empty slots, then the
+        slots of the bricks not requested for the longest time, then the slots of the lower
+        priority bricks of this request. Bricks that do not fit the cache or exceed
+        ``max_uploads`` are counted in :py:attr:`misses` and can be requested again in the
+        next frame.
+
+        Args:
+            bricks (list): The ``(x, y, z)`` index of the bricks.
+            max_uploads (int): The maximum number of bricks loaded, ``None`` loads all of them.
+
+        Returns:
+            int: The number of bricks loaded.
+        """
+        return self.mglo.request(list(bricks), -1 if max_uploads is None else max_uploads)
+
+    def slot(self, brick: Tuple[int, int, int]) -> Optional[Tuple[int, int, int]]:
+        """
+        Get the slot of a brick in the cache.
+
+        Args:
+            brick (tuple): The ``(x, y, z)`` index of the brick.
+
+        Returns:
+            tuple: The ``(x, y, z)`` index of the slot or ``None`` if the brick is not resident.
+        """
+        return self.mglo.slot(tuple(brick))
+
+    def use(self, cache_location: int = 0, indirection_location: int = 1) -> None:
+        """
+        Bind the cache and the indirection texture to texture units.
+
+        Args:
+            cache_location (int): The texture unit of the cache.
+            indirection_location (int): The texture unit of the indirection texture.
+        """
+        self._cache.use(cache_location)
+        self._indirection.use(indirection_location)
+
+    def release(self) -> None:
+        """Release the ModernGL object, its textures and the file mapping."""
+        if not isinstance(self.mglo, InvalidObject):
+            self.mglo.release()
+            self._cache.release()
+            self._indirection.release()
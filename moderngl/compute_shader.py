@@ -4,6 +4,7 @@ from moderngl.mgl import InvalidObject  # type: ignore
 
 from .program_members import (
     Attribute,
+    StorageBlock,
     Subroutine,
     Uniform,
     UniformBlock,
@@ -60,7 +61,7 @@ class ComputeShader:
         elif self.ctx.gc_mode == "context_gc":
             self.ctx.objects.append(self.mglo)
 
-    def __getitem__(self, key: str) -> Union[Uniform, UniformBlock, Subroutine, Attribute, Varying]:
+    def __getitem__(self, key: str) -> Union[Uniform, UniformBlock, StorageBlock, Subroutine, Attribute, Varying]:
         """
         Get a member such as uniforms, uniform blocks, subroutines, \
         attributes and varyings by name.
@@ -133,7 +134,7 @@ class ComputeShader:
         """
         return self.mglo.run(group_x, group_y, group_z)
 
-    def get(self, key: str, default: Any) -> Union[Uniform, UniformBlock, Subroutine, Attribute, Varying]:
+    def get(self, key: str, default: Any) -> Union[Uniform, UniformBlock, StorageBlock, Subroutine, Attribute, Varying]:
         """
         Returns a Uniform, UniformBlock, Subroutine, Attribute or Varying.
 
@@ -1,29 +1,35 @@
+import os
 import warnings
-from collections import deque
+from collections import OrderedDict, deque
 from typing import Any, Deque, Dict, List, Optional, Set, Tuple, Union
 
 from moderngl.mgl import InvalidObject  # type: ignore
 
+from .brick_volume import BrickVolume
 from .buffer import Buffer
 from .compute_shader import ComputeShader
 from .conditional_render import ConditionalRender
 from .framebuffer import Framebuffer
 from .program import Program, detect_format
 from .program_members import (
-    Attribute,
-    Subroutine,
+    StorageBlock,
     Uniform,
     UniformBlock,
-    Varying,
 )
 from .query import Query
+from .render_target_pool import RenderTargetPool
 from .renderbuffer import Renderbuffer
+from .residency import ResidencyManager
 from .sampler import Sampler
 from .scope import Scope
 from .texture import Texture
 from .texture_3d import Texture3D
 from .texture_array import TextureArray
+from .texture_atlas import TextureAtlas
+from .texture_buffer import TextureBuffer
 from .texture_cube import TextureCube
+from .uniform_stream import UniformStream
+from .upload_queue import UploadQueue
 from .vertex_array import VertexArray
 
 try:
@@ -274,7 +280,9 @@ class Context:
     #: Used with :py:attr:`Context.provoking_vertex`.
     LAST_VERTEX_CONVENTION = 0x8E4E
 
-    __slots__ = ['mglo', '_screen', '_info', '_extensions', 'version_code', 'fbo', '_gc_mode', '_objects', 'extra']
+    __slots__ = [
+        'mglo', '_screen', '_info', '_extensions', 'version_code', 'fbo', '_gc_mode', '_objects', '_residency', 'extra',
+    ]
 
     def __init__(self):
         self.mglo = None  #: Internal representation for debug purposes only.
@@ -288,6 +296,7 @@ class Context:
         self.extra = None  #: Any - Attribute for storing user defined objects
         self._gc_mode = None
         self._objects: Deque[Any] = deque()
+        self._residency = None
         raise TypeError()
 
     def __repr__(self) -> str:
@@ -1103,6 +1112,47 @@ class Context:
         """
         self.mglo.copy_framebuffer(dst.mglo, src.mglo)
 
+    def copy_texture(
+        self,
+        dst: Union[Texture, Texture3D, TextureArray, TextureCube, Renderbuffer],
+        src: Union[Texture, Texture3D, TextureArray, TextureCube, Renderbuffer],
+        src_level: int = 0,
+        src_region: Optional[Tuple[int, ...]] = None,
+        dst_level: int = 0,
+        dst_offset: Optional[Tuple[int, ...]] = None,
+    ) -> None:
+        """
+        Copy texels between textures and renderbuffers on the GPU with ``glCopyImageSubData``.
+
+        No framebuffer is involved and the data never leaves the GPU.
+        The formats must have the same texel size, a ``'f1'`` RGBA texture
+        can be copied into a ``'u4'`` single channel texture.
+        Compressed textures can only be copied to compressed textures with the same block size.
+        The number of samples must match.
+
+        The third coordinate of the regions selects the depth, the layer
+        or the face of the cube map. Requires OpenGL 4.3.
+
+        .. code-block:: python
+
+            # Copy the second layer of an array into a 2D texture
+            ctx.copy_texture(texture, array, src_region=(0, 0, 1, 64, 64, 1))
+
+            # Copy a 16x16 tile into an atlas
+            ctx.copy_texture(atlas, tile, dst_offset=(32, 48))
+
+        Args:
+            dst: The destination texture or renderbuffer.
+            src: The source texture or renderbuffer.
+            src_level (int): The source mipmap level.
+            src_region (tuple): The region to copy, ``(width, height)``, ``(x, y, width, height)``,
+                                ``(width, height, depth)`` or ``(x, y, z, width, height, depth)``.
+                                By default the whole source level is copied.
+            dst_level (int): The destination mipmap level.
+            dst_offset (tuple): The destination ``(x, y)`` or ``(x, y, z)``.
+        """
+        self.mglo.copy_texture(dst.mglo, src.mglo, src_level, src_region, dst_level, dst_offset)
+
     def detect_framebuffer(self, glo: Optional[int] = None) -> 'Framebuffer':
         """
         Detect a framebuffer.
@@ -1123,6 +1173,7 @@ class Context:
         res._depth_attachment = None
         res.ctx = self
         res._is_reference = True
+        res._capture = None
         res.extra = None
         return res
 
@@ -1166,6 +1217,8 @@ class Context:
         alignment: int = 1,
         dtype: str = 'f1',
         internal_format: int = None,
+        immutable: bool = False,
+        levels: Optional[int] = None,
     ) -> 'Texture':
         """
         Create a :py:class:`Texture` object.
@@ -1184,17 +1237,24 @@ class Context:
             alignment (int): The byte alignment 1, 2, 4 or 8.
             dtype (str): Data type.
             internal_format (int): Override the internalformat of the texture (IF needed)
+            immutable (bool): Allocate immutable storage with ``glTexStorage``.
+            levels (int): The number of levels of the immutable storage.
+                          By default the full mipmap chain is allocated.
+                          Passing ``levels`` implies ``immutable``.
 
         Returns:
             :py:class:`Texture` object
         """
         res = Texture.__new__(Texture)
-        res.mglo, res._glo = self.mglo.texture(size, components, data, samples, alignment, dtype, internal_format or 0)
+        res.mglo, res._glo = self.mglo.texture(
+            size, components, data, samples, alignment, dtype, internal_format or 0, _storage_levels(immutable, levels),
+        )
         res._size = size
         res._components = components
         res._samples = samples
         res._dtype = dtype
         res._depth = False
+        res._depth_format = None
         res.ctx = self
         res.extra = None
         return res
@@ -1207,6 +1267,8 @@ class Context:
         *,
         alignment: int = 1,
         dtype: str = 'f1',
+        immutable: bool = False,
+        levels: Optional[int] = None,
     ) -> 'TextureArray':
         """
         Create a :py:class:`TextureArray` object.
@@ -1220,12 +1282,16 @@ class Context:
         Keyword Args:
             alignment (int): The byte alignment 1, 2, 4 or 8.
             dtype (str): Data type.
+            immutable (bool): Allocate immutable storage with ``glTexStorage``.
+            levels (int): The number of levels of the immutable storage.
+                          By default the full mipmap chain is allocated.
+                          Passing ``levels`` implies ``immutable``.
 
         Returns:
             :py:class:`Texture3D` object
         """
         res = TextureArray.__new__(TextureArray)
-        res.mglo, res._glo = self.mglo.texture_array(size, components, data, alignment, dtype)
+        res.mglo, res._glo = self.mglo.texture_array(size, components, data, alignment, dtype, _storage_levels(immutable, levels))
         res._size = size
         res._components = components
         res._dtype = dtype
@@ -1241,6 +1307,8 @@ class Context:
         *,
         alignment: int = 1,
         dtype: str = 'f1',
+        immutable: bool = False,
+        levels: Optional[int] = None,
     ) -> 'Texture3D':
         """
         Create a :py:class:`Texture3D` object.
@@ -1253,12 +1321,19 @@ class Context:
         Keyword Args:
             alignment (int): The byte alignment 1, 2, 4 or 8.
             dtype (str): Data type.
+            immutable (bool): Allocate immutable storage with ``glTexStorage``.
+            levels (int): The number of levels of the immutable storage.
+                          By default the full mipmap chain is allocated.
+                          Passing ``levels`` implies ``immutable``.
 
         Returns:
             :py:class:`Texture3D` object
         """
         res = Texture3D.__new__(Texture3D)
-        res.mglo, res._glo = self.mglo.texture3d(size, components, data, alignment, dtype)
+        res.mglo, res._glo = self.mglo.texture3d(size, components, data, alignment, dtype, _storage_levels(immutable, levels))
+        res._size = size
+        res._components = components
+        res._dtype = dtype
         res.ctx = self
         res.extra = None
         return res
@@ -1271,6 +1346,8 @@ class Context:
         *,
         alignment: int = 1,
         dtype: str = 'f1',
+        immutable: bool = False,
+        levels: Optional[int] = None,
     ) -> 'TextureCube':
         """
         Create a :py:class:`TextureCube` object.
@@ -1288,17 +1365,220 @@ class Context:
         Keyword Args:
             alignment (int): The byte alignment 1, 2, 4 or 8.
             dtype (str): Data type.
+            immutable (bool): Allocate immutable storage with ``glTexStorage``.
+            levels (int): The number of levels of the immutable storage.
+                          By default the full mipmap chain is allocated.
+                          Passing ``levels`` implies ``immutable``.
 
         Returns:
             :py:class:`TextureCube` object
         """
         res = TextureCube.__new__(TextureCube)
-        res.mglo, res._glo = self.mglo.texture_cube(size, components, data, alignment, dtype)
+        res.mglo, res._glo = self.mglo.texture_cube(size, components, data, alignment, dtype, _storage_levels(immutable, levels))
+        res._size = size
+        res._components = components
+        res._dtype = dtype
+        res.ctx = self
+        res.extra = None
+        return res
+
+    def texture_atlas(
+        self,
+        size: Tuple[int, int],
+        components: int = 4,
+        *,
+        layers: int = 1,
+        dtype: str = 'f1',
+        padding: int = 1,
+    ) -> TextureAtlas:
+        """
+        Create a :py:class:`TextureAtlas` object.
+
+        The atlas allocates a :py:class:`TextureArray` of ``layers`` layers
+        and packs the images added to it into the layers.
+
+        Args:
+            size (tuple): The width and height of a layer.
+            components (int): The number of components 1, 2, 3 or 4.
+
+        Keyword Args:
+            layers (int): The number of layers.
+            dtype (str): Data type, compressed dtypes are not supported.
+            padding (int): The number of texels kept empty between the images,
+                           linear filtering does not bleed the neighbours into an image.
+
+        Returns:
+            :py:class:`TextureAtlas` object
+        """
+        texture = self.texture_array((size[0], size[1], layers), components, dtype=dtype)
+        res = TextureAtlas.__new__(TextureAtlas)
+        res.mglo = self.mglo.texture_atlas(texture.mglo, padding)
+        res._texture = texture
+        res._size = tuple(size)
+        res._layers = layers
+        res._padding = padding
+        res._regions = {}
+        res.ctx = self
+        res.extra = None
+        return res
+
+    def brick_volume(
+        self,
+        path: str,
+        size: Tuple[int, int, int],
+        components: int = 1,
+        *,
+        dtype: str = 'f1',
+        brick_size: int = 32,
+        border: int = 1,
+        cache_bricks: Tuple[int, int, int] = (8, 8, 8),
+        offset: int = 0,
+    ) -> BrickVolume:
+        """
+        Create a :py:class:`BrickVolume` object streaming a volume from a raw file.
+
+        The cache :py:class:`Texture3D` holds ``cache_bricks`` bricks along every axis,
+        every brick takes ``brick_size + 2 * border`` texels in the cache.
+
+        Args:
+            path (str): The raw file holding the volume.
+            size (tuple): The width, height and depth of the volume.
+            components (int): The number of components 1, 2, 3 or 4.
+
+        Keyword Args:
+            dtype (str): Data type of the texels in the file, compressed dtypes are not supported.
+            brick_size (int): The size of a brick along every axis.
+            border (int): The number of neighbouring texels stored around every brick.
+            cache_bricks (tuple): The number of cache slots along every axis.
+            offset (int): The size of the file header skipped before the texels.
+
+        Returns:
+            :py:class:`BrickVolume` object
+        """
+        if brick_size < 1 or min(size) < 1:
+            raise ValueError('the volume and the bricks cannot be empty')
+        if border < 0:
+            raise ValueError('border must not be negative, got %d' % border)
+
+        stride = brick_size + border * 2
+        grid = tuple((axis + brick_size - 1) // brick_size for axis in size)
+        cache = self.texture3d(tuple(bricks * stride for bricks in cache_bricks), components, dtype=dtype)
+        indirection = self.texture3d(grid, 4, dtype='u2')
+
+        res = BrickVolume.__new__(BrickVolume)
+        try:
+            res.mglo = self.mglo.brick_volume(
+                cache.mglo, indirection.mglo, os.fspath(path), tuple(size), brick_size, border, offset,
+            )
+        except Exception:
+            cache.release()
+            indirection.release()
+            raise
+        res._cache = cache
+        res._indirection = indirection
+        res._size = tuple(size)
+        res._brick_size = brick_size
+        res._border = border
+        res._grid = grid
+        res.ctx = self
+        res.extra = None
+        return res
+
+    def texture_buffer(
+        self,
+        buffer: Buffer,
+        dtype: str = 'f4',
+        components: int = 4,
+        *,
+        offset: int = 0,
+        size: Optional[int] = None,
+    ) -> TextureBuffer:
+        """
+        Create a :py:class:`TextureBuffer` object.
+
+        The texels are sourced from the buffer, the whole buffer is used by default.
+        A range of the buffer requires OpenGL 4.3 and the offset must be a multiple of
+        ``GL_TEXTURE_BUFFER_OFFSET_ALIGNMENT``.
+
+        Three components are only supported with the ``f4``, ``i4`` and ``u4`` dtypes.
+        Compressed, packed, sRGB and signed normalized dtypes are not supported.
+
+        Args:
+            buffer (Buffer): The buffer holding the texels.
+            dtype (str): Data type.
+            components (int): The number of components 1, 2, 3 or 4.
+
+        Keyword Args:
+            offset (int): The offset of the first texel in bytes.
+            size (int): The size of the texel range in bytes.
+                        By default the range ends at the end of the buffer.
+
+        Returns:
+            :py:class:`TextureBuffer` object
+        """
+        res = TextureBuffer.__new__(TextureBuffer)
+        res.mglo, res._glo = self.mglo.texture_buffer(buffer.mglo, dtype, components, offset, -1 if size is None else size)
+        res._buffer = buffer
+        res._dtype = dtype
+        res._components = components
+        res._offset = offset
+        res._size = buffer.size - offset if size is None else size
+        res.ctx = self
+        res.extra = None
+        return res
+
+    def texture_from_file(
+        self,
+        path: Union[str, os.PathLike],
+        *,
+        stats: Optional[Dict[str, Any]] = None,
+    ) -> Union[Texture, TextureArray, TextureCube, Texture3D]:
+        """
+        Load a KTX, KTX2 or DDS file into an immutable texture.
+
+        The file is memory mapped and every mipmap level, layer and face is
+        uploaded straight from the mapping without an intermediate copy.
+        The returned type depends on the file: a :py:class:`Texture`,
+        :py:class:`TextureArray`, :py:class:`TextureCube` or :py:class:`Texture3D`.
+        Files without mipmap levels get a full chain built by the driver.
+
+        Supported formats are 8 bit unorm, 16 and 32 bit float and the
+        compressed dtypes listed in :ref:`compressed-textures-label`.
+        Supercompressed KTX2 files and cube map arrays are not supported.
+        Requires OpenGL 4.2.
+
+        Args:
+            path (str): The path of the file.
+
+        Keyword Args:
+            stats (dict): Filled with ``kind``, ``levels``, ``bytes`` and ``seconds``,
+                          the time spent mapping, parsing and uploading the file.
+
+        Returns:
+            The texture object
+        """
+        res_type = {
+            'texture': Texture,
+            'texture_array': TextureArray,
+            'texture_cube': TextureCube,
+            'texture3d': Texture3D,
+        }
+        mglo, glo, kind, size, components, dtype, levels, seconds, nbytes = self.mglo.texture_from_file(os.fspath(path))
+        res = res_type[kind].__new__(res_type[kind])
+        res.mglo, res._glo = mglo, glo
         res._size = size
         res._components = components
         res._dtype = dtype
+        if kind in ('texture', 'texture_array'):
+            res._depth = False
+        if kind == 'texture':
+            res._depth_format = None
+        if kind in ('texture', 'texture3d'):
+            res._samples = 0
         res.ctx = self
         res.extra = None
+        if stats is not None:
+            stats.update(kind=kind, levels=levels, bytes=nbytes, seconds=seconds)
         return res
 
     def depth_texture(
@@ -1308,10 +1588,20 @@ class Context:
         *,
         samples: int = 0,
         alignment: int = 4,
+        immutable: bool = False,
+        levels: Optional[int] = None,
+        dtype: str = 'd24',
     ) -> 'Texture':
         """
         Create a :py:class:`Texture` object.
 
+        The ``dtype`` selects the depth format: ``d16``, ``d24``, ``d32f``,
+        ``d24s8`` or ``d32fs8``. The data is read and written as ``u2`` for ``d16``,
+        as ``f4`` for ``d24`` and ``d32f`` and in the packed ``GL_DEPTH_STENCIL``
+        layouts for ``d24s8`` and ``d32fs8``. Depth-stencil textures also
+        provide the stencil buffer of a framebuffer. :py:attr:`Texture.dtype`
+        reports the pixel type and :py:attr:`Texture.depth_format` the depth format.
+
         Args:
             size (tuple): The width and height of the texture.
             data (bytes): Content of the texture.
@@ -1319,17 +1609,25 @@ class Context:
         Keyword Args:
             samples (int): The number of samples. Value 0 means no multisample format.
             alignment (int): The byte alignment 1, 2, 4 or 8.
+            immutable (bool): Allocate immutable storage with ``glTexStorage``.
+            levels (int): The number of levels of the immutable storage.
+                          By default the full mipmap chain is allocated.
+                          Passing ``levels`` implies ``immutable``.
+            dtype (str): The depth format.
 
         Returns:
             :py:class:`Texture` object
         """
         res = Texture.__new__(Texture)
-        res.mglo, res._glo = self.mglo.depth_texture(size, data, samples, alignment)
+        res.mglo, res._glo = self.mglo.depth_texture(
+            size, data, samples, alignment, _storage_levels(immutable, levels), dtype
+        )
         res._size = size
         res._components = 1
         res._samples = samples
-        res._dtype = 'f4'
+        res._dtype = _DEPTH_PIXEL_TYPES[dtype]
         res._depth = True
+        res._depth_format = dtype
         res.ctx = self
         res.extra = None
         return res
@@ -1411,10 +1709,9 @@ class Context:
         Returns:
             :py:class:`VertexArray` object
         """
-        members = program._members
         index_buffer_mglo = None if index_buffer is None else index_buffer.mglo
         mgl_content = tuple(
-            (a.mglo, b) + tuple(getattr(members.get(x), 'mglo', None) for x in c)
+            (a.mglo, b) + tuple(getattr(program.get(x, None), 'mglo', None) for x in c)
             for a, b, *c in content
         )
 
@@ -1427,6 +1724,7 @@ class Context:
         res._index_buffer = index_buffer
         res._content = content
         res._index_element_size = index_element_size
+        res._uniform_stream = None
         if mode is not None:
             res._mode = mode
         else:
@@ -1502,39 +1800,12 @@ class Context:
         varyings = tuple(varyings)
 
         res = Program.__new__(Program)
-        res.mglo, ls1, ls2, ls3, ls4, ls5, res._subroutines, res._geom, res._glo = self.mglo.program(
+        res.mglo, res._member_names, res._subroutines, res._geom, res._glo = self.mglo.program(
             vertex_shader, fragment_shader, geometry_shader, tess_control_shader, tess_evaluation_shader,
             varyings
         )
 
-        members = {}
-
-        for item in ls1:
-            obj = Attribute.__new__(Attribute)
-            obj.mglo, obj._location, obj._array_length, obj._dimension, obj._shape, obj._name = item
-            members[obj.name] = obj
-
-        for item in ls2:
-            obj = Varying.__new__(Varying)
-            obj._number, obj._array_length, obj._dimension, obj._name = item
-            members[obj.name] = obj
-
-        for item in ls3:
-            obj = Uniform.__new__(Uniform)
-            obj.mglo, obj._location, obj._array_length, obj._dimension, obj._name = item
-            members[obj.name] = obj
-
-        for item in ls4:
-            obj = UniformBlock.__new__(UniformBlock)
-            obj.mglo, obj._index, obj._size, obj._name = item
-            members[obj.name] = obj
-
-        for item in ls5:
-            obj = Subroutine.__new__(Subroutine)
-            obj._index, obj._name = item
-            members[obj.name] = obj
-
-        res._members = members
+        res._members = {}
         res._is_transform = fragment_shader is None
         res.ctx = self
         res.extra = None
@@ -1654,19 +1925,39 @@ class Context:
         used as the destination for rendering. The buffers for Framebuffer \
         objects reference images from either Textures or Renderbuffers.
 
+        A :py:class:`TextureArray`, :py:class:`TextureCube` or :py:class:`Texture3D`
+        attachment is layered, the geometry shader selects the layer to render to
+        with ``gl_Layer``. A cube map environment or shadow cascades render in a single pass.
+        Every attachment of a layered framebuffer must be layered.
+
+        A single layer, cube map face or mipmap level is attached with a
+        ``(texture, layer)`` or ``(texture, layer, level)`` tuple. A ``None`` layer
+        attaches every layer of the level.
+
+        .. code-block:: python
+
+            cascades = ctx.texture_array((1024, 1024, 4), 1, dtype='f4')
+            layered = ctx.framebuffer(cascades)
+            second = ctx.framebuffer((cascades, 1))
+            face = ctx.framebuffer([(cube, 3, 1)], (depth, None, 1))
+
         Args:
-            color_attachments (list): A list of :py:class:`Texture` or
-                                        :py:class:`Renderbuffer` objects.
+            color_attachments (list): A list of :py:class:`Texture`, :py:class:`Renderbuffer`,
+                                        :py:class:`TextureArray`, :py:class:`TextureCube`
+                                        or :py:class:`Texture3D` objects or attachment tuples.
             depth_attachment (Renderbuffer or Texture): The depth attachment.
 
         Returns:
             :py:class:`Framebuffer` object
         """
-        if type(color_attachments) is Texture or type(color_attachments) is Renderbuffer:
+        if isinstance(color_attachments, _ATTACHMENT_TYPES) or _is_attachment_tuple(color_attachments):
             color_attachments = (color_attachments,)
 
-        ca_mglo = tuple(x.mglo for x in color_attachments)
-        da_mglo = None if depth_attachment is None else depth_attachment.mglo
+        if self._residency is not None:
+            self._residency._touch_attachments(tuple(color_attachments) + (depth_attachment,))
+
+        ca_mglo = tuple(_attachment_mglo(x) for x in color_attachments)
+        da_mglo = None if depth_attachment is None else _attachment_mglo(depth_attachment)
 
         res = Framebuffer.__new__(Framebuffer)
         res.mglo, res._size, res._samples, res._glo = self.mglo.framebuffer(ca_mglo, da_mglo)
@@ -1674,6 +1965,7 @@ class Context:
         res._depth_attachment = depth_attachment
         res.ctx = self
         res._is_reference = False
+        res._capture = None
         res.extra = None
         return res
 
@@ -1707,6 +1999,7 @@ class Context:
         res._samples = samples
         res._dtype = dtype
         res._depth = False
+        res._depth_format = None
         res.ctx = self
         res.extra = None
         return res
@@ -1715,7 +2008,8 @@ class Context:
         self,
         size: Tuple[int, int],
         *,
-        samples: int = 0
+        samples: int = 0,
+        dtype: str = 'd24',
     ) -> 'Renderbuffer':
         """
         :py:class:`Renderbuffer` objects are OpenGL objects that contain images. \
@@ -1726,17 +2020,19 @@ class Context:
 
         Keyword Args:
             samples (int): The number of samples. Value 0 means no multisample format.
+            dtype (str): The depth format ``d16``, ``d24``, ``d32f``, ``d24s8`` or ``d32fs8``.
 
         Returns:
             :py:class:`Renderbuffer` object
         """
         res = Renderbuffer.__new__(Renderbuffer)
-        res.mglo, res._glo = self.mglo.depth_renderbuffer(size, samples)
+        res.mglo, res._glo = self.mglo.depth_renderbuffer(size, samples, dtype)
         res._size = size
         res._components = 1
         res._samples = samples
-        res._dtype = 'f4'
+        res._dtype = _DEPTH_PIXEL_TYPES[dtype]
         res._depth = True
+        res._depth_format = dtype
         res.ctx = self
         res.extra = None
         return res
@@ -1754,7 +2050,7 @@ class Context:
             :py:class:`ComputeShader` object
         """
         res = ComputeShader.__new__(ComputeShader)
-        res.mglo, ls1, ls2, ls3, ls4, res._glo = self.mglo.compute_shader(source)
+        res.mglo, ls1, ls2, ls3, ls4, ls5, res._glo = self.mglo.compute_shader(source)
 
         members = {}
 
@@ -1768,6 +2064,11 @@ class Context:
             obj.mglo, obj._index, obj._size, obj._name = item
             members[obj.name] = obj
 
+        for item in ls3:
+            obj = StorageBlock.__new__(StorageBlock)
+            obj.mglo, obj._index, obj._size, obj._name = item
+            members[obj.name] = obj
+
         res._members = members
         res.ctx = self
         res.extra = None
@@ -1827,6 +2128,115 @@ class Context:
         res.texture = texture
         return res
 
+    def uniform_stream(self, block: UniformBlock, capacity: int = 4 * 1024 * 1024) -> UniformStream:
+        """
+        Create a :py:class:`UniformStream` object.
+
+        The records are packed with the layout of the given uniform block and
+        bound to the current binding of the block.
+
+        Args:
+            block (UniformBlock): The uniform block describing a record.
+            capacity (int): The size of the ring in bytes.
+
+        Returns:
+            :py:class:`UniformStream` object
+        """
+        res = UniformStream.__new__(UniformStream)
+        res.mglo, res._record_size, res._capacity = self.mglo.uniform_stream(block.mglo.writer(), capacity, block.binding)
+        res.ctx = self
+        res.extra = None
+        return res
+
+    def upload_queue(self, staging_size: int = 16 * 1024 * 1024) -> UploadQueue:
+        """
+        Create a :py:class:`UploadQueue` object.
+
+        Args:
+            staging_size (int): The size of the staging ring in bytes.
+                                A single upload cannot be larger than the ring.
+
+        Returns:
+            :py:class:`UploadQueue` object
+        """
+        res = UploadQueue.__new__(UploadQueue)
+        res.mglo, res._staging, res._staging_size = self.mglo.upload_queue(staging_size)
+        res.ctx = self
+        res.extra = None
+        return res
+
+    def render_target_pool(self, max_memory: int = 256 * 1024 * 1024, max_age: int = 3) -> RenderTargetPool:
+        """
+        Create a :py:class:`RenderTargetPool` object.
+
+        Args:
+            max_memory (int): The maximum size of the idle objects in bytes.
+            max_age (int): The number of frames an idle object is kept.
+
+        Returns:
+            :py:class:`RenderTargetPool` object
+        """
+        res = RenderTargetPool.__new__(RenderTargetPool)
+        res._idle = {}
+        res._active = {}
+        res._frame = 0
+        res._max_age = max_age
+        res._max_memory = max_memory
+        res._memory = 0
+        res._idle_memory = 0
+        res._hits = 0
+        res._misses = 0
+        res.ctx = self
+        res.extra = None
+        return res
+
+    def residency_manager(self, budget: int) -> ResidencyManager:
+        """
+        Create a :py:class:`ResidencyManager` object.
+
+        The manager becomes the residency manager of the context, the managed textures
+        are restored when they are used or bound. Creating a new manager replaces it.
+
+        Args:
+            budget (int): The memory budget in bytes.
+
+        Returns:
+            :py:class:`ResidencyManager` object
+        """
+        res = ResidencyManager.__new__(ResidencyManager)
+        res._budget = budget
+        res._entries = OrderedDict()
+        res._evictions = 0
+        res._restores = 0
+        res.ctx = self
+        res.extra = None
+        self._residency = res
+        return res
+
+    def memory_stats(self) -> Dict[str, Dict[str, int]]:
+        """
+        The memory allocated by the objects of the context.
+
+        The sizes are computed by ModernGL from the size, format, levels and samples of the
+        objects, the driver may round them up or keep more memory. The result has a dictionary
+        for every object type with the ``bytes`` allocated by the live objects, the ``peak``
+        of the bytes and the number of live ``objects``. The ``total`` entry has the
+        ``bytes`` and ``peak`` of all the objects together.
+
+        .. code-block:: python
+
+            >>> ctx.memory_stats()['texture']
+            {'bytes': 4194304, 'peak': 8388608, 'objects': 1}
+
+        The keys are ``buffer``, ``texture``, ``texture3d``, ``texture_array``,
+        ``texture_cube``, ``renderbuffer`` and ``total``. Texture views are counted
+        as objects without bytes, evicted textures have no bytes until they are restored.
+
+        Returns:
+            dict
+        """
+        return self.mglo.memory_stats()
+
     def clear_samplers(self, start: int = 0, end: int = -1) -> None:
         """
         Unbinds samplers from texture units.
@@ -1851,6 +2261,18 @@ class Context:
         """
         self.mglo.clear_samplers(start, end)
 
+    def reset_program_state(self) -> None:
+        """
+        Forget the currently bound program.
+
+        ModernGL skips ``glUseProgram`` and ``glUniformSubroutinesuiv``
+        when a draw call or dispatch uses the same program and subroutines
+        as the previous one. Call this method after other code has
+        bound a different program in the same OpenGL context
+        so the next draw call or dispatch binds the program again.
+        """
+        self.mglo.reset_program_state()
+
     def core_profile_check(self) -> None:
         """
         Core profile check.
@@ -1908,6 +2330,37 @@ class Context:
             self.mglo.release()
 
 
+def _storage_levels(immutable: bool, levels: Optional[int]) -> int:
+    # 0 is mutable storage and -1 is a full mipmap chain
+    if levels is not None:
+        if levels < 1:
+            raise ValueError('levels must be positive, got %d' % levels)
+        return levels
+    return -1 if immutable else 0
+
+
+# The pixel type read() and write() transfer for each depth format
+_DEPTH_PIXEL_TYPES = {'d16': 'u2', 'd24': 'f4', 'd32f': 'f4', 'd24s8': 'u4', 'd32fs8': 'u8'}
+
+_ATTACHMENT_TYPES = (Texture, Renderbuffer, TextureArray, TextureCube, Texture3D)
+
+
+def _is_attachment_tuple(attachment: Any) -> bool:
+    # (texture, layer) or (texture, layer, level), the layer is an int or None
+    return (
+        isinstance(attachment, tuple) and len(attachment) in (2, 3)
+        and isinstance(attachment[0], _ATTACHMENT_TYPES) and not isinstance(attachment[1], _ATTACHMENT_TYPES)
+    )
+
+
+def _attachment_mglo(attachment: Any) -> Tuple[Any, int, int]:
+    # A negative layer attaches every layer
+    if _is_attachment_tuple(attachment):
+        texture, layer, level = attachment if len(attachment) == 3 else attachment + (0,)
+        return (texture.mglo, -1 if layer is None else layer, level)
+    return (attachment.mglo, -1, 0)
+
+
 def create_context(
     require: Optional[int] = None,
     standalone: bool = False,
@@ -1954,6 +2407,7 @@ def create_context(
     ctx.extra = None
     ctx._gc_mode = None
     ctx._objects = deque()
+    ctx._residency = None
 
     if ctx.version_code < require:
         raise ValueError('Requested OpenGL version {0}, got version {1}'.format(
@@ -2010,6 +2464,7 @@ def create_standalone_context(
     ctx.extra = None
     ctx._gc_mode = None
     ctx._objects = deque()
+    ctx._residency = None
 
     if require is not None and ctx.version_code < require:
         raise ValueError('Requested OpenGL version {0}, got version {1}'.format(
@@ -0,0 +1,175 @@
+from typing import TYPE_CHECKING, Iterator, Optional, Tuple, Union
+
+from moderngl.mgl import InvalidObject  # type: ignore
+
+if TYPE_CHECKING:
+    from .framebuffer import Framebuffer
+
+__all__ = ['FrameCapture']
+
+
+class FrameCapture:
+    """
+    Pipelined framebuffer readback through a ring of pixel pack buffers.
+
+    Every :py:meth:`read` queues a ``glReadPixels`` into the next slot of the ring
+    and fences it. The oldest frame is handed out as soon as its fence is signaled,
+    up to ``depth - 1`` frames after it was read. Reading never waits for the GPU
+    unless all the slots are in use.
+
+    The frames are returned as read-only memoryviews of the mapped buffer.
+    A frame is only valid until the next call to :py:meth:`read` or :py:meth:`flush`,
+    copy it with ``bytes(frame)`` to keep it. The memoryview is released before its
+    slot is reused. Slices, casts and other objects sharing the memory of the frame keep
+    the slot in use, :py:meth:`read`, :py:meth:`next` and :py:meth:`release` raise a
+    BufferError until they are released.
+
+    .. code-block:: python
+
+        capture = moderngl.FrameCapture(fbo, depth=3)
+
+        for i in range(frames):
+            render()
+            frame = capture.read()
+            if frame is not None:
+                encoder.write(frame)
+
+        for frame in capture.flush():
+            encoder.write(frame)
+    """
+
+    __slots__ = ['mglo', '_framebuffer', '_depth', '_frame_size', '_frame', 'ctx', 'extra']
+
+    def __init__(
+        self,
+        framebuffer: 'Framebuffer',
+        depth: int = 3,
+        *,
+        viewport: Optional[Union[Tuple[int, int], Tuple[int, int, int, int]]] = None,
+        components: int = 3,
+        attachment: int = 0,
+        alignment: int = 1,
+        dtype: str = 'f1',
+    ):
+        """
+        Args:
+            framebuffer (Framebuffer): The framebuffer to read.
+            depth (int): The number of pixel pack buffers in the ring, from 2 to 16.
+
+        Keyword Args:
+            viewport (tuple): The viewport.
+            components (int): The number of components to read.
+            attachment (int): The color attachment number. -1 for the depth attachment
+            alignment (int): The byte alignment of the pixels.
+            dtype (str): Data type.
+        """
+        self.mglo, self._frame_size = framebuffer.mglo.frame_capture(
+            depth, viewport, components, attachment, alignment, dtype
+        )
+        self._framebuffer = framebuffer
+        self._depth = depth
+        self._frame = None
+        self.ctx = framebuffer.ctx  #: The context this object belongs to
+        self.extra = None  #: Any - Attribute for storing user defined objects
+
+    def __repr__(self):
+        return '<FrameCapture: %d>' % self._depth
+
+    def __hash__(self) -> int:
+        return id(self)
+
+    def __del__(self) -> None:
+        if not hasattr(self, "ctx"):
+            return
+
+        if self.ctx.gc_mode == "auto":
+            self.release()
+        elif self.ctx.gc_mode == "context_gc":
+            self.ctx.objects.append(self.mglo)
+
+    @property
+    def framebuffer(self) -> 'Framebuffer':
+        """Framebuffer: The framebuffer being read."""
+        return self._framebuffer
+
+    @property
+    def depth(self) -> int:
+        """int: The number of pixel pack buffers in the ring."""
+        return self._depth
+
+    @property
+    def frame_size(self) -> int:
+        """int: The size of a frame in bytes."""
+        return self._frame_size
+
+    @property
+    def pending(self) -> int:
+        """int: The number of frames read but not handed out yet."""
+        return self.mglo.pending
+
+    @property
+    def frames(self) -> int:
+        """int: The number of frames handed out."""
+        return self.mglo.frames
+
+    @property
+    def stalls(self) -> int:
+        """int: The number of times a full ring had to wait for the GPU."""
+        return self.mglo.stalls
+
+    @property
+    def stall_time(self) -> float:
+        """float: The time spent waiting for the GPU in seconds."""
+        return self.mglo.stall_time
+
+    def read(self) -> Optional[memoryview]:
+        """
+        Read the framebuffer into the next slot and hand out the oldest completed frame.
+
+        Returns:
+            memoryview: The oldest frame, or ``None`` if it is not ready yet.
+        """
+        self._release_frame()
+        self._framebuffer._touch_attachments()
+        self._frame = self.mglo.read()
+        return self._frame
+
+    def next(self, wait: bool = False) -> Optional[memoryview]:
+        """
+        Hand out the oldest pending frame without reading a new one.
+
+        Args:
+            wait (bool): Wait for the frame instead of returning ``None``.
+
+        Returns:
+            memoryview: The oldest frame, or ``None`` if there is none ready.
+        """
+        self._release_frame()
+        self._frame = self.mglo.next(wait)
+        return self._frame
+
+    def flush(self) -> Iterator[memoryview]:
+        """
+        Wait for and hand out every pending frame in order.
+
+        Returns:
+            An iterator of memoryviews, each one valid until the next frame is produced.
+        """
+        while True:
+            frame = self.next(True)
+            if frame is None:
+                return
+            yield frame
+
+    def release(self) -> None:
+        """Release the ModernGL object."""
+        if not isinstance(self.mglo, InvalidObject):
+            self._release_frame()
+            self.mglo.release()
+
+    def _release_frame(self) -> None:
+        # The slot of the last frame is only recycled once nothing exports its memory
+        if self._frame is not None:
+            self._frame.release()
+            self._frame = None
+
@@ -1,8 +1,11 @@
 from typing import Any, Dict, Optional, TYPE_CHECKING, Tuple, Union
 
+from moderngl import mgl  # type: ignore
 from moderngl.mgl import InvalidObject  # type: ignore
 
 from .buffer import Buffer
+from .frame_capture import FrameCapture
+from .pixel_format import _pixel_transfer
 from .renderbuffer import Renderbuffer
 from .texture import Texture
 
@@ -22,7 +25,7 @@ class Framebuffer:
 
     __slots__ = [
         'mglo', '_color_attachments', '_depth_attachment', '_size', '_samples', '_glo',
-        'ctx', '_is_reference', 'extra'
+        'ctx', '_is_reference', '_capture', 'extra'
     ]
 
     def __init__(self):
@@ -34,6 +37,7 @@ class Framebuffer:
         self._glo: int = None
         self.ctx: Context = None  #: The context this object belongs to
         self._is_reference = None  #: Detected framebuffers we should not delete
+        self._capture = None
         self.extra: Any = None  #: Attribute for storing user defined objects
         raise TypeError()
 
@@ -189,8 +193,8 @@ class Framebuffer:
         return self.mglo.bits
 
     @property
-    def color_attachments(self) -> Tuple[Union[Texture, Renderbuffer], ...]:
-        """tuple: The color attachments of the framebuffer."""
+    def color_attachments(self) -> Tuple[Any, ...]:
+        """tuple: The color attachments of the framebuffer, layer and level attachments are kept as tuples."""
         return self._color_attachments
 
     @property
@@ -252,10 +256,12 @@ class Framebuffer:
         if viewport is not None:
             viewport = tuple(viewport)
 
+        self._touch_attachments()
         self.mglo.clear(red, green, blue, alpha, depth, viewport)
 
     def use(self) -> None:
         """Bind the framebuffer. Sets the target for rendering commands."""
+        self._touch_attachments()
         self.ctx.fbo = self
         self.mglo.use()
 
@@ -296,6 +302,7 @@ class Framebuffer:
         Returns:
             bytes
         """
+        self._touch_attachments()
         return self.mglo.read(viewport, components, attachment, alignment, clamp, dtype)
 
     def read_into(
@@ -306,12 +313,26 @@ class Framebuffer:
         *,
         attachment: int = 0,
         alignment: int = 1,
+        row_length: int = 0,
+        skip_pixels: int = 0,
+        skip_rows: int = 0,
         dtype: str = 'f1',
         write_offset: int = 0,
+        dst_layout: Optional[str] = None,
+        flip: bool = False,
     ) -> None:
         """
         Read the content of the framebuffer into a buffer.
 
+        ``dst_layout`` and ``flip`` reorder the channels and the rows of ``f1``, ``f2`` and ``f4``
+        pixels while they are copied into the buffer, see :py:func:`convert_pixels`::
+
+            # Top-down BGRA rows for a video encoder
+            fbo.read_into(frame, components=4, dst_layout='bgra', flip=True)
+
+            # One plane per channel
+            fbo.read_into(planes, components=3, dst_layout='planar')
+
         Args:
             buffer (bytearray): The buffer that will receive the pixels.
             viewport (tuple): The viewport.
@@ -320,17 +341,92 @@ class Framebuffer:
         Keyword Args:
             attachment (int): The color attachment.
             alignment (int): The byte alignment of the pixels.
+            row_length (int): The number of pixels in a row of the client memory, 0 uses the width.
+            skip_pixels (int): The number of pixels skipped at the start of each row.
+            skip_rows (int): The number of rows skipped at the start of the client memory.
             dtype (str): Data type.
             write_offset (int): The write offset.
+            dst_layout (str): The channel layout of the pixels written to the buffer.
+            flip (bool): Flip the image vertically.
         """
+        self._touch_attachments()
+        if dst_layout is not None or flip:
+            size = tuple(self.viewport[2:] if viewport is None else viewport[-2:])
+            src = _pixel_transfer(size[0], dtype, None, components)
+            dst = _pixel_transfer(size[0], dtype, dst_layout, components, alignment, row_length, skip_pixels, skip_rows)
+            data = self.mglo.read(viewport, components, attachment, 1, False, dtype)
+            if type(buffer) is Buffer:
+                buffer.write(mgl.convert_pixels(data, None, size, src, dst, flip), offset=write_offset)
+            else:
+                mgl.convert_pixels(data, buffer, size, src, dst[:3] + (dst[3] + write_offset, dst[4]), flip)
+            return
+
         if type(buffer) is Buffer:
             buffer = buffer.mglo
 
-        return self.mglo.read_into(buffer, viewport, components, attachment, alignment, dtype, write_offset)
+        return self.mglo.read_into(
+            buffer, viewport, components, attachment, alignment, (row_length, skip_pixels, skip_rows, 0), dtype, write_offset
+        )
+
+    def read_async(
+        self,
+        viewport: Optional[Union[Tuple[int, int], Tuple[int, int, int, int]]] = None,
+        components: int = 3,
+        *,
+        attachment: int = 0,
+        alignment: int = 1,
+        dtype: str = 'f1',
+        depth: int = 3,
+    ) -> Optional[memoryview]:
+        """
+        Read the content of the framebuffer without waiting for the GPU.
+
+        The pixels are read into the next pixel pack buffer of a :py:class:`FrameCapture`
+        owned by the framebuffer. The oldest frame whose read completed is returned,
+        frames come out up to ``depth - 1`` calls after they were read.
+        Changing the arguments drops the pending frames.
+
+        .. code:: python
+
+            frame = fbo.read_async(components=4)
+            if frame is not None:
+                encoder.write(frame)
+
+        Args:
+            viewport (tuple): The viewport.
+            components (int): The number of components to read.
+
+        Keyword Args:
+            attachment (int): The color attachment number. -1 for the depth attachment
+            alignment (int): The byte alignment of the pixels.
+            dtype (str): Data type.
+            depth (int): The number of pixel pack buffers.
+
+        Returns:
+            memoryview: A read-only view valid until the next call, or ``None``.
+        """
+        key = (viewport, components, attachment, alignment, dtype, depth)
+        if self._capture is None or self._capture[0] != key:
+            if self._capture is not None:
+                self._capture[1].release()
+            self._capture = (key, FrameCapture(
+                self, depth, viewport=viewport, components=components,
+                attachment=attachment, alignment=alignment, dtype=dtype,
+            ))
+
+        return self._capture[1].read()
+
+    def _touch_attachments(self) -> None:
+        # Evicted textures of a ResidencyManager are restored before the attachments are accessed
+        if self.ctx._residency is not None and self._color_attachments is not None:
+            self.ctx._residency._touch_attachments(self._color_attachments + (self._depth_attachment,))
 
     def release(self) -> None:
         """Release the ModernGL object."""
         if not isinstance(self.mglo, InvalidObject):
             self._color_attachments = None
             self._depth_attachment = None
+            if self._capture is not None:
+                self._capture[1].release()
+                self._capture = None
             self.mglo.release()
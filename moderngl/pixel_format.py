@@ -0,0 +1,144 @@
+from typing import Any, Optional, Tuple
+
+from moderngl import mgl  # type: ignore
+
+__all__ = ['encode_pixels', 'decode_pixels', 'convert_pixels']
+
+# The number of components used when it is not given
+PACKED_COMPONENTS = {
+    'r11g11b10f': 3,
+    'rgb9e5': 3,
+    'rgb10a2': 4,
+    'srgb8': 4,
+}
+
+# The element size of the dtypes supported by the pixel conversions
+CONVERT_SIZES = {
+    'f1': 1,
+    'f2': 2,
+    'f4': 4,
+}
+
+
+def encode_pixels(data: Any, dtype: str, components: Optional[int] = None) -> bytes:
+    """
+    Pack float32 pixels into one of the packed dtypes.
+
+    The data is a bytes-like object of float32 values, ``components`` values per pixel.
+    The result can be written to a texture, renderbuffer or framebuffer of the same dtype.
+    Out of range values are clamped, NaN values are encoded as zero.
+
+    The conversion uses SSE2 when the CPU supports it.
+
+    .. code-block:: python
+
+        hdr = numpy.random.rand(512, 512, 3).astype('f4') * 16.0
+        texture = ctx.texture((512, 512), 3, dtype='r11g11b10f')
+        texture.write(moderngl.encode_pixels(hdr, 'r11g11b10f'))
+
+    Args:
+        data (bytes): The float32 pixels.
+        dtype (str): ``r11g11b10f``, ``rgb9e5``, ``rgb10a2`` or ``srgb8``.
+        components (int): The number of components. The default is 3 for ``r11g11b10f``
+                          and ``rgb9e5`` and 4 for ``rgb10a2`` and ``srgb8``.
+
+    Returns:
+        bytes: The packed pixels.
+    """
+    if components is None:
+        components = PACKED_COMPONENTS.get(dtype, 4)
+    return mgl.encode_pixels(data, dtype, components)
+
+
+def decode_pixels(data: Any, dtype: str, components: Optional[int] = None) -> bytes:
+    """
+    Unpack pixels of one of the packed dtypes into float32 values.
+
+    The data is usually the result of a ``read()`` with the same dtype.
+    ``srgb8`` pixels are converted to linear values, the alpha is not converted.
+
+    The conversion uses SSE2 when the CPU supports it.
+
+    Args:
+        data (bytes): The packed pixels.
+        dtype (str): ``r11g11b10f``, ``rgb9e5``, ``rgb10a2`` or ``srgb8``.
+        components (int): The number of components. The default is 3 for ``r11g11b10f``
+                          and ``rgb9e5`` and 4 for ``rgb10a2`` and ``srgb8``.
+
+    Returns:
+        bytes: The float32 pixels, ``components`` values per pixel.
+    """
+    if components is None:
+        components = PACKED_COMPONENTS.get(dtype, 4)
+    return mgl.decode_pixels(data, dtype, components)
+
+
+def convert_pixels(
+    data: Any,
+    size: Tuple[int, int],
+    components: int,
+    src_dtype: str = 'f1',
+    dst_dtype: str = 'f1',
+    *,
+    src_layout: Optional[str] = None,
+    dst_layout: Optional[str] = None,
+    flip: bool = False,
+) -> bytes:
+    """
+    Convert pixels between the ``f1``, ``f2`` and ``f4`` dtypes and between channel layouts.
+
+    A layout is a string naming the channel at each position of a pixel, such as
+    ``'rgba'``, ``'bgra'`` or ``'rgb'``. Channels missing from the source are zero,
+    a missing alpha channel is one. The ``'planar'`` layout stores every channel of the
+    ``rgba`` order in a separate plane. By default the layout is the first ``components``
+    channels of ``rgba``. ``f1`` values are normalized, ``f2`` values are rounded to nearest even.
+    ``flip`` reverses the order of the rows.
+
+    :py:meth:`Texture.write`, :py:meth:`Texture.read_into` and :py:meth:`Framebuffer.read_into`
+    run the same conversion on the fly. The conversion uses SSE2 when the CPU supports it.
+
+    .. code-block:: python
+
+        # float32 RGB pixels from an image decoder to a half float RGBA texture
+        pixels = moderngl.convert_pixels(image, (512, 512), 4, 'f4', 'f2', src_layout='rgb', flip=True)
+
+    Args:
+        data (bytes): The pixels.
+        size (tuple): The width and height of the image.
+        components (int): The number of components of the default layout.
+        src_dtype (str): The dtype of the data.
+        dst_dtype (str): The dtype of the result.
+
+    Keyword Args:
+        src_layout (str): The layout of the data.
+        dst_layout (str): The layout of the result.
+        flip (bool): Flip the image vertically.
+
+    Returns:
+        bytes: The converted pixels.
+    """
+    width = size[0]
+    src = _pixel_transfer(width, src_dtype, src_layout, components)
+    dst = _pixel_transfer(width, dst_dtype, dst_layout, components)
+    return mgl.convert_pixels(data, None, tuple(size), src, dst, flip)
+
+
+def _pixel_transfer(
+    width: int,
+    dtype: str,
+    layout: Optional[str],
+    components: int,
+    alignment: int = 1,
+    row_length: int = 0,
+    skip_pixels: int = 0,
+    skip_rows: int = 0,
+    offset: int = 0,
+) -> Tuple[str, str, bool, int, int]:
+    """Describe host pixels with the same packing rules as glPixelStore."""
+    planar = layout == 'planar'
+    if layout is None or planar:
+        layout = 'rgba'[:components]
+    pixel = CONVERT_SIZES.get(dtype, 1) * (1 if planar else len(layout))
+    stride = (row_length or width) * pixel
+    stride += -stride % alignment
+    return dtype, layout, planar, offset + skip_rows * stride + skip_pixels * pixel, stride
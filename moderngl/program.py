@@ -1,9 +1,10 @@
-from typing import Any, Generator, Tuple, Union
+from typing import Any, Callable, Dict, Generator, Iterable, Tuple, Union
 
 from moderngl.mgl import InvalidObject  # type: ignore
 
 from .program_members import (
     Attribute,
+    StorageBlock,
     Subroutine,
     Uniform,
     UniformBlock,
@@ -32,11 +33,12 @@ class Program:
     performance consider using :py:class:`moderngl.Scope`.
     """
 
-    __slots__ = ['mglo', '_members', '_subroutines', '_geom', '_glo', '_is_transform', 'ctx', 'extra']
+    __slots__ = ['mglo', '_members', '_member_names', '_subroutines', '_geom', '_glo', '_is_transform', 'ctx', 'extra']
 
     def __init__(self):
         self.mglo = None  #: Internal representation for debug purposes only.
         self._members = {}
+        self._member_names = {}
         self._subroutines = None
         self._geom = (None, None, None)
         self._glo = None
@@ -77,7 +79,7 @@ class Program:
         elif self.ctx.gc_mode == "context_gc":
             self.ctx.objects.append(self.mglo)
 
-    def __getitem__(self, key: str) -> Union[Uniform, UniformBlock, Subroutine, Attribute, Varying]:
+    def __getitem__(self, key: str) -> Union[Uniform, UniformBlock, StorageBlock, Subroutine, Attribute, Varying]:
         """
         Get a member such as uniforms, uniform blocks, subroutines, attributes and varyings by name.
 
@@ -93,7 +95,10 @@ class Program:
             # Still when writing byte data we need to use the `write()` method
             program['color'].write(buffer)
         """
-        return self._members[key]
+        member = self._members.get(key)
+        if member is None:
+            member = self._members[key] = _member_from_item(*self.mglo.member(key))
+        return member
 
     def __setitem__(self, key: str, value: Any) -> None:
         """
@@ -111,7 +116,7 @@ class Program:
             uniform = program['cameraMatrix']
             uniform.write(camera_matrix)
         """
-        self._members[key].value = value
+        self[key].value = value
 
     def __iter__(self) -> Generator[str, None, None]:
         """
@@ -152,7 +157,10 @@ class Program:
             {'rotation': <Uniform: 0>, 'scale': <Uniform: 1>}
 
         """
-        yield from self._members
+        yield from self._member_names
+
+    def __contains__(self, key: str) -> bool:
+        return key in self._member_names
 
     @property
     def is_transform(self) -> bool:
@@ -207,7 +215,7 @@ class Program:
         """
         return self._glo
 
-    def get(self, key: str, default: Any) -> Union[Uniform, UniformBlock, Subroutine, Attribute, Varying]:
+    def get(self, key: str, default: Any) -> Union[Uniform, UniformBlock, StorageBlock, Subroutine, Attribute, Varying]:
         """
         Returns a Uniform, UniformBlock, Subroutine, Attribute or Varying.
 
@@ -218,7 +226,52 @@ class Program:
             :py:class:`Uniform`, :py:class:`UniformBlock`, :py:class:`Subroutine`,
             :py:class:`Attribute` or :py:class:`Varying`
         """
-        return self._members.get(key, default)
+        if key not in self._member_names:
+            return default
+        return self[key]
+
+    def set_uniforms(self, values: Dict[str, Any]) -> None:
+        """
+        Set the value of multiple uniforms in a single call.
+
+        Values can be tuples, lists or any object supporting the buffer protocol
+        such as bytes or numpy arrays. Buffers with a different scalar type
+        than the uniform (float64 for a vec3) are converted by the native code.
+
+        .. code-block:: python
+
+            program.set_uniforms({
+                'color': (1.0, 0.0, 0.0, 1.0),
+                'mvp': camera_matrix.astype('f4'),
+            })
+
+        Args:
+            values (dict): A mapping of uniform names to values.
+        """
+        self.mglo.set_uniforms(values)
+
+    def uniform_setter(self, names: Iterable[str]) -> Callable[..., None]:
+        """
+        Returns a callable setting the given uniforms from positional values.
+
+        The uniforms are looked up once, calling the setter writes
+        all the values in a single native call.
+
+        .. code-block:: python
+
+            set_camera = program.uniform_setter(['mvp', 'eye'])
+
+            for camera in cameras:
+                set_camera(camera.mvp, camera.eye)
+                vao.render()
+
+        Args:
+            names (list): The uniform names in the order of the values.
+
+        Returns:
+            callable
+        """
+        return self.mglo.uniform_setter(tuple(self[name].mglo for name in names))
 
     def release(self) -> None:
         """Release the ModernGL object."""
@@ -226,6 +279,29 @@ class Program:
             self.mglo.release()
 
 
+def _member_from_item(kind: int, item: Tuple[Any, ...]) -> Any:
+    """For internal use only."""
+    if kind == 0:
+        obj = Attribute.__new__(Attribute)
+        obj.mglo, obj._location, obj._array_length, obj._dimension, obj._shape, obj._name = item
+    elif kind == 1:
+        obj = Varying.__new__(Varying)
+        obj._number, obj._array_length, obj._dimension, obj._name = item
+    elif kind == 2:
+        obj = Uniform.__new__(Uniform)
+        obj.mglo, obj._location, obj._array_length, obj._dimension, obj._name = item
+    elif kind == 3:
+        obj = UniformBlock.__new__(UniformBlock)
+        obj.mglo, obj._index, obj._size, obj._name = item
+    elif kind == 4:
+        obj = StorageBlock.__new__(StorageBlock)
+        obj.mglo, obj._index, obj._size, obj._name = item
+    else:
+        obj = Subroutine.__new__(Subroutine)
+        obj._index, obj._name = item
+    return obj
+
+
 def detect_format(
     program: Program,
     attributes: Any,
@@ -1,4 +1,6 @@
 from .attribute import *  # noqa
+from .block_writer import *  # noqa
+from .storage_block import *  # noqa
 from .subroutine import *  # noqa
 from .uniform import *  # noqa
 from .uniform_block import *  # noqa
@@ -0,0 +1,60 @@
+from typing import Any
+
+__all__ = ['BlockWriter']
+
+
+class BlockWriter:
+    """
+    Packs values into a buffer using the layout of a uniform or storage block.
+
+    The member offsets and strides are queried once when the writer is created.
+    Writing maps the target buffer range and packs the values in place
+    without building an intermediate bytes object.
+
+    .. code-block:: python
+
+        writer = program['Lights'].writer()
+        writer.write(ubo, {
+            'color': (1.0, 0.5, 0.0),
+            'positions': np.zeros((4, 4), dtype='f4'),
+        })
+
+    Use :py:meth:`UniformBlock.writer` or :py:meth:`StorageBlock.writer` to create one.
+    """
+
+    __slots__ = ['mglo', '_size', 'extra']
+
+    def __init__(self):
+        self.mglo = None  #: Internal representation for debug purposes only.
+        self._size = None
+        self.extra = None  #: Any - Attribute for storing user defined objects
+        raise TypeError()
+
+    def __repr__(self):
+        return '<BlockWriter: %d>' % self._size
+
+    @property
+    def size(self) -> int:
+        """int: The size of the block in bytes."""
+        return self._size
+
+    def write(self, buffer: Any, values: Any, offset: int = 0) -> None:
+        """
+        Write the block members into a buffer.
+
+        Members not present in values are left untouched.
+        Values can be numbers, nested sequences or buffers such as numpy arrays.
+        A numpy record (an element of a structured array) is accepted as well.
+
+        Args:
+            buffer (Buffer): The target buffer.
+            values (dict): A mapping of member names to values or a numpy record.
+
+        Keyword Args:
+            offset (int): The byte offset of the block in the buffer.
+        """
+        names = getattr(getattr(values, 'dtype', None), 'names', None)
+        if names is not None:
+            values = {name: values[name] for name in names}
+
+        self.mglo.write(buffer.mglo, values, offset)
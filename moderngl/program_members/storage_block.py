@@ -0,0 +1,83 @@
+from typing import Any, Dict
+
+from .block_writer import BlockWriter
+from .uniform_block import _members_dict
+
+__all__ = ['StorageBlock']
+
+
+class StorageBlock:
+    """Shader Storage Block metadata."""
+
+    __slots__ = ['mglo', '_index', '_size', '_name', 'extra']
+
+    def __init__(self):
+        self.mglo = None  #: Internal representation for debug purposes only.
+        self._index = None
+        self._size = None
+        self._name = None
+        self.extra = None  #: Any - Attribute for storing user defined objects
+        raise TypeError()
+
+    def __repr__(self):
+        return '<StorageBlock: %d>' % self._index
+
+    def __hash__(self) -> int:
+        return id(self)
+
+    @property
+    def binding(self) -> int:
+        """int: The binding of the storage block."""
+        return self.mglo.binding
+
+    @binding.setter
+    def binding(self, binding: int) -> None:
+        self.mglo.binding = binding
+
+    @property
+    def value(self) -> int:
+        """int: The value of the storage block."""
+        return self.mglo.binding
+
+    @value.setter
+    def value(self, value: int) -> None:
+        self.mglo.binding = value
+
+    @property
+    def name(self) -> str:
+        """str: The name of the storage block."""
+        return self._name
+
+    @property
+    def index(self) -> int:
+        """int: The index of the storage block."""
+        return self._index
+
+    @property
+    def size(self) -> int:
+        """int: The size of the storage block."""
+        return self._size
+
+    @property
+    def members(self) -> Dict[str, Dict[str, Any]]:
+        """
+        dict: The layout of the storage block members.
+
+        Each member is described by its ``gl_type``, ``offset``, ``array_length``,
+        ``array_stride``, ``matrix_stride`` and ``row_major`` as reported by the driver.
+        """
+        return _members_dict(self.mglo.members())
+
+    def writer(self) -> BlockWriter:
+        """
+        Returns a :py:class:`BlockWriter` packing values with the layout of this block.
+
+        Returns:
+            :py:class:`BlockWriter` object
+        """
+        res = BlockWriter.__new__(BlockWriter)
+        res.mglo = self.mglo.writer()
+        res._size = self._size
+        res.extra = None
+        return res
+
@@ -1,3 +1,7 @@
+from typing import Any, Dict
+
+from .block_writer import BlockWriter
+
 __all__ = ['UniformBlock']
 
 
@@ -52,3 +56,31 @@ class UniformBlock:
     def size(self) -> int:
         """int: The size of the uniform block."""
         return self._size
+
+    @property
+    def members(self) -> Dict[str, Dict[str, Any]]:
+        """
+        dict: The layout of the uniform block members.
+
+        Each member is described by its ``gl_type``, ``offset``, ``array_length``,
+        ``array_stride``, ``matrix_stride`` and ``row_major`` as reported by the driver.
+        """
+        return _members_dict(self.mglo.members())
+
+    def writer(self) -> BlockWriter:
+        """
+        Returns a :py:class:`BlockWriter` packing values with the layout of this block.
+
+        Returns:
+            :py:class:`BlockWriter` object
+        """
+        res = BlockWriter.__new__(BlockWriter)
+        res.mglo = self.mglo.writer()
+        res._size = self._size
+        res.extra = None
+        return res
+
+
+def _members_dict(members):
+    keys = ('gl_type', 'offset', 'array_length', 'array_stride', 'matrix_stride', 'row_major')
+    return {name: dict(zip(keys, layout)) for name, *layout in members}
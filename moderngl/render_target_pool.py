@@ -0,0 +1,345 @@
+from typing import Any, Tuple, Union
+
+from moderngl.mgl import InvalidObject  # type: ignore
+
+from .framebuffer import Framebuffer
+from .texture import Texture
+
+__all__ = ['RenderTargetPool']
+
+
+class RenderTargetPool:
+    """
+    Recycles transient textures and framebuffers of the same shape.
+
+    Objects are handed out by :py:meth:`texture`, :py:meth:`depth_texture` and
+    :py:meth:`framebuffer` and returned with :py:meth:`recycle` instead of being released.
+    A request matching the size, components, dtype, samples and depth of a returned
+    object gets that object back without creating a new one.
+
+    Idle objects not requested for ``max_age`` calls of :py:meth:`next_frame` are released.
+    When the idle objects take more than ``max_memory`` bytes the oldest ones are released.
+
+    The pool owns the objects it hands out, returning them is always explicit and
+    calling ``release()`` on them does not return them to the pool. A released object
+    or a framebuffer with a released attachment is dropped from the pool and from its
+    statistics, the remaining attachments are released, :py:meth:`recycle` rejects it.
+
+    .. code-block:: python
+
+        pool = ctx.render_target_pool()
+
+        while True:
+            bloom = pool.framebuffer((960, 540), 4, dtype='f2', depth=False)
+            ...
+            pool.recycle(bloom)
+            pool.next_frame()
+
+    A RenderTargetPool object cannot be instantiated directly, it requires a context.
+    Use :py:meth:`Context.render_target_pool` to create one.
+    """
+
+    __slots__ = [
+        '_idle', '_active', '_frame', '_max_age', '_max_memory', '_memory', '_idle_memory', '_hits', '_misses',
+        'ctx', 'extra',
+    ]
+
+    def __init__(self):
+        self._idle = None
+        self._active = None
+        self._frame = None
+        self._max_age = None
+        self._max_memory = None
+        self._memory = None
+        self._idle_memory = None
+        self._hits = None
+        self._misses = None
+        self.ctx = None  #: The context this object belongs to
+        self.extra = None  #: Any - Attribute for storing user defined objects
+        raise TypeError()
+
+    def __repr__(self):
+        return '<RenderTargetPool: %d active, %d idle>' % (len(self._active), self.idle)
+
+    def __hash__(self) -> int:
+        return id(self)
+
+    @property
+    def frame(self) -> int:
+        """int: The number of calls to :py:meth:`next_frame`."""
+        return self._frame
+
+    @property
+    def max_age(self) -> int:
+        """int: The number of frames an idle object is kept."""
+        return self._max_age
+
+    @property
+    def max_memory(self) -> int:
+        """int: The maximum size of the idle objects in bytes."""
+        return self._max_memory
+
+    @property
+    def memory(self) -> int:
+        """int: The estimated size of all the objects created by the pool and not released in bytes."""
+        self._drop_released()
+        return self._memory
+
+    @property
+    def idle_memory(self) -> int:
+        """int: The estimated size of the idle objects in bytes."""
+        self._drop_released()
+        return self._idle_memory
+
+    @property
+    def active(self) -> int:
+        """int: The number of objects handed out and not recycled or released yet."""
+        self._drop_released()
+        return len(self._active)
+
+    @property
+    def idle(self) -> int:
+        """int: The number of objects waiting in the pool."""
+        self._drop_released()
+        return sum(len(entries) for entries in self._idle.values())
+
+    @property
+    def hits(self) -> int:
+        """int: The number of requests served from the pool."""
+        return self._hits
+
+    @property
+    def misses(self) -> int:
+        """int: The number of requests that created a new object."""
+        return self._misses
+
+    @property
+    def hit_rate(self) -> float:
+        """float: The ratio of requests served from the pool."""
+        requests = self._hits + self._misses
+        return self._hits / requests if requests else 0.0
+
+    def texture(
+        self,
+        size: Tuple[int, int],
+        components: int = 4,
+        *,
+        dtype: str = 'f1',
+        samples: int = 0,
+    ) -> Texture:
+        """
+        Get a texture from the pool or create it.
+
+        Args:
+            size (tuple): The width and height of the texture.
+            components (int): The number of components 1, 2, 3 or 4.
+
+        Keyword Args:
+            dtype (str): Data type.
+            samples (int): The number of samples. Value 0 means no multisample format.
+
+        Returns:
+            :py:class:`Texture` object
+        """
+        key = ('texture', tuple(size), components, dtype, samples)
+        obj = self._acquire(key)
+        if obj is None:
+            obj = self.ctx.texture(size, components, samples=samples, dtype=dtype)
+            self._created(key, obj, _texture_size(size, components, dtype, samples))
+        return obj
+
+    def depth_texture(self, size: Tuple[int, int], *, samples: int = 0, dtype: str = 'd24') -> Texture:
+        """
+        Get a depth texture from the pool or create it.
+
+        Args:
+            size (tuple): The width and height of the texture.
+
+        Keyword Args:
+            samples (int): The number of samples. Value 0 means no multisample format.
+            dtype (str): The depth format.
+
+        Returns:
+            :py:class:`Texture` object
+        """
+        key = ('depth_texture', tuple(size), samples, dtype)
+        obj = self._acquire(key)
+        if obj is None:
+            obj = self.ctx.depth_texture(size, samples=samples, dtype=dtype)
+            self._created(key, obj, _texture_size(size, 1, dtype, samples))
+        return obj
+
+    def framebuffer(
+        self,
+        size: Tuple[int, int],
+        components: int = 4,
+        *,
+        dtype: str = 'f1',
+        samples: int = 0,
+        depth: bool = True,
+    ) -> Framebuffer:
+        """
+        Get a framebuffer with a color texture and an optional depth texture from the pool or create it.
+
+        The viewport and the scissor of a recycled framebuffer are reset.
+
+        Args:
+            size (tuple): The width and height of the attachments.
+            components (int): The number of components of the color attachment.
+
+        Keyword Args:
+            dtype (str): Data type of the color attachment.
+            samples (int): The number of samples. Value 0 means no multisample format.
+            depth (bool): Attach a depth texture.
+
+        Returns:
+            :py:class:`Framebuffer` object
+        """
+        key = ('framebuffer', tuple(size), components, dtype, samples, depth)
+        obj = self._acquire(key)
+        if obj is not None:
+            obj.viewport = (0, 0, size[0], size[1])
+            obj.scissor = None
+            return obj
+
+        color = self.ctx.texture(size, components, samples=samples, dtype=dtype)
+        depth_attachment = self.ctx.depth_texture(size, samples=samples) if depth else None
+        obj = self.ctx.framebuffer(color, depth_attachment)
+        nbytes = _texture_size(size, components, dtype, samples)
+        if depth:
+            nbytes += _texture_size(size, 1, 'd24', samples)
+        self._created(key, obj, nbytes)
+        return obj
+
+    def recycle(self, obj: Union[Texture, Framebuffer]) -> None:
+        """
+        Return an object to the pool.
+
+        The object must not be used after it is recycled, the next request
+        with the same shape may hand it out again. Released objects are rejected.
+
+        Args:
+            obj: A texture or framebuffer handed out by this pool.
+        """
+        entry = self._active.pop(id(obj), None)
+        if entry is None:
+            raise ValueError('the object does not belong to this pool or it is already recycled')
+
+        key, nbytes, obj, parts = entry
+        if _released(parts):
+            self._memory -= nbytes
+            _release(parts)
+            raise ValueError('the object is released, it cannot be recycled')
+
+        self._idle.setdefault(key, []).append((self._frame, nbytes, obj, parts))
+        self._idle_memory += nbytes
+        self._trim()
+
+    def next_frame(self) -> None:
+        """Advance the frame counter and release the idle objects older than ``max_age`` frames."""
+        self._frame += 1
+        oldest = self._frame - self._max_age
+        for key in list(self._idle):
+            entries = self._idle[key]
+            while entries and entries[0][0] < oldest:
+                self._evict(key)
+
+    def clear(self) -> None:
+        """Release all the idle objects."""
+        for key in list(self._idle):
+            while key in self._idle:
+                self._evict(key)
+
+    def release(self) -> None:
+        """Release the idle objects and every object handed out by the pool."""
+        self.clear()
+        for key, nbytes, obj, parts in self._active.values():
+            _release(parts)
+            self._memory -= nbytes
+        self._active.clear()
+
+    def _acquire(self, key: tuple) -> Any:
+        self._drop_released()
+        entries = self._idle.get(key)
+        if not entries:
+            self._misses += 1
+            return None
+
+        # The most recently recycled object is the most likely to be resident
+        entry = entries.pop()
+        if not entries:
+            del self._idle[key]
+        frame, nbytes, obj, parts = entry
+        self._idle_memory -= nbytes
+        self._active[id(obj)] = (key, nbytes, obj, parts)
+        self._hits += 1
+        return obj
+
+    def _created(self, key: tuple, obj: Any, nbytes: int) -> None:
+        # A released framebuffer forgets its attachments, they are kept to release them with it
+        parts = (obj,)
+        if isinstance(obj, Framebuffer):
+            parts += obj.color_attachments
+            if obj.depth_attachment is not None:
+                parts += (obj.depth_attachment,)
+        self._active[id(obj)] = (key, nbytes, obj, parts)
+        self._memory += nbytes
+
+    def _drop_released(self) -> None:
+        for obj_id in [obj_id for obj_id, entry in self._active.items() if _released(entry[3])]:
+            key, nbytes, obj, parts = self._active.pop(obj_id)
+            self._memory -= nbytes
+            _release(parts)
+
+        for key in list(self._idle):
+            entries = []
+            for entry in self._idle[key]:
+                if not _released(entry[3]):
+                    entries.append(entry)
+                    continue
+                self._idle_memory -= entry[1]
+                self._memory -= entry[1]
+                _release(entry[3])
+            if entries:
+                self._idle[key] = entries
+            else:
+                del self._idle[key]
+
+    def _trim(self) -> None:
+        while self._idle_memory > self._max_memory:
+            key = min(self._idle, key=lambda k: self._idle[k][0][0])
+            self._evict(key)
+
+    def _evict(self, key: tuple) -> None:
+        entries = self._idle[key]
+        frame, nbytes, obj, parts = entries.pop(0)
+        if not entries:
+            del self._idle[key]
+        self._idle_memory -= nbytes
+        self._memory -= nbytes
+        _release(parts)
+
+
+# The dtypes storing a whole pixel in a fixed size, the other ones take a fixed size per component
+PIXEL_SIZES = {
+    'r11g11b10f': 4, 'rgb9e5': 4, 'rgb10a2': 4,
+    'd16': 2, 'd24': 4, 'd32f': 4, 'd24s8': 4, 'd32fs8': 8,
+}
+
+
+def _texture_size(size: Tuple[int, int], components: int, dtype: str, samples: int) -> int:
+    if dtype in PIXEL_SIZES:
+        pixel_size = PIXEL_SIZES[dtype]
+    else:
+        pixel_size = components * (1 if dtype == 'srgb8' else int(dtype[-1]))
+    return size[0] * size[1] * pixel_size * max(samples, 1)
+
+
+def _released(parts: Tuple[Any, ...]) -> bool:
+    return any(isinstance(part.mglo, InvalidObject) for part in parts)
+
+
+def _release(parts: Tuple[Any, ...]) -> None:
+    # Releasing an object twice is a no-op, the framebuffer goes first
+    for part in parts:
+        part.release()
@@ -1,4 +1,4 @@
-from typing import Any
+from typing import Any, Optional
 
 from moderngl.mgl import InvalidObject  # type: ignore
 
@@ -20,7 +20,9 @@ class Renderbuffer:
     to create one.
     """
 
-    __slots__ = ['mglo', '_size', '_components', '_samples', '_depth', '_dtype', '_glo', 'ctx', 'extra']
+    __slots__ = [
+        'mglo', '_size', '_components', '_samples', '_depth', '_dtype', '_depth_format', '_glo', 'ctx', 'extra',
+    ]
 
     def __init__(self):
         self.mglo = None  #: Internal representation for debug purposes only.
@@ -29,6 +31,7 @@ class Renderbuffer:
         self._samples = None
         self._depth = None
         self._dtype = None
+        self._depth_format = None
         self._glo = None
         self.ctx = None  #: The context this object belongs to
         self.extra = None  #: Any - Attribute for storing user defined objects
@@ -87,9 +90,14 @@ class Renderbuffer:
 
     @property
     def dtype(self) -> str:
-        """str: Data type."""
+        """str: Data type, the pixel type a depth renderbuffer is read as."""
         return self._dtype
 
+    @property
+    def depth_format(self) -> Optional[str]:
+        """str: The depth format ``d16``, ``d24``, ``d32f``, ``d24s8`` or ``d32fs8``, None for color renderbuffers."""
+        return self._depth_format
+
     @property
     def glo(self) -> int:
         """
@@ -0,0 +1,243 @@
+from collections import OrderedDict
+from typing import Any, Callable, Iterable, List, Optional, Union
+
+from moderngl.mgl import InvalidObject  # type: ignore
+
+from .texture import Texture
+from .texture_3d import Texture3D
+from .texture_array import TextureArray
+from .texture_cube import TextureCube
+
+__all__ = ['ResidencyManager']
+
+AnyTexture = Union[Texture, Texture3D, TextureArray, TextureCube]
+
+
+class ResidencyManager:
+    """
+    Keeps the memory of the managed textures within a budget by evicting the least recently used ones.
+
+    The context keeps a ledger of the memory allocated by its buffers, textures and
+    renderbuffers, see :py:meth:`Context.memory_stats`. When the ledger exceeds the budget
+    :py:meth:`enforce` evicts the managed textures not used for the longest time. An evicted texture keeps
+    its OpenGL name and parameters but its levels are freed. Using, binding, reading, writing
+    or building the mipmaps of it restores the storage first, so do entering a :py:class:`Scope`
+    binding it and creating, using, clearing or reading a framebuffer it is attached to.
+
+    Restoring a texture never evicts another one, the textures bound for the next draw stay
+    resident and the memory can exceed the budget until :py:meth:`enforce` is called, usually
+    once per frame after the draws. :py:meth:`enforce` skips the attachments of the bound
+    framebuffer. The attachments of the other framebuffers can be evicted, they are restored
+    when the framebuffer is used again.
+
+    The pixels of an evicted texture are read back to the CPU unless a ``reload`` callback
+    is given to :py:meth:`manage`. The callback is called with the texture after its storage
+    is restored and should write the pixels again, for example from a file.
+
+    .. code-block:: python
+
+        residency = ctx.residency_manager(512 * 1024 * 1024)
+
+        for texture in level_textures:
+            residency.manage(texture)
+
+        while True:
+            ...
+            residency.enforce()
+
+    Only textures with mutable storage and uncompressed single sample formats can be managed.
+    Textures created with ``levels`` and texture views cannot be managed.
+
+    The manager holds a reference to every managed texture, a texture is not freed by the
+    garbage collector before :py:meth:`unmanage` is called. Released textures are dropped
+    by :py:meth:`enforce`.
+
+    A ResidencyManager object cannot be instantiated directly, it requires a context.
+    Use :py:meth:`Context.residency_manager` to create one.
+    """
+
+    __slots__ = ['_budget', '_entries', '_evictions', '_restores', 'ctx', 'extra']
+
+    def __init__(self):
+        self._budget = None
+        self._entries = None
+        self._evictions = None
+        self._restores = None
+        self.ctx = None  #: The context this object belongs to
+        self.extra = None  #: Any - Attribute for storing user defined objects
+        raise TypeError()
+
+    def __repr__(self):
+        return '<ResidencyManager: %d managed, %d evicted>' % (len(self._entries), self.evicted)
+
+    def __hash__(self) -> int:
+        return id(self)
+
+    @property
+    def budget(self) -> int:
+        """int: The memory budget in bytes, compared to the ``total`` of :py:meth:`Context.memory_stats`."""
+        return self._budget
+
+    @budget.setter
+    def budget(self, value: int) -> None:
+        self._budget = value
+
+    @property
+    def textures(self) -> List[AnyTexture]:
+        """list: The managed textures from the least to the most recently used."""
+        return list(self._entries)
+
+    @property
+    def evicted(self) -> int:
+        """int: The number of managed textures currently evicted."""
+        return sum(1 for entry in self._entries.values() if entry[0])
+
+    @property
+    def evictions(self) -> int:
+        """int: The number of evictions so far."""
+        return self._evictions
+
+    @property
+    def restores(self) -> int:
+        """int: The number of restores so far."""
+        return self._restores
+
+    def manage(self, texture: AnyTexture, *, reload: Optional[Callable[[Any], None]] = None) -> None:
+        """
+        Start managing a texture, it becomes the most recently used texture.
+
+        The manager keeps a reference to the texture until :py:meth:`unmanage` is called.
+
+        Args:
+            texture: The texture to manage.
+
+        Keyword Args:
+            reload (callable): Called with the texture after its storage is restored.
+                               The pixels are not read back on eviction when it is set.
+        """
+        if texture in self._entries:
+            self._entries[texture][2] = reload
+        else:
+            # Rejecting the texture here keeps enforce from failing halfway through the evictions
+            texture.mglo.check_evict()
+            self._entries[texture] = [False, None, reload]
+        self._entries.move_to_end(texture)
+
+    def unmanage(self, texture: AnyTexture) -> None:
+        """
+        Stop managing a texture, an evicted texture is restored first.
+
+        Args:
+            texture: The managed texture.
+        """
+        self._restore(texture)
+        del self._entries[texture]
+
+    def is_evicted(self, texture: AnyTexture) -> bool:
+        """
+        Check whether a managed texture is evicted.
+
+        Args:
+            texture: The managed texture.
+
+        Returns:
+            bool
+        """
+        return self._entries[texture][0]
+
+    def touch(self, texture: AnyTexture) -> None:
+        """
+        Mark a texture as the most recently used one, an evicted texture is restored.
+
+        The methods of the textures, scopes and framebuffers accessing the texture storage
+        call this method for the managed textures. Textures not managed are ignored.
+
+        Args:
+            texture: The texture.
+        """
+        if texture not in self._entries:
+            return
+
+        self._entries.move_to_end(texture)
+        if self._entries[texture][0]:
+            self._restore(texture)
+
+    def evict(self, texture: AnyTexture) -> None:
+        """
+        Evict a managed texture regardless of the budget.
+
+        Rendering into a framebuffer it is attached to requires :py:meth:`Framebuffer.use`
+        to be called again.
+
+        Args:
+            texture: The managed texture.
+        """
+        entry = self._entries[texture]
+        if entry[0]:
+            return
+
+        entry[1] = texture.mglo.evict(entry[2] is None)
+        entry[0] = True
+        self._evictions += 1
+
+    def enforce(self) -> int:
+        """
+        Evict the least recently used textures until the memory fits the budget.
+
+        The most recently used texture and the attachments of the bound framebuffer are never evicted.
+        Call it when the evicted textures are no longer bound for a draw, for example between frames.
+
+        Returns:
+            int: The number of evicted textures.
+        """
+        for texture in [texture for texture in self._entries if isinstance(texture.mglo, InvalidObject)]:
+            del self._entries[texture]
+
+        if not self._entries:
+            return 0
+
+        protected = next(reversed(self._entries))
+
+        # Rendering continues into the bound framebuffer without binding it again
+        attached = set()
+        fbo = self.ctx.fbo
+        if fbo is not None and fbo._color_attachments is not None:
+            attached = {_attachment_texture(x) for x in fbo._color_attachments + (fbo._depth_attachment,)}
+
+        total = self.ctx.mglo.memory_stats()['total']['bytes']
+        evicted = 0
+
+        for texture in list(self._entries):
+            if total <= self._budget:
+                break
+
+            if texture is protected or texture in attached or self._entries[texture][0]:
+                continue
+
+            total -= texture.mglo.memory
+            self.evict(texture)
+            evicted += 1
+
+        return evicted
+
+    def _touch_attachments(self, attachments: Iterable[Any]) -> None:
+        for attachment in attachments:
+            self.touch(_attachment_texture(attachment))
+
+    def _restore(self, texture: AnyTexture) -> None:
+        entry = self._entries[texture]
+        if not entry[0]:
+            return
+
+        texture.mglo.restore(entry[1])
+        entry[0] = False
+        entry[1] = None
+        self._restores += 1
+
+        if entry[2] is not None:
+            entry[2](texture)
+
+
+def _attachment_texture(attachment: Any) -> Any:
+    # Framebuffer attachments are given as objects or (texture, layer[, level]) tuples
+    return attachment[0] if isinstance(attachment, tuple) else attachment
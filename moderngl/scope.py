@@ -47,6 +47,10 @@ class Scope:
         return id(self)
 
     def __enter__(self):
+        if self.ctx._residency is not None:
+            for texture, _ in self._textures:
+                self.ctx._residency.touch(texture)
+            self._framebuffer._touch_attachments()
         self.mglo.begin()
         return self
 
@@ -0,0 +1,298 @@
+#include "Types.hpp"
+
+#include "InlineMethods.hpp"
+
+struct MGLBlockCursor {
+	MGLBlockMember * member;
+	char * base;
+	int index;
+	int count;
+};
+
+inline int block_scalar_size(int scalar_type) {
+	return scalar_type == GL_DOUBLE ? 8 : 4;
+}
+
+// Returns the address of the next scalar following the member's layout (std140, std430 or shared)
+
+inline char * block_cursor_address(const MGLBlockCursor & cursor) {
+	const MGLBlockMember & member = *cursor.member;
+	int scalar_size = block_scalar_size(member.scalar_type);
+	int element_size = member.rows * member.columns;
+	int element = cursor.index / element_size;
+	int component = cursor.index % element_size;
+
+	int offset = member.offset + element * member.array_stride;
+
+	if (member.columns > 1) {
+		int column = component / member.rows;
+		int row = component % member.rows;
+		if (member.row_major) {
+			offset += row * member.matrix_stride + column * scalar_size;
+		} else {
+			offset += column * member.matrix_stride + row * scalar_size;
+		}
+	} else {
+		offset += component * scalar_size;
+	}
+
+	return cursor.base + offset;
+}
+
+inline void block_cursor_put(MGLBlockCursor & cursor, double value) {
+	if (cursor.index < cursor.count) {
+		char * ptr = block_cursor_address(cursor);
+		switch (cursor.member->scalar_type) {
+			case GL_FLOAT: *(float *)ptr = (float)value; break;
+			case GL_DOUBLE: *(double *)ptr = value; break;
+			case GL_INT: *(int *)ptr = (int)value; break;
+			case GL_UNSIGNED_INT: *(unsigned *)ptr = (unsigned)(long long)value; break;
+			case GL_BOOL: *(unsigned *)ptr = value != 0.0; break;
+		}
+	}
+	cursor.index += 1;
+}
+
+template <typename T>
+inline void block_cursor_put_all(MGLBlockCursor & cursor, const void * data, Py_ssize_t count) {
+	const T * values = (const T *)data;
+	for (Py_ssize_t i = 0; i < count; ++i) {
+		block_cursor_put(cursor, (double)values[i]);
+	}
+}
+
+bool MGLBlockWriter_put_buffer(MGLBlockCursor & cursor, PyObject * value) {
+	Py_buffer buffer_view;
+
+	int get_buffer = PyObject_GetBuffer(value, &buffer_view, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT);
+	if (get_buffer < 0) {
+		// Propagate the default error
+		return false;
+	}
+
+	char kind = buffer_format_kind(buffer_view);
+	int scalar_size = block_scalar_size(cursor.member->scalar_type);
+
+	if (!cursor.index && buffer_view.itemsize == 1 && buffer_view.len == (Py_ssize_t)cursor.count * scalar_size) {
+		// Raw data in the member's scalar type, only as the whole value of the member
+		const char * src = (const char *)buffer_view.buf;
+		for (int i = 0; i < cursor.count; ++i) {
+			memcpy(block_cursor_address(cursor), src + i * scalar_size, scalar_size);
+			cursor.index += 1;
+		}
+		PyBuffer_Release(&buffer_view);
+		return true;
+	}
+
+	Py_ssize_t count = buffer_view.itemsize ? buffer_view.len / buffer_view.itemsize : 0;
+	bool converted = true;
+
+	switch (kind * 16 + (int)buffer_view.itemsize) {
+		case 'f' * 16 + 4: block_cursor_put_all<float>(cursor, buffer_view.buf, count); break;
+		case 'f' * 16 + 8: block_cursor_put_all<double>(cursor, buffer_view.buf, count); break;
+		case 'i' * 16 + 1: block_cursor_put_all<int8_t>(cursor, buffer_view.buf, count); break;
+		case 'i' * 16 + 2: block_cursor_put_all<int16_t>(cursor, buffer_view.buf, count); break;
+		case 'i' * 16 + 4: block_cursor_put_all<int32_t>(cursor, buffer_view.buf, count); break;
+		case 'i' * 16 + 8: block_cursor_put_all<int64_t>(cursor, buffer_view.buf, count); break;
+		case 'u' * 16 + 1: block_cursor_put_all<uint8_t>(cursor, buffer_view.buf, count); break;
+		case 'u' * 16 + 2: block_cursor_put_all<uint16_t>(cursor, buffer_view.buf, count); break;
+		case 'u' * 16 + 4: block_cursor_put_all<uint32_t>(cursor, buffer_view.buf, count); break;
+		case 'u' * 16 + 8: block_cursor_put_all<uint64_t>(cursor, buffer_view.buf, count); break;
+		default: converted = false; break;
+	}
+
+	if (!converted) {
+		MGLError_Set("invalid buffer format '%s'", buffer_view.format);
+	}
+
+	PyBuffer_Release(&buffer_view);
+	return converted;
+}
+
+bool MGLBlockWriter_put(MGLBlockCursor & cursor, PyObject * value) {
+	if (PyFloat_Check(value)) {
+		block_cursor_put(cursor, PyFloat_AS_DOUBLE(value));
+		return true;
+	}
+
+	if (PyLong_Check(value)) {
+		block_cursor_put(cursor, (double)PyLong_AsLongLong(value));
+		return !PyErr_Occurred();
+	}
+
+	if (PyObject_CheckBuffer(value)) {
+		return MGLBlockWriter_put_buffer(cursor, value);
+	}
+
+	if (!PyUnicode_Check(value) && PySequence_Check(value)) {
+		PyObject * sequence = PySequence_Fast(value, "not iterable");
+		if (!sequence) {
+			return false;
+		}
+
+		int size = (int)PySequence_Fast_GET_SIZE(sequence);
+		for (int i = 0; i < size; ++i) {
+			if (!MGLBlockWriter_put(cursor, PySequence_Fast_GET_ITEM(sequence, i))) {
+				Py_DECREF(sequence);
+				return false;
+			}
+		}
+
+		Py_DECREF(sequence);
+		return true;
+	}
+
+	MGLError_Set("invalid value %R", value);
+	return false;
+}
+
+bool MGLBlockWriter_Pack(MGLBlockWriter * self, char * map, PyObject * values) {
+	PyObject * items = PyMapping_Items(values);
+
+	if (!items) {
+		return false;
+	}
+
+	int num_items = (int)PyList_GET_SIZE(items);
+	bool success = true;
+
+	for (int i = 0; i < num_items && success; ++i) {
+		PyObject * item = PyList_GET_ITEM(items, i);
+		PyObject * name = PyTuple_GET_ITEM(item, 0);
+		PyObject * index = PyDict_GetItem(self->lookup, name);
+
+		if (!index) {
+			MGLError_Set("the block has no member %R", name);
+			success = false;
+			break;
+		}
+
+		MGLBlockMember * member = &self->members[PyLong_AsLong(index)];
+
+		if (!member->scalar_type || !member->array_length) {
+			MGLError_Set("cannot write %R", name);
+			success = false;
+			break;
+		}
+
+		MGLBlockCursor cursor = {member, map, 0, member->array_length * member->rows * member->columns};
+		success = MGLBlockWriter_put(cursor, PyTuple_GET_ITEM(item, 1));
+
+		if (success && cursor.index != cursor.count) {
+			MGLError_Set("%R expects %d values not %d", name, cursor.count, cursor.index);
+			success = false;
+		}
+	}
+
+	Py_DECREF(items);
+	return success;
+}
+
+PyObject * MGLBlockWriter_tp_new(PyTypeObject * type, PyObject * args, PyObject * kwargs) {
+	MGLBlockWriter * self = (MGLBlockWriter *)type->tp_alloc(type, 0);
+
+	if (self) {
+	}
+
+	return (PyObject *)self;
+}
+
+void MGLBlockWriter_tp_dealloc(MGLBlockWriter * self) {
+	for (int i = 0; i < self->num_members; ++i) {
+		Py_DECREF(self->members[i].name);
+	}
+
+	delete[] self->members;
+	Py_XDECREF(self->lookup);
+	Py_TYPE(self)->tp_free((PyObject *)self);
+}
+
+PyObject * MGLBlockWriter_write(MGLBlockWriter * self, PyObject * args) {
+	MGLBuffer * buffer;
+	PyObject * values;
+	Py_ssize_t offset;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"O!On",
+		&MGLBuffer_Type,
+		&buffer,
+		&values,
+		&offset
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	if (offset < 0 || offset + self->size > buffer->size) {
+		MGLError_Set("out of range offset = %d or size = %d", offset, self->size);
+		return 0;
+	}
+
+	const GLMethods & gl = buffer->context->gl;
+
+	gl.BindBuffer(GL_ARRAY_BUFFER, buffer->buffer_obj);
+	char * map = (char *)gl.MapBufferRange(GL_ARRAY_BUFFER, offset, self->size, GL_MAP_WRITE_BIT);
+
+	if (!map) {
+		MGLError_Set("cannot map the buffer");
+		return 0;
+	}
+
+	bool success = MGLBlockWriter_Pack(self, map, values);
+
+	gl.UnmapBuffer(GL_ARRAY_BUFFER);
+
+	if (!success) {
+		return 0;
+	}
+
+	Py_RETURN_NONE;
+}
+
+PyMethodDef MGLBlockWriter_tp_methods[] = {
+	{"write", (PyCFunction)MGLBlockWriter_write, METH_VARARGS, 0},
+	{0},
+};
+
+PyTypeObject MGLBlockWriter_Type = {
+	PyVarObject_HEAD_INIT(0, 0)
+	"mgl.BlockWriter",                                      // tp_name
+	sizeof(MGLBlockWriter),                                 // tp_basicsize
+	0,                                                      // tp_itemsize
+	(destructor)MGLBlockWriter_tp_dealloc,                  // tp_dealloc
+	0,                                                      // tp_print
+	0,                                                      // tp_getattr
+	0,                                                      // tp_setattr
+	0,                                                      // tp_reserved
+	0,                                                      // tp_repr
+	0,                                                      // tp_as_number
+	0,                                                      // tp_as_sequence
+	0,                                                      // tp_as_mapping
+	0,                                                      // tp_hash
+	0,                                                      // tp_call
+	0,                                                      // tp_str
+	0,                                                      // tp_getattro
+	0,                                                      // tp_setattro
+	0,                                                      // tp_as_buffer
+	Py_TPFLAGS_DEFAULT,                                     // tp_flags
+	0,                                                      // tp_doc
+	0,                                                      // tp_traverse
+	0,                                                      // tp_clear
+	0,                                                      // tp_richcompare
+	0,                                                      // tp_weaklistoffset
+	0,                                                      // tp_iter
+	0,                                                      // tp_iternext
+	MGLBlockWriter_tp_methods,                              // tp_methods
+	0,                                                      // tp_members
+	0,                                                      // tp_getset
+	0,                                                      // tp_base
+	0,                                                      // tp_dict
+	0,                                                      // tp_descr_get
+	0,                                                      // tp_descr_set
+	0,                                                      // tp_dictoffset
+	0,                                                      // tp_init
+	0,                                                      // tp_alloc
+	MGLBlockWriter_tp_new,                                  // tp_new
+};
@@ -0,0 +1,512 @@
+#include <cstring>
+#include <vector>
+
+#include "MappedFile.hpp"
+#include "Types.hpp"
+
+#include "InlineMethods.hpp"
+
+// Streams the bricks of a volume too large for the GPU from a memory mapped raw file.
+// The volume is split into bricks of brick_size^3 texels. The bricks in use are kept in the slots of a
+// cache Texture3D, every slot holds a brick and a border of its neighbours so linear filtering does
+// not sample the neighbouring slots. The indirection Texture3D has a texel for every brick holding the
+// slot of the brick and 1 in the alpha channel, or zeros while the brick is not resident.
+// Every request marks the requested bricks as used in a new frame and loads the missing ones in
+// priority order. A missing brick takes an empty slot, or the slot used the longest time ago,
+// or the slot of a lower priority brick of the same request.
+
+struct MGLBrickCache {
+	MGLMappedFile file;
+	size_t offset;
+
+	int size[3];
+	int grid[3];
+	int slots[3];
+	int brick_size;
+	int border;
+	int stride;
+	int pixel_size;
+
+	std::vector<int> brick_slot;
+	std::vector<int> slot_brick;
+	std::vector<long long> slot_frame;
+	std::vector<int> slot_rank;
+	std::vector<char> scratch;
+
+	long long frame;
+	long long uploads;
+	long long evictions;
+	int misses;
+};
+
+inline int clamp_texel(int value, int size) {
+	return value < 0 ? 0 : value >= size ? size - 1 : value;
+}
+
+// Copies a brick and its border into the scratch memory, the border repeats the edge texels of the volume
+static void brick_gather(MGLBrickCache * cache, int brick) {
+	int bx = brick % cache->grid[0];
+	int by = brick / cache->grid[0] % cache->grid[1];
+	int bz = brick / cache->grid[0] / cache->grid[1];
+
+	int x0 = bx * cache->brick_size - cache->border;
+	int y0 = by * cache->brick_size - cache->border;
+	int z0 = bz * cache->brick_size - cache->border;
+
+	int stride = cache->stride;
+	int px = cache->pixel_size;
+	const char * volume = (const char *)cache->file.data + cache->offset;
+	bool inside = x0 >= 0 && x0 + stride <= cache->size[0];
+
+	for (int z = 0; z < stride; ++z) {
+		size_t vz = clamp_texel(z0 + z, cache->size[2]);
+		for (int y = 0; y < stride; ++y) {
+			size_t vy = clamp_texel(y0 + y, cache->size[1]);
+			const char * row = volume + (vz * cache->size[1] + vy) * cache->size[0] * px;
+			char * dst = cache->scratch.data() + ((size_t)z * stride + y) * stride * px;
+			if (inside) {
+				memcpy(dst, row + (size_t)x0 * px, (size_t)stride * px);
+			} else {
+				for (int x = 0; x < stride; ++x) {
+					memcpy(dst + x * px, row + (size_t)clamp_texel(x0 + x, cache->size[0]) * px, px);
+				}
+			}
+		}
+	}
+}
+
+static void brick_set_entry(MGLBrickVolume * self, int brick, int slot) {
+	MGLBrickCache * cache = self->cache;
+	MGLTexture3D * indirection = self->indirection;
+
+	unsigned short entry[4] = {};
+	if (slot >= 0) {
+		entry[0] = (unsigned short)(slot % cache->slots[0]);
+		entry[1] = (unsigned short)(slot / cache->slots[0] % cache->slots[1]);
+		entry[2] = (unsigned short)(slot / cache->slots[0] / cache->slots[1]);
+		entry[3] = 1;
+	}
+
+	int bx = brick % cache->grid[0];
+	int by = brick / cache->grid[0] % cache->grid[1];
+	int bz = brick / cache->grid[0] / cache->grid[1];
+
+	const GLMethods & gl = self->context->gl;
+	gl.BindTexture(GL_TEXTURE_3D, indirection->texture_obj);
+	gl.TexSubImage3D(
+		GL_TEXTURE_3D, 0, bx, by, bz, 1, 1, 1,
+		indirection->data_type->base_format[4], indirection->data_type->gl_type, entry
+	);
+}
+
+// Picks the slot for a brick of the given rank, -1 if every slot holds a brick of a higher priority
+static int brick_victim(MGLBrickCache * cache, int rank) {
+	int victim = -1;
+	int num_slots = (int)cache->slot_brick.size();
+
+	for (int slot = 0; slot < num_slots; ++slot) {
+		if (cache->slot_brick[slot] < 0) {
+			return slot;
+		}
+		if (cache->slot_frame[slot] != cache->frame) {
+			if (victim < 0 || cache->slot_frame[victim] == cache->frame || cache->slot_frame[slot] < cache->slot_frame[victim]) {
+				victim = slot;
+			}
+		} else if (cache->slot_rank[slot] > rank) {
+			if (victim < 0 || (cache->slot_frame[victim] == cache->frame && cache->slot_rank[slot] > cache->slot_rank[victim])) {
+				victim = slot;
+			}
+		}
+	}
+
+	return victim;
+}
+
+PyObject * MGLContext_brick_volume(MGLContext * self, PyObject * args) {
+	MGLTexture3D * cache_texture;
+	MGLTexture3D * indirection;
+	const char * path;
+	int width;
+	int height;
+	int depth;
+	int brick_size;
+	int border;
+	unsigned long long offset;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"O!O!s(iii)iiK",
+		&MGLTexture3D_Type,
+		&cache_texture,
+		&MGLTexture3D_Type,
+		&indirection,
+		&path,
+		&width,
+		&height,
+		&depth,
+		&brick_size,
+		&border,
+		&offset
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	if (cache_texture->data_type->block_size) {
+		MGLError_Set("compressed dtypes cannot be used for brick volumes");
+		return 0;
+	}
+
+	if (width < 1 || height < 1 || depth < 1 || brick_size < 1) {
+		MGLError_Set("the volume and the bricks cannot be empty");
+		return 0;
+	}
+
+	if (border < 0) {
+		MGLError_Set("the border must not be negative");
+		return 0;
+	}
+
+	// A stride larger than the cache cannot divide it, checked in 64 bits before it is narrowed
+	long long wide_stride = (long long)brick_size + 2LL * border;
+	int cache_min = min(min(cache_texture->width, cache_texture->height), cache_texture->depth);
+
+	if (wide_stride > cache_min) {
+		MGLError_Set("the cache size must be a multiple of %lld", wide_stride);
+		return 0;
+	}
+
+	int stride = (int)wide_stride;
+
+	if (cache_texture->width % stride || cache_texture->height % stride || cache_texture->depth % stride) {
+		MGLError_Set("the cache size must be a multiple of %d", stride);
+		return 0;
+	}
+
+	int pixel = pixel_size(cache_texture->data_type, cache_texture->components);
+	size_t volume_size = (size_t)width * height * depth * pixel;
+
+	MGLMappedFile file;
+
+	if (!MGLMappedFile_Open(file, path)) {
+		MGLError_Set("cannot map %s", path);
+		return 0;
+	}
+
+	if (offset + volume_size > file.size) {
+		MGLError_Set("the file is %llu bytes, the volume needs %llu bytes", (unsigned long long)file.size, offset + volume_size);
+		MGLMappedFile_Close(file);
+		return 0;
+	}
+
+	MGLBrickCache * cache = new MGLBrickCache();
+	cache->file = file;
+	cache->offset = (size_t)offset;
+	cache->size[0] = width;
+	cache->size[1] = height;
+	cache->size[2] = depth;
+	cache->grid[0] = (width + brick_size - 1) / brick_size;
+	cache->grid[1] = (height + brick_size - 1) / brick_size;
+	cache->grid[2] = (depth + brick_size - 1) / brick_size;
+	cache->slots[0] = cache_texture->width / stride;
+	cache->slots[1] = cache_texture->height / stride;
+	cache->slots[2] = cache_texture->depth / stride;
+	cache->brick_size = brick_size;
+	cache->border = border;
+	cache->stride = stride;
+	cache->pixel_size = pixel;
+
+	int num_bricks = cache->grid[0] * cache->grid[1] * cache->grid[2];
+	int num_slots = cache->slots[0] * cache->slots[1] * cache->slots[2];
+
+	cache->brick_slot.assign(num_bricks, -1);
+	cache->slot_brick.assign(num_slots, -1);
+	cache->slot_frame.assign(num_slots, 0);
+	cache->slot_rank.assign(num_slots, 0);
+	cache->scratch.resize((size_t)stride * stride * stride * pixel);
+
+	cache->frame = 0;
+	cache->uploads = 0;
+	cache->evictions = 0;
+	cache->misses = 0;
+
+	// No brick is resident yet
+	std::vector<unsigned short> entries((size_t)num_bricks * 4);
+
+	const GLMethods & gl = self->gl;
+	gl.ActiveTexture(GL_TEXTURE0 + self->default_texture_unit);
+	gl.BindTexture(GL_TEXTURE_3D, indirection->texture_obj);
+	gl.PixelStorei(GL_UNPACK_ALIGNMENT, 1);
+	gl.TexSubImage3D(
+		GL_TEXTURE_3D, 0, 0, 0, 0, cache->grid[0], cache->grid[1], cache->grid[2],
+		indirection->data_type->base_format[4], indirection->data_type->gl_type, entries.data()
+	);
+
+	MGLBrickVolume * volume = (MGLBrickVolume *)MGLBrickVolume_Type.tp_alloc(&MGLBrickVolume_Type, 0);
+
+	Py_INCREF(self);
+	volume->context = self;
+
+	Py_INCREF(cache_texture);
+	volume->texture = cache_texture;
+
+	Py_INCREF(indirection);
+	volume->indirection = indirection;
+
+	volume->cache = cache;
+
+	Py_INCREF(volume);
+	return (PyObject *)volume;
+}
+
+PyObject * MGLBrickVolume_tp_new(PyTypeObject * type, PyObject * args, PyObject * kwargs) {
+	MGLBrickVolume * self = (MGLBrickVolume *)type->tp_alloc(type, 0);
+
+	if (self) {
+	}
+
+	return (PyObject *)self;
+}
+
+void MGLBrickVolume_tp_dealloc(MGLBrickVolume * self) {
+	Py_TYPE(self)->tp_free((PyObject *)self);
+}
+
+PyObject * MGLBrickVolume_request(MGLBrickVolume * self, PyObject * args) {
+	PyObject * bricks;
+	int max_uploads;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"Oi",
+		&bricks,
+		&max_uploads
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	MGLBrickCache * cache = self->cache;
+
+	PyObject * sequence = PySequence_Fast(bricks, "bricks must be a sequence");
+	if (!sequence) {
+		return 0;
+	}
+
+	int num_requested = (int)PySequence_Fast_GET_SIZE(sequence);
+	std::vector<int> requested(num_requested);
+
+	for (int i = 0; i < num_requested; ++i) {
+		int x, y, z;
+		if (!PyArg_ParseTuple(PySequence_Fast_GET_ITEM(sequence, i), "iii", &x, &y, &z)) {
+			Py_DECREF(sequence);
+			return 0;
+		}
+		if (x < 0 || y < 0 || z < 0 || x >= cache->grid[0] || y >= cache->grid[1] || z >= cache->grid[2]) {
+			MGLError_Set("the brick (%d, %d, %d) is out of range", x, y, z);
+			Py_DECREF(sequence);
+			return 0;
+		}
+		requested[i] = (z * cache->grid[1] + y) * cache->grid[0] + x;
+	}
+
+	Py_DECREF(sequence);
+
+	cache->frame += 1;
+	cache->misses = 0;
+
+	// The resident bricks are kept unless a brick of a higher priority needs the slot
+	for (int i = num_requested - 1; i >= 0; --i) {
+		int slot = cache->brick_slot[requested[i]];
+		if (slot >= 0) {
+			cache->slot_frame[slot] = cache->frame;
+			cache->slot_rank[slot] = i;
+		}
+	}
+
+	const GLMethods & gl = self->context->gl;
+	gl.ActiveTexture(GL_TEXTURE0 + self->context->default_texture_unit);
+	gl.PixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+	int base_format = self->texture->data_type->base_format[self->texture->components];
+	int pixel_type = self->texture->data_type->gl_type;
+	int uploaded = 0;
+
+	for (int i = 0; i < num_requested; ++i) {
+		int brick = requested[i];
+		if (cache->brick_slot[brick] >= 0) {
+			continue;
+		}
+
+		int slot = max_uploads < 0 || uploaded < max_uploads ? brick_victim(cache, i) : -1;
+		if (slot < 0) {
+			cache->misses += 1;
+			continue;
+		}
+
+		if (cache->slot_brick[slot] >= 0) {
+			cache->brick_slot[cache->slot_brick[slot]] = -1;
+			brick_set_entry(self, cache->slot_brick[slot], -1);
+			cache->evictions += 1;
+		}
+
+		brick_gather(cache, brick);
+
+		int sx = slot % cache->slots[0];
+		int sy = slot / cache->slots[0] % cache->slots[1];
+		int sz = slot / cache->slots[0] / cache->slots[1];
+		int stride = cache->stride;
+
+		gl.BindTexture(GL_TEXTURE_3D, self->texture->texture_obj);
+		gl.TexSubImage3D(
+			GL_TEXTURE_3D, 0, sx * stride, sy * stride, sz * stride, stride, stride, stride,
+			base_format, pixel_type, cache->scratch.data()
+		);
+
+		cache->slot_brick[slot] = brick;
+		cache->slot_frame[slot] = cache->frame;
+		cache->slot_rank[slot] = i;
+		cache->brick_slot[brick] = slot;
+		brick_set_entry(self, brick, slot);
+
+		cache->uploads += 1;
+		uploaded += 1;
+	}
+
+	return PyLong_FromLong(uploaded);
+}
+
+PyObject * MGLBrickVolume_slot(MGLBrickVolume * self, PyObject * args) {
+	int x, y, z;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"(iii)",
+		&x,
+		&y,
+		&z
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	MGLBrickCache * cache = self->cache;
+
+	if (x < 0 || y < 0 || z < 0 || x >= cache->grid[0] || y >= cache->grid[1] || z >= cache->grid[2]) {
+		MGLError_Set("the brick (%d, %d, %d) is out of range", x, y, z);
+		return 0;
+	}
+
+	int slot = cache->brick_slot[(z * cache->grid[1] + y) * cache->grid[0] + x];
+	if (slot < 0) {
+		Py_RETURN_NONE;
+	}
+
+	return Py_BuildValue(
+		"(iii)",
+		slot % cache->slots[0],
+		slot / cache->slots[0] % cache->slots[1],
+		slot / cache->slots[0] / cache->slots[1]
+	);
+}
+
+PyObject * MGLBrickVolume_release(MGLBrickVolume * self) {
+	MGLBrickVolume_Invalidate(self);
+	Py_RETURN_NONE;
+}
+
+PyMethodDef MGLBrickVolume_tp_methods[] = {
+	{"request", (PyCFunction)MGLBrickVolume_request, METH_VARARGS, 0},
+	{"slot", (PyCFunction)MGLBrickVolume_slot, METH_VARARGS, 0},
+	{"release", (PyCFunction)MGLBrickVolume_release, METH_NOARGS, 0},
+	{0},
+};
+
+PyObject * MGLBrickVolume_get_resident(MGLBrickVolume * self, void * closure) {
+	int resident = 0;
+	for (int brick : self->cache->slot_brick) {
+		resident += brick >= 0;
+	}
+	return PyLong_FromLong(resident);
+}
+
+PyObject * MGLBrickVolume_get_uploads(MGLBrickVolume * self, void * closure) {
+	return PyLong_FromLongLong(self->cache->uploads);
+}
+
+PyObject * MGLBrickVolume_get_evictions(MGLBrickVolume * self, void * closure) {
+	return PyLong_FromLongLong(self->cache->evictions);
+}
+
+PyObject * MGLBrickVolume_get_misses(MGLBrickVolume * self, void * closure) {
+	return PyLong_FromLong(self->cache->misses);
+}
+
+PyGetSetDef MGLBrickVolume_tp_getseters[] = {
+	{(char *)"resident", (getter)MGLBrickVolume_get_resident, 0, 0, 0},
+	{(char *)"uploads", (getter)MGLBrickVolume_get_uploads, 0, 0, 0},
+	{(char *)"evictions", (getter)MGLBrickVolume_get_evictions, 0, 0, 0},
+	{(char *)"misses", (getter)MGLBrickVolume_get_misses, 0, 0, 0},
+	{0},
+};
+
+PyTypeObject MGLBrickVolume_Type = {
+	PyVarObject_HEAD_INIT(0, 0)
+	"mgl.BrickVolume",                                      // tp_name
+	sizeof(MGLBrickVolume),                                 // tp_basicsize
+	0,                                                      // tp_itemsize
+	(destructor)MGLBrickVolume_tp_dealloc,                  // tp_dealloc
+	0,                                                      // tp_print
+	0,                                                      // tp_getattr
+	0,                                                      // tp_setattr
+	0,                                                      // tp_reserved
+	0,                                                      // tp_repr
+	0,                                                      // tp_as_number
+	0,                                                      // tp_as_sequence
+	0,                                                      // tp_as_mapping
+	0,                                                      // tp_hash
+	0,                                                      // tp_call
+	0,                                                      // tp_str
+	0,                                                      // tp_getattro
+	0,                                                      // tp_setattro
+	0,                                                      // tp_as_buffer
+	Py_TPFLAGS_DEFAULT,                                     // tp_flags
+	0,                                                      // tp_doc
+	0,                                                      // tp_traverse
+	0,                                                      // tp_clear
+	0,                                                      // tp_richcompare
+	0,                                                      // tp_weaklistoffset
+	0,                                                      // tp_iter
+	0,                                                      // tp_iternext
+	MGLBrickVolume_tp_methods,                              // tp_methods
+	0,                                                      // tp_members
+	MGLBrickVolume_tp_getseters,                            // tp_getset
+	0,                                                      // tp_base
+	0,                                                      // tp_dict
+	0,                                                      // tp_descr_get
+	0,                                                      // tp_descr_set
+	0,                                                      // tp_dictoffset
+	0,                                                      // tp_init
+	0,                                                      // tp_alloc
+	MGLBrickVolume_tp_new,                                  // tp_new
+};
+
+void MGLBrickVolume_Invalidate(MGLBrickVolume * volume) {
+	if (Py_TYPE(volume) == &MGLInvalidObject_Type) {
+		return;
+	}
+
+	MGLMappedFile_Close(volume->cache->file);
+	delete volume->cache;
+	volume->cache = 0;
+
+	Py_DECREF(volume->texture);
+	Py_DECREF(volume->indirection);
+
+	Py_SET_TYPE(volume, &MGLInvalidObject_Type);
+	Py_DECREF(volume->context);
+	Py_DECREF(volume);
+}
@@ -1,5 +1,7 @@
 #include "Types.hpp"
 
+#include "InlineMethods.hpp"
+
 PyObject * MGLContext_buffer(MGLContext * self, PyObject * args) {
 	PyObject * data;
 	int reserve;
@@ -70,6 +72,8 @@ PyObject * MGLContext_buffer(MGLContext * self, PyObject * args) {
 	Py_INCREF(self);
 	buffer->context = self;
 
+	MGLContext_track_object(self, MGL_MEMORY_BUFFER, buffer->memory, buffer->size);
+
 	if (data != Py_None) {
 		PyBuffer_Release(&buffer_view);
 	}
@@ -500,6 +504,7 @@ PyObject * MGLBuffer_orphan(MGLBuffer * self, PyObject * args) {
 	const GLMethods & gl = self->context->gl;
 	gl.BindBuffer(GL_ARRAY_BUFFER, self->buffer_obj);
 	gl.BufferData(GL_ARRAY_BUFFER, self->size, 0, self->dynamic ? GL_DYNAMIC_DRAW : GL_STATIC_DRAW);
+	MGLContext_track_memory(self->context, MGL_MEMORY_BUFFER, self->memory, self->size);
 	Py_RETURN_NONE;
 }
 
@@ -667,6 +672,8 @@ void MGLBuffer_Invalidate(MGLBuffer * buffer) {
 	const GLMethods & gl = buffer->context->gl;
 	gl.DeleteBuffers(1, (GLuint *)&buffer->buffer_obj);
 
+	MGLContext_untrack_object(buffer->context, MGL_MEMORY_BUFFER, buffer->memory);
+
 	Py_SET_TYPE(buffer, &MGLInvalidObject_Type);
 	Py_DECREF(buffer->context);
 	Py_DECREF(buffer);
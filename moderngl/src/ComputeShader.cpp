@@ -178,6 +178,8 @@ PyObject * MGLContext_compute_shader(MGLContext * self, PyObject * args) {
 		PyTuple_SET_ITEM(uniform_blocks_lst, i, item);
 	}
 
+	PyObject * storage_blocks_lst = MGLUniformBlock_StorageBlocks(gl, program_obj);
+
 	int subroutine_uniforms_base = 0;
 	int subroutines_base = 0;
 
@@ -224,13 +226,14 @@ PyObject * MGLContext_compute_shader(MGLContext * self, PyObject * args) {
 		}
 	}
 
-	PyObject * result = PyTuple_New(6);
+	PyObject * result = PyTuple_New(7);
 	PyTuple_SET_ITEM(result, 0, (PyObject *)compute_shader);
 	PyTuple_SET_ITEM(result, 1, uniforms_lst);
 	PyTuple_SET_ITEM(result, 2, uniform_blocks_lst);
-	PyTuple_SET_ITEM(result, 3, subroutines_lst);
-	PyTuple_SET_ITEM(result, 4, subroutine_uniforms_lst);
-	PyTuple_SET_ITEM(result, 5, PyLong_FromLong(compute_shader->program_obj));
+	PyTuple_SET_ITEM(result, 3, storage_blocks_lst);
+	PyTuple_SET_ITEM(result, 4, subroutines_lst);
+	PyTuple_SET_ITEM(result, 5, subroutine_uniforms_lst);
+	PyTuple_SET_ITEM(result, 6, PyLong_FromLong(compute_shader->program_obj));
 	return result;
 }
 
@@ -266,7 +269,7 @@ PyObject * MGLComputeShader_run(MGLComputeShader * self, PyObject * args) {
 
 	const GLMethods & gl = self->context->gl;
 
-	gl.UseProgram(self->program_obj);
+	MGLContext_use_program(self->context, self->program_obj);
 	gl.DispatchCompute(x, y, z);
 
 	Py_RETURN_NONE;
@@ -339,6 +342,10 @@ void MGLComputeShader_Invalidate(MGLComputeShader * compute_shader) {
 	gl.DeleteShader(compute_shader->shader_obj);
 	gl.DeleteProgram(compute_shader->program_obj);
 
+	if (compute_shader->context->bound_program == compute_shader->program_obj) {
+		MGLContext_reset_program_state(compute_shader->context);
+	}
+
 	Py_DECREF(compute_shader->context);
 	Py_SET_TYPE(compute_shader, &MGLInvalidObject_Type);
 	Py_DECREF(compute_shader);
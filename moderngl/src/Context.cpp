@@ -324,6 +324,212 @@ PyObject * MGLContext_copy_framebuffer(MGLContext * self, PyObject * args) {
 	Py_RETURN_NONE;
 }
 
+// An image of a texture level or renderbuffer as seen by glCopyImageSubData
+struct MGLCopyImage {
+	int obj;
+	int target;
+	int size[3];
+	int samples;
+	int texel_size;
+	bool compressed;
+	bool depth;
+};
+
+static bool MGLCopyImage_parse(PyObject * obj, int level, MGLCopyImage & image) {
+	int max_level = 0;
+	int width = 0;
+	int height = 0;
+	int depth = 1;
+	MGLDataType * data_type = 0;
+	int components = 0;
+
+	image.samples = 0;
+	image.depth = false;
+
+	// The level shifts the size below, a negative one is rejected first
+	if (level < 0) {
+		MGLError_Set("invalid level");
+		return false;
+	}
+
+	if (Py_TYPE(obj) == &MGLTexture_Type) {
+		MGLTexture * texture = (MGLTexture *)obj;
+		image.obj = texture->texture_obj;
+		image.target = texture->samples ? GL_TEXTURE_2D_MULTISAMPLE : GL_TEXTURE_2D;
+		image.samples = texture->samples;
+		image.depth = texture->depth;
+		max_level = texture->max_level;
+		width = texture->width >> level;
+		height = texture->height >> level;
+		data_type = texture->data_type;
+		components = texture->components;
+	} else if (Py_TYPE(obj) == &MGLTexture3D_Type) {
+		MGLTexture3D * texture = (MGLTexture3D *)obj;
+		image.obj = texture->texture_obj;
+		image.target = GL_TEXTURE_3D;
+		max_level = texture->max_level;
+		width = texture->width >> level;
+		height = texture->height >> level;
+		depth = max(texture->depth >> level, 1);
+		data_type = texture->data_type;
+		components = texture->components;
+	} else if (Py_TYPE(obj) == &MGLTextureArray_Type) {
+		MGLTextureArray * texture = (MGLTextureArray *)obj;
+		image.obj = texture->texture_obj;
+		image.target = GL_TEXTURE_2D_ARRAY;
+		max_level = texture->max_level;
+		width = texture->width >> level;
+		height = texture->height >> level;
+		depth = texture->layers;
+		data_type = texture->data_type;
+		components = texture->components;
+	} else if (Py_TYPE(obj) == &MGLTextureCube_Type) {
+		// The faces are addressed as layers
+		MGLTextureCube * texture = (MGLTextureCube *)obj;
+		image.obj = texture->texture_obj;
+		image.target = GL_TEXTURE_CUBE_MAP;
+		max_level = texture->max_level;
+		width = texture->width >> level;
+		height = texture->height >> level;
+		depth = 6;
+		data_type = texture->data_type;
+		components = texture->components;
+	} else if (Py_TYPE(obj) == &MGLRenderbuffer_Type) {
+		MGLRenderbuffer * renderbuffer = (MGLRenderbuffer *)obj;
+		image.obj = renderbuffer->renderbuffer_obj;
+		image.target = GL_RENDERBUFFER;
+		image.samples = renderbuffer->samples;
+		image.depth = renderbuffer->depth;
+		width = renderbuffer->width;
+		height = renderbuffer->height;
+		data_type = renderbuffer->data_type;
+		components = renderbuffer->components;
+	} else {
+		MGLError_Set("the images must be a Texture, Texture3D, TextureArray, TextureCube or Renderbuffer");
+		return false;
+	}
+
+	if (level > max_level) {
+		MGLError_Set("invalid level");
+		return false;
+	}
+
+	image.size[0] = max(width, 1);
+	image.size[1] = max(height, 1);
+	image.size[2] = depth;
+	image.compressed = data_type->block_size != 0;
+	image.texel_size = image.compressed ? data_type->block_size[components] : pixel_size(data_type, components);
+	return true;
+}
+
+// Regions and offsets are given as 2 or 3 values, the third one selects the layer or cube map face
+static int copy_region_dims(PyObject * region) {
+	if (Py_TYPE(region) == &PyTuple_Type && (PyTuple_GET_SIZE(region) == 2 || PyTuple_GET_SIZE(region) == 4)) {
+		return 2;
+	}
+	return 3;
+}
+
+PyObject * MGLContext_copy_texture(MGLContext * self, PyObject * args) {
+	PyObject * dst;
+	PyObject * src;
+	int src_level;
+	PyObject * src_region;
+	int dst_level;
+	PyObject * dst_offset;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"OOiOiO",
+		&dst,
+		&src,
+		&src_level,
+		&src_region,
+		&dst_level,
+		&dst_offset
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	if (self->version_code < 430 || !self->gl.CopyImageSubData) {
+		MGLError_Set("copying textures requires OpenGL 4.3");
+		return 0;
+	}
+
+	MGLCopyImage src_image;
+	MGLCopyImage dst_image;
+
+	if (!MGLCopyImage_parse(src, src_level, src_image) || !MGLCopyImage_parse(dst, dst_level, dst_image)) {
+		return 0;
+	}
+
+	if (src_image.samples != dst_image.samples) {
+		MGLError_Set("the number of samples must match");
+		return 0;
+	}
+
+	if (src_image.compressed != dst_image.compressed || src_image.texel_size != dst_image.texel_size || src_image.depth != dst_image.depth) {
+		MGLError_Set("the formats are not compatible");
+		return 0;
+	}
+
+	int src_offset[3] = {0, 0, 0};
+	int size[3] = {src_image.size[0], src_image.size[1], src_image.size[2]};
+
+	if (!parse_texture_viewport(src_region, copy_region_dims(src_region), src_offset, size)) {
+		return 0;
+	}
+
+	if (!texture_viewport_ok(3, src_offset, size, src_image.size)) {
+		MGLError_Set("the source region is out of range");
+		return 0;
+	}
+
+	int offset[3] = {0, 0, 0};
+
+	if (dst_offset != Py_None) {
+		if (Py_TYPE(dst_offset) != &PyTuple_Type || (PyTuple_GET_SIZE(dst_offset) != 2 && PyTuple_GET_SIZE(dst_offset) != 3)) {
+			MGLError_Set("the dst_offset must be a tuple of 2 or 3 integers");
+			return 0;
+		}
+
+		for (int i = 0; i < PyTuple_GET_SIZE(dst_offset); ++i) {
+			offset[i] = PyLong_AsLong(PyTuple_GET_ITEM(dst_offset, i));
+		}
+
+		if (PyErr_Occurred()) {
+			MGLError_Set("wrong values in the dst_offset");
+			return 0;
+		}
+	}
+
+	if (!texture_viewport_ok(3, offset, size, dst_image.size)) {
+		MGLError_Set("the destination region is out of range");
+		return 0;
+	}
+
+	if (src_image.compressed) {
+		bool src_ok = compressed_viewport_ok(src_offset[0], src_offset[1], size[0], size[1], src_image.size[0], src_image.size[1]);
+		bool dst_ok = compressed_viewport_ok(offset[0], offset[1], size[0], size[1], dst_image.size[0], dst_image.size[1]);
+		if (!src_ok || !dst_ok) {
+			MGLError_Set("the regions must be aligned to 4x4 blocks");
+			return 0;
+		}
+	}
+
+	const GLMethods & gl = self->gl;
+
+	gl.CopyImageSubData(
+		src_image.obj, src_image.target, src_level, src_offset[0], src_offset[1], src_offset[2],
+		dst_image.obj, dst_image.target, dst_level, offset[0], offset[1], offset[2],
+		size[0], size[1], size[2]
+	);
+
+	Py_RETURN_NONE;
+}
+
 PyObject * MGLContext_detect_framebuffer(MGLContext * self, PyObject * args) {
 	PyObject * glo;
 
@@ -487,11 +693,42 @@ PyObject * MGLContext_clear_samplers(MGLContext * self, PyObject * args) {
 	Py_RETURN_NONE;
 }
 
+// The memory ledger is kept up to date by the objects, nothing is queried from the driver
+PyObject * MGLContext_memory_stats(MGLContext * self) {
+	static const char * names[MGL_MEMORY_KINDS] = {
+		"buffer", "texture", "texture3d", "texture_array", "texture_cube", "renderbuffer",
+	};
+
+	PyObject * stats = PyDict_New();
+	long long total = 0;
+
+	for (int i = 0; i < MGL_MEMORY_KINDS; ++i) {
+		PyObject * kind = Py_BuildValue(
+			"{sLsLsi}",
+			"bytes", self->memory[i],
+			"peak", self->memory_peak[i],
+			"objects", self->memory_objects[i]
+		);
+		PyDict_SetItemString(stats, names[i], kind);
+		Py_DECREF(kind);
+		total += self->memory[i];
+	}
+
+	PyObject * kind = Py_BuildValue("{sLsL}", "bytes", total, "peak", self->memory_total_peak);
+	PyDict_SetItemString(stats, "total", kind);
+	Py_DECREF(kind);
+	return stats;
+}
+
 PyObject * MGLContext_buffer(MGLContext * self, PyObject * args);
 PyObject * MGLContext_texture(MGLContext * self, PyObject * args);
 PyObject * MGLContext_texture3d(MGLContext * self, PyObject * args);
 PyObject * MGLContext_texture_array(MGLContext * self, PyObject * args);
 PyObject * MGLContext_texture_cube(MGLContext * self, PyObject * args);
+PyObject * MGLContext_texture_atlas(MGLContext * self, PyObject * args);
+PyObject * MGLContext_brick_volume(MGLContext * self, PyObject * args);
+PyObject * MGLContext_texture_buffer(MGLContext * self, PyObject * args);
+PyObject * MGLContext_texture_from_file(MGLContext * self, PyObject * args);
 PyObject * MGLContext_depth_texture(MGLContext * self, PyObject * args);
 PyObject * MGLContext_vertex_array(MGLContext * self, PyObject * args);
 PyObject * MGLContext_program(MGLContext * self, PyObject * args);
@@ -502,14 +739,23 @@ PyObject * MGLContext_compute_shader(MGLContext * self, PyObject * args);
 PyObject * MGLContext_query(MGLContext * self, PyObject * args);
 PyObject * MGLContext_scope(MGLContext * self, PyObject * args);
 PyObject * MGLContext_sampler(MGLContext * self, PyObject * args);
+PyObject * MGLContext_uniform_stream(MGLContext * self, PyObject * args);
+PyObject * MGLContext_upload_queue(MGLContext * self, PyObject * args);
 
 PyObject * MGLContext_enter(MGLContext * self) {
 	PyObject_CallMethod(self->ctx, "__enter__", NULL);
+	MGLContext_reset_program_state(self);
 	Py_RETURN_NONE;
 }
 
 PyObject * MGLContext_exit(MGLContext * self) {
 	PyObject_CallMethod(self->ctx, "__exit__", NULL);
+	MGLContext_reset_program_state(self);
+	Py_RETURN_NONE;
+}
+
+PyObject * MGLContext_reset_program_state_method(MGLContext * self) {
+	MGLContext_reset_program_state(self);
 	Py_RETURN_NONE;
 }
 
@@ -527,14 +773,21 @@ PyMethodDef MGLContext_tp_methods[] = {
 	{"finish", (PyCFunction)MGLContext_finish, METH_NOARGS, 0},
 	{"copy_buffer", (PyCFunction)MGLContext_copy_buffer, METH_VARARGS, 0},
 	{"copy_framebuffer", (PyCFunction)MGLContext_copy_framebuffer, METH_VARARGS, 0},
+	{"copy_texture", (PyCFunction)MGLContext_copy_texture, METH_VARARGS, 0},
 	{"detect_framebuffer", (PyCFunction)MGLContext_detect_framebuffer, METH_VARARGS, 0},
 	{"clear_samplers", (PyCFunction)MGLContext_clear_samplers, METH_VARARGS, 0},
+	{"reset_program_state", (PyCFunction)MGLContext_reset_program_state_method, METH_NOARGS, 0},
+	{"memory_stats", (PyCFunction)MGLContext_memory_stats, METH_NOARGS, 0},
 
 	{"buffer", (PyCFunction)MGLContext_buffer, METH_VARARGS, 0},
 	{"texture", (PyCFunction)MGLContext_texture, METH_VARARGS, 0},
 	{"texture3d", (PyCFunction)MGLContext_texture3d, METH_VARARGS, 0},
 	{"texture_array", (PyCFunction)MGLContext_texture_array, METH_VARARGS, 0},
 	{"texture_cube", (PyCFunction)MGLContext_texture_cube, METH_VARARGS, 0},
+	{"texture_atlas", (PyCFunction)MGLContext_texture_atlas, METH_VARARGS, 0},
+	{"brick_volume", (PyCFunction)MGLContext_brick_volume, METH_VARARGS, 0},
+	{"texture_buffer", (PyCFunction)MGLContext_texture_buffer, METH_VARARGS, 0},
+	{"texture_from_file", (PyCFunction)MGLContext_texture_from_file, METH_VARARGS, 0},
 	{"depth_texture", (PyCFunction)MGLContext_depth_texture, METH_VARARGS, 0},
 	{"vertex_array", (PyCFunction)MGLContext_vertex_array, METH_VARARGS, 0},
 	{"program", (PyCFunction)MGLContext_program, METH_VARARGS, 0},
@@ -546,6 +799,8 @@ PyMethodDef MGLContext_tp_methods[] = {
 	{"query", (PyCFunction)MGLContext_query, METH_VARARGS, 0},
 	{"scope", (PyCFunction)MGLContext_scope, METH_VARARGS, 0},
 	{"sampler", (PyCFunction)MGLContext_sampler, METH_VARARGS, 0},
+	{"uniform_stream", (PyCFunction)MGLContext_uniform_stream, METH_VARARGS, 0},
+	{"upload_queue", (PyCFunction)MGLContext_upload_queue, METH_VARARGS, 0},
 
 	{"__enter__", (PyCFunction)MGLContext_enter, METH_NOARGS, 0},
 	{"__exit__", (PyCFunction)MGLContext_exit, METH_VARARGS, 0},
@@ -1397,6 +1652,9 @@ PyObject * MGLContext_get_info(MGLContext * self, void * closure) {
 		int gl_max_uniform_locations = 0;
 		gl.GetIntegerv(GL_MAX_UNIFORM_LOCATIONS, &gl_max_uniform_locations);
 
+		int gl_texture_buffer_offset_alignment = 0;
+		gl.GetIntegerv(GL_TEXTURE_BUFFER_OFFSET_ALIGNMENT, &gl_texture_buffer_offset_alignment);
+
 		long long gl_max_element_index = 0;
 
 		if (gl.GetInteger64v) {
@@ -1429,6 +1687,7 @@ PyObject * MGLContext_get_info(MGLContext * self, void * closure) {
 		PyDict_SetItemString(info, "GL_MAX_FRAMEBUFFER_LAYERS", PyLong_FromLong(gl_max_framebuffer_layers));
 		PyDict_SetItemString(info, "GL_MAX_FRAMEBUFFER_SAMPLES", PyLong_FromLong(gl_max_framebuffer_samples));
 		PyDict_SetItemString(info, "GL_MAX_UNIFORM_LOCATIONS", PyLong_FromLong(gl_max_uniform_locations));
+		PyDict_SetItemString(info, "GL_TEXTURE_BUFFER_OFFSET_ALIGNMENT", PyLong_FromLong(gl_texture_buffer_offset_alignment));
 		PyDict_SetItemString(info, "GL_MAX_ELEMENT_INDEX", PyLong_FromLongLong(gl_max_element_index));
 		PyDict_SetItemString(info, "GL_MAX_SHADER_STORAGE_BLOCK_SIZE", PyLong_FromLongLong(gl_max_shader_storage_block_size));
 	}
@@ -1516,6 +1775,9 @@ void MGLContext_Invalidate(MGLContext * context) {
 
 	PyObject_CallMethod(context->ctx, "release", NULL);
 
+	delete[] context->bound_subroutines;
+	context->bound_subroutines = 0;
+
 	// TODO: decref
 
 	Py_SET_TYPE(context, &MGLInvalidObject_Type);
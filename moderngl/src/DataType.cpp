@@ -16,6 +16,38 @@ static int i4_internal_format[5] = {0, GL_R32I, GL_RG32I, GL_RGB32I, GL_RGBA32I}
 static int n1_internal_format[5] = {0, GL_R8, GL_RG8, GL_RGB8, GL_RGBA8};
 static int n2_internal_format[5] = {0, GL_R16, GL_RG16, GL_RGB16, GL_RGBA16};
 
+// Compressed dtypes store 4x4 blocks, the block size is in bytes
+static int bc1_internal_format[5] = {0, 0, 0, GL_COMPRESSED_RGB_S3TC_DXT1_EXT, GL_COMPRESSED_RGBA_S3TC_DXT1_EXT};
+static int bc2_internal_format[5] = {0, 0, 0, 0, GL_COMPRESSED_RGBA_S3TC_DXT3_EXT};
+static int bc3_internal_format[5] = {0, 0, 0, 0, GL_COMPRESSED_RGBA_S3TC_DXT5_EXT};
+static int bc4_internal_format[5] = {0, GL_COMPRESSED_RED_RGTC1, 0, 0, 0};
+static int bc4s_internal_format[5] = {0, GL_COMPRESSED_SIGNED_RED_RGTC1, 0, 0, 0};
+static int bc5_internal_format[5] = {0, 0, GL_COMPRESSED_RG_RGTC2, 0, 0};
+static int bc5s_internal_format[5] = {0, 0, GL_COMPRESSED_SIGNED_RG_RGTC2, 0, 0};
+static int bc6h_internal_format[5] = {0, 0, 0, GL_COMPRESSED_RGB_BPTC_UNSIGNED_FLOAT, 0};
+static int bc6s_internal_format[5] = {0, 0, 0, GL_COMPRESSED_RGB_BPTC_SIGNED_FLOAT, 0};
+static int bc7_internal_format[5] = {0, 0, 0, 0, GL_COMPRESSED_RGBA_BPTC_UNORM};
+static int etc2_internal_format[5] = {0, 0, 0, GL_COMPRESSED_RGB8_ETC2, GL_COMPRESSED_RGBA8_ETC2_EAC};
+static int eac_internal_format[5] = {0, GL_COMPRESSED_R11_EAC, GL_COMPRESSED_RG11_EAC, 0, 0};
+static int eacs_internal_format[5] = {0, GL_COMPRESSED_SIGNED_R11_EAC, GL_COMPRESSED_SIGNED_RG11_EAC, 0, 0};
+
+// Packed dtypes store a whole pixel in a single 32 bit value
+static int r11g11b10f_base_format[5] = {0, 0, 0, GL_RGB, 0};
+static int rgb10a2_base_format[5] = {0, 0, 0, 0, GL_RGBA};
+
+static int r11g11b10f_internal_format[5] = {0, 0, 0, GL_R11F_G11F_B10F, 0};
+static int rgb9e5_internal_format[5] = {0, 0, 0, GL_RGB9_E5, 0};
+static int rgb10a2_internal_format[5] = {0, 0, 0, 0, GL_RGB10_A2};
+static int srgb8_internal_format[5] = {0, 0, 0, GL_SRGB8, GL_SRGB8_ALPHA8};
+
+static int bc1_block_size[5] = {0, 0, 0, 8, 8};
+static int bc2_block_size[5] = {0, 0, 0, 0, 16};
+static int bc4_block_size[5] = {0, 8, 0, 0, 0};
+static int bc5_block_size[5] = {0, 0, 16, 0, 0};
+static int bc6_block_size[5] = {0, 0, 0, 16, 0};
+static int etc2_block_size[5] = {0, 0, 0, 8, 16};
+static int eac_block_size[5] = {0, 8, 16, 0, 0};
+
 static MGLDataType f1 = {float_base_format, f1_internal_format, GL_UNSIGNED_BYTE, 1, true};
 static MGLDataType f2 = {float_base_format, f2_internal_format, GL_HALF_FLOAT, 2, true};
 static MGLDataType f4 = {float_base_format, f4_internal_format, GL_FLOAT, 4, true};
@@ -31,8 +63,43 @@ static MGLDataType nu2 = {float_base_format, n2_internal_format, GL_UNSIGNED_SHO
 static MGLDataType ni1 = {float_base_format, n1_internal_format, GL_BYTE, 1, false};
 static MGLDataType ni2 = {float_base_format, n2_internal_format, GL_SHORT, 2, false};
 
+static MGLDataType bc1 = {float_base_format, bc1_internal_format, GL_UNSIGNED_BYTE, 1, true, bc1_block_size};
+static MGLDataType bc2 = {float_base_format, bc2_internal_format, GL_UNSIGNED_BYTE, 1, true, bc2_block_size};
+static MGLDataType bc3 = {float_base_format, bc3_internal_format, GL_UNSIGNED_BYTE, 1, true, bc2_block_size};
+static MGLDataType bc4 = {float_base_format, bc4_internal_format, GL_UNSIGNED_BYTE, 1, true, bc4_block_size};
+static MGLDataType bc4s = {float_base_format, bc4s_internal_format, GL_UNSIGNED_BYTE, 1, true, bc4_block_size};
+static MGLDataType bc5 = {float_base_format, bc5_internal_format, GL_UNSIGNED_BYTE, 1, true, bc5_block_size};
+static MGLDataType bc5s = {float_base_format, bc5s_internal_format, GL_UNSIGNED_BYTE, 1, true, bc5_block_size};
+static MGLDataType bc6h = {float_base_format, bc6h_internal_format, GL_UNSIGNED_BYTE, 1, true, bc6_block_size};
+static MGLDataType bc6s = {float_base_format, bc6s_internal_format, GL_UNSIGNED_BYTE, 1, true, bc6_block_size};
+static MGLDataType bc7 = {float_base_format, bc7_internal_format, GL_UNSIGNED_BYTE, 1, true, bc2_block_size};
+static MGLDataType etc2 = {float_base_format, etc2_internal_format, GL_UNSIGNED_BYTE, 1, true, etc2_block_size};
+static MGLDataType eac = {float_base_format, eac_internal_format, GL_UNSIGNED_BYTE, 1, true, eac_block_size};
+static MGLDataType eacs = {float_base_format, eacs_internal_format, GL_UNSIGNED_BYTE, 1, true, eac_block_size};
+
+static MGLDataType r11g11b10f = {r11g11b10f_base_format, r11g11b10f_internal_format, GL_UNSIGNED_INT_10F_11F_11F_REV, 4, true, 0, 4};
+static MGLDataType rgb9e5 = {r11g11b10f_base_format, rgb9e5_internal_format, GL_UNSIGNED_INT_5_9_9_9_REV, 4, true, 0, 4};
+static MGLDataType rgb10a2 = {rgb10a2_base_format, rgb10a2_internal_format, GL_UNSIGNED_INT_2_10_10_10_REV, 4, true, 0, 4};
+static MGLDataType srgb8 = {float_base_format, srgb8_internal_format, GL_UNSIGNED_BYTE, 1, true};
+
+// Depth dtypes only have a single component, d24 is read as float for compatibility
+static int depth_base_format[5] = {0, GL_DEPTH_COMPONENT, 0, 0, 0};
+static int depth_stencil_base_format[5] = {0, GL_DEPTH_STENCIL, 0, 0, 0};
+
+static int d16_internal_format[5] = {0, GL_DEPTH_COMPONENT16, 0, 0, 0};
+static int d24_internal_format[5] = {0, GL_DEPTH_COMPONENT24, 0, 0, 0};
+static int d32f_internal_format[5] = {0, GL_DEPTH_COMPONENT32F, 0, 0, 0};
+static int d24s8_internal_format[5] = {0, GL_DEPTH24_STENCIL8, 0, 0, 0};
+static int d32fs8_internal_format[5] = {0, GL_DEPTH32F_STENCIL8, 0, 0, 0};
+
+static MGLDataType d16 = {depth_base_format, d16_internal_format, GL_UNSIGNED_SHORT, 2, true};
+static MGLDataType d24 = {depth_base_format, d24_internal_format, GL_FLOAT, 4, true};
+static MGLDataType d32f = {depth_base_format, d32f_internal_format, GL_FLOAT, 4, true};
+static MGLDataType d24s8 = {depth_stencil_base_format, d24s8_internal_format, GL_UNSIGNED_INT_24_8, 4, true, 0, 4};
+static MGLDataType d32fs8 = {depth_stencil_base_format, d32fs8_internal_format, GL_FLOAT_32_UNSIGNED_INT_24_8_REV, 4, true, 0, 8};
+
 MGLDataType * from_dtype(const char * dtype, Py_ssize_t size) {
-	if (size < 2 || size > 3) return 0;
+	if (size < 2 || size > 10) return 0;
 
 	// if (!dtype[0] || (dtype[1] && dtype[2])) {
 	// 	return 0;
@@ -87,9 +154,55 @@ MGLDataType * from_dtype(const char * dtype, Py_ssize_t size) {
 			case ('n' * 65536 + 'u' * 256 + '2'):
 				return &nu2;
 
+			case ('b' * 65536 + 'c' * 256 + '1'):
+				return &bc1;
+
+			case ('b' * 65536 + 'c' * 256 + '2'):
+				return &bc2;
+
+			case ('b' * 65536 + 'c' * 256 + '3'):
+				return &bc3;
+
+			case ('b' * 65536 + 'c' * 256 + '4'):
+				return &bc4;
+
+			case ('b' * 65536 + 'c' * 256 + '5'):
+				return &bc5;
+
+			case ('b' * 65536 + 'c' * 256 + '7'):
+				return &bc7;
+
+			case ('e' * 65536 + 'a' * 256 + 'c'):
+				return &eac;
+
 			default:
 				return 0;		
 		}
 	}
+	else if (size == 4)
+	{
+		if (!memcmp(dtype, "bc4s", 4)) return &bc4s;
+		if (!memcmp(dtype, "bc5s", 4)) return &bc5s;
+		if (!memcmp(dtype, "bc6h", 4)) return &bc6h;
+		if (!memcmp(dtype, "bc6s", 4)) return &bc6s;
+		if (!memcmp(dtype, "etc2", 4)) return &etc2;
+		if (!memcmp(dtype, "eacs", 4)) return &eacs;
+	}
+	else
+	{
+		if (size == 10 && !memcmp(dtype, "r11g11b10f", 10)) return &r11g11b10f;
+		if (size == 6 && !memcmp(dtype, "rgb9e5", 6)) return &rgb9e5;
+		if (size == 7 && !memcmp(dtype, "rgb10a2", 7)) return &rgb10a2;
+		if (size == 5 && !memcmp(dtype, "srgb8", 5)) return &srgb8;
+	}
+	return 0;
+}
+
+MGLDataType * from_depth_dtype(const char * dtype, Py_ssize_t size) {
+	if (size == 3 && !memcmp(dtype, "d16", 3)) return &d16;
+	if (size == 3 && !memcmp(dtype, "d24", 3)) return &d24;
+	if (size == 4 && !memcmp(dtype, "d32f", 4)) return &d32f;
+	if (size == 5 && !memcmp(dtype, "d24s8", 5)) return &d24s8;
+	if (size == 6 && !memcmp(dtype, "d32fs8", 6)) return &d32fs8;
 	return 0;
 }
@@ -0,0 +1,450 @@
+#include <chrono>
+
+#include "Types.hpp"
+
+#include "InlineMethods.hpp"
+
+PyObject * MGLFramebuffer_frame_capture(MGLFramebuffer * self, PyObject * args) {
+	int depth;
+	PyObject * viewport;
+	int components;
+	int attachment;
+	int alignment;
+	const char * dtype;
+	Py_ssize_t dtype_size;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"IOIiIs#",
+		&depth,
+		&viewport,
+		&components,
+		&attachment,
+		&alignment,
+		&dtype,
+		&dtype_size
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	if (depth < 2 || depth > FRAME_CAPTURE_MAX_DEPTH) {
+		MGLError_Set("the depth must be between 2 and %d", FRAME_CAPTURE_MAX_DEPTH);
+		return 0;
+	}
+
+	if (alignment != 1 && alignment != 2 && alignment != 4 && alignment != 8) {
+		MGLError_Set("the alignment must be 1, 2, 4 or 8");
+		return 0;
+	}
+
+	MGLDataType * data_type = from_dtype(dtype, dtype_size);
+
+	if (!data_type) {
+		MGLError_Set("invalid dtype");
+		return 0;
+	}
+
+	if (data_type->block_size) {
+		MGLError_Set("compressed dtypes are only supported by textures");
+		return 0;
+	}
+
+	int x = 0;
+	int y = 0;
+	int width = self->width;
+	int height = self->height;
+
+	if (viewport != Py_None) {
+		if (Py_TYPE(viewport) != &PyTuple_Type) {
+			MGLError_Set("the viewport must be a tuple not %s", Py_TYPE(viewport)->tp_name);
+			return 0;
+		}
+
+		if (PyTuple_GET_SIZE(viewport) == 4) {
+
+			x = PyLong_AsLong(PyTuple_GET_ITEM(viewport, 0));
+			y = PyLong_AsLong(PyTuple_GET_ITEM(viewport, 1));
+			width = PyLong_AsLong(PyTuple_GET_ITEM(viewport, 2));
+			height = PyLong_AsLong(PyTuple_GET_ITEM(viewport, 3));
+
+		} else if (PyTuple_GET_SIZE(viewport) == 2) {
+
+			width = PyLong_AsLong(PyTuple_GET_ITEM(viewport, 0));
+			height = PyLong_AsLong(PyTuple_GET_ITEM(viewport, 1));
+
+		} else {
+
+			MGLError_Set("the viewport size %d is invalid", PyTuple_GET_SIZE(viewport));
+			return 0;
+
+		}
+
+		if (PyErr_Occurred()) {
+			MGLError_Set("wrong values in the viewport");
+			return 0;
+		}
+
+	}
+
+	bool read_depth = false;
+
+	if (attachment == -1) {
+		components = 1;
+		read_depth = true;
+	}
+
+	if (data_type->packed_size && !data_type->base_format[components]) {
+		MGLError_Set("the %s dtype does not support %d components", dtype, components);
+		return 0;
+	}
+
+	int frame_size = width * pixel_size(data_type, components);
+	frame_size = (frame_size + alignment - 1) / alignment * alignment;
+	frame_size = frame_size * height;
+
+	if (frame_size < 1) {
+		MGLError_Set("the viewport is empty");
+		return 0;
+	}
+
+	const GLMethods & gl = self->context->gl;
+
+	int buffer_obj = 0;
+	gl.GenBuffers(1, (GLuint *)&buffer_obj);
+
+	if (!buffer_obj) {
+		MGLError_Set("cannot create buffer");
+		return 0;
+	}
+
+	char * mapped = 0;
+
+	gl.BindBuffer(GL_PIXEL_PACK_BUFFER, buffer_obj);
+
+	if (self->context->version_code >= 440 && gl.BufferStorage) {
+		// Persistent coherent mapping, the frames are handed out without map calls
+		const int flags = GL_MAP_READ_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+		gl.BufferStorage(GL_PIXEL_PACK_BUFFER, (GLsizeiptr)frame_size * depth, 0, flags);
+		mapped = (char *)gl.MapBufferRange(GL_PIXEL_PACK_BUFFER, 0, (GLsizeiptr)frame_size * depth, flags);
+	} else {
+		gl.BufferData(GL_PIXEL_PACK_BUFFER, (GLsizeiptr)frame_size * depth, 0, GL_STREAM_READ);
+	}
+
+	gl.BindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+	MGLFrameCapture * capture = (MGLFrameCapture *)MGLFrameCapture_Type.tp_alloc(&MGLFrameCapture_Type, 0);
+
+	Py_INCREF(self->context);
+	capture->context = self->context;
+
+	Py_INCREF(self);
+	capture->framebuffer = self;
+
+	capture->buffer_obj = buffer_obj;
+	capture->mapped = mapped;
+	capture->frame_map = 0;
+	capture->frame = 0;
+	capture->exports = 0;
+	capture->x = x;
+	capture->y = y;
+	capture->width = width;
+	capture->height = height;
+	capture->read_buffer = read_depth ? GL_NONE : (GL_COLOR_ATTACHMENT0 + attachment);
+	capture->base_format = read_depth ? GL_DEPTH_COMPONENT : data_type->base_format[components];
+	capture->pixel_type = data_type->gl_type;
+	capture->alignment = alignment;
+	capture->frame_size = frame_size;
+	capture->depth = depth;
+	capture->head = 0;
+	capture->num_pending = 0;
+	capture->out_slot = -1;
+	capture->frames = 0;
+	capture->stalls = 0;
+	capture->stall_time = 0.0;
+
+	Py_INCREF(capture);
+
+	PyObject * result = PyTuple_New(2);
+	PyTuple_SET_ITEM(result, 0, (PyObject *)capture);
+	PyTuple_SET_ITEM(result, 1, PyLong_FromLong(frame_size));
+	return result;
+}
+
+PyObject * MGLFrameCapture_tp_new(PyTypeObject * type, PyObject * args, PyObject * kwargs) {
+	MGLFrameCapture * self = (MGLFrameCapture *)type->tp_alloc(type, 0);
+
+	if (self) {
+	}
+
+	return (PyObject *)self;
+}
+
+void MGLFrameCapture_tp_dealloc(MGLFrameCapture * self) {
+	Py_TYPE(self)->tp_free((PyObject *)self);
+}
+
+// Fails while the frame is exported, slices and casts of its memoryview keep the export alive
+bool MGLFrameCapture_check_exports(MGLFrameCapture * self) {
+	if (self->exports) {
+		PyErr_Format(PyExc_BufferError, "the last frame is still referenced by %d buffers", self->exports);
+		return false;
+	}
+	return true;
+}
+
+// Frees the slot of the frame handed out by the previous call
+bool MGLFrameCapture_recycle(MGLFrameCapture * self) {
+	if (!MGLFrameCapture_check_exports(self)) {
+		return false;
+	}
+
+	if (self->frame_map) {
+		const GLMethods & gl = self->context->gl;
+		gl.BindBuffer(GL_PIXEL_PACK_BUFFER, self->buffer_obj);
+		gl.UnmapBuffer(GL_PIXEL_PACK_BUFFER);
+		gl.BindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+		self->frame_map = 0;
+	}
+
+	self->frame = 0;
+	self->out_slot = -1;
+	return true;
+}
+
+// Hands out the oldest pending frame, returns None when it is not ready and wait is false
+PyObject * MGLFrameCapture_next_frame(MGLFrameCapture * self, bool wait) {
+	if (!MGLFrameCapture_recycle(self)) {
+		return 0;
+	}
+
+	if (!self->num_pending) {
+		Py_RETURN_NONE;
+	}
+
+	const GLMethods & gl = self->context->gl;
+
+	int slot = (self->head - self->num_pending + self->depth) % self->depth;
+	GLsync fence = self->fences[slot];
+
+	int status = gl.ClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 0);
+
+	if (status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED) {
+		if (!wait) {
+			Py_RETURN_NONE;
+		}
+
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		gl.ClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, GL_TIMEOUT_IGNORED);
+		self->stall_time += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+		self->stalls += 1;
+	}
+
+	gl.DeleteSync(fence);
+	self->fences[slot] = 0;
+
+	char * frame = 0;
+	GLintptr offset = (GLintptr)slot * self->frame_size;
+
+	if (self->mapped) {
+		frame = self->mapped + offset;
+	} else {
+		gl.BindBuffer(GL_PIXEL_PACK_BUFFER, self->buffer_obj);
+		frame = (char *)gl.MapBufferRange(GL_PIXEL_PACK_BUFFER, offset, self->frame_size, GL_MAP_READ_BIT);
+		gl.BindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+		if (!frame) {
+			MGLError_Set("cannot map the buffer");
+			return 0;
+		}
+
+		self->frame_map = frame;
+	}
+
+	self->num_pending -= 1;
+	self->out_slot = slot;
+	self->frame = frame;
+	self->frames += 1;
+
+	return PyMemoryView_FromObject((PyObject *)self);
+}
+
+PyObject * MGLFrameCapture_read(MGLFrameCapture * self, PyObject * args) {
+	if (!MGLFrameCapture_recycle(self)) {
+		return 0;
+	}
+
+	const GLMethods & gl = self->context->gl;
+
+	int slot = self->head;
+	GLintptr offset = (GLintptr)slot * self->frame_size;
+
+	gl.BindBuffer(GL_PIXEL_PACK_BUFFER, self->buffer_obj);
+	gl.BindFramebuffer(GL_FRAMEBUFFER, self->framebuffer->framebuffer_obj);
+	gl.ReadBuffer(self->read_buffer);
+	gl.PixelStorei(GL_PACK_ALIGNMENT, self->alignment);
+	gl.PixelStorei(GL_UNPACK_ALIGNMENT, self->alignment);
+	gl.ReadPixels(self->x, self->y, self->width, self->height, self->base_format, self->pixel_type, (void *)offset);
+	gl.BindFramebuffer(GL_FRAMEBUFFER, self->context->bound_framebuffer->framebuffer_obj);
+	gl.BindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+	self->fences[slot] = gl.FenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+	self->head = (slot + 1) % self->depth;
+	self->num_pending += 1;
+
+	// The next read needs a free slot, a full ring waits for the oldest frame
+	return MGLFrameCapture_next_frame(self, self->num_pending == self->depth);
+}
+
+PyObject * MGLFrameCapture_next(MGLFrameCapture * self, PyObject * args) {
+	int wait;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"p",
+		&wait
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	return MGLFrameCapture_next_frame(self, wait ? true : false);
+}
+
+PyObject * MGLFrameCapture_release(MGLFrameCapture * self) {
+	if (!MGLFrameCapture_check_exports(self)) {
+		return 0;
+	}
+
+	MGLFrameCapture_Invalidate(self);
+	Py_RETURN_NONE;
+}
+
+PyMethodDef MGLFrameCapture_tp_methods[] = {
+	{"read", (PyCFunction)MGLFrameCapture_read, METH_NOARGS, 0},
+	{"next", (PyCFunction)MGLFrameCapture_next, METH_VARARGS, 0},
+	{"release", (PyCFunction)MGLFrameCapture_release, METH_NOARGS, 0},
+	{0},
+};
+
+PyObject * MGLFrameCapture_get_pending(MGLFrameCapture * self, void * closure) {
+	return PyLong_FromLong(self->num_pending);
+}
+
+PyObject * MGLFrameCapture_get_frames(MGLFrameCapture * self, void * closure) {
+	return PyLong_FromLongLong(self->frames);
+}
+
+PyObject * MGLFrameCapture_get_stalls(MGLFrameCapture * self, void * closure) {
+	return PyLong_FromLongLong(self->stalls);
+}
+
+PyObject * MGLFrameCapture_get_stall_time(MGLFrameCapture * self, void * closure) {
+	return PyFloat_FromDouble(self->stall_time);
+}
+
+PyGetSetDef MGLFrameCapture_tp_getseters[] = {
+	{(char *)"pending", (getter)MGLFrameCapture_get_pending, 0, 0, 0},
+	{(char *)"frames", (getter)MGLFrameCapture_get_frames, 0, 0, 0},
+	{(char *)"stalls", (getter)MGLFrameCapture_get_stalls, 0, 0, 0},
+	{(char *)"stall_time", (getter)MGLFrameCapture_get_stall_time, 0, 0, 0},
+	{0},
+};
+
+int MGLFrameCapture_tp_as_buffer_get_view(MGLFrameCapture * self, Py_buffer * view, int flags) {
+	if (!self->frame) {
+		PyErr_Format(PyExc_BufferError, "no frame is handed out");
+		view->obj = 0;
+		return -1;
+	}
+
+	if (PyBuffer_FillInfo(view, (PyObject *)self, self->frame, self->frame_size, 1, flags) < 0) {
+		return -1;
+	}
+
+	self->exports += 1;
+	return 0;
+}
+
+void MGLFrameCapture_tp_as_buffer_release_view(MGLFrameCapture * self, Py_buffer * view) {
+	self->exports -= 1;
+}
+
+PyBufferProcs MGLFrameCapture_tp_as_buffer = {
+	(getbufferproc)MGLFrameCapture_tp_as_buffer_get_view,            // getbufferproc bf_getbuffer
+	(releasebufferproc)MGLFrameCapture_tp_as_buffer_release_view,    // releasebufferproc bf_releasebuffer
+};
+
+PyTypeObject MGLFrameCapture_Type = {
+	PyVarObject_HEAD_INIT(0, 0)
+	"mgl.FrameCapture",                                     // tp_name
+	sizeof(MGLFrameCapture),                                // tp_basicsize
+	0,                                                      // tp_itemsize
+	(destructor)MGLFrameCapture_tp_dealloc,                 // tp_dealloc
+	0,                                                      // tp_print
+	0,                                                      // tp_getattr
+	0,                                                      // tp_setattr
+	0,                                                      // tp_reserved
+	0,                                                      // tp_repr
+	0,                                                      // tp_as_number
+	0,                                                      // tp_as_sequence
+	0,                                                      // tp_as_mapping
+	0,                                                      // tp_hash
+	0,                                                      // tp_call
+	0,                                                      // tp_str
+	0,                                                      // tp_getattro
+	0,                                                      // tp_setattro
+	&MGLFrameCapture_tp_as_buffer,                          // tp_as_buffer
+	Py_TPFLAGS_DEFAULT,                                     // tp_flags
+	0,                                                      // tp_doc
+	0,                                                      // tp_traverse
+	0,                                                      // tp_clear
+	0,                                                      // tp_richcompare
+	0,                                                      // tp_weaklistoffset
+	0,                                                      // tp_iter
+	0,                                                      // tp_iternext
+	MGLFrameCapture_tp_methods,                             // tp_methods
+	0,                                                      // tp_members
+	MGLFrameCapture_tp_getseters,                           // tp_getset
+	0,                                                      // tp_base
+	0,                                                      // tp_dict
+	0,                                                      // tp_descr_get
+	0,                                                      // tp_descr_set
+	0,                                                      // tp_dictoffset
+	0,                                                      // tp_init
+	0,                                                      // tp_alloc
+	MGLFrameCapture_tp_new,                                 // tp_new
+};
+
+void MGLFrameCapture_Invalidate(MGLFrameCapture * capture) {
+	if (Py_TYPE(capture) == &MGLInvalidObject_Type) {
+		return;
+	}
+
+	const GLMethods & gl = capture->context->gl;
+
+	for (int i = 0; i < capture->depth; ++i) {
+		if (capture->fences[i]) {
+			gl.DeleteSync(capture->fences[i]);
+			capture->fences[i] = 0;
+		}
+	}
+
+	if (capture->mapped || capture->frame_map) {
+		gl.BindBuffer(GL_PIXEL_PACK_BUFFER, capture->buffer_obj);
+		gl.UnmapBuffer(GL_PIXEL_PACK_BUFFER);
+		gl.BindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+		capture->mapped = 0;
+		capture->frame_map = 0;
+	}
+
+	gl.DeleteBuffers(1, (GLuint *)&capture->buffer_obj);
+	capture->num_pending = 0;
+
+	Py_SET_TYPE(capture, &MGLInvalidObject_Type);
+	Py_DECREF(capture->framebuffer);
+	Py_DECREF(capture->context);
+	Py_DECREF(capture);
+}
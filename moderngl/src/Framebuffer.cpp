@@ -1,5 +1,143 @@
 #include "Types.hpp"
 
+#include "InlineMethods.hpp"
+
+// Depth-stencil dtypes also provide the stencil buffer of the framebuffer
+inline int depth_attachment_point(MGLDataType * data_type) {
+	return data_type->base_format[1] == GL_DEPTH_STENCIL ? GL_DEPTH_STENCIL_ATTACHMENT : GL_DEPTH_ATTACHMENT;
+}
+
+// A framebuffer attachment resolved from a (object, layer, level) tuple, a negative layer attaches every layer
+struct MGLFramebufferAttachment {
+	MGLContext * context;
+	MGLDataType * data_type;
+	int object;
+	int target;
+	int width;
+	int height;
+	int samples;
+	int components;
+	int layer;
+	int level;
+	bool depth;
+};
+
+// Resolves an attachment of a Texture, Texture3D, TextureArray, TextureCube or Renderbuffer.
+// The name prefixes the error messages, the sizes are the sizes of the attached level.
+static bool resolve_attachment(PyObject * item, const char * name, MGLFramebufferAttachment & attachment) {
+	PyObject * object;
+
+	if (!PyArg_ParseTuple(item, "Oii", &object, &attachment.layer, &attachment.level)) {
+		return false;
+	}
+
+	int layers = 0;
+	int levels = 0;
+
+	attachment.samples = 0;
+	attachment.depth = false;
+	attachment.data_type = 0;
+
+	if (Py_TYPE(object) == &MGLTexture_Type) {
+		MGLTexture * texture = (MGLTexture *)object;
+		attachment.context = texture->context;
+		attachment.data_type = texture->data_type;
+		attachment.object = texture->texture_obj;
+		attachment.target = texture->samples ? GL_TEXTURE_2D_MULTISAMPLE : GL_TEXTURE_2D;
+		attachment.width = texture->width;
+		attachment.height = texture->height;
+		attachment.samples = texture->samples;
+		attachment.components = texture->components;
+		attachment.depth = texture->depth;
+		levels = texture->levels;
+	} else if (Py_TYPE(object) == &MGLTexture3D_Type) {
+		MGLTexture3D * texture = (MGLTexture3D *)object;
+		attachment.context = texture->context;
+		attachment.object = texture->texture_obj;
+		attachment.target = GL_TEXTURE_3D;
+		attachment.width = texture->width;
+		attachment.height = texture->height;
+		attachment.components = texture->components;
+		layers = max(texture->depth >> max(attachment.level, 0), 1);
+		levels = texture->levels;
+	} else if (Py_TYPE(object) == &MGLTextureArray_Type) {
+		MGLTextureArray * texture = (MGLTextureArray *)object;
+		attachment.context = texture->context;
+		attachment.object = texture->texture_obj;
+		attachment.target = GL_TEXTURE_2D_ARRAY;
+		attachment.width = texture->width;
+		attachment.height = texture->height;
+		attachment.components = texture->components;
+		layers = texture->layers;
+		levels = texture->levels;
+	} else if (Py_TYPE(object) == &MGLTextureCube_Type) {
+		MGLTextureCube * texture = (MGLTextureCube *)object;
+		attachment.context = texture->context;
+		attachment.object = texture->texture_obj;
+		attachment.target = GL_TEXTURE_CUBE_MAP;
+		attachment.width = texture->width;
+		attachment.height = texture->height;
+		attachment.components = texture->components;
+		layers = 6;
+		levels = texture->levels;
+	} else if (Py_TYPE(object) == &MGLRenderbuffer_Type) {
+		MGLRenderbuffer * renderbuffer = (MGLRenderbuffer *)object;
+		attachment.context = renderbuffer->context;
+		attachment.data_type = renderbuffer->data_type;
+		attachment.object = renderbuffer->renderbuffer_obj;
+		attachment.target = GL_RENDERBUFFER;
+		attachment.width = renderbuffer->width;
+		attachment.height = renderbuffer->height;
+		attachment.samples = renderbuffer->samples;
+		attachment.components = renderbuffer->components;
+		attachment.depth = renderbuffer->depth;
+	} else {
+		MGLError_Set("%s must be a Renderbuffer, Texture, Texture3D, TextureArray or TextureCube not %s", name, Py_TYPE(object)->tp_name);
+		return false;
+	}
+
+	if (attachment.level < 0 || (levels && attachment.level >= levels)) {
+		MGLError_Set("%s has no level %d", name, attachment.level);
+		return false;
+	}
+
+	if (attachment.level && (attachment.samples || attachment.target == GL_RENDERBUFFER)) {
+		MGLError_Set("%s has a single level", name);
+		return false;
+	}
+
+	if (attachment.layer >= 0 && !layers) {
+		MGLError_Set("%s has no layers", name);
+		return false;
+	}
+
+	if (attachment.layer >= layers) {
+		MGLError_Set("%s has no layer %d", name, attachment.layer);
+		return false;
+	}
+
+	attachment.width = max(attachment.width >> attachment.level, 1);
+	attachment.height = max(attachment.height >> attachment.level, 1);
+	return true;
+}
+
+static void attach(const GLMethods & gl, int attachment_point, const MGLFramebufferAttachment & attachment) {
+	if (attachment.target == GL_RENDERBUFFER) {
+		gl.FramebufferRenderbuffer(GL_FRAMEBUFFER, attachment_point, GL_RENDERBUFFER, attachment.object);
+	} else if (attachment.target == GL_TEXTURE_2D || attachment.target == GL_TEXTURE_2D_MULTISAMPLE) {
+		gl.FramebufferTexture2D(GL_FRAMEBUFFER, attachment_point, attachment.target, attachment.object, attachment.level);
+	} else if (attachment.layer < 0) {
+		// Layered rendering selects the layer with gl_Layer
+		gl.FramebufferTexture(GL_FRAMEBUFFER, attachment_point, attachment.object, attachment.level);
+	} else if (attachment.target == GL_TEXTURE_CUBE_MAP) {
+		gl.FramebufferTexture2D(
+			GL_FRAMEBUFFER, attachment_point, GL_TEXTURE_CUBE_MAP_POSITIVE_X + attachment.layer, attachment.object, attachment.level
+		);
+	} else {
+		gl.FramebufferTextureLayer(GL_FRAMEBUFFER, attachment_point, attachment.object, attachment.level, attachment.layer);
+	}
+}
+
 PyObject * MGLContext_framebuffer(MGLContext * self, PyObject * args) {
 	PyObject * color_attachments;
 	PyObject * depth_attachment;
@@ -31,62 +169,43 @@ PyObject * MGLContext_framebuffer(MGLContext * self, PyObject * args) {
 		return 0;
 	}
 
-	// if (!color_attachments_len) {
-	// 	MGLError_Set("the color_attachments must not be empty");
-	// 	return 0;
-	// }
-
-	for (int i = 0; i < color_attachments_len; ++i) {
-		PyObject * item = PyTuple_GET_ITEM(color_attachments, i);
+	if (color_attachments_len > 64) {
+		MGLError_Set("too many color_attachments");
+		return 0;
+	}
 
-		if (Py_TYPE(item) == &MGLTexture_Type) {
-			MGLTexture * texture = (MGLTexture *)item;
+	MGLFramebufferAttachment colors[64];
+	MGLFramebufferAttachment depth;
 
-			if (texture->depth) {
-				MGLError_Set("color_attachments[%d] is a depth attachment", i);
-				return 0;
-			}
+	char name[64];
 
-			if (i == 0) {
-				width = texture->width;
-				height = texture->height;
-				samples = texture->samples;
-			} else {
-				if (texture->width != width || texture->height != height || texture->samples != samples) {
-					MGLError_Set("the color_attachments have different sizes or samples");
-					return 0;
-				}
-			}
+	for (int i = 0; i < color_attachments_len; ++i) {
+		MGLFramebufferAttachment & attachment = colors[i];
 
-			if (texture->context != self) {
-				MGLError_Set("color_attachments[%d] belongs to a different context", i);
-				return 0;
-			}
-		} else if (Py_TYPE(item) == &MGLRenderbuffer_Type) {
-			MGLRenderbuffer * renderbuffer = (MGLRenderbuffer *)item;
+		snprintf(name, sizeof(name), "color_attachments[%d]", i);
 
-			if (renderbuffer->depth) {
-				MGLError_Set("color_attachments[%d] is a depth attachment", i);
-				return 0;
-			}
+		if (!resolve_attachment(PyTuple_GET_ITEM(color_attachments, i), name, attachment)) {
+			return 0;
+		}
 
-			if (i == 0) {
-				width = renderbuffer->width;
-				height = renderbuffer->height;
-				samples = renderbuffer->samples;
-			} else {
-				if (renderbuffer->width != width || renderbuffer->height != height || renderbuffer->samples != samples) {
-					MGLError_Set("the color_attachments have different sizes or samples");
-					return 0;
-				}
-			}
+		if (attachment.depth) {
+			MGLError_Set("color_attachments[%d] is a depth attachment", i);
+			return 0;
+		}
 
-			if (renderbuffer->context != self) {
-				MGLError_Set("color_attachments[%d] belongs to a different context", i);
+		if (i == 0) {
+			width = attachment.width;
+			height = attachment.height;
+			samples = attachment.samples;
+		} else {
+			if (attachment.width != width || attachment.height != height || attachment.samples != samples) {
+				MGLError_Set("the color_attachments have different sizes or samples");
 				return 0;
 			}
-		} else {
-			MGLError_Set("color_attachments[%d] must be a Renderbuffer or Texture not %s", i, Py_TYPE(item)->tp_name);
+		}
+
+		if (attachment.context != self) {
+			MGLError_Set("color_attachments[%d] belongs to a different context", i);
 			return 0;
 		}
 	}
@@ -94,58 +213,30 @@ PyObject * MGLContext_framebuffer(MGLContext * self, PyObject * args) {
 	const GLMethods & gl = self->gl;
 
 	if (depth_attachment != Py_None) {
+		if (!resolve_attachment(depth_attachment, "the depth_attachment", depth)) {
+			return 0;
+		}
 
-		if (Py_TYPE(depth_attachment) == &MGLTexture_Type) {
-			MGLTexture * texture = (MGLTexture *)depth_attachment;
-
-			if (!texture->depth) {
-				MGLError_Set("the depth_attachment is a color attachment");
-				return 0;
-			}
-
-			if (texture->context != self) {
-				MGLError_Set("the depth_attachment belongs to a different context");
-				return 0;
-			}
-
-			if (color_attachments_len) {
-				if (texture->width != width || texture->height != height || texture->samples != samples) {
-					MGLError_Set("the depth_attachment have different sizes or samples");
-					return 0;
-				}
-			}
-			else {
-				width = texture->width;
-				height = texture->height;
-				samples = texture->samples;
-			}
-		} else if (Py_TYPE(depth_attachment) == &MGLRenderbuffer_Type) {
-			MGLRenderbuffer * renderbuffer = (MGLRenderbuffer *)depth_attachment;
+		if (!depth.depth) {
+			MGLError_Set("the depth_attachment is a color attachment");
+			return 0;
+		}
 
-			if (!renderbuffer->depth) {
-				MGLError_Set("the depth_attachment is a color attachment");
-				return 0;
-			}
+		if (depth.context != self) {
+			MGLError_Set("the depth_attachment belongs to a different context");
+			return 0;
+		}
 
-			if (renderbuffer->context != self) {
-				MGLError_Set("the depth_attachment belongs to a different context");
+		if (color_attachments_len) {
+			if (depth.width != width || depth.height != height || depth.samples != samples) {
+				MGLError_Set("the depth_attachment have different sizes or samples");
 				return 0;
 			}
-
-			if (color_attachments_len) {
-				if (renderbuffer->width != width || renderbuffer->height != height || renderbuffer->samples != samples) {
-					MGLError_Set("the depth_attachment have different sizes or samples");
-					return 0;
-				}
-			}
-			else {
-				width = renderbuffer->width;
-				height = renderbuffer->height;
-				samples = renderbuffer->samples;
-			}
-		} else {
-			MGLError_Set("the depth_attachment must be a Renderbuffer or Texture not %s", Py_TYPE(depth_attachment)->tp_name);
-			return 0;
+		}
+		else {
+			width = depth.width;
+			height = depth.height;
+			samples = depth.samples;
 		}
 	}
 
@@ -167,53 +258,11 @@ PyObject * MGLContext_framebuffer(MGLContext * self, PyObject * args) {
 	}
 
 	for (int i = 0; i < color_attachments_len; ++i) {
-		PyObject * item = PyTuple_GET_ITEM(color_attachments, i);
-
-		if (Py_TYPE(item) == &MGLTexture_Type) {
-
-			MGLTexture * texture = (MGLTexture *)item;
-
-			gl.FramebufferTexture2D(
-				GL_FRAMEBUFFER,
-				GL_COLOR_ATTACHMENT0 + i,
-				texture->samples ? GL_TEXTURE_2D_MULTISAMPLE : GL_TEXTURE_2D,
-				texture->texture_obj,
-				0
-			);
-
-		} else if (Py_TYPE(item) == &MGLRenderbuffer_Type) {
-
-			MGLRenderbuffer * renderbuffer = (MGLRenderbuffer *)item;
-
-			gl.FramebufferRenderbuffer(
-				GL_FRAMEBUFFER,
-				GL_COLOR_ATTACHMENT0 + i,
-				GL_RENDERBUFFER,
-				renderbuffer->renderbuffer_obj
-			);
-		}
+		attach(gl, GL_COLOR_ATTACHMENT0 + i, colors[i]);
 	}
 
-	if (Py_TYPE(depth_attachment) == &MGLTexture_Type) {
-		MGLTexture * texture = (MGLTexture *)depth_attachment;
-
-		gl.FramebufferTexture2D(
-			GL_FRAMEBUFFER,
-			GL_DEPTH_ATTACHMENT,
-			texture->samples ? GL_TEXTURE_2D_MULTISAMPLE : GL_TEXTURE_2D,
-			texture->texture_obj,
-			0
-		);
-
-	} else if (Py_TYPE(depth_attachment) == &MGLRenderbuffer_Type) {
-		MGLRenderbuffer * renderbuffer = (MGLRenderbuffer *)depth_attachment;
-
-		gl.FramebufferRenderbuffer(
-			GL_FRAMEBUFFER,
-			GL_DEPTH_ATTACHMENT,
-			GL_RENDERBUFFER,
-			renderbuffer->renderbuffer_obj
-		);
+	if (depth_attachment != Py_None) {
+		attach(gl, depth_attachment_point(depth.data_type), depth);
 	}
 
 	int status = gl.CheckFramebufferStatus(GL_FRAMEBUFFER);
@@ -271,20 +320,10 @@ PyObject * MGLContext_framebuffer(MGLContext * self, PyObject * args) {
 	framebuffer->color_mask = new bool[color_attachments_len * 4 + 1];
 
 	for (int i = 0; i < color_attachments_len; ++i) {
-		PyObject * item = PyTuple_GET_ITEM(color_attachments, i);
-		if (Py_TYPE(item) == &MGLTexture_Type) {
-			MGLTexture * texture = (MGLTexture *)item;
-			framebuffer->color_mask[i * 4 + 0] = texture->components >= 1;
-			framebuffer->color_mask[i * 4 + 1] = texture->components >= 2;
-			framebuffer->color_mask[i * 4 + 2] = texture->components >= 3;
-			framebuffer->color_mask[i * 4 + 3] = texture->components >= 4;
-		} else if (Py_TYPE(item) == &MGLRenderbuffer_Type) {
-			MGLTexture * renderbuffer = (MGLTexture *)item;
-			framebuffer->color_mask[i * 4 + 0] = renderbuffer->components >= 1;
-			framebuffer->color_mask[i * 4 + 1] = renderbuffer->components >= 2;
-			framebuffer->color_mask[i * 4 + 2] = renderbuffer->components >= 3;
-			framebuffer->color_mask[i * 4 + 3] = renderbuffer->components >= 4;
-		}
+		framebuffer->color_mask[i * 4 + 0] = colors[i].components >= 1;
+		framebuffer->color_mask[i * 4 + 1] = colors[i].components >= 2;
+		framebuffer->color_mask[i * 4 + 2] = colors[i].components >= 3;
+		framebuffer->color_mask[i * 4 + 3] = colors[i].components >= 4;
 	}
 
 	framebuffer->depth_mask = (depth_attachment != Py_None);
@@ -537,6 +576,11 @@ PyObject * MGLFramebuffer_read(MGLFramebuffer * self, PyObject * args) {
 		return 0;
 	}
 
+	if (data_type->block_size) {
+		MGLError_Set("compressed dtypes are only supported by textures");
+		return 0;
+	}
+
 	int x = 0;
 	int y = 0;
 	int width = self->width;
@@ -581,7 +625,12 @@ PyObject * MGLFramebuffer_read(MGLFramebuffer * self, PyObject * args) {
 		read_depth = true;
 	}
 
-	int expected_size = width * components * data_type->size;
+	if (data_type->packed_size && !data_type->base_format[components]) {
+		MGLError_Set("the %s dtype does not support %d components", dtype, components);
+		return 0;
+	}
+
+	int expected_size = width * pixel_size(data_type, components);
 	expected_size = (expected_size + alignment - 1) / alignment * alignment;
 	expected_size = expected_size * height;
 
@@ -620,18 +669,23 @@ PyObject * MGLFramebuffer_read_into(MGLFramebuffer * self, PyObject * args) {
 	int components;
 	int attachment;
 	int alignment;
+	MGLPixelStore store;
 	const char * dtype;
 	Py_ssize_t dtype_size;
 	Py_ssize_t write_offset;
 
 	int args_ok = PyArg_ParseTuple(
 		args,
-		"OOIIIs#n",
+		"OOIII(iiii)s#n",
 		&data,
 		&viewport,
 		&components,
 		&attachment,
 		&alignment,
+		&store.row_length,
+		&store.skip_pixels,
+		&store.skip_rows,
+		&store.image_height,
 		&dtype,
 		&dtype_size,
 		&write_offset
@@ -646,6 +700,11 @@ PyObject * MGLFramebuffer_read_into(MGLFramebuffer * self, PyObject * args) {
 		return 0;
 	}
 
+	if (!pixel_store_ok(store)) {
+		MGLError_Set("the pixel store parameters must not be negative");
+		return 0;
+	}
+
 	MGLDataType * data_type = from_dtype(dtype, dtype_size);
 
 	if (!data_type) {
@@ -653,6 +712,11 @@ PyObject * MGLFramebuffer_read_into(MGLFramebuffer * self, PyObject * args) {
 		return 0;
 	}
 
+	if (data_type->block_size) {
+		MGLError_Set("compressed dtypes are only supported by textures");
+		return 0;
+	}
+
 	int x = 0;
 	int y = 0;
 	int width = self->width;
@@ -697,10 +761,19 @@ PyObject * MGLFramebuffer_read_into(MGLFramebuffer * self, PyObject * args) {
 		read_depth = true;
 	}
 
-	int expected_size = width * components * data_type->size;
+	if (data_type->packed_size && !data_type->base_format[components]) {
+		MGLError_Set("the %s dtype does not support %d components", dtype, components);
+		return 0;
+	}
+
+	Py_ssize_t expected_size = (Py_ssize_t)width * pixel_size(data_type, components);
 	expected_size = (expected_size + alignment - 1) / alignment * alignment;
 	expected_size = expected_size * height;
 
+	if (!pixel_store_default(store)) {
+		expected_size = pixel_store_size(store, width, height, 1, pixel_size(data_type, components), alignment);
+	}
+
 	int pixel_type = data_type->gl_type;
 	int base_format = read_depth ? GL_DEPTH_COMPONENT : data_type->base_format[components];
 
@@ -715,7 +788,9 @@ PyObject * MGLFramebuffer_read_into(MGLFramebuffer * self, PyObject * args) {
 		gl.ReadBuffer(read_depth ? GL_NONE : (GL_COLOR_ATTACHMENT0 + attachment));
 		gl.PixelStorei(GL_PACK_ALIGNMENT, alignment);
 		gl.PixelStorei(GL_UNPACK_ALIGNMENT, alignment);
+		set_pixel_store(gl, true, store);
 		gl.ReadPixels(x, y, width, height, base_format, pixel_type, (void *)write_offset);
+		reset_pixel_store(gl, true, store);
 		gl.BindFramebuffer(GL_FRAMEBUFFER, self->context->bound_framebuffer->framebuffer_obj);
 		gl.BindBuffer(GL_PIXEL_PACK_BUFFER, 0);
 
@@ -743,20 +818,25 @@ PyObject * MGLFramebuffer_read_into(MGLFramebuffer * self, PyObject * args) {
 		gl.ReadBuffer(read_depth ? GL_NONE : (GL_COLOR_ATTACHMENT0 + attachment));
 		gl.PixelStorei(GL_PACK_ALIGNMENT, alignment);
 		gl.PixelStorei(GL_UNPACK_ALIGNMENT, alignment);
+		set_pixel_store(gl, true, store);
 		gl.ReadPixels(x, y, width, height, base_format, pixel_type, ptr);
+		reset_pixel_store(gl, true, store);
 		gl.BindFramebuffer(GL_FRAMEBUFFER, self->context->bound_framebuffer->framebuffer_obj);
 
 		PyBuffer_Release(&buffer_view);
 	}
 
-	return PyLong_FromLong(expected_size);
+	return PyLong_FromSsize_t(expected_size);
 }
 
+PyObject * MGLFramebuffer_frame_capture(MGLFramebuffer * self, PyObject * args);
+
 PyMethodDef MGLFramebuffer_tp_methods[] = {
 	{"clear", (PyCFunction)MGLFramebuffer_clear, METH_VARARGS, 0},
 	{"use", (PyCFunction)MGLFramebuffer_use, METH_NOARGS, 0},
 	{"read", (PyCFunction)MGLFramebuffer_read, METH_VARARGS, 0},
 	{"read_into", (PyCFunction)MGLFramebuffer_read_into, METH_VARARGS, 0},
+	{"frame_capture", (PyCFunction)MGLFramebuffer_frame_capture, METH_VARARGS, 0},
 	{"release", (PyCFunction)MGLFramebuffer_release, METH_NOARGS, 0},
 	{0},
 };
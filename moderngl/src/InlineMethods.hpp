@@ -7,6 +7,427 @@
 #define min(a,b) (((a) < (b)) ? (a) : (b))
 #endif
 
+// Binds the program unless it is already bound.
+// Subroutine uniforms are reset by every UseProgram so the cached subroutine state is dropped too.
+inline void MGLContext_use_program(MGLContext * ctx, int program_obj) {
+	if (ctx->bound_program == program_obj) {
+		return;
+	}
+
+	ctx->gl.UseProgram(program_obj);
+	ctx->bound_program = program_obj;
+	ctx->num_bound_subroutines = -1;
+}
+
+// Forgets the bound program, the next draw or dispatch calls UseProgram again.
+inline void MGLContext_reset_program_state(MGLContext * ctx) {
+	ctx->bound_program = 0;
+	ctx->num_bound_subroutines = -1;
+}
+
+// Resolves the level count of a new texture. Zero keeps the mutable storage and -1 is a full mipmap chain.
+inline bool MGLContext_texture_levels(MGLContext * ctx, int & levels, int width, int height, int depth) {
+	if (!levels) {
+		return true;
+	}
+
+	if (ctx->version_code < 420) {
+		MGLError_Set("immutable textures require OpenGL 4.2");
+		return false;
+	}
+
+	int full_levels = 1;
+	for (int size = max(max(width, height), depth); size > 1; size >>= 1) {
+		full_levels += 1;
+	}
+
+	if (levels < 0) {
+		levels = full_levels;
+	}
+
+	if (levels > full_levels) {
+		MGLError_Set("the number of levels must be between 1 and %d", full_levels);
+		return false;
+	}
+
+	return true;
+}
+
+// Size in bytes of an uncompressed pixel, packed dtypes store every component in a single value
+inline int pixel_size(const MGLDataType * data_type, int components) {
+	return data_type->packed_size ? data_type->packed_size : data_type->size * components;
+}
+
+// Size in bytes of a compressed image, the alignment does not apply to compressed dtypes
+inline int compressed_image_size(const MGLDataType * data_type, int components, int width, int height) {
+	return (width + 3) / 4 * ((height + 3) / 4) * data_type->block_size[components];
+}
+
+// Size in bytes of the levels of a texture. Array layers and cube faces are passed as the depth,
+// only the depth of volumes shrinks with the levels. Levels past the 1x1 level are not allocated.
+inline long long texture_memory(
+	const MGLDataType * data_type, int components, int width, int height, int depth, bool volume, int levels, int samples
+) {
+	int chain = 1;
+	for (int size = max(max(width, height), volume ? depth : 1); size > 1; size >>= 1) {
+		chain += 1;
+	}
+	levels = min(levels, chain);
+
+	long long total = 0;
+	for (int level = 0; level < levels; ++level) {
+		int level_width = max(width >> level, 1);
+		int level_height = max(height >> level, 1);
+		int level_depth = volume ? max(depth >> level, 1) : depth;
+		long long image_size = data_type->block_size
+			? compressed_image_size(data_type, components, level_width, level_height)
+			: (long long)level_width * level_height * pixel_size(data_type, components);
+		total += image_size * level_depth;
+	}
+	return total * max(samples, 1);
+}
+
+// Moves the bytes accounted for an object to its current size, the peaks only grow
+inline void MGLContext_track_memory(MGLContext * ctx, int kind, long long & tracked, long long size) {
+	ctx->memory[kind] += size - tracked;
+	ctx->memory_peak[kind] = max(ctx->memory_peak[kind], ctx->memory[kind]);
+	tracked = size;
+
+	long long total = 0;
+	for (int i = 0; i < MGL_MEMORY_KINDS; ++i) {
+		total += ctx->memory[i];
+	}
+	ctx->memory_total_peak = max(ctx->memory_total_peak, total);
+}
+
+inline void MGLContext_track_object(MGLContext * ctx, int kind, long long & tracked, long long size) {
+	ctx->memory_objects[kind] += 1;
+	tracked = 0;
+	MGLContext_track_memory(ctx, kind, tracked, size);
+}
+
+inline void MGLContext_untrack_object(MGLContext * ctx, int kind, long long & tracked) {
+	ctx->memory_objects[kind] -= 1;
+	MGLContext_track_memory(ctx, kind, tracked, 0);
+}
+
+// Mutable textures hold the levels up to max_level, build_mipmaps moves it to the last level
+inline long long MGLTexture_memory(MGLTexture * texture) {
+	int levels = texture->levels ? texture->levels : texture->max_level + 1;
+	return texture_memory(
+		texture->data_type, texture->components, texture->width, texture->height, 1, false, levels, texture->samples
+	);
+}
+
+inline long long MGLTexture3D_memory(MGLTexture3D * texture) {
+	int levels = texture->levels ? texture->levels : texture->max_level + 1;
+	return texture_memory(
+		texture->data_type, texture->components, texture->width, texture->height, texture->depth, true, levels, 1
+	);
+}
+
+inline long long MGLTextureArray_memory(MGLTextureArray * texture) {
+	int levels = texture->levels ? texture->levels : texture->max_level + 1;
+	return texture_memory(
+		texture->data_type, texture->components, texture->width, texture->height, texture->layers, false, levels, 1
+	);
+}
+
+inline long long MGLTextureCube_memory(MGLTextureCube * texture) {
+	int levels = texture->levels ? texture->levels : texture->max_level + 1;
+	return texture_memory(
+		texture->data_type, texture->components, texture->width, texture->height, 6, false, levels, 1
+	);
+}
+
+// Compressed images are written in whole 4x4 blocks, only the last block of a row or column can be partial
+inline bool compressed_viewport_ok(int x, int y, int width, int height, int level_width, int level_height) {
+	if ((x & 3) || (y & 3)) {
+		return false;
+	}
+
+	return ((width & 3) == 0 || x + width == level_width) && ((height & 3) == 0 || y + height == level_height);
+}
+
+// Parses a viewport of 2 or 3 sizes optionally preceded by as many offsets, None keeps the defaults
+inline bool parse_texture_viewport(PyObject * viewport, int dims, int * offset, int * size) {
+	if (viewport == Py_None) {
+		return true;
+	}
+
+	if (Py_TYPE(viewport) != &PyTuple_Type) {
+		MGLError_Set("the viewport must be a tuple not %s", Py_TYPE(viewport)->tp_name);
+		return false;
+	}
+
+	int num_values = (int)PyTuple_GET_SIZE(viewport);
+
+	if (num_values != dims && num_values != dims * 2) {
+		MGLError_Set("the viewport size %d is invalid", num_values);
+		return false;
+	}
+
+	int first_size = num_values - dims;
+
+	for (int i = 0; i < dims; ++i) {
+		if (first_size) {
+			offset[i] = PyLong_AsLong(PyTuple_GET_ITEM(viewport, i));
+		}
+		size[i] = PyLong_AsLong(PyTuple_GET_ITEM(viewport, first_size + i));
+	}
+
+	if (PyErr_Occurred()) {
+		MGLError_Set("wrong values in the viewport");
+		return false;
+	}
+
+	return true;
+}
+
+inline bool texture_viewport_ok(int dims, const int * offset, const int * size, const int * level_size) {
+	for (int i = 0; i < dims; ++i) {
+		if (offset[i] < 0 || size[i] < 1 || offset[i] + size[i] > level_size[i]) {
+			return false;
+		}
+	}
+	return true;
+}
+
+// Reads a whole texture level with glGetTexImage or a region of it with glGetTextureSubImage.
+// The texture must be bound for whole levels, the image target selects the cube map face.
+inline bool MGLContext_read_texture(
+	MGLContext * ctx, int texture_obj, int image_target, int level, bool region,
+	const int * offset, const int * size, const MGLDataType * data_type, int format, int image_size, void * pixels
+) {
+	const GLMethods & gl = ctx->gl;
+
+	if (!region) {
+		if (data_type->block_size) {
+			gl.GetCompressedTexImage(image_target, level, pixels);
+		} else {
+			gl.GetTexImage(image_target, level, format, data_type->gl_type, pixels);
+		}
+		return true;
+	}
+
+	if (ctx->version_code < 450) {
+		MGLError_Set("reading a viewport requires OpenGL 4.5");
+		return false;
+	}
+
+	if (data_type->block_size) {
+		gl.GetCompressedTextureSubImage(
+			texture_obj, level, offset[0], offset[1], offset[2], size[0], size[1], size[2], image_size, pixels
+		);
+	} else {
+		gl.GetTextureSubImage(
+			texture_obj, level, offset[0], offset[1], offset[2], size[0], size[1], size[2],
+			format, data_type->gl_type, image_size, pixels
+		);
+	}
+	return true;
+}
+
+// Clears a whole texture level with glClearTexImage or a region of it with glClearTexSubImage.
+// Integer textures take integer values, the other ones take floats converted by the driver.
+// A single number is used for every component.
+inline bool MGLContext_clear_texture(
+	MGLContext * ctx, int texture_obj, const MGLDataType * data_type, int components, bool depth,
+	PyObject * value, int level, bool region, const int * offset, const int * size
+) {
+	if (ctx->version_code < 440) {
+		MGLError_Set("clearing a texture requires OpenGL 4.4");
+		return false;
+	}
+
+	if (data_type->block_size) {
+		MGLError_Set("compressed textures cannot be cleared");
+		return false;
+	}
+
+	if (depth) {
+		components = 1;
+	}
+
+	bool integer = data_type->base_format[1] == GL_RED_INTEGER;
+	bool is_signed = data_type->gl_type == GL_BYTE || data_type->gl_type == GL_SHORT || data_type->gl_type == GL_INT;
+
+	union {
+		float f;
+		int i;
+		unsigned u;
+	} pixel[4] = {};
+
+	PyObject * values = PySequence_Check(value) ? PySequence_Tuple(value) : PyTuple_Pack(1, value);
+
+	if (!values) {
+		MGLError_Set("the value must be a number or a sequence of numbers");
+		return false;
+	}
+
+	int num_values = (int)PyTuple_GET_SIZE(values);
+
+	if (num_values != 1 && num_values != components) {
+		MGLError_Set("the value must have 1 or %d components not %d", components, num_values);
+		Py_DECREF(values);
+		return false;
+	}
+
+	for (int i = 0; i < components; ++i) {
+		PyObject * item = PyTuple_GET_ITEM(values, num_values == 1 ? 0 : i);
+		if (!integer) {
+			pixel[i].f = (float)PyFloat_AsDouble(item);
+		} else if (is_signed) {
+			pixel[i].i = PyLong_AsLong(item);
+		} else {
+			pixel[i].u = PyLong_AsUnsignedLong(item);
+		}
+	}
+
+	Py_DECREF(values);
+
+	if (PyErr_Occurred()) {
+		MGLError_Set("invalid clear value");
+		return false;
+	}
+
+	int format = data_type->base_format[components];
+	int type = !integer ? GL_FLOAT : is_signed ? GL_INT : GL_UNSIGNED_INT;
+
+	// The stencil of a depth-stencil texture is cleared to zero
+	if (format == GL_DEPTH_STENCIL) {
+		type = GL_FLOAT_32_UNSIGNED_INT_24_8_REV;
+	}
+
+	const GLMethods & gl = ctx->gl;
+
+	if (region) {
+		gl.ClearTexSubImage(texture_obj, level, offset[0], offset[1], offset[2], size[0], size[1], size[2], format, type, pixel);
+	} else {
+		gl.ClearTexImage(texture_obj, level, format, type, pixel);
+	}
+
+	return true;
+}
+
+inline bool pixel_store_ok(const MGLPixelStore & store) {
+	return store.row_length >= 0 && store.skip_pixels >= 0 && store.skip_rows >= 0 && store.image_height >= 0;
+}
+
+inline bool pixel_store_default(const MGLPixelStore & store) {
+	return !store.row_length && !store.skip_pixels && !store.skip_rows && !store.image_height;
+}
+
+// The number of bytes from the start of the client memory to the end of the last pixel transferred
+inline Py_ssize_t pixel_store_size(const MGLPixelStore & store, int width, int height, int depth, int pixel_size, int alignment) {
+	Py_ssize_t row_size = (Py_ssize_t)(store.row_length ? store.row_length : width) * pixel_size;
+	row_size = (row_size + alignment - 1) / alignment * alignment;
+	Py_ssize_t image_rows = store.image_height ? store.image_height : height;
+	return row_size * (store.skip_rows + image_rows * (depth - 1) + height - 1) + ((Py_ssize_t)store.skip_pixels + width) * pixel_size;
+}
+
+inline void set_pixel_store(const GLMethods & gl, bool pack, const MGLPixelStore & store) {
+	if (pixel_store_default(store)) {
+		return;
+	}
+
+	gl.PixelStorei(pack ? GL_PACK_ROW_LENGTH : GL_UNPACK_ROW_LENGTH, store.row_length);
+	gl.PixelStorei(pack ? GL_PACK_SKIP_PIXELS : GL_UNPACK_SKIP_PIXELS, store.skip_pixels);
+	gl.PixelStorei(pack ? GL_PACK_SKIP_ROWS : GL_UNPACK_SKIP_ROWS, store.skip_rows);
+	gl.PixelStorei(pack ? GL_PACK_IMAGE_HEIGHT : GL_UNPACK_IMAGE_HEIGHT, store.image_height);
+}
+
+// Every other transfer expects the default parameters
+inline void reset_pixel_store(const GLMethods & gl, bool pack, const MGLPixelStore & store) {
+	if (pixel_store_default(store)) {
+		return;
+	}
+
+	gl.PixelStorei(pack ? GL_PACK_ROW_LENGTH : GL_UNPACK_ROW_LENGTH, 0);
+	gl.PixelStorei(pack ? GL_PACK_SKIP_PIXELS : GL_UNPACK_SKIP_PIXELS, 0);
+	gl.PixelStorei(pack ? GL_PACK_SKIP_ROWS : GL_UNPACK_SKIP_ROWS, 0);
+	gl.PixelStorei(pack ? GL_PACK_IMAGE_HEIGHT : GL_UNPACK_IMAGE_HEIGHT, 0);
+}
+
+// Parses the (first, count) level or layer range of a texture view, None selects all of them
+inline bool parse_view_range(PyObject * value, int total, const char * name, int & first, int & count) {
+	first = 0;
+	count = total;
+
+	if (value == Py_None) {
+		return true;
+	}
+
+	PyObject * range = PySequence_Check(value) ? PySequence_Tuple(value) : 0;
+
+	if (!range || PyTuple_GET_SIZE(range) != 2) {
+		MGLError_Set("the %s must be a tuple of the first one and the count", name);
+		Py_XDECREF(range);
+		return false;
+	}
+
+	first = PyLong_AsLong(PyTuple_GET_ITEM(range, 0));
+	count = PyLong_AsLong(PyTuple_GET_ITEM(range, 1));
+	Py_DECREF(range);
+
+	if (PyErr_Occurred()) {
+		MGLError_Set("the %s must be a tuple of the first one and the count", name);
+		return false;
+	}
+
+	if (first < 0 || count < 1 || first + count > total) {
+		MGLError_Set("the %s (%d, %d) are out of range", name, first, count);
+		return false;
+	}
+
+	return true;
+}
+
+// Resolves the dtype of a texture view. glTextureView only reinterprets formats of the same size,
+// compressed and depth textures can only be viewed with their own dtype.
+inline MGLDataType * texture_view_dtype(
+	MGLContext * ctx,
+	int levels,
+	MGLDataType * parent_type,
+	int parent_components,
+	bool depth,
+	const char * dtype,
+	Py_ssize_t dtype_size,
+	int components
+) {
+	if (ctx->version_code < 430) {
+		MGLError_Set("texture views require OpenGL 4.3");
+		return 0;
+	}
+
+	if (!levels) {
+		MGLError_Set("texture views require immutable storage");
+		return 0;
+	}
+
+	MGLDataType * data_type = depth ? from_depth_dtype(dtype, dtype_size) : from_dtype(dtype, dtype_size);
+
+	if (!data_type) {
+		MGLError_Set("invalid dtype");
+		return 0;
+	}
+
+	if (components < 1 || components > 4 || !data_type->internal_format[components]) {
+		MGLError_Set("the %s dtype does not support %d components", dtype, components);
+		return 0;
+	}
+
+	bool same_format = data_type == parent_type && components == parent_components;
+	bool plain = !depth && !data_type->block_size && !parent_type->block_size;
+
+	if (!same_format && !(plain && pixel_size(data_type, components) == pixel_size(parent_type, parent_components))) {
+		MGLError_Set("the %s dtype with %d components cannot view the texture format", dtype, components);
+		return 0;
+	}
+
+	return data_type;
+}
+
 inline void clean_glsl_name(char * name, int & name_len) {
 	if (name_len && name[name_len - 1] == ']') {
 		name_len -= 1;
@@ -17,6 +438,32 @@ inline void clean_glsl_name(char * name, int & name_len) {
 	name[name_len] = 0;
 }
 
+// Returns 'f', 'i' or 'u' for single item float, signed or unsigned buffer formats
+inline char buffer_format_kind(const Py_buffer & view) {
+	const char * format = view.format ? view.format : "B";
+
+	if (format[0] == '@' || format[0] == '=' || format[0] == '<' || format[0] == '>' || format[0] == '!') {
+		format += 1;
+	}
+
+	if (!format[0] || format[1]) {
+		return 0;
+	}
+
+	switch (format[0]) {
+		case 'f': case 'd':
+			return 'f';
+
+		case 'b': case 'h': case 'i': case 'l': case 'q': case 'n':
+			return 'i';
+
+		case 'B': case 'H': case 'I': case 'L': case 'Q': case 'N': case 'c': case '?':
+			return 'u';
+	}
+
+	return 0;
+}
+
 inline int swizzle_from_char(char c) {
 	switch (c) {
 		case 'R':
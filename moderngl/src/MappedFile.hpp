@@ -0,0 +1,21 @@
+#pragma once
+
+#include <cstddef>
+
+#ifdef _WIN32
+#define NOMINMAX
+#include <windows.h>
+#endif
+
+// A read-only memory mapping of a whole file, the pages are read from the disk on first access
+struct MGLMappedFile {
+	const unsigned char * data;
+	size_t size;
+#ifdef _WIN32
+	HANDLE file;
+	HANDLE mapping;
+#endif
+};
+
+bool MGLMappedFile_Open(MGLMappedFile & mapped, const char * path);
+void MGLMappedFile_Close(MGLMappedFile & mapped);
@@ -0,0 +1,523 @@
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <thread>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define MGL_SSE2
+#endif
+
+#include "Types.hpp"
+
+// Builds mipmap chains on the CPU for the formats glGenerateMipmap does not filter.
+// Every level is reduced from the previous one by separable taps. A vertical pass accumulates the
+// source rows of a destination row, a horizontal pass combines the columns of the accumulated row.
+// Odd sizes widen the footprint of the last texel, so the min and max methods stay conservative.
+// The rows of a level are split between threads, the vertical pass uses SSE2 for f1 and float pixels.
+
+enum MGLMipmapMethod {
+	MIPMAP_BOX,
+	MIPMAP_MIN,
+	MIPMAP_MAX,
+	MIPMAP_KAISER,
+};
+
+struct MGLMipmapTap {
+	int index;
+	float weight;
+};
+
+// The taps of destination texel i are taps[first[i]] to taps[first[i + 1] - 1]
+struct MGLMipmapAxis {
+	std::vector<int> first;
+	std::vector<MGLMipmapTap> taps;
+};
+
+struct MGLMipmapLevel {
+	const char * src;
+	char * dst;
+
+	int src_width;
+	int src_height;
+	int src_depth;
+
+	int dst_width;
+	int dst_height;
+	int dst_depth;
+
+	int components;
+	MGLMipmapMethod method;
+
+	MGLMipmapAxis x;
+	MGLMipmapAxis y;
+	MGLMipmapAxis z;
+};
+
+// The modified Bessel function of the first kind
+static double bessel_i0(double x) {
+	double sum = 1.0;
+	double term = 1.0;
+	for (int k = 1; k < 32; ++k) {
+		term *= (x * 0.5 / k) * (x * 0.5 / k);
+		sum += term;
+	}
+	return sum;
+}
+
+// A Kaiser windowed sinc with two lobes at the destination rate, beta = 4
+static float kaiser_weight(double distance) {
+	const double beta = 4.0;
+	const double pi = 3.14159265358979323846;
+	double u = distance / 2.0;
+	if (u <= -1.0 || u >= 1.0) {
+		return 0.0f;
+	}
+	double sinc = distance == 0.0 ? 1.0 : sin(pi * distance) / (pi * distance);
+	return (float)(sinc * bessel_i0(beta * sqrt(1.0 - u * u)) / bessel_i0(beta));
+}
+
+static void mipmap_axis(MGLMipmapAxis & axis, int src, int dst, MGLMipmapMethod method) {
+	axis.first.clear();
+	axis.taps.clear();
+
+	for (int i = 0; i < dst; ++i) {
+		axis.first.push_back((int)axis.taps.size());
+
+		if (src == dst) {
+			axis.taps.push_back({i, 1.0f});
+			continue;
+		}
+
+		if (method == MIPMAP_KAISER) {
+			double scale = (double)src / dst;
+			double center = (i + 0.5) * scale;
+			int begin = (int)floor(center - 2.0 * scale);
+			int end = (int)ceil(center + 2.0 * scale);
+			int first = (int)axis.taps.size();
+			float total = 0.0f;
+			for (int j = begin; j <= end; ++j) {
+				float weight = kaiser_weight((j + 0.5 - center) / scale);
+				if (weight == 0.0f) {
+					continue;
+				}
+				int index = j < 0 ? 0 : (j < src ? j : src - 1);
+				axis.taps.push_back({index, weight});
+				total += weight;
+			}
+			for (int j = first; j < (int)axis.taps.size(); ++j) {
+				axis.taps[j].weight /= total;
+			}
+			continue;
+		}
+
+		int begin = i * 2;
+		int end = i == dst - 1 ? src : begin + 2;
+		for (int j = begin; j < end; ++j) {
+			axis.taps.push_back({j, 1.0f / (end - begin)});
+		}
+	}
+
+	axis.first.push_back((int)axis.taps.size());
+}
+
+template <typename T>
+struct MGLMipmapAccumulator {
+	typedef double type;
+};
+
+template <>
+struct MGLMipmapAccumulator<float> {
+	typedef float type;
+};
+
+template <>
+struct MGLMipmapAccumulator<unsigned char> {
+	typedef float type;
+};
+
+template <typename T, typename A>
+static void accumulate_row(A * acc, const T * row, int count, float weight, MGLMipmapMethod method, bool first) {
+	for (int i = 0; i < count; ++i) {
+		A value = (A)row[i];
+		switch (method) {
+			case MIPMAP_MIN:
+				acc[i] = first || value < acc[i] ? value : acc[i];
+				break;
+
+			case MIPMAP_MAX:
+				acc[i] = first || value > acc[i] ? value : acc[i];
+				break;
+
+			default:
+				acc[i] = first ? value * weight : acc[i] + value * weight;
+				break;
+		}
+	}
+}
+
+#ifdef MGL_SSE2
+
+static inline __m128 sse_accumulate(__m128 acc, __m128 value, __m128 weight, MGLMipmapMethod method, bool first) {
+	switch (method) {
+		case MIPMAP_MIN:
+			return first ? value : _mm_min_ps(value, acc);
+
+		case MIPMAP_MAX:
+			return first ? value : _mm_max_ps(value, acc);
+
+		default:
+			return first ? _mm_mul_ps(value, weight) : _mm_add_ps(acc, _mm_mul_ps(value, weight));
+	}
+}
+
+template <>
+void accumulate_row<float, float>(float * acc, const float * row, int count, float weight, MGLMipmapMethod method, bool first) {
+	const __m128 sse_weight = _mm_set1_ps(weight);
+	int i = 0;
+	for (; i + 4 <= count; i += 4) {
+		__m128 value = _mm_loadu_ps(row + i);
+		_mm_storeu_ps(acc + i, sse_accumulate(_mm_loadu_ps(acc + i), value, sse_weight, method, first));
+	}
+	for (; i < count; ++i) {
+		float value = row[i];
+		switch (method) {
+			case MIPMAP_MIN:
+				acc[i] = first || value < acc[i] ? value : acc[i];
+				break;
+
+			case MIPMAP_MAX:
+				acc[i] = first || value > acc[i] ? value : acc[i];
+				break;
+
+			default:
+				acc[i] = first ? value * weight : acc[i] + value * weight;
+				break;
+		}
+	}
+}
+
+template <>
+void accumulate_row<unsigned char, float>(float * acc, const unsigned char * row, int count, float weight, MGLMipmapMethod method, bool first) {
+	const __m128 sse_weight = _mm_set1_ps(weight);
+	const __m128i zero = _mm_setzero_si128();
+	int i = 0;
+	for (; i + 16 <= count; i += 16) {
+		__m128i value = _mm_loadu_si128((const __m128i *)(row + i));
+		__m128i low = _mm_unpacklo_epi8(value, zero);
+		__m128i high = _mm_unpackhi_epi8(value, zero);
+		__m128 values[4] = {
+			_mm_cvtepi32_ps(_mm_unpacklo_epi16(low, zero)),
+			_mm_cvtepi32_ps(_mm_unpackhi_epi16(low, zero)),
+			_mm_cvtepi32_ps(_mm_unpacklo_epi16(high, zero)),
+			_mm_cvtepi32_ps(_mm_unpackhi_epi16(high, zero)),
+		};
+		for (int j = 0; j < 4; ++j) {
+			_mm_storeu_ps(acc + i + j * 4, sse_accumulate(_mm_loadu_ps(acc + i + j * 4), values[j], sse_weight, method, first));
+		}
+	}
+	for (; i < count; ++i) {
+		float value = (float)row[i];
+		switch (method) {
+			case MIPMAP_MIN:
+				acc[i] = first || value < acc[i] ? value : acc[i];
+				break;
+
+			case MIPMAP_MAX:
+				acc[i] = first || value > acc[i] ? value : acc[i];
+				break;
+
+			default:
+				acc[i] = first ? value * weight : acc[i] + value * weight;
+				break;
+		}
+	}
+}
+
+#endif
+
+template <typename T, typename A>
+static inline T store_texel(A value) {
+	if (!std::numeric_limits<T>::is_integer) {
+		return (T)value;
+	}
+	double rounded = floor((double)value + 0.5);
+	if (rounded < (double)std::numeric_limits<T>::min()) {
+		return std::numeric_limits<T>::min();
+	}
+	if (rounded > (double)std::numeric_limits<T>::max()) {
+		return std::numeric_limits<T>::max();
+	}
+	return (T)rounded;
+}
+
+template <typename T>
+static void reduce_rows(const MGLMipmapLevel * level, int begin, int end) {
+	typedef typename MGLMipmapAccumulator<T>::type A;
+
+	const int components = level->components;
+	const int src_row = level->src_width * components;
+	std::vector<A> acc(src_row);
+
+	for (int row = begin; row < end; ++row) {
+		int z = row / level->dst_height;
+		int y = row % level->dst_height;
+
+		bool first = true;
+		for (int k = level->z.first[z]; k < level->z.first[z + 1]; ++k) {
+			const MGLMipmapTap & slice = level->z.taps[k];
+			for (int j = level->y.first[y]; j < level->y.first[y + 1]; ++j) {
+				const MGLMipmapTap & line = level->y.taps[j];
+				const T * src = (const T *)level->src + ((size_t)slice.index * level->src_height + line.index) * src_row;
+				accumulate_row<T, A>(acc.data(), src, src_row, slice.weight * line.weight, level->method, first);
+				first = false;
+			}
+		}
+
+		T * dst = (T *)level->dst + (size_t)row * level->dst_width * components;
+		for (int x = 0; x < level->dst_width; ++x) {
+			const MGLMipmapTap * taps = level->x.taps.data() + level->x.first[x];
+			int count = level->x.first[x + 1] - level->x.first[x];
+			for (int c = 0; c < components; ++c) {
+				A value = acc[taps[0].index * components + c];
+				if (level->method == MIPMAP_MIN) {
+					for (int t = 1; t < count; ++t) {
+						A other = acc[taps[t].index * components + c];
+						value = other < value ? other : value;
+					}
+				} else if (level->method == MIPMAP_MAX) {
+					for (int t = 1; t < count; ++t) {
+						A other = acc[taps[t].index * components + c];
+						value = other > value ? other : value;
+					}
+				} else {
+					value *= taps[0].weight;
+					for (int t = 1; t < count; ++t) {
+						value += acc[taps[t].index * components + c] * taps[t].weight;
+					}
+				}
+				dst[x * components + c] = store_texel<T, A>(value);
+			}
+		}
+	}
+}
+
+template <typename T>
+static void reduce_level(const MGLMipmapLevel * level) {
+	int rows = level->dst_depth * level->dst_height;
+	size_t work = (size_t)rows * level->dst_width * level->components;
+
+	int threads = (int)std::thread::hardware_concurrency();
+	threads = threads < 8 ? threads : 8;
+	threads = threads < rows ? threads : rows;
+
+	// Small levels are not worth a thread
+	if (threads < 2 || work < 65536) {
+		reduce_rows<T>(level, 0, rows);
+		return;
+	}
+
+	std::vector<std::thread> workers;
+	for (int i = 0; i < threads; ++i) {
+		int begin = rows * i / threads;
+		int end = rows * (i + 1) / threads;
+		workers.push_back(std::thread(reduce_rows<T>, level, begin, end));
+	}
+	for (size_t i = 0; i < workers.size(); ++i) {
+		workers[i].join();
+	}
+}
+
+static void reduce_level(const MGLMipmapLevel * level, int pixel_type) {
+	switch (pixel_type) {
+		case GL_UNSIGNED_BYTE:
+			reduce_level<unsigned char>(level);
+			break;
+
+		case GL_BYTE:
+			reduce_level<signed char>(level);
+			break;
+
+		case GL_UNSIGNED_SHORT:
+			reduce_level<unsigned short>(level);
+			break;
+
+		case GL_SHORT:
+			reduce_level<short>(level);
+			break;
+
+		case GL_UNSIGNED_INT:
+			reduce_level<unsigned>(level);
+			break;
+
+		case GL_INT:
+			reduce_level<int>(level);
+			break;
+
+		default:
+			reduce_level<float>(level);
+			break;
+	}
+}
+
+static int pixel_type_size(int pixel_type) {
+	switch (pixel_type) {
+		case GL_UNSIGNED_BYTE:
+		case GL_BYTE:
+			return 1;
+
+		case GL_UNSIGNED_SHORT:
+		case GL_SHORT:
+			return 2;
+
+		default:
+			return 4;
+	}
+}
+
+// Builds the levels base + 1 to max from the base level and returns the last level, -1 on error.
+// Array layers and cube faces are reduced separately, the depth of 3D textures is reduced too.
+int MGLContext_build_mipmaps(
+	MGLContext * context, int target, int texture_obj, MGLDataType * data_type, int components,
+	int internal_format, bool immutable, int width, int height, int depth, int base, int max,
+	const char * method_name, Py_ssize_t method_size
+) {
+	MGLMipmapMethod method;
+
+	if (method_size == 3 && !memcmp(method_name, "box", 3)) {
+		method = MIPMAP_BOX;
+	} else if (method_size == 3 && !memcmp(method_name, "min", 3)) {
+		method = MIPMAP_MIN;
+	} else if (method_size == 3 && !memcmp(method_name, "max", 3)) {
+		method = MIPMAP_MAX;
+	} else if (method_size == 6 && !memcmp(method_name, "kaiser", 6)) {
+		method = MIPMAP_KAISER;
+	} else {
+		MGLError_Set("invalid method %s, expected box, min, max or kaiser", method_name);
+		return -1;
+	}
+
+	if (data_type->block_size || data_type->packed_size) {
+		MGLError_Set("compressed and packed dtypes cannot build mipmaps on the CPU");
+		return -1;
+	}
+
+	bool volume = target == GL_TEXTURE_3D;
+	bool cube = target == GL_TEXTURE_CUBE_MAP;
+	int images = volume ? 1 : depth;
+
+	// Half floats are filtered as floats, the driver converts them on transfer
+	int pixel_type = data_type->gl_type == GL_HALF_FLOAT ? GL_FLOAT : data_type->gl_type;
+	int base_format = data_type->base_format[components];
+	int pixel_size = pixel_type_size(pixel_type) * components;
+
+	int level_width[32];
+	int level_height[32];
+	int level_depth[32];
+	size_t level_offset[33];
+
+	int last = base;
+	level_width[0] = width >> base > 1 ? width >> base : 1;
+	level_height[0] = height >> base > 1 ? height >> base : 1;
+	level_depth[0] = volume && depth >> base > 1 ? depth >> base : 1;
+	level_offset[0] = 0;
+
+	for (int i = 0; ; ++i) {
+		level_offset[i + 1] = level_offset[i] + (size_t)level_width[i] * level_height[i] * level_depth[i] * images * pixel_size;
+		bool smallest = level_width[i] == 1 && level_height[i] == 1 && level_depth[i] == 1;
+		if (smallest || base + i >= max || i == 31) {
+			last = base + i;
+			break;
+		}
+		level_width[i + 1] = level_width[i] > 1 ? level_width[i] / 2 : 1;
+		level_height[i + 1] = level_height[i] > 1 ? level_height[i] / 2 : 1;
+		level_depth[i + 1] = level_depth[i] > 1 ? level_depth[i] / 2 : 1;
+	}
+
+	if (last == base) {
+		return base;
+	}
+
+	std::vector<char> pixels(level_offset[last - base + 1]);
+
+	const GLMethods & gl = context->gl;
+
+	gl.ActiveTexture(GL_TEXTURE0 + context->default_texture_unit);
+	gl.BindTexture(target, texture_obj);
+
+	gl.PixelStorei(GL_PACK_ALIGNMENT, 1);
+	gl.PixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+	size_t image_size = level_offset[1] / images;
+
+	if (cube) {
+		for (int face = 0; face < 6; ++face) {
+			gl.GetTexImage(GL_TEXTURE_CUBE_MAP_POSITIVE_X + face, base, base_format, pixel_type, pixels.data() + face * image_size);
+		}
+	} else {
+		gl.GetTexImage(target, base, base_format, pixel_type, pixels.data());
+	}
+
+	MGLMipmapLevel level;
+	level.components = components;
+	level.method = method;
+
+	for (int i = 1; i <= last - base; ++i) {
+		level.src_width = level_width[i - 1];
+		level.src_height = level_height[i - 1];
+		level.src_depth = level_depth[i - 1];
+		level.dst_width = level_width[i];
+		level.dst_height = level_height[i];
+		level.dst_depth = level_depth[i];
+
+		mipmap_axis(level.x, level.src_width, level.dst_width, method);
+		mipmap_axis(level.y, level.src_height, level.dst_height, method);
+		mipmap_axis(level.z, level.src_depth, level.dst_depth, method);
+
+		size_t src_image = (level_offset[i] - level_offset[i - 1]) / images;
+		size_t dst_image = (level_offset[i + 1] - level_offset[i]) / images;
+
+		for (int image = 0; image < images; ++image) {
+			level.src = pixels.data() + level_offset[i - 1] + image * src_image;
+			level.dst = pixels.data() + level_offset[i] + image * dst_image;
+			reduce_level(&level, pixel_type);
+		}
+	}
+
+	for (int i = 1; i <= last - base; ++i) {
+		int w = level_width[i];
+		int h = level_height[i];
+		const char * data = pixels.data() + level_offset[i];
+
+		if (cube) {
+			size_t face_size = (level_offset[i + 1] - level_offset[i]) / 6;
+			for (int face = 0; face < 6; ++face) {
+				int face_target = GL_TEXTURE_CUBE_MAP_POSITIVE_X + face;
+				if (immutable) {
+					gl.TexSubImage2D(face_target, base + i, 0, 0, w, h, base_format, pixel_type, data + face * face_size);
+				} else {
+					gl.TexImage2D(face_target, base + i, internal_format, w, h, 0, base_format, pixel_type, data + face * face_size);
+				}
+			}
+		} else if (target == GL_TEXTURE_2D) {
+			if (immutable) {
+				gl.TexSubImage2D(target, base + i, 0, 0, w, h, base_format, pixel_type, data);
+			} else {
+				gl.TexImage2D(target, base + i, internal_format, w, h, 0, base_format, pixel_type, data);
+			}
+		} else {
+			int d = volume ? level_depth[i] : depth;
+			if (immutable) {
+				gl.TexSubImage3D(target, base + i, 0, 0, 0, w, h, d, base_format, pixel_type, data);
+			} else {
+				gl.TexImage3D(target, base + i, internal_format, w, h, d, 0, base_format, pixel_type, data);
+			}
+		}
+	}
+
+	gl.TexParameteri(target, GL_TEXTURE_BASE_LEVEL, base);
+	gl.TexParameteri(target, GL_TEXTURE_MAX_LEVEL, last);
+
+	return last;
+}
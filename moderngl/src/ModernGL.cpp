@@ -297,6 +297,11 @@ PyObject * create_context(PyObject * self, PyObject * args, PyObject * kwargs) {
 
 	ctx->provoking_vertex = GL_LAST_VERTEX_CONVENTION;
 
+	ctx->bound_program = 0;
+	ctx->bound_subroutines = 0;
+	ctx->num_bound_subroutines = -1;
+	ctx->bound_subroutines_capacity = 0;
+
     ctx->polygon_offset_factor = 0.0f;
     ctx->polygon_offset_units = 0.0f;
 
@@ -314,10 +319,17 @@ PyObject * create_context(PyObject * self, PyObject * args, PyObject * kwargs) {
 	return result;
 }
 
+PyObject * encode_pixels(PyObject * self, PyObject * args);
+PyObject * decode_pixels(PyObject * self, PyObject * args);
+PyObject * convert_pixels(PyObject * self, PyObject * args);
+
 PyMethodDef MGL_module_methods[] = {
 	{"strsize", (PyCFunction)strsize, METH_VARARGS, 0},
 	{"create_context", (PyCFunction)create_context, METH_VARARGS | METH_KEYWORDS, 0},
 	{"fmtdebug", (PyCFunction)fmtdebug, METH_VARARGS, 0},
+	{"encode_pixels", (PyCFunction)encode_pixels, METH_VARARGS, 0},
+	{"decode_pixels", (PyCFunction)decode_pixels, METH_VARARGS, 0},
+	{"convert_pixels", (PyCFunction)convert_pixels, METH_VARARGS, 0},
 	{0},
 };
 
@@ -333,6 +345,17 @@ bool MGL_InitializeModule(PyObject * module) {
 		PyModule_AddObject(module, "Attribute", (PyObject *)&MGLAttribute_Type);
 	}
 
+	{
+		if (PyType_Ready(&MGLBlockWriter_Type) < 0) {
+			PyErr_Format(PyExc_ImportError, "Cannot register BlockWriter in %s (%s:%d)", __FUNCTION__, __FILE__, __LINE__);
+			return false;
+		}
+
+		Py_INCREF(&MGLBlockWriter_Type);
+
+		PyModule_AddObject(module, "BlockWriter", (PyObject *)&MGLBlockWriter_Type);
+	}
+
 	{
 		if (PyType_Ready(&MGLBuffer_Type) < 0) {
 			PyErr_Format(PyExc_ImportError, "Cannot register Buffer in %s (%s:%d)", __FUNCTION__, __FILE__, __LINE__);
@@ -377,6 +400,17 @@ bool MGL_InitializeModule(PyObject * module) {
 		PyModule_AddObject(module, "Framebuffer", (PyObject *)&MGLFramebuffer_Type);
 	}
 
+	{
+		if (PyType_Ready(&MGLFrameCapture_Type) < 0) {
+			PyErr_Format(PyExc_ImportError, "Cannot register FrameCapture in %s (%s:%d)", __FUNCTION__, __FILE__, __LINE__);
+			return false;
+		}
+
+		Py_INCREF(&MGLFrameCapture_Type);
+
+		PyModule_AddObject(module, "FrameCapture", (PyObject *)&MGLFrameCapture_Type);
+	}
+
 	{
 		if (PyType_Ready(&MGLInvalidObject_Type) < 0) {
 			PyErr_Format(PyExc_ImportError, "Cannot register InvalidObject in %s (%s:%d)", __FUNCTION__, __FILE__, __LINE__);
@@ -454,6 +488,39 @@ bool MGL_InitializeModule(PyObject * module) {
 		PyModule_AddObject(module, "TextureArray", (PyObject *)&MGLTextureArray_Type);
 	}
 
+	{
+		if (PyType_Ready(&MGLTextureAtlas_Type) < 0) {
+			PyErr_Format(PyExc_ImportError, "Cannot register TextureAtlas in %s (%s:%d)", __FUNCTION__, __FILE__, __LINE__);
+			return false;
+		}
+
+		Py_INCREF(&MGLTextureAtlas_Type);
+
+		PyModule_AddObject(module, "TextureAtlas", (PyObject *)&MGLTextureAtlas_Type);
+	}
+
+	{
+		if (PyType_Ready(&MGLBrickVolume_Type) < 0) {
+			PyErr_Format(PyExc_ImportError, "Cannot register BrickVolume in %s (%s:%d)", __FUNCTION__, __FILE__, __LINE__);
+			return false;
+		}
+
+		Py_INCREF(&MGLBrickVolume_Type);
+
+		PyModule_AddObject(module, "BrickVolume", (PyObject *)&MGLBrickVolume_Type);
+	}
+
+	{
+		if (PyType_Ready(&MGLTextureBuffer_Type) < 0) {
+			PyErr_Format(PyExc_ImportError, "Cannot register TextureBuffer in %s (%s:%d)", __FUNCTION__, __FILE__, __LINE__);
+			return false;
+		}
+
+		Py_INCREF(&MGLTextureBuffer_Type);
+
+		PyModule_AddObject(module, "TextureBuffer", (PyObject *)&MGLTextureBuffer_Type);
+	}
+
 	{
 		if (PyType_Ready(&MGLTextureCube_Type) < 0) {
 			PyErr_Format(PyExc_ImportError, "Cannot register TextureCube in %s (%s:%d)", __FUNCTION__, __FILE__, __LINE__);
@@ -487,6 +554,17 @@ bool MGL_InitializeModule(PyObject * module) {
 		PyModule_AddObject(module, "Uniform", (PyObject *)&MGLUniform_Type);
 	}
 
+	{
+		if (PyType_Ready(&MGLUniformBatch_Type) < 0) {
+			PyErr_Format(PyExc_ImportError, "Cannot register UniformBatch in %s (%s:%d)", __FUNCTION__, __FILE__, __LINE__);
+			return false;
+		}
+
+		Py_INCREF(&MGLUniformBatch_Type);
+
+		PyModule_AddObject(module, "UniformBatch", (PyObject *)&MGLUniformBatch_Type);
+	}
+
 	{
 		if (PyType_Ready(&MGLUniformBlock_Type) < 0) {
 			PyErr_Format(PyExc_ImportError, "Cannot register UniformBlock in %s (%s:%d)", __FUNCTION__, __FILE__, __LINE__);
@@ -498,6 +576,28 @@ bool MGL_InitializeModule(PyObject * module) {
 		PyModule_AddObject(module, "UniformBlock", (PyObject *)&MGLUniformBlock_Type);
 	}
 
+	{
+		if (PyType_Ready(&MGLUniformStream_Type) < 0) {
+			PyErr_Format(PyExc_ImportError, "Cannot register UniformStream in %s (%s:%d)", __FUNCTION__, __FILE__, __LINE__);
+			return false;
+		}
+
+		Py_INCREF(&MGLUniformStream_Type);
+
+		PyModule_AddObject(module, "UniformStream", (PyObject *)&MGLUniformStream_Type);
+	}
+
+	{
+		if (PyType_Ready(&MGLUploadQueue_Type) < 0) {
+			PyErr_Format(PyExc_ImportError, "Cannot register UploadQueue in %s (%s:%d)", __FUNCTION__, __FILE__, __LINE__);
+			return false;
+		}
+
+		Py_INCREF(&MGLUploadQueue_Type);
+
+		PyModule_AddObject(module, "UploadQueue", (PyObject *)&MGLUploadQueue_Type);
+	}
+
 	{
 		if (PyType_Ready(&MGLVertexArray_Type) < 0) {
 			PyErr_Format(PyExc_ImportError, "Cannot register VertexArray in %s (%s:%d)", __FUNCTION__, __FILE__, __LINE__);
@@ -0,0 +1,503 @@
+#include <cstdlib>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define MGL_SSE2
+#endif
+
+#include "Types.hpp"
+
+// Converts host pixels between the f1, f2 and f4 dtypes and between channel layouts.
+// A row is decoded to floats, reordered and encoded again, rows keeping the dtype are reordered in place.
+// The SSE2 paths convert 16 bytes at a time, the scalar paths handle the tail and other CPUs.
+// Both paths use the same float operations and produce the same bits.
+
+struct MGLPixelTransfer {
+	char * ptr;
+	Py_ssize_t offset;
+	Py_ssize_t stride;
+	Py_ssize_t plane;
+
+	// The element size 1, 2 or 4 of the f1, f2 and f4 dtypes
+	int size;
+	int channels;
+	bool planar;
+
+	// The channel (r, g, b or a) at each position of the pixel
+	int map[4];
+};
+
+static inline float bits_to_float(unsigned bits) {
+	float value;
+	memcpy(&value, &bits, 4);
+	return value;
+}
+
+static inline unsigned float_to_bits(float value) {
+	unsigned bits;
+	memcpy(&bits, &value, 4);
+	return bits;
+}
+
+// Half floats are rounded to nearest even, NaN values are kept quiet.
+// Values below 2^-14 are rounded by the float addition of 0.5, the half denormal is the low bits of the sum.
+
+static inline unsigned short float_to_half(float value) {
+	unsigned bits = float_to_bits(value);
+	unsigned sign = bits & 0x80000000;
+	bits ^= sign;
+	unsigned half;
+	if (bits >= 0x47800000) {
+		half = bits > 0x7f800000 ? 0x7e00 : 0x7c00;
+	} else if (bits < 0x38800000) {
+		half = float_to_bits(bits_to_float(bits) + 0.5f) - 0x3f000000;
+	} else {
+		half = (bits + 0xc8000fff + (bits >> 13 & 1)) >> 13;
+	}
+	return (unsigned short)(half | sign >> 16);
+}
+
+// Scaling by 2^112 rebiases the exponent, the half denormals become float32 normals.
+static inline float half_to_float(unsigned short value) {
+	unsigned exponent_mantissa = value & 0x7fff;
+	unsigned bits = float_to_bits(bits_to_float(exponent_mantissa << 13) * bits_to_float(239 << 23));
+	if (exponent_mantissa > 0x7bff) {
+		bits |= 0x7f800000;
+	}
+	return bits_to_float(bits | (value & 0x8000) << 16);
+}
+
+// The NaN inputs are mapped to zero
+static inline unsigned char float_to_unorm8(float value) {
+	value = value > 0.0f ? value : 0.0f;
+	value = value < 1.0f ? value : 1.0f;
+	return (unsigned char)(int)(value * 255.0f + 0.5f);
+}
+
+#ifdef MGL_SSE2
+
+static inline __m128i sse_select(__m128i mask, __m128i a, __m128i b) {
+	return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+}
+
+// Returns the halves in the low 16 bits, the sign is extended for _mm_packs_epi32
+static inline __m128i sse_float_to_half(__m128 value) {
+	__m128i bits = _mm_castps_si128(value);
+	__m128i sign = _mm_and_si128(bits, _mm_set1_epi32((int)0x80000000));
+	bits = _mm_xor_si128(bits, sign);
+	__m128i nan = _mm_and_si128(_mm_cmpgt_epi32(bits, _mm_set1_epi32(0x7f800000)), _mm_set1_epi32(0x200));
+	__m128i special = _mm_or_si128(_mm_set1_epi32(0x7c00), nan);
+	__m128 denormal_sum = _mm_add_ps(_mm_castsi128_ps(bits), _mm_set1_ps(0.5f));
+	__m128i denormal = _mm_sub_epi32(_mm_castps_si128(denormal_sum), _mm_set1_epi32(0x3f000000));
+	__m128i odd = _mm_and_si128(_mm_srli_epi32(bits, 13), _mm_set1_epi32(1));
+	__m128i rounded = _mm_add_epi32(_mm_add_epi32(bits, _mm_set1_epi32((int)0xc8000fff)), odd);
+	__m128i half = sse_select(_mm_cmplt_epi32(bits, _mm_set1_epi32(0x38800000)), denormal, _mm_srli_epi32(rounded, 13));
+	half = sse_select(_mm_cmpgt_epi32(bits, _mm_set1_epi32(0x477fffff)), special, half);
+	return _mm_or_si128(half, _mm_srai_epi32(sign, 16));
+}
+
+// Takes the halves in the low 16 bits
+static inline __m128 sse_half_to_float(__m128i value) {
+	__m128i exponent_mantissa = _mm_and_si128(value, _mm_set1_epi32(0x7fff));
+	__m128 shifted = _mm_castsi128_ps(_mm_slli_epi32(exponent_mantissa, 13));
+	__m128i bits = _mm_castps_si128(_mm_mul_ps(shifted, _mm_castsi128_ps(_mm_set1_epi32(239 << 23))));
+	__m128i special = _mm_and_si128(_mm_cmpgt_epi32(exponent_mantissa, _mm_set1_epi32(0x7bff)), _mm_set1_epi32(0x7f800000));
+	__m128i sign = _mm_slli_epi32(_mm_and_si128(value, _mm_set1_epi32(0x8000)), 16);
+	return _mm_castsi128_ps(_mm_or_si128(_mm_or_si128(bits, special), sign));
+}
+
+static inline __m128i sse_float_to_unorm8(__m128 value) {
+	__m128 clamped = _mm_min_ps(_mm_max_ps(value, _mm_setzero_ps()), _mm_set1_ps(1.0f));
+	return _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(clamped, _mm_set1_ps(255.0f)), _mm_set1_ps(0.5f)));
+}
+
+#endif
+
+static void decode_elements(int size, const char * src, float * dst, int count) {
+	int i = 0;
+
+	if (size == 1) {
+		const unsigned char * bytes = (const unsigned char *)src;
+
+#ifdef MGL_SSE2
+		const __m128i zero = _mm_setzero_si128();
+		const __m128 scale = _mm_set1_ps(255.0f);
+		for (; i + 16 <= count; i += 16) {
+			__m128i value = _mm_loadu_si128((const __m128i *)(bytes + i));
+			__m128i low = _mm_unpacklo_epi8(value, zero);
+			__m128i high = _mm_unpackhi_epi8(value, zero);
+			_mm_storeu_ps(dst + i, _mm_div_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(low, zero)), scale));
+			_mm_storeu_ps(dst + i + 4, _mm_div_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(low, zero)), scale));
+			_mm_storeu_ps(dst + i + 8, _mm_div_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(high, zero)), scale));
+			_mm_storeu_ps(dst + i + 12, _mm_div_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(high, zero)), scale));
+		}
+#endif
+
+		for (; i < count; ++i) {
+			dst[i] = (float)bytes[i] / 255.0f;
+		}
+	} else if (size == 2) {
+		const unsigned short * halves = (const unsigned short *)src;
+
+#ifdef MGL_SSE2
+		const __m128i zero = _mm_setzero_si128();
+		for (; i + 8 <= count; i += 8) {
+			__m128i value = _mm_loadu_si128((const __m128i *)(halves + i));
+			_mm_storeu_ps(dst + i, sse_half_to_float(_mm_unpacklo_epi16(value, zero)));
+			_mm_storeu_ps(dst + i + 4, sse_half_to_float(_mm_unpackhi_epi16(value, zero)));
+		}
+#endif
+
+		for (; i < count; ++i) {
+			dst[i] = half_to_float(halves[i]);
+		}
+	} else {
+		memcpy(dst, src, count * 4);
+	}
+}
+
+static void encode_elements(int size, const float * src, char * dst, int count) {
+	int i = 0;
+
+	if (size == 1) {
+		unsigned char * bytes = (unsigned char *)dst;
+
+#ifdef MGL_SSE2
+		for (; i + 16 <= count; i += 16) {
+			__m128i a = _mm_packs_epi32(sse_float_to_unorm8(_mm_loadu_ps(src + i)), sse_float_to_unorm8(_mm_loadu_ps(src + i + 4)));
+			__m128i b = _mm_packs_epi32(sse_float_to_unorm8(_mm_loadu_ps(src + i + 8)), sse_float_to_unorm8(_mm_loadu_ps(src + i + 12)));
+			_mm_storeu_si128((__m128i *)(bytes + i), _mm_packus_epi16(a, b));
+		}
+#endif
+
+		for (; i < count; ++i) {
+			bytes[i] = float_to_unorm8(src[i]);
+		}
+	} else if (size == 2) {
+		unsigned short * halves = (unsigned short *)dst;
+
+#ifdef MGL_SSE2
+		for (; i + 8 <= count; i += 8) {
+			__m128i low = sse_float_to_half(_mm_loadu_ps(src + i));
+			__m128i high = sse_float_to_half(_mm_loadu_ps(src + i + 4));
+			_mm_storeu_si128((__m128i *)(halves + i), _mm_packs_epi32(low, high));
+		}
+#endif
+
+		for (; i < count; ++i) {
+			halves[i] = float_to_half(src[i]);
+		}
+	} else {
+		memcpy(dst, src, count * 4);
+	}
+}
+
+// Copies the channels of a row, source[j] is the source position of the destination position j.
+// Missing color channels are zero, a missing alpha channel is one.
+template <typename T>
+static void reorder_row(
+	const char * src, Py_ssize_t src_pixel, Py_ssize_t src_channel,
+	char * dst, Py_ssize_t dst_pixel, Py_ssize_t dst_channel,
+	const int * source, const int * map, int channels, int width, T one
+) {
+	for (int j = 0; j < channels; ++j) {
+		char * ptr = dst + j * dst_channel;
+		if (source[j] < 0) {
+			T fill = map[j] == 3 ? one : (T)0;
+			for (int x = 0; x < width; ++x) {
+				memcpy(ptr + x * dst_pixel, &fill, sizeof(T));
+			}
+			continue;
+		}
+		const char * from = src + source[j] * src_channel;
+		for (int x = 0; x < width; ++x) {
+			memcpy(ptr + x * dst_pixel, from + x * src_pixel, sizeof(T));
+		}
+	}
+}
+
+static void swap_red_blue_row(const unsigned char * src, unsigned char * dst, int width) {
+	int x = 0;
+
+#ifdef MGL_SSE2
+	const __m128i green_alpha = _mm_set1_epi32((int)0xff00ff00);
+	const __m128i low_byte = _mm_set1_epi32(0xff);
+	for (; x + 4 <= width; x += 4) {
+		__m128i value = _mm_loadu_si128((const __m128i *)(src + x * 4));
+		__m128i red = _mm_slli_epi32(_mm_and_si128(value, low_byte), 16);
+		__m128i blue = _mm_and_si128(_mm_srli_epi32(value, 16), low_byte);
+		_mm_storeu_si128((__m128i *)(dst + x * 4), _mm_or_si128(_mm_and_si128(value, green_alpha), _mm_or_si128(red, blue)));
+	}
+#endif
+
+	for (; x < width; ++x) {
+		unsigned char red = src[x * 4];
+		dst[x * 4] = src[x * 4 + 2];
+		dst[x * 4 + 1] = src[x * 4 + 1];
+		dst[x * 4 + 2] = red;
+		dst[x * 4 + 3] = src[x * 4 + 3];
+	}
+}
+
+static bool parse_pixel_transfer(
+	const char * dtype, Py_ssize_t dtype_size, const char * layout, Py_ssize_t layout_size,
+	int planar, Py_ssize_t offset, Py_ssize_t stride, int width, int height, MGLPixelTransfer * transfer
+) {
+	if (dtype_size != 2 || dtype[0] != 'f' || (dtype[1] != '1' && dtype[1] != '2' && dtype[1] != '4')) {
+		MGLError_Set("pixel conversions support the f1, f2 and f4 dtypes, not %s", dtype);
+		return false;
+	}
+
+	if (layout_size < 1 || layout_size > 4) {
+		MGLError_Set("invalid layout %s", layout);
+		return false;
+	}
+
+	for (int i = 0; i < layout_size; ++i) {
+		const char * channel = strchr("rgba", layout[i]);
+		if (!layout[i] || !channel || memchr(layout, layout[i], i)) {
+			MGLError_Set("invalid layout %s", layout);
+			return false;
+		}
+		transfer->map[i] = (int)(channel - "rgba");
+	}
+
+	transfer->size = dtype[1] - '0';
+	transfer->channels = (int)layout_size;
+	transfer->planar = planar != 0;
+	transfer->stride = stride;
+	transfer->plane = planar ? stride * height : 0;
+	transfer->offset = offset;
+
+	Py_ssize_t row = (Py_ssize_t)width * transfer->size * (planar ? 1 : transfer->channels);
+
+	if (offset < 0 || stride < row) {
+		MGLError_Set("invalid offset = %d or stride = %d", (int)offset, (int)stride);
+		return false;
+	}
+
+	return true;
+}
+
+// The number of bytes from the start of the buffer to the end of the last pixel
+static Py_ssize_t pixel_transfer_end(const MGLPixelTransfer & transfer, int width, int height) {
+	Py_ssize_t row = (Py_ssize_t)width * transfer.size * (transfer.planar ? 1 : transfer.channels);
+	Py_ssize_t planes = transfer.planar ? (transfer.channels - 1) * transfer.plane : 0;
+	return transfer.offset + planes + (height - 1) * transfer.stride + row;
+}
+
+static void convert_rows(const MGLPixelTransfer & src, const MGLPixelTransfer & dst, int width, int height, bool flip) {
+	int source[4];
+	bool identity = src.channels == dst.channels && src.planar == dst.planar;
+	for (int j = 0; j < dst.channels; ++j) {
+		source[j] = -1;
+		for (int i = 0; i < src.channels; ++i) {
+			if (src.map[i] == dst.map[j]) {
+				source[j] = i;
+			}
+		}
+		identity = identity && source[j] == j;
+	}
+
+	Py_ssize_t src_pixel = src.planar ? src.size : src.size * src.channels;
+	Py_ssize_t src_channel = src.planar ? src.plane : src.size;
+	Py_ssize_t dst_pixel = dst.planar ? dst.size : dst.size * dst.channels;
+	Py_ssize_t dst_channel = dst.planar ? dst.plane : dst.size;
+
+	bool swap_red_blue = (
+		src.size == 1 && dst.size == 1 && src.channels == 4 && dst.channels == 4 && !src.planar && !dst.planar &&
+		source[0] == 2 && source[1] == 1 && source[2] == 0 && source[3] == 3
+	);
+
+	// The float rows are planar or interleaved like the pixels
+	float * src_floats = 0;
+	float * dst_floats = 0;
+	if (src.size != dst.size) {
+		src_floats = (float *)malloc(width * 4 * sizeof(float));
+		dst_floats = (float *)malloc(width * 4 * sizeof(float));
+	}
+
+	for (int y = 0; y < height; ++y) {
+		const char * src_row = src.ptr + (flip ? height - 1 - y : y) * src.stride;
+		char * dst_row = dst.ptr + y * dst.stride;
+
+		if (src.size == dst.size) {
+			if (identity && !src.planar) {
+				memcpy(dst_row, src_row, dst_pixel * width);
+			} else if (swap_red_blue) {
+				swap_red_blue_row((const unsigned char *)src_row, (unsigned char *)dst_row, width);
+			} else if (src.size == 1) {
+				reorder_row<unsigned char>(src_row, src_pixel, src_channel, dst_row, dst_pixel, dst_channel, source, dst.map, dst.channels, width, 0xff);
+			} else if (src.size == 2) {
+				reorder_row<unsigned short>(src_row, src_pixel, src_channel, dst_row, dst_pixel, dst_channel, source, dst.map, dst.channels, width, 0x3c00);
+			} else {
+				reorder_row<float>(src_row, src_pixel, src_channel, dst_row, dst_pixel, dst_channel, source, dst.map, dst.channels, width, 1.0f);
+			}
+			continue;
+		}
+
+		if (src.planar) {
+			for (int i = 0; i < src.channels; ++i) {
+				decode_elements(src.size, src_row + i * src.plane, src_floats + i * width, width);
+			}
+		} else {
+			decode_elements(src.size, src_row, src_floats, width * src.channels);
+		}
+
+		float * floats = src_floats;
+		if (!identity) {
+			Py_ssize_t src_float_pixel = src.planar ? 4 : 4 * src.channels;
+			Py_ssize_t src_float_channel = src.planar ? 4 * width : 4;
+			Py_ssize_t dst_float_pixel = dst.planar ? 4 : 4 * dst.channels;
+			Py_ssize_t dst_float_channel = dst.planar ? 4 * width : 4;
+			reorder_row<float>(
+				(const char *)src_floats, src_float_pixel, src_float_channel,
+				(char *)dst_floats, dst_float_pixel, dst_float_channel,
+				source, dst.map, dst.channels, width, 1.0f
+			);
+			floats = dst_floats;
+		}
+
+		if (dst.planar) {
+			for (int j = 0; j < dst.channels; ++j) {
+				encode_elements(dst.size, floats + j * width, dst_row + j * dst.plane, width);
+			}
+		} else {
+			encode_elements(dst.size, floats, dst_row, width * dst.channels);
+		}
+	}
+
+	free(src_floats);
+	free(dst_floats);
+}
+
+PyObject * convert_pixels(PyObject * self, PyObject * args) {
+	PyObject * data;
+	PyObject * output;
+	int width;
+	int height;
+
+	const char * src_dtype;
+	Py_ssize_t src_dtype_size;
+	const char * src_layout;
+	Py_ssize_t src_layout_size;
+	int src_planar;
+	Py_ssize_t src_offset;
+	Py_ssize_t src_stride;
+
+	const char * dst_dtype;
+	Py_ssize_t dst_dtype_size;
+	const char * dst_layout;
+	Py_ssize_t dst_layout_size;
+	int dst_planar;
+	Py_ssize_t dst_offset;
+	Py_ssize_t dst_stride;
+
+	int flip;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"OO(II)(s#s#pnn)(s#s#pnn)p",
+		&data,
+		&output,
+		&width,
+		&height,
+		&src_dtype,
+		&src_dtype_size,
+		&src_layout,
+		&src_layout_size,
+		&src_planar,
+		&src_offset,
+		&src_stride,
+		&dst_dtype,
+		&dst_dtype_size,
+		&dst_layout,
+		&dst_layout_size,
+		&dst_planar,
+		&dst_offset,
+		&dst_stride,
+		&flip
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	MGLPixelTransfer src;
+	MGLPixelTransfer dst;
+
+	if (!parse_pixel_transfer(src_dtype, src_dtype_size, src_layout, src_layout_size, src_planar, src_offset, src_stride, width, height, &src)) {
+		return 0;
+	}
+
+	if (!parse_pixel_transfer(dst_dtype, dst_dtype_size, dst_layout, dst_layout_size, dst_planar, dst_offset, dst_stride, width, height, &dst)) {
+		return 0;
+	}
+
+	if (!width || !height) {
+		if (output == Py_None) {
+			return PyBytes_FromStringAndSize(0, 0);
+		}
+		Py_RETURN_NONE;
+	}
+
+	Py_buffer src_view;
+
+	int get_buffer = PyObject_GetBuffer(data, &src_view, PyBUF_SIMPLE);
+	if (get_buffer < 0) {
+		// Propagate the default error
+		return 0;
+	}
+
+	Py_ssize_t src_end = pixel_transfer_end(src, width, height);
+
+	if (src_view.len < src_end) {
+		MGLError_Set("the data size %d is less than %d", (int)src_view.len, (int)src_end);
+		PyBuffer_Release(&src_view);
+		return 0;
+	}
+
+	src.ptr = (char *)src_view.buf + src_offset;
+
+	Py_ssize_t dst_end = pixel_transfer_end(dst, width, height);
+
+	if (output == Py_None) {
+		PyObject * res = PyBytes_FromStringAndSize(0, dst_end);
+		dst.ptr = PyBytes_AS_STRING(res) + dst_offset;
+
+		// The offset and the row padding are zero
+		if (dst_end != (Py_ssize_t)width * height * dst.channels * dst.size) {
+			memset(PyBytes_AS_STRING(res), 0, dst_end);
+		}
+
+		convert_rows(src, dst, width, height, flip != 0);
+
+		PyBuffer_Release(&src_view);
+		return res;
+	}
+
+	Py_buffer dst_view;
+
+	get_buffer = PyObject_GetBuffer(output, &dst_view, PyBUF_WRITABLE);
+	if (get_buffer < 0) {
+		// Propagate the default error
+		PyBuffer_Release(&src_view);
+		return 0;
+	}
+
+	if (dst_view.len < dst_end) {
+		MGLError_Set("the buffer size %d is less than %d", (int)dst_view.len, (int)dst_end);
+		PyBuffer_Release(&dst_view);
+		PyBuffer_Release(&src_view);
+		return 0;
+	}
+
+	dst.ptr = (char *)dst_view.buf + dst_offset;
+
+	convert_rows(src, dst, width, height, flip != 0);
+
+	PyBuffer_Release(&dst_view);
+	PyBuffer_Release(&src_view);
+	Py_RETURN_NONE;
+}
@@ -0,0 +1,480 @@
+#include <cmath>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define MGL_SSE2
+#endif
+
+#include "Types.hpp"
+
+// Converts host pixels between float32 and the packed dtypes.
+// The SSE2 paths convert 4 pixels at a time, the scalar paths handle the tail and other CPUs.
+// Both paths use the same float operations and produce the same bits.
+
+enum MGLPixelFormat {
+	PIXEL_FORMAT_R11G11B10F,
+	PIXEL_FORMAT_RGB9E5,
+	PIXEL_FORMAT_RGB10A2,
+	PIXEL_FORMAT_SRGB8,
+};
+
+static inline float bits_to_float(unsigned bits) {
+	float value;
+	memcpy(&value, &bits, 4);
+	return value;
+}
+
+static inline unsigned float_to_bits(float value) {
+	unsigned bits;
+	memcpy(&bits, &value, 4);
+	return bits;
+}
+
+// The NaN inputs are mapped to zero
+static inline float clamp_positive(float value, float limit) {
+	value = value > 0.0f ? value : 0.0f;
+	return value < limit ? value : limit;
+}
+
+// Small floats have a 5 bit exponent with a bias of 15 and no sign bit.
+// Scaling by 2^-112 rebiases the float32 exponent, the small float is the top bits of the result.
+// The denormals of the small float fall on the float32 denormals with the same shift.
+
+static inline unsigned encode_small_float(float value, int mantissa) {
+	float limit = mantissa == 6 ? 65024.0f : 64512.0f;
+	unsigned bits = float_to_bits(clamp_positive(value, limit) * bits_to_float(15 << 23));
+	return (bits + (1 << (22 - mantissa))) >> (23 - mantissa);
+}
+
+static inline float decode_small_float(unsigned value, int mantissa) {
+	if ((value >> mantissa) == 31) {
+		return bits_to_float(0x7f800000 | (value & ((1 << mantissa) - 1)) << (23 - mantissa));
+	}
+	return bits_to_float(value << (23 - mantissa)) * bits_to_float(239 << 23);
+}
+
+static inline unsigned encode_r11g11b10f(const float * src) {
+	return encode_small_float(src[0], 6) | encode_small_float(src[1], 6) << 11 | encode_small_float(src[2], 5) << 22;
+}
+
+static inline void decode_r11g11b10f(unsigned value, float * dst) {
+	dst[0] = decode_small_float(value & 0x7ff, 6);
+	dst[1] = decode_small_float(value >> 11 & 0x7ff, 6);
+	dst[2] = decode_small_float(value >> 22, 5);
+}
+
+// The shared exponent encoding follows EXT_texture_shared_exponent.
+// Clamping the largest component to 2^-16 implements max(-B - 1, floor(log2(maxc))).
+
+static inline unsigned encode_rgb9e5(const float * src) {
+	float r = clamp_positive(src[0], 65408.0f);
+	float g = clamp_positive(src[1], 65408.0f);
+	float b = clamp_positive(src[2], 65408.0f);
+	float maxc = r > g ? r : g;
+	maxc = maxc > b ? maxc : b;
+	maxc = maxc > bits_to_float(111 << 23) ? maxc : bits_to_float(111 << 23);
+	int exponent = (int)(float_to_bits(maxc) >> 23) - 111;
+	if ((int)(maxc * bits_to_float((151 - exponent) << 23) + 0.5f) == 512) {
+		exponent += 1;
+	}
+	float scale = bits_to_float((151 - exponent) << 23);
+	unsigned rs = (unsigned)(int)(r * scale + 0.5f);
+	unsigned gs = (unsigned)(int)(g * scale + 0.5f);
+	unsigned bs = (unsigned)(int)(b * scale + 0.5f);
+	return rs | gs << 9 | bs << 18 | (unsigned)exponent << 27;
+}
+
+static inline void decode_rgb9e5(unsigned value, float * dst) {
+	float scale = bits_to_float(((value >> 27) + 103) << 23);
+	dst[0] = (float)(int)(value & 0x1ff) * scale;
+	dst[1] = (float)(int)(value >> 9 & 0x1ff) * scale;
+	dst[2] = (float)(int)(value >> 18 & 0x1ff) * scale;
+}
+
+static inline unsigned encode_unorm(float value, float scale) {
+	return (unsigned)(int)(clamp_positive(value, 1.0f) * scale + 0.5f);
+}
+
+static inline unsigned encode_rgb10a2(const float * src) {
+	return (
+		encode_unorm(src[0], 1023.0f) | encode_unorm(src[1], 1023.0f) << 10 |
+		encode_unorm(src[2], 1023.0f) << 20 | encode_unorm(src[3], 3.0f) << 30
+	);
+}
+
+static inline void decode_rgb10a2(unsigned value, float * dst) {
+	dst[0] = (float)(int)(value & 0x3ff) * (1.0f / 1023.0f);
+	dst[1] = (float)(int)(value >> 10 & 0x3ff) * (1.0f / 1023.0f);
+	dst[2] = (float)(int)(value >> 20 & 0x3ff) * (1.0f / 1023.0f);
+	dst[3] = (float)(int)(value >> 30) * (1.0f / 3.0f);
+}
+
+static inline unsigned char encode_srgb(float value) {
+	value = clamp_positive(value, 1.0f);
+	value = value <= 0.0031308f ? value * 12.92f : 1.055f * powf(value, 1.0f / 2.4f) - 0.055f;
+	return (unsigned char)encode_unorm(value, 255.0f);
+}
+
+static const float * srgb_table() {
+	static float table[256];
+	static bool ready = false;
+	if (!ready) {
+		for (int i = 0; i < 256; ++i) {
+			float value = i / 255.0f;
+			table[i] = value <= 0.04045f ? value / 12.92f : powf((value + 0.055f) / 1.055f, 2.4f);
+		}
+		ready = true;
+	}
+	return table;
+}
+
+#ifdef MGL_SSE2
+
+static inline __m128 sse_clamp_positive(__m128 value, __m128 limit) {
+	return _mm_min_ps(_mm_max_ps(value, _mm_setzero_ps()), limit);
+}
+
+static inline __m128 sse_exponent_scale(__m128i biased_exponent) {
+	return _mm_castsi128_ps(_mm_slli_epi32(biased_exponent, 23));
+}
+
+// Reads 4 pixels of 3 or 4 floats into one register per component
+static inline void sse_load_pixels(const float * src, int components, __m128 * rgba) {
+	if (components == 4) {
+		rgba[0] = _mm_loadu_ps(src);
+		rgba[1] = _mm_loadu_ps(src + 4);
+		rgba[2] = _mm_loadu_ps(src + 8);
+		rgba[3] = _mm_loadu_ps(src + 12);
+		_MM_TRANSPOSE4_PS(rgba[0], rgba[1], rgba[2], rgba[3]);
+	} else {
+		rgba[0] = _mm_set_ps(src[9], src[6], src[3], src[0]);
+		rgba[1] = _mm_set_ps(src[10], src[7], src[4], src[1]);
+		rgba[2] = _mm_set_ps(src[11], src[8], src[5], src[2]);
+	}
+}
+
+static inline void sse_store_pixels(float * dst, int components, __m128 * rgba) {
+	if (components == 4) {
+		_MM_TRANSPOSE4_PS(rgba[0], rgba[1], rgba[2], rgba[3]);
+		_mm_storeu_ps(dst, rgba[0]);
+		_mm_storeu_ps(dst + 4, rgba[1]);
+		_mm_storeu_ps(dst + 8, rgba[2]);
+		_mm_storeu_ps(dst + 12, rgba[3]);
+	} else {
+		float temp[3][4];
+		_mm_storeu_ps(temp[0], rgba[0]);
+		_mm_storeu_ps(temp[1], rgba[1]);
+		_mm_storeu_ps(temp[2], rgba[2]);
+		for (int i = 0; i < 4; ++i) {
+			dst[i * 3 + 0] = temp[0][i];
+			dst[i * 3 + 1] = temp[1][i];
+			dst[i * 3 + 2] = temp[2][i];
+		}
+	}
+}
+
+static inline __m128i sse_encode_small_float(__m128 value, int mantissa) {
+	__m128 limit = _mm_set1_ps(mantissa == 6 ? 65024.0f : 64512.0f);
+	__m128 scaled = _mm_mul_ps(sse_clamp_positive(value, limit), _mm_castsi128_ps(_mm_set1_epi32(15 << 23)));
+	__m128i bits = _mm_add_epi32(_mm_castps_si128(scaled), _mm_set1_epi32(1 << (22 - mantissa)));
+	return _mm_srli_epi32(bits, 23 - mantissa);
+}
+
+static inline __m128 sse_decode_small_float(__m128i value, int mantissa) {
+	__m128i shifted = _mm_slli_epi32(value, 23 - mantissa);
+	__m128 finite = _mm_mul_ps(_mm_castsi128_ps(shifted), _mm_castsi128_ps(_mm_set1_epi32(239 << 23)));
+	__m128 special = _mm_castsi128_ps(_mm_or_si128(shifted, _mm_set1_epi32(0x7f800000)));
+	__m128 mask = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_srli_epi32(value, mantissa), _mm_set1_epi32(31)));
+	return _mm_or_ps(_mm_and_ps(mask, special), _mm_andnot_ps(mask, finite));
+}
+
+static inline __m128i sse_encode_unorm(__m128 value, float scale) {
+	__m128 clamped = sse_clamp_positive(value, _mm_set1_ps(1.0f));
+	return _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(clamped, _mm_set1_ps(scale)), _mm_set1_ps(0.5f)));
+}
+
+static inline __m128 sse_decode_unorm(__m128i value, int mask, float scale) {
+	return _mm_mul_ps(_mm_cvtepi32_ps(_mm_and_si128(value, _mm_set1_epi32(mask))), _mm_set1_ps(scale));
+}
+
+static int sse_encode(MGLPixelFormat format, const float * src, unsigned * dst, int pixels) {
+	__m128 rgba[4] = {};
+	int components = format == PIXEL_FORMAT_RGB10A2 ? 4 : 3;
+	int i = 0;
+
+	for (; i + 4 <= pixels; i += 4) {
+		sse_load_pixels(src + i * components, components, rgba);
+		__m128i packed;
+
+		if (format == PIXEL_FORMAT_R11G11B10F) {
+			packed = _mm_or_si128(
+				_mm_or_si128(sse_encode_small_float(rgba[0], 6), _mm_slli_epi32(sse_encode_small_float(rgba[1], 6), 11)),
+				_mm_slli_epi32(sse_encode_small_float(rgba[2], 5), 22)
+			);
+		} else if (format == PIXEL_FORMAT_RGB9E5) {
+			__m128 limit = _mm_set1_ps(65408.0f);
+			__m128 r = sse_clamp_positive(rgba[0], limit);
+			__m128 g = sse_clamp_positive(rgba[1], limit);
+			__m128 b = sse_clamp_positive(rgba[2], limit);
+			__m128 maxc = _mm_max_ps(_mm_max_ps(_mm_max_ps(r, g), b), _mm_castsi128_ps(_mm_set1_epi32(111 << 23)));
+			__m128i exponent = _mm_sub_epi32(_mm_srli_epi32(_mm_castps_si128(maxc), 23), _mm_set1_epi32(111));
+			__m128 scale = sse_exponent_scale(_mm_sub_epi32(_mm_set1_epi32(151), exponent));
+			__m128i max_s = _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(maxc, scale), _mm_set1_ps(0.5f)));
+			exponent = _mm_sub_epi32(exponent, _mm_cmpeq_epi32(max_s, _mm_set1_epi32(512)));
+			scale = sse_exponent_scale(_mm_sub_epi32(_mm_set1_epi32(151), exponent));
+			__m128 half = _mm_set1_ps(0.5f);
+			__m128i rs = _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(r, scale), half));
+			__m128i gs = _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(g, scale), half));
+			__m128i bs = _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(b, scale), half));
+			packed = _mm_or_si128(
+				_mm_or_si128(rs, _mm_slli_epi32(gs, 9)),
+				_mm_or_si128(_mm_slli_epi32(bs, 18), _mm_slli_epi32(exponent, 27))
+			);
+		} else {
+			packed = _mm_or_si128(
+				_mm_or_si128(sse_encode_unorm(rgba[0], 1023.0f), _mm_slli_epi32(sse_encode_unorm(rgba[1], 1023.0f), 10)),
+				_mm_or_si128(_mm_slli_epi32(sse_encode_unorm(rgba[2], 1023.0f), 20), _mm_slli_epi32(sse_encode_unorm(rgba[3], 3.0f), 30))
+			);
+		}
+
+		_mm_storeu_si128((__m128i *)(dst + i), packed);
+	}
+
+	return i;
+}
+
+static int sse_decode(MGLPixelFormat format, const unsigned * src, float * dst, int pixels) {
+	__m128 rgba[4] = {};
+	int components = format == PIXEL_FORMAT_RGB10A2 ? 4 : 3;
+	int i = 0;
+
+	for (; i + 4 <= pixels; i += 4) {
+		__m128i value = _mm_loadu_si128((const __m128i *)(src + i));
+
+		if (format == PIXEL_FORMAT_R11G11B10F) {
+			__m128i mask = _mm_set1_epi32(0x7ff);
+			rgba[0] = sse_decode_small_float(_mm_and_si128(value, mask), 6);
+			rgba[1] = sse_decode_small_float(_mm_and_si128(_mm_srli_epi32(value, 11), mask), 6);
+			rgba[2] = sse_decode_small_float(_mm_srli_epi32(value, 22), 5);
+		} else if (format == PIXEL_FORMAT_RGB9E5) {
+			__m128 scale = sse_exponent_scale(_mm_add_epi32(_mm_srli_epi32(value, 27), _mm_set1_epi32(103)));
+			__m128i mask = _mm_set1_epi32(0x1ff);
+			rgba[0] = _mm_mul_ps(_mm_cvtepi32_ps(_mm_and_si128(value, mask)), scale);
+			rgba[1] = _mm_mul_ps(_mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(value, 9), mask)), scale);
+			rgba[2] = _mm_mul_ps(_mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(value, 18), mask)), scale);
+		} else {
+			rgba[0] = sse_decode_unorm(value, 0x3ff, 1.0f / 1023.0f);
+			rgba[1] = sse_decode_unorm(_mm_srli_epi32(value, 10), 0x3ff, 1.0f / 1023.0f);
+			rgba[2] = sse_decode_unorm(_mm_srli_epi32(value, 20), 0x3ff, 1.0f / 1023.0f);
+			rgba[3] = sse_decode_unorm(_mm_srli_epi32(value, 30), 0x3, 1.0f / 3.0f);
+		}
+
+		sse_store_pixels(dst + i * components, components, rgba);
+	}
+
+	return i;
+}
+
+#endif
+
+static bool parse_pixel_format(const char * dtype, Py_ssize_t dtype_size, int components, MGLPixelFormat * format) {
+	MGLDataType * data_type = from_dtype(dtype, dtype_size);
+
+	if (!data_type) {
+		MGLError_Set("invalid dtype");
+		return false;
+	}
+
+	if (components < 1 || components > 4 || !data_type->internal_format[components]) {
+		MGLError_Set("the %s dtype does not support %d components", dtype, components);
+		return false;
+	}
+
+	switch (data_type->gl_type) {
+		case GL_UNSIGNED_INT_10F_11F_11F_REV:
+			*format = PIXEL_FORMAT_R11G11B10F;
+			return true;
+
+		case GL_UNSIGNED_INT_5_9_9_9_REV:
+			*format = PIXEL_FORMAT_RGB9E5;
+			return true;
+
+		case GL_UNSIGNED_INT_2_10_10_10_REV:
+			*format = PIXEL_FORMAT_RGB10A2;
+			return true;
+	}
+
+	if (data_type->internal_format[4] == GL_SRGB8_ALPHA8) {
+		*format = PIXEL_FORMAT_SRGB8;
+		return true;
+	}
+
+	MGLError_Set("the %s dtype has no pixel conversion", dtype);
+	return false;
+}
+
+PyObject * encode_pixels(PyObject * self, PyObject * args) {
+	PyObject * data;
+	const char * dtype;
+	Py_ssize_t dtype_size;
+	int components;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"Os#I",
+		&data,
+		&dtype,
+		&dtype_size,
+		&components
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	MGLPixelFormat format;
+	if (!parse_pixel_format(dtype, dtype_size, components, &format)) {
+		return 0;
+	}
+
+	Py_buffer buffer_view;
+
+	int get_buffer = PyObject_GetBuffer(data, &buffer_view, PyBUF_SIMPLE);
+	if (get_buffer < 0) {
+		// Propagate the default error
+		return 0;
+	}
+
+	if (buffer_view.len % (components * 4)) {
+		MGLError_Set("the data size %d is not a multiple of %d floats", (int)buffer_view.len, components);
+		PyBuffer_Release(&buffer_view);
+		return 0;
+	}
+
+	int pixels = (int)(buffer_view.len / (components * 4));
+	const float * src = (const float *)buffer_view.buf;
+
+	if (format == PIXEL_FORMAT_SRGB8) {
+		PyObject * res = PyBytes_FromStringAndSize(0, pixels * components);
+		unsigned char * dst = (unsigned char *)PyBytes_AS_STRING(res);
+		for (int i = 0; i < pixels * components; ++i) {
+			// The alpha channel is linear
+			bool alpha = components == 4 && i % 4 == 3;
+			dst[i] = alpha ? (unsigned char)encode_unorm(src[i], 255.0f) : encode_srgb(src[i]);
+		}
+		PyBuffer_Release(&buffer_view);
+		return res;
+	}
+
+	PyObject * res = PyBytes_FromStringAndSize(0, pixels * 4);
+	unsigned * dst = (unsigned *)PyBytes_AS_STRING(res);
+	int i = 0;
+
+#ifdef MGL_SSE2
+	i = sse_encode(format, src, dst, pixels);
+#endif
+
+	for (; i < pixels; ++i) {
+		const float * pixel = src + i * components;
+		switch (format) {
+			case PIXEL_FORMAT_R11G11B10F:
+				dst[i] = encode_r11g11b10f(pixel);
+				break;
+
+			case PIXEL_FORMAT_RGB9E5:
+				dst[i] = encode_rgb9e5(pixel);
+				break;
+
+			default:
+				dst[i] = encode_rgb10a2(pixel);
+				break;
+		}
+	}
+
+	PyBuffer_Release(&buffer_view);
+	return res;
+}
+
+PyObject * decode_pixels(PyObject * self, PyObject * args) {
+	PyObject * data;
+	const char * dtype;
+	Py_ssize_t dtype_size;
+	int components;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"Os#I",
+		&data,
+		&dtype,
+		&dtype_size,
+		&components
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	MGLPixelFormat format;
+	if (!parse_pixel_format(dtype, dtype_size, components, &format)) {
+		return 0;
+	}
+
+	Py_buffer buffer_view;
+
+	int get_buffer = PyObject_GetBuffer(data, &buffer_view, PyBUF_SIMPLE);
+	if (get_buffer < 0) {
+		// Propagate the default error
+		return 0;
+	}
+
+	int pixel_size = format == PIXEL_FORMAT_SRGB8 ? components : 4;
+
+	if (buffer_view.len % pixel_size) {
+		MGLError_Set("the data size %d is not a multiple of the pixel size %d", (int)buffer_view.len, pixel_size);
+		PyBuffer_Release(&buffer_view);
+		return 0;
+	}
+
+	int pixels = (int)(buffer_view.len / pixel_size);
+	PyObject * res = PyBytes_FromStringAndSize(0, pixels * components * 4);
+	float * dst = (float *)PyBytes_AS_STRING(res);
+
+	if (format == PIXEL_FORMAT_SRGB8) {
+		const unsigned char * src = (const unsigned char *)buffer_view.buf;
+		const float * table = srgb_table();
+		for (int i = 0; i < pixels * components; ++i) {
+			bool alpha = components == 4 && i % 4 == 3;
+			dst[i] = alpha ? src[i] * (1.0f / 255.0f) : table[src[i]];
+		}
+		PyBuffer_Release(&buffer_view);
+		return res;
+	}
+
+	const unsigned * src = (const unsigned *)buffer_view.buf;
+	int i = 0;
+
+#ifdef MGL_SSE2
+	i = sse_decode(format, src, dst, pixels);
+#endif
+
+	for (; i < pixels; ++i) {
+		float * pixel = dst + i * components;
+		switch (format) {
+			case PIXEL_FORMAT_R11G11B10F:
+				decode_r11g11b10f(src[i], pixel);
+				break;
+
+			case PIXEL_FORMAT_RGB9E5:
+				decode_rgb9e5(src[i], pixel);
+				break;
+
+			default:
+				decode_rgb10a2(src[i], pixel);
+				break;
+		}
+	}
+
+	PyBuffer_Release(&buffer_view);
+	return res;
+}
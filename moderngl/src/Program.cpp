@@ -2,6 +2,75 @@
 
 #include "InlineMethods.hpp"
 
+void MGLProgram_AddMember(MGLProgram * self, int kind, const char * name, int name_len, int location, int type, int array_length, int size) {
+	MGLProgramMember & member = self->members[self->num_members];
+
+	member.name = PyUnicode_FromStringAndSize(name, name_len);
+	member.mglo = 0;
+	member.kind = kind;
+	member.location = location;
+	member.type = type;
+	member.array_length = array_length;
+	member.size = size;
+
+	PyObject * index = PyLong_FromLong(self->num_members);
+	PyDict_SetItem(self->member_lookup, member.name, index);
+	Py_DECREF(index);
+
+	self->num_members += 1;
+}
+
+MGLProgramMember * MGLProgram_FindMember(MGLProgram * self, PyObject * name) {
+	PyObject * index = PyDict_GetItem(self->member_lookup, name);
+	return index ? &self->members[PyLong_AsLong(index)] : 0;
+}
+
+PyObject * MGLProgram_MemberObject(MGLProgram * self, MGLProgramMember * member) {
+	if (member->mglo) {
+		return member->mglo;
+	}
+
+	const GLMethods & gl = self->context->gl;
+
+	switch (member->kind) {
+		case MGL_ATTRIBUTE_MEMBER: {
+			MGLAttribute * mglo = (MGLAttribute *)MGLAttribute_Type.tp_alloc(&MGLAttribute_Type, 0);
+			mglo->type = member->type;
+			mglo->location = member->location;
+			mglo->array_length = member->array_length;
+			mglo->program_obj = self->program_obj;
+			MGLAttribute_Complete(mglo, gl);
+			member->mglo = (PyObject *)mglo;
+			break;
+		}
+
+		case MGL_UNIFORM_MEMBER: {
+			MGLUniform * mglo = (MGLUniform *)MGLUniform_Type.tp_alloc(&MGLUniform_Type, 0);
+			mglo->type = member->type;
+			mglo->location = member->location;
+			mglo->array_length = member->array_length;
+			mglo->program_obj = self->program_obj;
+			MGLUniform_Complete(mglo, gl);
+			member->mglo = (PyObject *)mglo;
+			break;
+		}
+
+		case MGL_UNIFORM_BLOCK_MEMBER:
+		case MGL_STORAGE_BLOCK_MEMBER: {
+			MGLUniformBlock * mglo = (MGLUniformBlock *)MGLUniformBlock_Type.tp_alloc(&MGLUniformBlock_Type, 0);
+			mglo->index = member->location;
+			mglo->size = member->size;
+			mglo->program_obj = self->program_obj;
+			mglo->storage_block = member->kind == MGL_STORAGE_BLOCK_MEMBER;
+			mglo->gl = &gl;
+			member->mglo = (PyObject *)mglo;
+			break;
+		}
+	}
+
+	return member->mglo;
+}
+
 PyObject * MGLContext_program(MGLContext * self, PyObject * args) {
 	PyObject * shaders[5];
 	PyObject * outputs;
@@ -403,12 +472,17 @@ PyObject * MGLContext_program(MGLContext * self, PyObject * args) {
 	int num_varyings = 0;
 	int num_uniforms = 0;
 	int num_uniform_blocks = 0;
+	int num_storage_blocks = 0;
 
 	gl.GetProgramiv(program->program_obj, GL_ACTIVE_ATTRIBUTES, &num_attributes);
 	gl.GetProgramiv(program->program_obj, GL_TRANSFORM_FEEDBACK_VARYINGS, &num_varyings);
 	gl.GetProgramiv(program->program_obj, GL_ACTIVE_UNIFORMS, &num_uniforms);
 	gl.GetProgramiv(program->program_obj, GL_ACTIVE_UNIFORM_BLOCKS, &num_uniform_blocks);
 
+	if (program->context->version_code >= 430) {
+		gl.GetProgramInterfaceiv(program->program_obj, GL_SHADER_STORAGE_BLOCK, GL_ACTIVE_RESOURCES, &num_storage_blocks);
+	}
+
 	int num_subroutines = num_vertex_shader_subroutines + num_fragment_shader_subroutines + num_geometry_shader_subroutines + num_tess_evaluation_shader_subroutines + num_tess_control_shader_subroutines;
 	int num_subroutine_uniforms = num_vertex_shader_subroutine_uniforms + num_fragment_shader_subroutine_uniforms + num_geometry_shader_subroutine_uniforms + num_tess_evaluation_shader_subroutine_uniforms + num_tess_control_shader_subroutine_uniforms;
 
@@ -420,11 +494,13 @@ PyObject * MGLContext_program(MGLContext * self, PyObject * args) {
 
 	program->num_varyings = num_varyings;
 
-	PyObject * attributes_lst = PyTuple_New(num_attributes);
-	PyObject * varyings_lst = PyTuple_New(num_varyings);
-	PyObject * uniforms_lst = PyTuple_New(num_uniforms);
-	PyObject * uniform_blocks_lst = PyTuple_New(num_uniform_blocks);
-	PyObject * subroutines_lst = PyTuple_New(num_subroutines);
+	// Only the names and locations are recorded here.
+	// The member objects are created on first access by MGLProgram_member.
+
+	program->members = new MGLProgramMember[num_attributes + num_varyings + num_uniforms + num_uniform_blocks + num_storage_blocks + num_subroutines];
+	program->member_lookup = PyDict_New();
+	program->num_members = 0;
+
 	PyObject * subroutine_uniforms_lst = PyTuple_New(num_subroutine_uniforms);
 
 	for (int i = 0; i < num_attributes; ++i) {
@@ -438,43 +514,20 @@ PyObject * MGLContext_program(MGLContext * self, PyObject * args) {
 
 		clean_glsl_name(name, name_len);
 
-		MGLAttribute * mglo = (MGLAttribute *)MGLAttribute_Type.tp_alloc(&MGLAttribute_Type, 0);
-		mglo->type = type;
-		mglo->location = location;
-		mglo->array_length = array_length;
-		mglo->program_obj = program->program_obj;
-		MGLAttribute_Complete(mglo, gl);
-
-		PyObject * item = PyTuple_New(6);
-		PyTuple_SET_ITEM(item, 0, (PyObject *)mglo);
-		PyTuple_SET_ITEM(item, 1, PyLong_FromLong(location));
-		PyTuple_SET_ITEM(item, 2, PyLong_FromLong(array_length));
-		PyTuple_SET_ITEM(item, 3, PyLong_FromLong(mglo->dimension));
-		PyTuple_SET_ITEM(item, 4, PyUnicode_FromFormat("%c", mglo->shape));
-		PyTuple_SET_ITEM(item, 5, PyUnicode_FromStringAndSize(name, name_len));
-
-		PyTuple_SET_ITEM(attributes_lst, i, item);
+		MGLProgram_AddMember(program, MGL_ATTRIBUTE_MEMBER, name, name_len, location, type, array_length, 0);
 	}
 
 	for (int i = 0; i < num_varyings; ++i) {
 		int type = 0;
 		int array_length = 0;
-		int dimension = 0;
 		int name_len = 0;
 		char name[256];
 
 		gl.GetTransformFeedbackVarying(program->program_obj, i, 256, &name_len, &array_length, (GLenum *)&type, name);
 
-		PyObject * item = PyTuple_New(4);
-		PyTuple_SET_ITEM(item, 0, PyLong_FromLong(i));
-		PyTuple_SET_ITEM(item, 1, PyLong_FromLong(array_length));
-		PyTuple_SET_ITEM(item, 2, PyLong_FromLong(dimension));
-		PyTuple_SET_ITEM(item, 3, PyUnicode_FromStringAndSize(name, name_len));
-
-		PyTuple_SET_ITEM(varyings_lst, i, item);
+		MGLProgram_AddMember(program, MGL_VARYING_MEMBER, name, name_len, i, type, array_length, 0);
 	}
 
-	int uniform_counter = 0;
 	for (int i = 0; i < num_uniforms; ++i) {
 		int type = 0;
 		int array_length = 0;
@@ -490,26 +543,7 @@ PyObject * MGLContext_program(MGLContext * self, PyObject * args) {
 			continue;
 		}
 
-		MGLUniform * mglo = (MGLUniform *)MGLUniform_Type.tp_alloc(&MGLUniform_Type, 0);
-		mglo->type = type;
-		mglo->location = location;
-		mglo->array_length = array_length;
-		mglo->program_obj = program->program_obj;
-		MGLUniform_Complete(mglo, gl);
-
-		PyObject * item = PyTuple_New(5);
-		PyTuple_SET_ITEM(item, 0, (PyObject *)mglo);
-		PyTuple_SET_ITEM(item, 1, PyLong_FromLong(location));
-		PyTuple_SET_ITEM(item, 2, PyLong_FromLong(array_length));
-		PyTuple_SET_ITEM(item, 3, PyLong_FromLong(mglo->dimension));
-		PyTuple_SET_ITEM(item, 4, PyUnicode_FromStringAndSize(name, name_len));
-
-		PyTuple_SET_ITEM(uniforms_lst, uniform_counter, item);
-		++uniform_counter;
-	}
-
-	if (uniform_counter != num_uniforms) {
-		_PyTuple_Resize(&uniforms_lst, uniform_counter);
+		MGLProgram_AddMember(program, MGL_UNIFORM_MEMBER, name, name_len, location, type, array_length, 0);
 	}
 
 	for (int i = 0; i < num_uniform_blocks; ++i) {
@@ -523,24 +557,24 @@ PyObject * MGLContext_program(MGLContext * self, PyObject * args) {
 
 		clean_glsl_name(name, name_len);
 
-		MGLUniformBlock * mglo = (MGLUniformBlock *)MGLUniformBlock_Type.tp_alloc(&MGLUniformBlock_Type, 0);
+		MGLProgram_AddMember(program, MGL_UNIFORM_BLOCK_MEMBER, name, name_len, index, 0, 0, size);
+	}
 
-		mglo->index = index;
-		mglo->size = size;
-		mglo->program_obj = program->program_obj;
-		mglo->gl = &gl;
+	for (int i = 0; i < num_storage_blocks; ++i) {
+		int size = 0;
+		int name_len = 0;
+		char name[256];
 
-		PyObject * item = PyTuple_New(4);
-		PyTuple_SET_ITEM(item, 0, (PyObject *)mglo);
-		PyTuple_SET_ITEM(item, 1, PyLong_FromLong(index));
-		PyTuple_SET_ITEM(item, 2, PyLong_FromLong(size));
-		PyTuple_SET_ITEM(item, 3, PyUnicode_FromStringAndSize(name, name_len));
+		GLenum prop = GL_BUFFER_DATA_SIZE;
+		gl.GetProgramResourceName(program->program_obj, GL_SHADER_STORAGE_BLOCK, i, 256, &name_len, name);
+		gl.GetProgramResourceiv(program->program_obj, GL_SHADER_STORAGE_BLOCK, i, 1, &prop, 1, 0, &size);
+
+		clean_glsl_name(name, name_len);
 
-		PyTuple_SET_ITEM(uniform_blocks_lst, i, item);
+		MGLProgram_AddMember(program, MGL_STORAGE_BLOCK_MEMBER, name, name_len, i, 0, 0, size);
 	}
 
 	int subroutine_uniforms_base = 0;
-	int subroutines_base = 0;
 
 	if (program->context->version_code >= 400) {
 		const int shader_type[5] = {
@@ -565,10 +599,7 @@ PyObject * MGLContext_program(MGLContext * self, PyObject * args) {
 				gl.GetActiveSubroutineName(program_obj, shader_type[st], i, 256, &name_len, name);
 				int index = gl.GetSubroutineIndex(program_obj, shader_type[st], name);
 
-				PyObject * item = PyTuple_New(2);
-				PyTuple_SET_ITEM(item, 0, PyLong_FromLong(index));
-				PyTuple_SET_ITEM(item, 1, PyUnicode_FromStringAndSize(name, name_len));
-				PyTuple_SET_ITEM(subroutines_lst, subroutines_base + i, item);
+				MGLProgram_AddMember(program, MGL_SUBROUTINE_MEMBER, name, name_len, index, 0, 0, 0);
 			}
 
 			for (int i = 0; i < num_subroutine_uniforms; ++i) {
@@ -581,7 +612,6 @@ PyObject * MGLContext_program(MGLContext * self, PyObject * args) {
 			}
 
 			subroutine_uniforms_base += num_subroutine_uniforms;
-			subroutines_base += num_subroutines;
 		}
 	}
 
@@ -600,16 +630,14 @@ PyObject * MGLContext_program(MGLContext * self, PyObject * args) {
 	}
 	PyTuple_SET_ITEM(geom_info, 2, PyLong_FromLong(program->geometry_vertices));
 
-	PyObject * result = PyTuple_New(9);
+	Py_INCREF(program->member_lookup);
+
+	PyObject * result = PyTuple_New(5);
 	PyTuple_SET_ITEM(result, 0, (PyObject *)program);
-	PyTuple_SET_ITEM(result, 1, attributes_lst);
-	PyTuple_SET_ITEM(result, 2, varyings_lst);
-	PyTuple_SET_ITEM(result, 3, uniforms_lst);
-	PyTuple_SET_ITEM(result, 4, uniform_blocks_lst);
-	PyTuple_SET_ITEM(result, 5, subroutines_lst);
-	PyTuple_SET_ITEM(result, 6, subroutine_uniforms_lst);
-	PyTuple_SET_ITEM(result, 7, geom_info);
-	PyTuple_SET_ITEM(result, 8, PyLong_FromLong(program->program_obj));
+	PyTuple_SET_ITEM(result, 1, program->member_lookup);
+	PyTuple_SET_ITEM(result, 2, subroutine_uniforms_lst);
+	PyTuple_SET_ITEM(result, 3, geom_info);
+	PyTuple_SET_ITEM(result, 4, PyLong_FromLong(program->program_obj));
 	return result;
 }
 
@@ -631,7 +659,125 @@ PyObject * MGLProgram_release(MGLProgram * self) {
 	Py_RETURN_NONE;
 }
 
+PyObject * MGLProgram_member(MGLProgram * self, PyObject * name) {
+	MGLProgramMember * member = MGLProgram_FindMember(self, name);
+
+	if (!member) {
+		PyErr_SetObject(PyExc_KeyError, name);
+		return 0;
+	}
+
+	PyObject * mglo = MGLProgram_MemberObject(self, member);
+	PyObject * item = 0;
+
+	switch (member->kind) {
+		case MGL_ATTRIBUTE_MEMBER:
+			item = PyTuple_New(6);
+			Py_INCREF(mglo);
+			PyTuple_SET_ITEM(item, 0, mglo);
+			PyTuple_SET_ITEM(item, 1, PyLong_FromLong(member->location));
+			PyTuple_SET_ITEM(item, 2, PyLong_FromLong(member->array_length));
+			PyTuple_SET_ITEM(item, 3, PyLong_FromLong(((MGLAttribute *)mglo)->dimension));
+			PyTuple_SET_ITEM(item, 4, PyUnicode_FromFormat("%c", ((MGLAttribute *)mglo)->shape));
+			break;
+
+		case MGL_VARYING_MEMBER:
+			item = PyTuple_New(4);
+			PyTuple_SET_ITEM(item, 0, PyLong_FromLong(member->location));
+			PyTuple_SET_ITEM(item, 1, PyLong_FromLong(member->array_length));
+			PyTuple_SET_ITEM(item, 2, PyLong_FromLong(0));
+			break;
+
+		case MGL_UNIFORM_MEMBER:
+			item = PyTuple_New(5);
+			Py_INCREF(mglo);
+			PyTuple_SET_ITEM(item, 0, mglo);
+			PyTuple_SET_ITEM(item, 1, PyLong_FromLong(member->location));
+			PyTuple_SET_ITEM(item, 2, PyLong_FromLong(member->array_length));
+			PyTuple_SET_ITEM(item, 3, PyLong_FromLong(((MGLUniform *)mglo)->dimension));
+			break;
+
+		case MGL_UNIFORM_BLOCK_MEMBER:
+		case MGL_STORAGE_BLOCK_MEMBER:
+			item = PyTuple_New(4);
+			Py_INCREF(mglo);
+			PyTuple_SET_ITEM(item, 0, mglo);
+			PyTuple_SET_ITEM(item, 1, PyLong_FromLong(member->location));
+			PyTuple_SET_ITEM(item, 2, PyLong_FromLong(member->size));
+			break;
+
+		case MGL_SUBROUTINE_MEMBER:
+			item = PyTuple_New(2);
+			PyTuple_SET_ITEM(item, 0, PyLong_FromLong(member->location));
+			break;
+	}
+
+	// The name is always the last item
+	Py_INCREF(member->name);
+	PyTuple_SET_ITEM(item, PyTuple_GET_SIZE(item) - 1, member->name);
+
+	PyObject * result = PyTuple_New(2);
+	PyTuple_SET_ITEM(result, 0, PyLong_FromLong(member->kind));
+	PyTuple_SET_ITEM(result, 1, item);
+	return result;
+}
+
+PyObject * MGLProgram_set_uniforms(MGLProgram * self, PyObject * args) {
+	PyObject * values;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"O",
+		&values
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	PyObject * items = PyMapping_Items(values);
+
+	if (!items) {
+		return 0;
+	}
+
+	int num_items = (int)PyList_GET_SIZE(items);
+
+	for (int i = 0; i < num_items; ++i) {
+		PyObject * item = PyList_GET_ITEM(items, i);
+		PyObject * name = PyTuple_GET_ITEM(item, 0);
+		MGLProgramMember * member = MGLProgram_FindMember(self, name);
+
+		if (!member) {
+			MGLError_Set("the program has no uniform %R", name);
+			Py_DECREF(items);
+			return 0;
+		}
+
+		if (member->kind != MGL_UNIFORM_MEMBER) {
+			MGLError_Set("%R is not a uniform", name);
+			Py_DECREF(items);
+			return 0;
+		}
+
+		MGLUniform * uniform = (MGLUniform *)MGLProgram_MemberObject(self, member);
+
+		if (MGLUniform_Write(uniform, PyTuple_GET_ITEM(item, 1)) < 0) {
+			Py_DECREF(items);
+			return 0;
+		}
+	}
+
+	Py_DECREF(items);
+	Py_RETURN_NONE;
+}
+
+PyObject * MGLProgram_uniform_setter(MGLProgram * self, PyObject * args);
+
 PyMethodDef MGLProgram_tp_methods[] = {
+	{"member", (PyCFunction)MGLProgram_member, METH_O, 0},
+	{"set_uniforms", (PyCFunction)MGLProgram_set_uniforms, METH_VARARGS, 0},
+	{"uniform_setter", (PyCFunction)MGLProgram_uniform_setter, METH_VARARGS, 0},
 	{"release", (PyCFunction)MGLProgram_release, METH_NOARGS, 0},
 	{0},
 };
@@ -685,6 +831,20 @@ void MGLProgram_Invalidate(MGLProgram * program) {
 	const GLMethods & gl = program->context->gl;
 	gl.DeleteProgram(program->program_obj);
 
+	if (program->context->bound_program == program->program_obj) {
+		MGLContext_reset_program_state(program->context);
+	}
+
+	for (int i = 0; i < program->num_members; ++i) {
+		Py_DECREF(program->members[i].name);
+		Py_XDECREF(program->members[i].mglo);
+	}
+
+	delete[] program->members;
+	program->members = 0;
+	program->num_members = 0;
+	Py_CLEAR(program->member_lookup);
+
 	Py_SET_TYPE(program, &MGLInvalidObject_Type);
 	Py_DECREF(program);
 }
@@ -1,5 +1,7 @@
 #include "Types.hpp"
 
+#include "InlineMethods.hpp"
+
 PyObject * MGLContext_renderbuffer(MGLContext * self, PyObject * args) {
 	int width;
 	int height;
@@ -43,6 +45,16 @@ PyObject * MGLContext_renderbuffer(MGLContext * self, PyObject * args) {
 		return 0;
 	}
 
+	if (data_type->block_size) {
+		MGLError_Set("compressed dtypes are only supported by textures");
+		return 0;
+	}
+
+	if (!data_type->internal_format[components]) {
+		MGLError_Set("the %s dtype does not support %d components", dtype, components);
+		return 0;
+	}
+
 	int format = data_type->internal_format[components];
 
 	const GLMethods & gl = self->gl;
@@ -73,6 +85,9 @@ PyObject * MGLContext_renderbuffer(MGLContext * self, PyObject * args) {
 	renderbuffer->data_type = data_type;
 	renderbuffer->depth = false;
 
+	long long memory = texture_memory(data_type, components, width, height, 1, false, 1, samples);
+	MGLContext_track_object(self, MGL_MEMORY_RENDERBUFFER, renderbuffer->memory, memory);
+
 	Py_INCREF(self);
 	renderbuffer->context = self;
 
@@ -90,12 +105,17 @@ PyObject * MGLContext_depth_renderbuffer(MGLContext * self, PyObject * args) {
 
 	int samples;
 
+	const char * dtype;
+	Py_ssize_t dtype_size;
+
 	int args_ok = PyArg_ParseTuple(
 		args,
-		"(II)I",
+		"(II)Is#",
 		&width,
 		&height,
-		&samples
+		&samples,
+		&dtype,
+		&dtype_size
 	);
 
 	if (!args_ok) {
@@ -107,6 +127,13 @@ PyObject * MGLContext_depth_renderbuffer(MGLContext * self, PyObject * args) {
 		return 0;
 	}
 
+	MGLDataType * data_type = from_depth_dtype(dtype, dtype_size);
+
+	if (!data_type) {
+		MGLError_Set("invalid depth dtype");
+		return 0;
+	}
+
 	const GLMethods & gl = self->gl;
 
 	MGLRenderbuffer * renderbuffer = (MGLRenderbuffer *)MGLRenderbuffer_Type.tp_alloc(&MGLRenderbuffer_Type, 0);
@@ -123,18 +150,21 @@ PyObject * MGLContext_depth_renderbuffer(MGLContext * self, PyObject * args) {
 	gl.BindRenderbuffer(GL_RENDERBUFFER, renderbuffer->renderbuffer_obj);
 
 	if (samples == 0) {
-		gl.RenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT24, width, height);
+		gl.RenderbufferStorage(GL_RENDERBUFFER, data_type->internal_format[1], width, height);
 	} else {
-		gl.RenderbufferStorageMultisample(GL_RENDERBUFFER, samples, GL_DEPTH_COMPONENT24, width, height);
+		gl.RenderbufferStorageMultisample(GL_RENDERBUFFER, samples, data_type->internal_format[1], width, height);
 	}
 
 	renderbuffer->width = width;
 	renderbuffer->height = height;
 	renderbuffer->components = 1;
 	renderbuffer->samples = samples;
-	renderbuffer->data_type = from_dtype("f4", 2);
+	renderbuffer->data_type = data_type;
 	renderbuffer->depth = true;
 
+	long long memory = texture_memory(data_type, 1, width, height, 1, false, 1, samples);
+	MGLContext_track_object(self, MGL_MEMORY_RENDERBUFFER, renderbuffer->memory, memory);
+
 	Py_INCREF(self);
 	renderbuffer->context = self;
 
@@ -220,6 +250,8 @@ void MGLRenderbuffer_Invalidate(MGLRenderbuffer * renderbuffer) {
 	const GLMethods & gl = renderbuffer->context->gl;
 	gl.DeleteRenderbuffers(1, (GLuint *)&renderbuffer->renderbuffer_obj);
 
+	MGLContext_untrack_object(renderbuffer->context, MGL_MEMORY_RENDERBUFFER, renderbuffer->memory);
+
 	Py_SET_TYPE(renderbuffer, &MGLInvalidObject_Type);
 	Py_DECREF(renderbuffer);
 }
@@ -0,0 +1,192 @@
+#include <vector>
+
+#include "Types.hpp"
+
+#include "InlineMethods.hpp"
+
+// Evicts and restores the storage of mutable textures for the residency manager.
+// Eviction respecifies every level with an empty image, the driver frees the storage while the
+// texture object keeps its name, parameters and the bindings referring to it. The levels can be
+// read back first, the snapshot is tightly packed level by level and the faces of a cube map
+// are stored one after the other in every level. Restoring specifies the levels again.
+
+struct MGLResidencyLevel {
+	int width;
+	int height;
+	int depth;
+	size_t offset;
+};
+
+bool MGLContext_check_evict(MGLDataType * data_type, bool immutable, int samples) {
+	if (samples) {
+		MGLError_Set("multisample textures cannot be evicted");
+		return false;
+	}
+
+	if (immutable) {
+		MGLError_Set("immutable textures cannot be evicted");
+		return false;
+	}
+
+	if (data_type->block_size) {
+		MGLError_Set("compressed textures cannot be evicted");
+		return false;
+	}
+
+	return true;
+}
+
+static bool residency_levels(
+	MGLDataType * data_type, int components, bool immutable, int target, int width, int height, int depth,
+	int levels, std::vector<MGLResidencyLevel> & result
+) {
+	if (!MGLContext_check_evict(data_type, immutable, 0)) {
+		return false;
+	}
+
+	bool volume = target == GL_TEXTURE_3D;
+	int images = target == GL_TEXTURE_CUBE_MAP ? 6 : 1;
+	size_t offset = 0;
+
+	for (int i = 0; i < levels; ++i) {
+		MGLResidencyLevel level;
+		level.width = max(width >> i, 1);
+		level.height = max(height >> i, 1);
+		level.depth = volume ? max(depth >> i, 1) : depth;
+		level.offset = offset;
+		offset += (size_t)level.width * level.height * level.depth * images * pixel_size(data_type, components);
+		result.push_back(level);
+		if (level.width == 1 && level.height == 1 && (!volume || level.depth == 1)) {
+			break;
+		}
+	}
+
+	MGLResidencyLevel end = {0, 0, 0, offset};
+	result.push_back(end);
+	return true;
+}
+
+static void residency_specify(
+	const GLMethods & gl, int target, int level, int internal_format, int base_format, int pixel_type,
+	int width, int height, int depth, const char * data, size_t face_size
+) {
+	if (target == GL_TEXTURE_CUBE_MAP) {
+		for (int face = 0; face < 6; ++face) {
+			const char * face_data = data ? data + face * face_size : 0;
+			gl.TexImage2D(
+				GL_TEXTURE_CUBE_MAP_POSITIVE_X + face, level, internal_format, width, height, 0, base_format, pixel_type, face_data
+			);
+		}
+	} else if (target == GL_TEXTURE_2D) {
+		gl.TexImage2D(target, level, internal_format, width, height, 0, base_format, pixel_type, data);
+	} else {
+		gl.TexImage3D(target, level, internal_format, width, height, depth, 0, base_format, pixel_type, data);
+	}
+}
+
+PyObject * MGLContext_evict_texture(
+	MGLContext * context, int target, int texture_obj, MGLDataType * data_type, int components, int internal_format,
+	bool immutable, int width, int height, int depth, int levels, bool keep
+) {
+	std::vector<MGLResidencyLevel> level_info;
+	if (!residency_levels(data_type, components, immutable, target, width, height, depth, levels, level_info)) {
+		return 0;
+	}
+
+	int base_format = data_type->base_format[components];
+	int pixel_type = data_type->gl_type;
+	int count = (int)level_info.size() - 1;
+
+	const GLMethods & gl = context->gl;
+
+	gl.ActiveTexture(GL_TEXTURE0 + context->default_texture_unit);
+	gl.BindTexture(target, texture_obj);
+
+	PyObject * snapshot = 0;
+
+	if (keep) {
+		snapshot = PyBytes_FromStringAndSize(0, level_info[count].offset);
+		char * data = PyBytes_AS_STRING(snapshot);
+
+		gl.PixelStorei(GL_PACK_ALIGNMENT, 1);
+
+		for (int i = 0; i < count; ++i) {
+			const MGLResidencyLevel & level = level_info[i];
+			if (target == GL_TEXTURE_CUBE_MAP) {
+				size_t face_size = (level_info[i + 1].offset - level.offset) / 6;
+				for (int face = 0; face < 6; ++face) {
+					gl.GetTexImage(GL_TEXTURE_CUBE_MAP_POSITIVE_X + face, i, base_format, pixel_type, data + level.offset + face * face_size);
+				}
+			} else {
+				gl.GetTexImage(target, i, base_format, pixel_type, data + level.offset);
+			}
+		}
+	}
+
+	for (int i = 0; i < count; ++i) {
+		residency_specify(gl, target, i, internal_format, base_format, pixel_type, 0, 0, 0, 0, 0);
+	}
+
+	if (!snapshot) {
+		Py_RETURN_NONE;
+	}
+
+	return snapshot;
+}
+
+bool MGLContext_restore_texture(
+	MGLContext * context, int target, int texture_obj, MGLDataType * data_type, int components, int internal_format,
+	bool immutable, int width, int height, int depth, int levels, PyObject * data
+) {
+	std::vector<MGLResidencyLevel> level_info;
+	if (!residency_levels(data_type, components, immutable, target, width, height, depth, levels, level_info)) {
+		return false;
+	}
+
+	int count = (int)level_info.size() - 1;
+
+	Py_buffer buffer_view;
+
+	if (data != Py_None) {
+		int get_buffer = PyObject_GetBuffer(data, &buffer_view, PyBUF_SIMPLE);
+		if (get_buffer < 0) {
+			// Propagate the default error
+			return false;
+		}
+	} else {
+		buffer_view.len = level_info[count].offset;
+		buffer_view.buf = 0;
+	}
+
+	if ((size_t)buffer_view.len != level_info[count].offset) {
+		MGLError_Set("data size mismatch %zd != %zd", buffer_view.len, (Py_ssize_t)level_info[count].offset);
+		if (data != Py_None) {
+			PyBuffer_Release(&buffer_view);
+		}
+		return false;
+	}
+
+	int base_format = data_type->base_format[components];
+	int pixel_type = data_type->gl_type;
+
+	const GLMethods & gl = context->gl;
+
+	gl.ActiveTexture(GL_TEXTURE0 + context->default_texture_unit);
+	gl.BindTexture(target, texture_obj);
+	gl.PixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+	for (int i = 0; i < count; ++i) {
+		const MGLResidencyLevel & level = level_info[i];
+		const char * level_data = buffer_view.buf ? (const char *)buffer_view.buf + level.offset : 0;
+		size_t face_size = (level_info[i + 1].offset - level.offset) / 6;
+		residency_specify(
+			gl, target, i, internal_format, base_format, pixel_type, level.width, level.height, level.depth, level_data, face_size
+		);
+	}
+
+	if (data != Py_None) {
+		PyBuffer_Release(&buffer_view);
+	}
+
+	return true;
+}
@@ -17,9 +17,11 @@ PyObject * MGLContext_texture(MGLContext * self, PyObject * args) {
 	Py_ssize_t dtype_size;
 	int internal_format_override;
 
+	int levels;
+
 	int args_ok = PyArg_ParseTuple(
 		args,
-		"(II)IOIIs#I",
+		"(II)IOIIs#Ii",
 		&width,
 		&height,
 		&components,
@@ -28,7 +30,8 @@ PyObject * MGLContext_texture(MGLContext * self, PyObject * args) {
 		&alignment,
 		&dtype,
 		&dtype_size,
-		&internal_format_override
+		&internal_format_override,
+		&levels
 	);
 
 	if (!args_ok) {
@@ -62,10 +65,42 @@ PyObject * MGLContext_texture(MGLContext * self, PyObject * args) {
 		return 0;
 	}
 
-	int expected_size = width * components * data_type->size;
+	if (samples && levels < 0) {
+		levels = 1;
+	}
+
+	if (samples && levels > 1) {
+		MGLError_Set("multisample textures have a single level");
+		return 0;
+	}
+
+	if (!data_type->internal_format[components]) {
+		MGLError_Set("the %s dtype does not support %d components", dtype, components);
+		return 0;
+	}
+
+	if (data_type->block_size && samples) {
+		MGLError_Set("multisample textures cannot be compressed");
+		return 0;
+	}
+
+	if (!MGLContext_texture_levels(self, levels, width, height, 1)) {
+		return 0;
+	}
+
+	if (samples && levels && (self->version_code < 430 || !self->gl.TexStorage2DMultisample)) {
+		MGLError_Set("immutable multisample textures require OpenGL 4.3");
+		return 0;
+	}
+
+	int expected_size = width * pixel_size(data_type, components);
 	expected_size = (expected_size + alignment - 1) / alignment * alignment;
 	expected_size = expected_size * height;
 
+	if (data_type->block_size) {
+		expected_size = compressed_image_size(data_type, components, width, height);
+	}
+
 	Py_buffer buffer_view;
 
 	if (data != Py_None) {
@@ -109,12 +144,25 @@ PyObject * MGLContext_texture(MGLContext * self, PyObject * args) {
 
 	gl.BindTexture(texture_target, texture->texture_obj);
 
-	if (samples) {
+	if (samples && levels) {
+		gl.TexStorage2DMultisample(texture_target, samples, internal_format, width, height, true);
+	} else if (samples) {
 		gl.TexImage2DMultisample(texture_target, samples, internal_format, width, height, true);
 	} else {
 		gl.PixelStorei(GL_PACK_ALIGNMENT, alignment);
 		gl.PixelStorei(GL_UNPACK_ALIGNMENT, alignment);
-		gl.TexImage2D(texture_target, 0, internal_format, width, height, 0, base_format, pixel_type, buffer_view.buf);
+		if (levels) {
+			gl.TexStorage2D(texture_target, levels, internal_format, width, height);
+			if (buffer_view.buf && data_type->block_size) {
+				gl.CompressedTexSubImage2D(texture_target, 0, 0, 0, width, height, internal_format, expected_size, buffer_view.buf);
+			} else if (buffer_view.buf) {
+				gl.TexSubImage2D(texture_target, 0, 0, 0, width, height, base_format, pixel_type, buffer_view.buf);
+			}
+		} else if (buffer_view.buf && data_type->block_size) {
+			gl.CompressedTexImage2D(texture_target, 0, internal_format, width, height, 0, expected_size, buffer_view.buf);
+		} else {
+			gl.TexImage2D(texture_target, 0, internal_format, width, height, 0, base_format, pixel_type, buffer_view.buf);
+		}
 		if (data_type->float_type) {
 			gl.TexParameteri(texture_target, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
 			gl.TexParameteri(texture_target, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
@@ -132,9 +180,11 @@ PyObject * MGLContext_texture(MGLContext * self, PyObject * args) {
 	texture->height = height;
 	texture->components = components;
 	texture->samples = samples;
+	texture->internal_format = internal_format;
 	texture->data_type = data_type;
 
-	texture->max_level = 0;
+	texture->max_level = levels ? levels - 1 : 0;
+	texture->levels = levels;
 	texture->compare_func = 0;
 	texture->anisotropy = 1.0f;
 	texture->depth = false;
@@ -147,6 +197,7 @@ PyObject * MGLContext_texture(MGLContext * self, PyObject * args) {
 
 	Py_INCREF(self);
 	texture->context = self;
+	MGLContext_track_object(self, MGL_MEMORY_TEXTURE, texture->memory, MGLTexture_memory(texture));
 
 	Py_INCREF(texture);
 
@@ -165,14 +216,22 @@ PyObject * MGLContext_depth_texture(MGLContext * self, PyObject * args) {
 	int samples;
 	int alignment;
 
+	int levels;
+
+	const char * dtype;
+	Py_ssize_t dtype_size;
+
 	int args_ok = PyArg_ParseTuple(
 		args,
-		"(II)OII",
+		"(II)OIIis#",
 		&width,
 		&height,
 		&data,
 		&samples,
-		&alignment
+		&alignment,
+		&levels,
+		&dtype,
+		&dtype_size
 	);
 
 	if (!args_ok) {
@@ -184,12 +243,37 @@ PyObject * MGLContext_depth_texture(MGLContext * self, PyObject * args) {
 		return 0;
 	}
 
+	MGLDataType * data_type = from_depth_dtype(dtype, dtype_size);
+
+	if (!data_type) {
+		MGLError_Set("invalid depth dtype");
+		return 0;
+	}
+
 	if (data != Py_None && samples) {
 		MGLError_Set("multisample textures are not writable directly");
 		return 0;
 	}
 
-	int expected_size = width * 4;
+	if (samples && levels < 0) {
+		levels = 1;
+	}
+
+	if (samples && levels > 1) {
+		MGLError_Set("multisample textures have a single level");
+		return 0;
+	}
+
+	if (!MGLContext_texture_levels(self, levels, width, height, 1)) {
+		return 0;
+	}
+
+	if (samples && levels && (self->version_code < 430 || !self->gl.TexStorage2DMultisample)) {
+		MGLError_Set("immutable multisample textures require OpenGL 4.3");
+		return 0;
+	}
+
+	int expected_size = width * pixel_size(data_type, 1);
 	expected_size = (expected_size + alignment - 1) / alignment * alignment;
 	expected_size = expected_size * height;
 
@@ -215,7 +299,9 @@ PyObject * MGLContext_depth_texture(MGLContext * self, PyObject * args) {
 	}
 
 	int texture_target = samples ? GL_TEXTURE_2D_MULTISAMPLE : GL_TEXTURE_2D;
-	int pixel_type = GL_FLOAT;
+	int internal_format = data_type->internal_format[1];
+	int base_format = data_type->base_format[1];
+	int pixel_type = data_type->gl_type;
 
 	const GLMethods & gl = self->gl;
 
@@ -234,14 +320,23 @@ PyObject * MGLContext_depth_texture(MGLContext * self, PyObject * args) {
 
 	gl.BindTexture(texture_target, texture->texture_obj);
 
-	if (samples) {
-		gl.TexImage2DMultisample(texture_target, samples, GL_DEPTH_COMPONENT24, width, height, true);
+	if (samples && levels) {
+		gl.TexStorage2DMultisample(texture_target, samples, internal_format, width, height, true);
+	} else if (samples) {
+		gl.TexImage2DMultisample(texture_target, samples, internal_format, width, height, true);
 	} else {
 		gl.TexParameteri(texture_target, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
 		gl.TexParameteri(texture_target, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
 		gl.PixelStorei(GL_PACK_ALIGNMENT, alignment);
 		gl.PixelStorei(GL_UNPACK_ALIGNMENT, alignment);
-		gl.TexImage2D(texture_target, 0, GL_DEPTH_COMPONENT24, width, height, 0, GL_DEPTH_COMPONENT, pixel_type, buffer_view.buf);
+		if (levels) {
+			gl.TexStorage2D(texture_target, levels, internal_format, width, height);
+			if (buffer_view.buf) {
+				gl.TexSubImage2D(texture_target, 0, 0, 0, width, height, base_format, pixel_type, buffer_view.buf);
+			}
+		} else {
+			gl.TexImage2D(texture_target, 0, internal_format, width, height, 0, base_format, pixel_type, buffer_view.buf);
+		}
 		gl.TexParameteri(texture_target, GL_TEXTURE_COMPARE_MODE, GL_COMPARE_REF_TO_TEXTURE);
 		gl.TexParameteri(texture_target, GL_TEXTURE_COMPARE_FUNC, GL_LEQUAL);
 	}
@@ -254,20 +349,23 @@ PyObject * MGLContext_depth_texture(MGLContext * self, PyObject * args) {
 	texture->height = height;
 	texture->components = 1;
 	texture->samples = samples;
-	texture->data_type = from_dtype("f4", 2);
+	texture->internal_format = internal_format;
+	texture->data_type = data_type;
 
 	texture->compare_func = GL_LEQUAL;
 	texture->depth = true;
 
 	texture->min_filter = GL_LINEAR;
 	texture->mag_filter = GL_LINEAR;
-	texture->max_level = 0;
+	texture->max_level = levels ? levels - 1 : 0;
+	texture->levels = levels;
 
 	texture->repeat_x = false;
 	texture->repeat_y = false;
 
 	Py_INCREF(self);
 	texture->context = self;
+	MGLContext_track_object(self, MGL_MEMORY_TEXTURE, texture->memory, MGLTexture_memory(texture));
 
 	Py_INCREF(texture);
 
@@ -310,7 +408,7 @@ PyObject * MGLTexture_read(MGLTexture * self, PyObject * args) {
 		return 0;
 	}
 
-	if (level > self->max_level) {
+	if (level < 0 || level > self->max_level) {
 		MGLError_Set("invalid level");
 		return 0;
 	}
@@ -326,15 +424,19 @@ PyObject * MGLTexture_read(MGLTexture * self, PyObject * args) {
 	width = width > 1 ? width : 1;
 	height = height > 1 ? height : 1;
 
-	int expected_size = width * self->components * self->data_type->size;
+	int expected_size = width * pixel_size(self->data_type, self->components);
 	expected_size = (expected_size + alignment - 1) / alignment * alignment;
 	expected_size = expected_size * height;
 
+	if (self->data_type->block_size) {
+		expected_size = compressed_image_size(self->data_type, self->components, width, height);
+	}
+
 	PyObject * result = PyBytes_FromStringAndSize(0, expected_size);
 	char * data = PyBytes_AS_STRING(result);
 
 	int pixel_type = self->data_type->gl_type;
-	int base_format = self->depth ? GL_DEPTH_COMPONENT : self->data_type->base_format[self->components];
+	int base_format = self->data_type->base_format[self->components];
 
 	const GLMethods & gl = self->context->gl;
 
@@ -364,7 +466,11 @@ PyObject * MGLTexture_read(MGLTexture * self, PyObject * args) {
 	// printf("level_width: %d\n", level_width);
 	// printf("level_height: %d\n", level_height);
 
-	gl.GetTexImage(GL_TEXTURE_2D, level, base_format, pixel_type, data);
+	if (self->data_type->block_size) {
+		gl.GetCompressedTexImage(GL_TEXTURE_2D, level, data);
+	} else {
+		gl.GetTexImage(GL_TEXTURE_2D, level, base_format, pixel_type, data);
+	}
 
 	return result;
 }
@@ -373,14 +479,19 @@ PyObject * MGLTexture_read_into(MGLTexture * self, PyObject * args) {
 	PyObject * data;
 	int level;
 	int alignment;
+	MGLPixelStore store;
 	Py_ssize_t write_offset;
 
 	int args_ok = PyArg_ParseTuple(
 		args,
-		"OIIn",
+		"OII(iiii)n",
 		&data,
 		&level,
 		&alignment,
+		&store.row_length,
+		&store.skip_pixels,
+		&store.skip_rows,
+		&store.image_height,
 		&write_offset
 	);
 
@@ -393,7 +504,12 @@ PyObject * MGLTexture_read_into(MGLTexture * self, PyObject * args) {
 		return 0;
 	}
 
-	if (level > self->max_level) {
+	if (!pixel_store_ok(store)) {
+		MGLError_Set("the pixel store parameters must not be negative");
+		return 0;
+	}
+
+	if (level < 0 || level > self->max_level) {
 		MGLError_Set("invalid level");
 		return 0;
 	}
@@ -409,12 +525,24 @@ PyObject * MGLTexture_read_into(MGLTexture * self, PyObject * args) {
 	width = width > 1 ? width : 1;
 	height = height > 1 ? height : 1;
 
-	int expected_size = width * self->components * self->data_type->size;
+	Py_ssize_t expected_size = (Py_ssize_t)width * pixel_size(self->data_type, self->components);
 	expected_size = (expected_size + alignment - 1) / alignment * alignment;
 	expected_size = expected_size * height;
 
+	if (self->data_type->block_size) {
+		expected_size = compressed_image_size(self->data_type, self->components, width, height);
+	}
+
+	if (!pixel_store_default(store)) {
+		if (self->data_type->block_size) {
+			MGLError_Set("pixel store parameters are not supported by compressed textures");
+			return 0;
+		}
+		expected_size = pixel_store_size(store, width, height, 1, pixel_size(self->data_type, self->components), alignment);
+	}
+
 	int pixel_type = self->data_type->gl_type;
-	int base_format = self->depth ? GL_DEPTH_COMPONENT : self->data_type->base_format[self->components];
+	int base_format = self->data_type->base_format[self->components];
 
 	if (Py_TYPE(data) == &MGLBuffer_Type) {
 
@@ -427,7 +555,13 @@ PyObject * MGLTexture_read_into(MGLTexture * self, PyObject * args) {
 		gl.BindTexture(GL_TEXTURE_2D, self->texture_obj);
 		gl.PixelStorei(GL_PACK_ALIGNMENT, alignment);
 		gl.PixelStorei(GL_UNPACK_ALIGNMENT, alignment);
-		gl.GetTexImage(GL_TEXTURE_2D, level, base_format, pixel_type, (void *)write_offset);
+		set_pixel_store(gl, true, store);
+		if (self->data_type->block_size) {
+			gl.GetCompressedTexImage(GL_TEXTURE_2D, level, (void *)write_offset);
+		} else {
+			gl.GetTexImage(GL_TEXTURE_2D, level, base_format, pixel_type, (void *)write_offset);
+		}
+		reset_pixel_store(gl, true, store);
 		gl.BindBuffer(GL_PIXEL_PACK_BUFFER, 0);
 
 	} else {
@@ -454,7 +588,13 @@ PyObject * MGLTexture_read_into(MGLTexture * self, PyObject * args) {
 		gl.BindTexture(GL_TEXTURE_2D, self->texture_obj);
 		gl.PixelStorei(GL_PACK_ALIGNMENT, alignment);
 		gl.PixelStorei(GL_UNPACK_ALIGNMENT, alignment);
-		gl.GetTexImage(GL_TEXTURE_2D, level, base_format, pixel_type, ptr);
+		set_pixel_store(gl, true, store);
+		if (self->data_type->block_size) {
+			gl.GetCompressedTexImage(GL_TEXTURE_2D, level, ptr);
+		} else {
+			gl.GetTexImage(GL_TEXTURE_2D, level, base_format, pixel_type, ptr);
+		}
+		reset_pixel_store(gl, true, store);
 
 		PyBuffer_Release(&buffer_view);
 
@@ -468,14 +608,23 @@ PyObject * MGLTexture_write(MGLTexture * self, PyObject * args) {
 	PyObject * viewport;
 	int level;
 	int alignment;
+	MGLPixelStore store;
+	Py_ssize_t read_offset;
+	Py_ssize_t read_size;
 
 	int args_ok = PyArg_ParseTuple(
 		args,
-		"OOII",
+		"OOII(iiii)nn",
 		&data,
 		&viewport,
 		&level,
-		&alignment
+		&alignment,
+		&store.row_length,
+		&store.skip_pixels,
+		&store.skip_rows,
+		&store.image_height,
+		&read_offset,
+		&read_size
 	);
 
 	if (!args_ok) {
@@ -487,7 +636,12 @@ PyObject * MGLTexture_write(MGLTexture * self, PyObject * args) {
 		return 0;
 	}
 
-	if (level > self->max_level) {
+	if (!pixel_store_ok(store)) {
+		MGLError_Set("the pixel store parameters must not be negative");
+		return 0;
+	}
+
+	if (level < 0 || level > self->max_level) {
 		MGLError_Set("invalid level");
 		return 0;
 	}
@@ -505,6 +659,9 @@ PyObject * MGLTexture_write(MGLTexture * self, PyObject * args) {
 	width = width > 1 ? width : 1;
 	height = height > 1 ? height : 1;
 
+	int level_width = width;
+	int level_height = height;
+
 	Py_buffer buffer_view;
 
 	if (viewport != Py_None) {
@@ -539,10 +696,26 @@ PyObject * MGLTexture_write(MGLTexture * self, PyObject * args) {
 
 	}
 
-	int expected_size = width * self->components * self->data_type->size;
+	Py_ssize_t expected_size = (Py_ssize_t)width * pixel_size(self->data_type, self->components);
 	expected_size = (expected_size + alignment - 1) / alignment * alignment;
 	expected_size = expected_size * height;
 
+	if (self->data_type->block_size) {
+		if (!compressed_viewport_ok(x, y, width, height, level_width, level_height)) {
+			MGLError_Set("the viewport must be aligned to 4x4 blocks");
+			return 0;
+		}
+		expected_size = compressed_image_size(self->data_type, self->components, width, height);
+	}
+
+	if (!pixel_store_default(store)) {
+		if (self->data_type->block_size) {
+			MGLError_Set("pixel store parameters are not supported by compressed textures");
+			return 0;
+		}
+		expected_size = pixel_store_size(store, width, height, 1, pixel_size(self->data_type, self->components), alignment);
+	}
+
 	int texture_target = self->samples ? GL_TEXTURE_2D_MULTISAMPLE : GL_TEXTURE_2D;
 	int pixel_type = self->data_type->gl_type;
 	int format = self->data_type->base_format[self->components];
@@ -551,6 +724,17 @@ PyObject * MGLTexture_write(MGLTexture * self, PyObject * args) {
 
 		MGLBuffer * buffer = (MGLBuffer *)data;
 
+		if (read_offset < 0 || read_offset + expected_size > buffer->size) {
+			MGLError_Set("the buffer is too small");
+			return 0;
+		}
+
+		// The number of bytes staged for this transfer, -1 when the rest of the buffer is available
+		if (read_size >= 0 && read_size != expected_size) {
+			MGLError_Set("data size mismatch %zd != %zd", read_size, expected_size);
+			return 0;
+		}
+
 		const GLMethods & gl = self->context->gl;
 
 		gl.BindBuffer(GL_PIXEL_UNPACK_BUFFER, buffer->buffer_obj);
@@ -558,7 +742,13 @@ PyObject * MGLTexture_write(MGLTexture * self, PyObject * args) {
 		gl.BindTexture(texture_target, self->texture_obj);
 		gl.PixelStorei(GL_PACK_ALIGNMENT, alignment);
 		gl.PixelStorei(GL_UNPACK_ALIGNMENT, alignment);
-		gl.TexSubImage2D(texture_target, level, x, y, width, height, format, pixel_type, 0);
+		set_pixel_store(gl, false, store);
+		if (self->data_type->block_size) {
+			gl.CompressedTexSubImage2D(texture_target, level, x, y, width, height, self->internal_format, expected_size, (void *)read_offset);
+		} else {
+			gl.TexSubImage2D(texture_target, level, x, y, width, height, format, pixel_type, (void *)read_offset);
+		}
+		reset_pixel_store(gl, false, store);
 		gl.BindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
 
 	} else {
@@ -569,8 +759,8 @@ PyObject * MGLTexture_write(MGLTexture * self, PyObject * args) {
 			return 0;
 		}
 
-		if (buffer_view.len != expected_size) {
-			MGLError_Set("data size mismatch %d != %d", buffer_view.len, expected_size);
+		if (pixel_store_default(store) ? buffer_view.len != expected_size : buffer_view.len < expected_size) {
+			MGLError_Set("data size mismatch %zd != %zd", buffer_view.len, expected_size);
 			if (data != Py_None) {
 				PyBuffer_Release(&buffer_view);
 			}
@@ -583,7 +773,13 @@ PyObject * MGLTexture_write(MGLTexture * self, PyObject * args) {
 		gl.BindTexture(texture_target, self->texture_obj);
 		gl.PixelStorei(GL_PACK_ALIGNMENT, alignment);
 		gl.PixelStorei(GL_UNPACK_ALIGNMENT, alignment);
-		gl.TexSubImage2D(texture_target, level, x, y, width, height, format, pixel_type, buffer_view.buf);
+		set_pixel_store(gl, false, store);
+		if (self->data_type->block_size) {
+			gl.CompressedTexSubImage2D(texture_target, level, x, y, width, height, self->internal_format, expected_size, buffer_view.buf);
+		} else {
+			gl.TexSubImage2D(texture_target, level, x, y, width, height, format, pixel_type, buffer_view.buf);
+		}
+		reset_pixel_store(gl, false, store);
 
 		PyBuffer_Release(&buffer_view);
 
@@ -650,15 +846,67 @@ PyObject * MGLTexture_use(MGLTexture * self, PyObject * args) {
 	Py_RETURN_NONE;
 }
 
+PyObject * MGLTexture_clear(MGLTexture * self, PyObject * args) {
+	PyObject * value;
+	int level;
+	PyObject * viewport;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"OIO",
+		&value,
+		&level,
+		&viewport
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	if (level < 0 || level > self->max_level) {
+		MGLError_Set("invalid level");
+		return 0;
+	}
+
+	int level_size[3] = {max(self->width >> level, 1), max(self->height >> level, 1), 1};
+	int offset[3] = {0, 0, 0};
+	int size[3] = {level_size[0], level_size[1], 1};
+
+	if (!parse_texture_viewport(viewport, 2, offset, size)) {
+		return 0;
+	}
+
+	if (!texture_viewport_ok(2, offset, size, level_size)) {
+		MGLError_Set("the viewport is out of range");
+		return 0;
+	}
+
+	bool region = viewport != Py_None;
+
+	if (!MGLContext_clear_texture(self->context, self->texture_obj, self->data_type, self->components, self->depth, value, level, region, offset, size)) {
+		return 0;
+	}
+
+	Py_RETURN_NONE;
+}
+
 PyObject * MGLTexture_build_mipmaps(MGLTexture * self, PyObject * args) {
 	int base = 0;
 	int max = 1000;
 
+	const char * method;
+	Py_ssize_t method_size;
+
+	int cpu;
+
 	int args_ok = PyArg_ParseTuple(
 		args,
-		"II",
+		"IIs#p",
 		&base,
-		&max
+		&max,
+		&method,
+		&method_size,
+		&cpu
 	);
 
 	if (!args_ok) {
@@ -670,40 +918,265 @@ PyObject * MGLTexture_build_mipmaps(MGLTexture * self, PyObject * args) {
 		return 0;
 	}
 
+	if (!cpu && (method_size != 3 || memcmp(method, "box", 3))) {
+		MGLError_Set("the %s method requires cpu=True", method);
+		return 0;
+	}
+
+	// Immutable textures keep their level count
+	if (self->levels && max > self->levels - 1) {
+		max = self->levels - 1;
+	}
+
+	if (cpu && self->samples) {
+		MGLError_Set("multisample textures cannot build mipmaps");
+		return 0;
+	}
+
 	int texture_target = self->samples ? GL_TEXTURE_2D_MULTISAMPLE : GL_TEXTURE_2D;
 
 	const GLMethods & gl = self->context->gl;
 
-	gl.ActiveTexture(GL_TEXTURE0 + self->context->default_texture_unit);
-	gl.BindTexture(texture_target, self->texture_obj);
+	if (cpu) {
+		max = MGLContext_build_mipmaps(
+			self->context, texture_target, self->texture_obj, self->data_type, self->components,
+			self->internal_format, self->levels != 0, self->width, self->height, 1, base, max, method, method_size
+		);
 
-	gl.TexParameteri(texture_target, GL_TEXTURE_BASE_LEVEL, base);
-	gl.TexParameteri(texture_target, GL_TEXTURE_MAX_LEVEL, max);
+		if (max < 0) {
+			return 0;
+		}
+	} else {
+		gl.ActiveTexture(GL_TEXTURE0 + self->context->default_texture_unit);
+		gl.BindTexture(texture_target, self->texture_obj);
+
+		gl.TexParameteri(texture_target, GL_TEXTURE_BASE_LEVEL, base);
+		gl.TexParameteri(texture_target, GL_TEXTURE_MAX_LEVEL, max);
+
+		gl.GenerateMipmap(texture_target);
+	}
 
-	gl.GenerateMipmap(texture_target);
+	// Integer textures cannot be filtered linearly
+	int min_filter = self->data_type->float_type ? GL_LINEAR_MIPMAP_LINEAR : GL_NEAREST_MIPMAP_NEAREST;
+	int mag_filter = self->data_type->float_type ? GL_LINEAR : GL_NEAREST;
 
-	gl.TexParameteri(texture_target, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
-	gl.TexParameteri(texture_target, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+	gl.TexParameteri(texture_target, GL_TEXTURE_MIN_FILTER, min_filter);
+	gl.TexParameteri(texture_target, GL_TEXTURE_MAG_FILTER, mag_filter);
 
-	self->min_filter = GL_LINEAR_MIPMAP_LINEAR;
-	self->mag_filter = GL_LINEAR;
-	self->max_level = max;
+	self->min_filter = min_filter;
+	self->mag_filter = mag_filter;
+	self->max_level = self->levels ? self->levels - 1 : max;
+
+	// Immutable textures and views keep the storage they were created with
+	if (!self->levels) {
+		MGLContext_track_memory(self->context, MGL_MEMORY_TEXTURE, self->memory, MGLTexture_memory(self));
+	}
 
 	Py_RETURN_NONE;
 }
 
+// Creates a 2D texture sharing the storage of the origin texture with glTextureView.
+// The size is the size of the first level, the filters are reset like for a new texture.
+PyObject * MGLContext_texture_view(
+	MGLContext * self,
+	int origin,
+	MGLDataType * data_type,
+	int components,
+	int internal_format,
+	int width,
+	int height,
+	int samples,
+	bool depth,
+	int first_level,
+	int levels,
+	int layer
+) {
+	const GLMethods & gl = self->gl;
+
+	MGLTexture * texture = (MGLTexture *)MGLTexture_Type.tp_alloc(&MGLTexture_Type, 0);
+
+	texture->texture_obj = 0;
+	gl.GenTextures(1, (GLuint *)&texture->texture_obj);
+
+	if (!texture->texture_obj) {
+		MGLError_Set("cannot create texture");
+		Py_DECREF(texture);
+		return 0;
+	}
+
+	int texture_target = samples ? GL_TEXTURE_2D_MULTISAMPLE : GL_TEXTURE_2D;
+	bool linear = data_type->float_type;
+
+	gl.TextureView(texture->texture_obj, texture_target, origin, internal_format, first_level, levels, layer, 1);
+
+	gl.ActiveTexture(GL_TEXTURE0 + self->default_texture_unit);
+	gl.BindTexture(texture_target, texture->texture_obj);
+
+	if (!samples) {
+		gl.TexParameteri(texture_target, GL_TEXTURE_MIN_FILTER, linear ? GL_LINEAR : GL_NEAREST);
+		gl.TexParameteri(texture_target, GL_TEXTURE_MAG_FILTER, linear ? GL_LINEAR : GL_NEAREST);
+		if (depth) {
+			gl.TexParameteri(texture_target, GL_TEXTURE_COMPARE_MODE, GL_COMPARE_REF_TO_TEXTURE);
+			gl.TexParameteri(texture_target, GL_TEXTURE_COMPARE_FUNC, GL_LEQUAL);
+		}
+	}
+
+	texture->width = max(width >> first_level, 1);
+	texture->height = max(height >> first_level, 1);
+	texture->components = components;
+	texture->samples = samples;
+	texture->internal_format = internal_format;
+	texture->data_type = data_type;
+
+	texture->max_level = levels - 1;
+	texture->levels = levels;
+	texture->compare_func = depth ? GL_LEQUAL : 0;
+	texture->anisotropy = 1.0f;
+	texture->depth = depth;
+
+	texture->min_filter = linear ? GL_LINEAR : GL_NEAREST;
+	texture->mag_filter = linear ? GL_LINEAR : GL_NEAREST;
+
+	texture->repeat_x = true;
+	texture->repeat_y = true;
+
+	Py_INCREF(self);
+	texture->context = self;
+	MGLContext_track_object(self, MGL_MEMORY_TEXTURE, texture->memory, 0);
+
+	Py_INCREF(texture);
+
+	PyObject * result = PyTuple_New(2);
+	PyTuple_SET_ITEM(result, 0, (PyObject *)texture);
+	PyTuple_SET_ITEM(result, 1, PyLong_FromLong(texture->texture_obj));
+	return result;
+}
+
+PyObject * MGLTexture_view(MGLTexture * self, PyObject * args) {
+	const char * dtype;
+	Py_ssize_t dtype_size;
+	int components;
+	PyObject * levels;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"s#IO",
+		&dtype,
+		&dtype_size,
+		&components,
+		&levels
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	MGLDataType * data_type = texture_view_dtype(
+		self->context, self->levels, self->data_type, self->components, self->depth, dtype, dtype_size, components
+	);
+
+	if (!data_type) {
+		return 0;
+	}
+
+	int first_level;
+	int num_levels;
+
+	if (!parse_view_range(levels, self->levels, "levels", first_level, num_levels)) {
+		return 0;
+	}
+
+	// Keeps an overridden internal format when the format is not reinterpreted
+	bool same_format = data_type == self->data_type && components == self->components;
+	int internal_format = same_format ? self->internal_format : data_type->internal_format[components];
+
+	return MGLContext_texture_view(
+		self->context, self->texture_obj, data_type, components, internal_format,
+		self->width, self->height, self->samples, self->depth, first_level, num_levels, 0
+	);
+}
+
 PyObject * MGLTexture_release(MGLTexture * self) {
 	MGLTexture_Invalidate(self);
 	Py_RETURN_NONE;
 }
 
+PyObject * MGLTexture_evict(MGLTexture * self, PyObject * args) {
+	int keep;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"p",
+		&keep
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	if (self->samples) {
+		MGLError_Set("multisample textures cannot be evicted");
+		return 0;
+	}
+
+	PyObject * snapshot = MGLContext_evict_texture(
+		self->context, GL_TEXTURE_2D, self->texture_obj, self->data_type, self->components, self->internal_format,
+		self->levels != 0, self->width, self->height, 1, self->max_level + 1, keep
+	);
+
+	if (snapshot) {
+		MGLContext_track_memory(self->context, MGL_MEMORY_TEXTURE, self->memory, 0);
+	}
+
+	return snapshot;
+}
+
+PyObject * MGLTexture_check_evict(MGLTexture * self, PyObject * args) {
+	if (!MGLContext_check_evict(self->data_type, self->levels != 0, self->samples)) {
+		return 0;
+	}
+
+	Py_RETURN_NONE;
+}
+
+PyObject * MGLTexture_restore(MGLTexture * self, PyObject * args) {
+	PyObject * data;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"O",
+		&data
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	bool restored = MGLContext_restore_texture(
+		self->context, GL_TEXTURE_2D, self->texture_obj, self->data_type, self->components, self->internal_format,
+		self->levels != 0, self->width, self->height, 1, self->max_level + 1, data
+	);
+
+	if (!restored) {
+		return 0;
+	}
+
+	MGLContext_track_memory(self->context, MGL_MEMORY_TEXTURE, self->memory, MGLTexture_memory(self));
+	Py_RETURN_NONE;
+}
+
 PyMethodDef MGLTexture_tp_methods[] = {
 	{"write", (PyCFunction)MGLTexture_write, METH_VARARGS, 0},
+	{"clear", (PyCFunction)MGLTexture_clear, METH_VARARGS, 0},
 	{"bind", (PyCFunction)MGLTexture_meth_bind, METH_VARARGS, 0},
 	{"use", (PyCFunction)MGLTexture_use, METH_VARARGS, 0},
 	{"build_mipmaps", (PyCFunction)MGLTexture_build_mipmaps, METH_VARARGS, 0},
+	{"evict", (PyCFunction)MGLTexture_evict, METH_VARARGS, 0},
+	{"check_evict", (PyCFunction)MGLTexture_check_evict, METH_NOARGS, 0},
+	{"restore", (PyCFunction)MGLTexture_restore, METH_VARARGS, 0},
 	{"read", (PyCFunction)MGLTexture_read, METH_VARARGS, 0},
 	{"read_into", (PyCFunction)MGLTexture_read_into, METH_VARARGS, 0},
+	{"view", (PyCFunction)MGLTexture_view, METH_VARARGS, 0},
 	{"release", (PyCFunction)MGLTexture_release, METH_NOARGS, 0},
 	{0},
 };
@@ -927,6 +1400,10 @@ int MGLTexture_set_anisotropy(MGLTexture * self, PyObject * value) {
 	return 0;
 }
 
+PyObject * MGLTexture_get_memory(MGLTexture * self) {
+	return PyLong_FromLongLong(self->memory);
+}
+
 PyGetSetDef MGLTexture_tp_getseters[] = {
 	{(char *)"repeat_x", (getter)MGLTexture_get_repeat_x, (setter)MGLTexture_set_repeat_x, 0, 0},
 	{(char *)"repeat_y", (getter)MGLTexture_get_repeat_y, (setter)MGLTexture_set_repeat_y, 0, 0},
@@ -934,6 +1411,7 @@ PyGetSetDef MGLTexture_tp_getseters[] = {
 	{(char *)"swizzle", (getter)MGLTexture_get_swizzle, (setter)MGLTexture_set_swizzle, 0, 0},
 	{(char *)"compare_func", (getter)MGLTexture_get_compare_func, (setter)MGLTexture_set_compare_func, 0, 0},
 	{(char *)"anisotropy", (getter)MGLTexture_get_anisotropy, (setter)MGLTexture_set_anisotropy, 0, 0},
+	{(char *)"memory", (getter)MGLTexture_get_memory, 0, 0, 0},
 	{0},
 };
 
@@ -985,6 +1463,7 @@ void MGLTexture_Invalidate(MGLTexture * texture) {
 
 	const GLMethods & gl = texture->context->gl;
 	gl.DeleteTextures(1, (GLuint *)&texture->texture_obj);
+	MGLContext_untrack_object(texture->context, MGL_MEMORY_TEXTURE, texture->memory);
 
 	Py_DECREF(texture->context);
 	Py_SET_TYPE(texture, &MGLInvalidObject_Type);
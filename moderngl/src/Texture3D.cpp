@@ -16,9 +16,11 @@ PyObject * MGLContext_texture3d(MGLContext * self, PyObject * args) {
 	const char * dtype;
 	Py_ssize_t dtype_size;
 
+	int levels;
+
 	int args_ok = PyArg_ParseTuple(
 		args,
-		"(III)IOIs#",
+		"(III)IOIs#i",
 		&width,
 		&height,
 		&depth,
@@ -26,7 +28,8 @@ PyObject * MGLContext_texture3d(MGLContext * self, PyObject * args) {
 		&data,
 		&alignment,
 		&dtype,
-		&dtype_size
+		&dtype_size,
+		&levels
 	);
 
 	if (!args_ok) {
@@ -50,7 +53,21 @@ PyObject * MGLContext_texture3d(MGLContext * self, PyObject * args) {
 		return 0;
 	}
 
-	int expected_size = width * components * data_type->size;
+	if (data_type->block_size) {
+		MGLError_Set("compressed dtypes are not supported by 3D textures");
+		return 0;
+	}
+
+	if (!data_type->internal_format[components]) {
+		MGLError_Set("the %s dtype does not support %d components", dtype, components);
+		return 0;
+	}
+
+	if (!MGLContext_texture_levels(self, levels, width, height, depth)) {
+		return 0;
+	}
+
+	int expected_size = width * pixel_size(data_type, components);
 	expected_size = (expected_size + alignment - 1) / alignment * alignment;
 	expected_size = expected_size * height * depth;
 
@@ -97,7 +114,14 @@ PyObject * MGLContext_texture3d(MGLContext * self, PyObject * args) {
 
 	gl.PixelStorei(GL_PACK_ALIGNMENT, alignment);
 	gl.PixelStorei(GL_UNPACK_ALIGNMENT, alignment);
-	gl.TexImage3D(GL_TEXTURE_3D, 0, internal_format, width, height, depth, 0, base_format, pixel_type, buffer_view.buf);
+	if (levels) {
+		gl.TexStorage3D(GL_TEXTURE_3D, levels, internal_format, width, height, depth);
+		if (buffer_view.buf) {
+			gl.TexSubImage3D(GL_TEXTURE_3D, 0, 0, 0, 0, width, height, depth, base_format, pixel_type, buffer_view.buf);
+		}
+	} else {
+		gl.TexImage3D(GL_TEXTURE_3D, 0, internal_format, width, height, depth, 0, base_format, pixel_type, buffer_view.buf);
+	}
 	if (data_type->float_type) {
 		gl.TexParameteri(GL_TEXTURE_3D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
 		gl.TexParameteri(GL_TEXTURE_3D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
@@ -114,11 +138,13 @@ PyObject * MGLContext_texture3d(MGLContext * self, PyObject * args) {
 	texture->height = height;
 	texture->depth = depth;
 	texture->components = components;
+	texture->internal_format = internal_format;
 	texture->data_type = data_type;
 
 	texture->min_filter = data_type->float_type ? GL_LINEAR : GL_NEAREST;
 	texture->mag_filter = data_type->float_type ? GL_LINEAR : GL_NEAREST;
-	texture->max_level = 0;
+	texture->max_level = levels ? levels - 1 : 0;
+	texture->levels = levels;
 
 	texture->repeat_x = true;
 	texture->repeat_y = true;
@@ -126,6 +152,7 @@ PyObject * MGLContext_texture3d(MGLContext * self, PyObject * args) {
 
 	Py_INCREF(self);
 	texture->context = self;
+	MGLContext_track_object(self, MGL_MEMORY_TEXTURE_3D, texture->memory, MGLTexture3D_memory(texture));
 
 	Py_INCREF(texture);
 
@@ -149,11 +176,15 @@ void MGLTexture3D_tp_dealloc(MGLTexture3D * self) {
 }
 
 PyObject * MGLTexture3D_read(MGLTexture3D * self, PyObject * args) {
+	PyObject * viewport;
+	int level;
 	int alignment;
 
 	int args_ok = PyArg_ParseTuple(
 		args,
-		"I",
+		"OII",
+		&viewport,
+		&level,
 		&alignment
 	);
 
@@ -166,14 +197,31 @@ PyObject * MGLTexture3D_read(MGLTexture3D * self, PyObject * args) {
 		return 0;
 	}
 
-	int expected_size = self->width * self->components * self->data_type->size;
+	if (level < 0 || level > self->max_level) {
+		MGLError_Set("invalid level");
+		return 0;
+	}
+
+	int level_size[3] = {max(self->width >> level, 1), max(self->height >> level, 1), max(self->depth >> level, 1)};
+	int offset[3] = {0, 0, 0};
+	int size[3] = {level_size[0], level_size[1], level_size[2]};
+
+	if (!parse_texture_viewport(viewport, 3, offset, size)) {
+		return 0;
+	}
+
+	if (!texture_viewport_ok(3, offset, size, level_size)) {
+		MGLError_Set("the viewport is out of range");
+		return 0;
+	}
+
+	int expected_size = size[0] * pixel_size(self->data_type, self->components);
 	expected_size = (expected_size + alignment - 1) / alignment * alignment;
-	expected_size = expected_size * self->height * self->depth;
+	expected_size = expected_size * size[1] * size[2];
 
 	PyObject * result = PyBytes_FromStringAndSize(0, expected_size);
 	char * data = PyBytes_AS_STRING(result);
 
-	int pixel_type = self->data_type->gl_type;
 	int base_format = self->data_type->base_format[self->components];
 
 	const GLMethods & gl = self->context->gl;
@@ -183,21 +231,36 @@ PyObject * MGLTexture3D_read(MGLTexture3D * self, PyObject * args) {
 
 	gl.PixelStorei(GL_PACK_ALIGNMENT, alignment);
 	gl.PixelStorei(GL_UNPACK_ALIGNMENT, alignment);
-	gl.GetTexImage(GL_TEXTURE_3D, 0, base_format, pixel_type, data);
+
+	bool region = viewport != Py_None;
+
+	if (!MGLContext_read_texture(self->context, self->texture_obj, GL_TEXTURE_3D, level, region, offset, size, self->data_type, base_format, expected_size, data)) {
+		Py_DECREF(result);
+		return 0;
+	}
 
 	return result;
 }
 
 PyObject * MGLTexture3D_read_into(MGLTexture3D * self, PyObject * args) {
 	PyObject * data;
+	PyObject * viewport;
+	int level;
 	int alignment;
+	MGLPixelStore store;
 	Py_ssize_t write_offset;
 
 	int args_ok = PyArg_ParseTuple(
 		args,
-		"OIn",
+		"OOII(iiii)n",
 		&data,
+		&viewport,
+		&level,
 		&alignment,
+		&store.row_length,
+		&store.skip_pixels,
+		&store.skip_rows,
+		&store.image_height,
 		&write_offset
 	);
 
@@ -210,12 +273,39 @@ PyObject * MGLTexture3D_read_into(MGLTexture3D * self, PyObject * args) {
 		return 0;
 	}
 
-	int expected_size = self->width * self->components * self->data_type->size;
+	if (!pixel_store_ok(store)) {
+		MGLError_Set("the pixel store parameters must not be negative");
+		return 0;
+	}
+
+	if (level < 0 || level > self->max_level) {
+		MGLError_Set("invalid level");
+		return 0;
+	}
+
+	int level_size[3] = {max(self->width >> level, 1), max(self->height >> level, 1), max(self->depth >> level, 1)};
+	int offset[3] = {0, 0, 0};
+	int size[3] = {level_size[0], level_size[1], level_size[2]};
+
+	if (!parse_texture_viewport(viewport, 3, offset, size)) {
+		return 0;
+	}
+
+	if (!texture_viewport_ok(3, offset, size, level_size)) {
+		MGLError_Set("the viewport is out of range");
+		return 0;
+	}
+
+	Py_ssize_t expected_size = (Py_ssize_t)size[0] * pixel_size(self->data_type, self->components);
 	expected_size = (expected_size + alignment - 1) / alignment * alignment;
-	expected_size = expected_size * self->height * self->depth;
+	expected_size = expected_size * size[1] * size[2];
+
+	if (!pixel_store_default(store)) {
+		expected_size = pixel_store_size(store, size[0], size[1], size[2], pixel_size(self->data_type, self->components), alignment);
+	}
 
-	int pixel_type = self->data_type->gl_type;
 	int format = self->data_type->base_format[self->components];
+	bool region = viewport != Py_None;
 
 	if (Py_TYPE(data) == &MGLBuffer_Type) {
 
@@ -228,9 +318,15 @@ PyObject * MGLTexture3D_read_into(MGLTexture3D * self, PyObject * args) {
 		gl.BindTexture(GL_TEXTURE_3D, self->texture_obj);
 		gl.PixelStorei(GL_PACK_ALIGNMENT, alignment);
 		gl.PixelStorei(GL_UNPACK_ALIGNMENT, alignment);
-		gl.GetTexImage(GL_TEXTURE_3D, 0, format, pixel_type, (void *)write_offset);
+		set_pixel_store(gl, true, store);
+		bool success = MGLContext_read_texture(self->context, self->texture_obj, GL_TEXTURE_3D, level, region, offset, size, self->data_type, format, expected_size, (void *)write_offset);
+		reset_pixel_store(gl, true, store);
 		gl.BindBuffer(GL_PIXEL_PACK_BUFFER, 0);
 
+		if (!success) {
+			return 0;
+		}
+
 	} else {
 
 		Py_buffer buffer_view;
@@ -254,10 +350,16 @@ PyObject * MGLTexture3D_read_into(MGLTexture3D * self, PyObject * args) {
 		gl.BindTexture(GL_TEXTURE_3D, self->texture_obj);
 		gl.PixelStorei(GL_PACK_ALIGNMENT, alignment);
 		gl.PixelStorei(GL_UNPACK_ALIGNMENT, alignment);
-		gl.GetTexImage(GL_TEXTURE_3D, 0, format, pixel_type, ptr);
+		set_pixel_store(gl, true, store);
+		bool success = MGLContext_read_texture(self->context, self->texture_obj, GL_TEXTURE_3D, level, region, offset, size, self->data_type, format, expected_size, ptr);
+		reset_pixel_store(gl, true, store);
 
 		PyBuffer_Release(&buffer_view);
 
+		if (!success) {
+			return 0;
+		}
+
 	}
 
 	Py_RETURN_NONE;
@@ -266,14 +368,25 @@ PyObject * MGLTexture3D_read_into(MGLTexture3D * self, PyObject * args) {
 PyObject * MGLTexture3D_write(MGLTexture3D * self, PyObject * args) {
 	PyObject * data;
 	PyObject * viewport;
+	int level;
 	int alignment;
+	MGLPixelStore store;
+	Py_ssize_t read_offset;
+	Py_ssize_t read_size;
 
 	int args_ok = PyArg_ParseTuple(
 		args,
-		"OOI",
+		"OOII(iiii)nn",
 		&data,
 		&viewport,
-		&alignment
+		&level,
+		&alignment,
+		&store.row_length,
+		&store.skip_pixels,
+		&store.skip_rows,
+		&store.image_height,
+		&read_offset,
+		&read_size
 	);
 
 	if (!args_ok) {
@@ -285,12 +398,22 @@ PyObject * MGLTexture3D_write(MGLTexture3D * self, PyObject * args) {
 		return 0;
 	}
 
+	if (!pixel_store_ok(store)) {
+		MGLError_Set("the pixel store parameters must not be negative");
+		return 0;
+	}
+
+	if (level < 0 || level > self->max_level) {
+		MGLError_Set("invalid level");
+		return 0;
+	}
+
 	int x = 0;
 	int y = 0;
 	int z = 0;
-	int width = self->width;
-	int height = self->height;
-	int depth = self->depth;
+	int width = max(self->width >> level, 1);
+	int height = max(self->height >> level, 1);
+	int depth = max(self->depth >> level, 1);
 
 	Py_buffer buffer_view;
 
@@ -329,10 +452,14 @@ PyObject * MGLTexture3D_write(MGLTexture3D * self, PyObject * args) {
 
 	}
 
-	int expected_size = width * self->components * self->data_type->size;
+	Py_ssize_t expected_size = (Py_ssize_t)width * pixel_size(self->data_type, self->components);
 	expected_size = (expected_size + alignment - 1) / alignment * alignment;
 	expected_size = expected_size * height * depth;
 
+	if (!pixel_store_default(store)) {
+		expected_size = pixel_store_size(store, width, height, depth, pixel_size(self->data_type, self->components), alignment);
+	}
+
 	int pixel_type = self->data_type->gl_type;
 	int format = self->data_type->base_format[self->components];
 
@@ -340,6 +467,17 @@ PyObject * MGLTexture3D_write(MGLTexture3D * self, PyObject * args) {
 
 		MGLBuffer * buffer = (MGLBuffer *)data;
 
+		if (read_offset < 0 || read_offset + expected_size > buffer->size) {
+			MGLError_Set("the buffer is too small");
+			return 0;
+		}
+
+		// The number of bytes staged for this transfer, -1 when the rest of the buffer is available
+		if (read_size >= 0 && read_size != expected_size) {
+			MGLError_Set("data size mismatch %zd != %zd", read_size, expected_size);
+			return 0;
+		}
+
 		const GLMethods & gl = self->context->gl;
 
 		gl.BindBuffer(GL_PIXEL_UNPACK_BUFFER, buffer->buffer_obj);
@@ -347,7 +485,9 @@ PyObject * MGLTexture3D_write(MGLTexture3D * self, PyObject * args) {
 		gl.BindTexture(GL_TEXTURE_3D, self->texture_obj);
 		gl.PixelStorei(GL_PACK_ALIGNMENT, alignment);
 		gl.PixelStorei(GL_UNPACK_ALIGNMENT, alignment);
-		gl.TexSubImage3D(GL_TEXTURE_3D, 0, x, y, z, width, height, depth, format, pixel_type, 0);
+		set_pixel_store(gl, false, store);
+		gl.TexSubImage3D(GL_TEXTURE_3D, level, x, y, z, width, height, depth, format, pixel_type, (void *)read_offset);
+		reset_pixel_store(gl, false, store);
 		gl.BindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
 
 	} else {
@@ -358,8 +498,8 @@ PyObject * MGLTexture3D_write(MGLTexture3D * self, PyObject * args) {
 			return 0;
 		}
 
-		if (buffer_view.len != expected_size) {
-			MGLError_Set("data size mismatch %d != %d", buffer_view.len, expected_size);
+		if (pixel_store_default(store) ? buffer_view.len != expected_size : buffer_view.len < expected_size) {
+			MGLError_Set("data size mismatch %zd != %zd", buffer_view.len, expected_size);
 			if (data != Py_None) {
 				PyBuffer_Release(&buffer_view);
 			}
@@ -373,7 +513,9 @@ PyObject * MGLTexture3D_write(MGLTexture3D * self, PyObject * args) {
 
 		gl.PixelStorei(GL_PACK_ALIGNMENT, alignment);
 		gl.PixelStorei(GL_UNPACK_ALIGNMENT, alignment);
-		gl.TexSubImage3D(GL_TEXTURE_3D, 0, x, y, z, width, height, depth, format, pixel_type, buffer_view.buf);
+		set_pixel_store(gl, false, store);
+		gl.TexSubImage3D(GL_TEXTURE_3D, level, x, y, z, width, height, depth, format, pixel_type, buffer_view.buf);
+		reset_pixel_store(gl, false, store);
 
 		PyBuffer_Release(&buffer_view);
 
@@ -439,15 +581,67 @@ PyObject * MGLTexture3D_use(MGLTexture3D * self, PyObject * args) {
 	Py_RETURN_NONE;
 }
 
+PyObject * MGLTexture3D_clear(MGLTexture3D * self, PyObject * args) {
+	PyObject * value;
+	int level;
+	PyObject * viewport;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"OIO",
+		&value,
+		&level,
+		&viewport
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	if (level < 0 || level > self->max_level) {
+		MGLError_Set("invalid level");
+		return 0;
+	}
+
+	int level_size[3] = {max(self->width >> level, 1), max(self->height >> level, 1), max(self->depth >> level, 1)};
+	int offset[3] = {0, 0, 0};
+	int size[3] = {level_size[0], level_size[1], level_size[2]};
+
+	if (!parse_texture_viewport(viewport, 3, offset, size)) {
+		return 0;
+	}
+
+	if (!texture_viewport_ok(3, offset, size, level_size)) {
+		MGLError_Set("the viewport is out of range");
+		return 0;
+	}
+
+	bool region = viewport != Py_None;
+
+	if (!MGLContext_clear_texture(self->context, self->texture_obj, self->data_type, self->components, false, value, level, region, offset, size)) {
+		return 0;
+	}
+
+	Py_RETURN_NONE;
+}
+
 PyObject * MGLTexture3D_build_mipmaps(MGLTexture3D * self, PyObject * args) {
 	int base = 0;
 	int max = 1000;
 
+	const char * method;
+	Py_ssize_t method_size;
+
+	int cpu;
+
 	int args_ok = PyArg_ParseTuple(
 		args,
-		"II",
+		"IIs#p",
 		&base,
-		&max
+		&max,
+		&method,
+		&method_size,
+		&cpu
 	);
 
 	if (!args_ok) {
@@ -459,22 +653,52 @@ PyObject * MGLTexture3D_build_mipmaps(MGLTexture3D * self, PyObject * args) {
 		return 0;
 	}
 
+	if (!cpu && (method_size != 3 || memcmp(method, "box", 3))) {
+		MGLError_Set("the %s method requires cpu=True", method);
+		return 0;
+	}
+
+	// Immutable textures keep their level count
+	if (self->levels && max > self->levels - 1) {
+		max = self->levels - 1;
+	}
+
 	const GLMethods & gl = self->context->gl;
 
-	gl.ActiveTexture(GL_TEXTURE0 + self->context->default_texture_unit);
-	gl.BindTexture(GL_TEXTURE_3D, self->texture_obj);
+	if (cpu) {
+		max = MGLContext_build_mipmaps(
+			self->context, GL_TEXTURE_3D, self->texture_obj, self->data_type, self->components,
+			self->internal_format, self->levels != 0, self->width, self->height, self->depth, base, max, method, method_size
+		);
 
-	gl.TexParameteri(GL_TEXTURE_3D, GL_TEXTURE_BASE_LEVEL, base);
-	gl.TexParameteri(GL_TEXTURE_3D, GL_TEXTURE_MAX_LEVEL, max);
+		if (max < 0) {
+			return 0;
+		}
+	} else {
+		gl.ActiveTexture(GL_TEXTURE0 + self->context->default_texture_unit);
+		gl.BindTexture(GL_TEXTURE_3D, self->texture_obj);
 
-	gl.GenerateMipmap(GL_TEXTURE_3D);
+		gl.TexParameteri(GL_TEXTURE_3D, GL_TEXTURE_BASE_LEVEL, base);
+		gl.TexParameteri(GL_TEXTURE_3D, GL_TEXTURE_MAX_LEVEL, max);
 
-	gl.TexParameteri(GL_TEXTURE_3D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
-	gl.TexParameteri(GL_TEXTURE_3D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+		gl.GenerateMipmap(GL_TEXTURE_3D);
+	}
+
+	// Integer textures cannot be filtered linearly
+	int min_filter = self->data_type->float_type ? GL_LINEAR_MIPMAP_LINEAR : GL_NEAREST_MIPMAP_NEAREST;
+	int mag_filter = self->data_type->float_type ? GL_LINEAR : GL_NEAREST;
+
+	gl.TexParameteri(GL_TEXTURE_3D, GL_TEXTURE_MIN_FILTER, min_filter);
+	gl.TexParameteri(GL_TEXTURE_3D, GL_TEXTURE_MAG_FILTER, mag_filter);
 
-	self->min_filter = GL_LINEAR_MIPMAP_LINEAR;
-	self->mag_filter = GL_LINEAR;
-	self->max_level = max;
+	self->min_filter = min_filter;
+	self->mag_filter = mag_filter;
+	self->max_level = self->levels ? self->levels - 1 : max;
+
+	// Immutable textures and views keep the storage they were created with
+	if (!self->levels) {
+		MGLContext_track_memory(self->context, MGL_MEMORY_TEXTURE_3D, self->memory, MGLTexture3D_memory(self));
+	}
 
 	Py_RETURN_NONE;
 }
@@ -484,11 +708,74 @@ PyObject * MGLTexture3D_release(MGLTexture3D * self) {
 	Py_RETURN_NONE;
 }
 
+PyObject * MGLTexture3D_evict(MGLTexture3D * self, PyObject * args) {
+	int keep;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"p",
+		&keep
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	PyObject * snapshot = MGLContext_evict_texture(
+		self->context, GL_TEXTURE_3D, self->texture_obj, self->data_type, self->components, self->internal_format,
+		self->levels != 0, self->width, self->height, self->depth, self->max_level + 1, keep
+	);
+
+	if (snapshot) {
+		MGLContext_track_memory(self->context, MGL_MEMORY_TEXTURE_3D, self->memory, 0);
+	}
+
+	return snapshot;
+}
+
+PyObject * MGLTexture3D_check_evict(MGLTexture3D * self, PyObject * args) {
+	if (!MGLContext_check_evict(self->data_type, self->levels != 0, 0)) {
+		return 0;
+	}
+
+	Py_RETURN_NONE;
+}
+
+PyObject * MGLTexture3D_restore(MGLTexture3D * self, PyObject * args) {
+	PyObject * data;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"O",
+		&data
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	bool restored = MGLContext_restore_texture(
+		self->context, GL_TEXTURE_3D, self->texture_obj, self->data_type, self->components, self->internal_format,
+		self->levels != 0, self->width, self->height, self->depth, self->max_level + 1, data
+	);
+
+	if (!restored) {
+		return 0;
+	}
+
+	MGLContext_track_memory(self->context, MGL_MEMORY_TEXTURE_3D, self->memory, MGLTexture3D_memory(self));
+	Py_RETURN_NONE;
+}
+
 PyMethodDef MGLTexture3D_tp_methods[] = {
 	{"write", (PyCFunction)MGLTexture3D_write, METH_VARARGS, 0},
+	{"clear", (PyCFunction)MGLTexture3D_clear, METH_VARARGS, 0},
 	{"bind", (PyCFunction)MGLTexture3D_meth_bind, METH_VARARGS, 0},
 	{"use", (PyCFunction)MGLTexture3D_use, METH_VARARGS, 0},
 	{"build_mipmaps", (PyCFunction)MGLTexture3D_build_mipmaps, METH_VARARGS, 0},
+	{"evict", (PyCFunction)MGLTexture3D_evict, METH_VARARGS, 0},
+	{"check_evict", (PyCFunction)MGLTexture3D_check_evict, METH_NOARGS, 0},
+	{"restore", (PyCFunction)MGLTexture3D_restore, METH_VARARGS, 0},
 	{"read", (PyCFunction)MGLTexture3D_read, METH_VARARGS, 0},
 	{"read_into", (PyCFunction)MGLTexture3D_read_into, METH_VARARGS, 0},
 	{"release", (PyCFunction)MGLTexture3D_release, METH_NOARGS, 0},
@@ -668,12 +955,17 @@ int MGLTexture3D_set_swizzle(MGLTexture3D * self, PyObject * value, void * closu
 	return 0;
 }
 
+PyObject * MGLTexture3D_get_memory(MGLTexture3D * self) {
+	return PyLong_FromLongLong(self->memory);
+}
+
 PyGetSetDef MGLTexture3D_tp_getseters[] = {
 	{(char *)"repeat_x", (getter)MGLTexture3D_get_repeat_x, (setter)MGLTexture3D_set_repeat_x, 0, 0},
 	{(char *)"repeat_y", (getter)MGLTexture3D_get_repeat_y, (setter)MGLTexture3D_set_repeat_y, 0, 0},
 	{(char *)"repeat_z", (getter)MGLTexture3D_get_repeat_z, (setter)MGLTexture3D_set_repeat_z, 0, 0},
 	{(char *)"filter", (getter)MGLTexture3D_get_filter, (setter)MGLTexture3D_set_filter, 0, 0},
 	{(char *)"swizzle", (getter)MGLTexture3D_get_swizzle, (setter)MGLTexture3D_set_swizzle, 0, 0},
+	{(char *)"memory", (getter)MGLTexture3D_get_memory, 0, 0, 0},
 	{0},
 };
 
@@ -727,6 +1019,7 @@ void MGLTexture3D_Invalidate(MGLTexture3D * texture) {
 
 	const GLMethods & gl = texture->context->gl;
 	gl.DeleteTextures(1, (GLuint *)&texture->texture_obj);
+	MGLContext_untrack_object(texture->context, MGL_MEMORY_TEXTURE_3D, texture->memory);
 
 	Py_DECREF(texture->context);
 	Py_SET_TYPE(texture, &MGLInvalidObject_Type);
@@ -16,9 +16,11 @@ PyObject * MGLContext_texture_array(MGLContext * self, PyObject * args) {
 	const char * dtype;
 	Py_ssize_t dtype_size;
 
+	int levels;
+
 	int args_ok = PyArg_ParseTuple(
 		args,
-		"(III)IOIs#",
+		"(III)IOIs#i",
 		&width,
 		&height,
 		&layers,
@@ -26,7 +28,8 @@ PyObject * MGLContext_texture_array(MGLContext * self, PyObject * args) {
 		&data,
 		&alignment,
 		&dtype,
-		&dtype_size
+		&dtype_size,
+		&levels
 	);
 
 	if (!args_ok) {
@@ -50,10 +53,23 @@ PyObject * MGLContext_texture_array(MGLContext * self, PyObject * args) {
 		return 0;
 	}
 
-	int expected_size = width * components * data_type->size;
+	if (!data_type->internal_format[components]) {
+		MGLError_Set("the %s dtype does not support %d components", dtype, components);
+		return 0;
+	}
+
+	if (!MGLContext_texture_levels(self, levels, width, height, 1)) {
+		return 0;
+	}
+
+	int expected_size = width * pixel_size(data_type, components);
 	expected_size = (expected_size + alignment - 1) / alignment * alignment;
 	expected_size = expected_size * height * layers;
 
+	if (data_type->block_size) {
+		expected_size = compressed_image_size(data_type, components, width, height) * layers;
+	}
+
 	Py_buffer buffer_view;
 
 	if (data != Py_None) {
@@ -96,9 +112,20 @@ PyObject * MGLContext_texture_array(MGLContext * self, PyObject * args) {
 
 	gl.BindTexture(GL_TEXTURE_2D_ARRAY, texture->texture_obj);
 
-    gl.PixelStorei(GL_PACK_ALIGNMENT, alignment);
-    gl.PixelStorei(GL_UNPACK_ALIGNMENT, alignment);
-    gl.TexImage3D(GL_TEXTURE_2D_ARRAY, 0, internal_format, width, height, layers, 0, base_format, pixel_type, buffer_view.buf);
+	gl.PixelStorei(GL_PACK_ALIGNMENT, alignment);
+	gl.PixelStorei(GL_UNPACK_ALIGNMENT, alignment);
+	if (levels) {
+		gl.TexStorage3D(GL_TEXTURE_2D_ARRAY, levels, internal_format, width, height, layers);
+		if (buffer_view.buf && data_type->block_size) {
+			gl.CompressedTexSubImage3D(GL_TEXTURE_2D_ARRAY, 0, 0, 0, 0, width, height, layers, internal_format, expected_size, buffer_view.buf);
+		} else if (buffer_view.buf) {
+			gl.TexSubImage3D(GL_TEXTURE_2D_ARRAY, 0, 0, 0, 0, width, height, layers, base_format, pixel_type, buffer_view.buf);
+		}
+	} else if (buffer_view.buf && data_type->block_size) {
+		gl.CompressedTexImage3D(GL_TEXTURE_2D_ARRAY, 0, internal_format, width, height, layers, 0, expected_size, buffer_view.buf);
+	} else {
+		gl.TexImage3D(GL_TEXTURE_2D_ARRAY, 0, internal_format, width, height, layers, 0, base_format, pixel_type, buffer_view.buf);
+	}
 	if (data_type->float_type) {
 		gl.TexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
 		gl.TexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
@@ -115,10 +142,13 @@ PyObject * MGLContext_texture_array(MGLContext * self, PyObject * args) {
 	texture->height = height;
 	texture->layers = layers;
 	texture->components = components;
+	texture->internal_format = internal_format;
 	texture->data_type = data_type;
 
 	texture->min_filter = data_type->float_type ? GL_LINEAR : GL_NEAREST;
 	texture->mag_filter = data_type->float_type ? GL_LINEAR : GL_NEAREST;
+	texture->max_level = levels ? levels - 1 : 0;
+	texture->levels = levels;
 
 	texture->repeat_x = true;
 	texture->repeat_y = true;
@@ -126,6 +156,7 @@ PyObject * MGLContext_texture_array(MGLContext * self, PyObject * args) {
 
 	Py_INCREF(self);
 	texture->context = self;
+	MGLContext_track_object(self, MGL_MEMORY_TEXTURE_ARRAY, texture->memory, MGLTextureArray_memory(texture));
 
 	Py_INCREF(texture);
 
@@ -149,11 +180,15 @@ void MGLTextureArray_tp_dealloc(MGLTextureArray * self) {
 }
 
 PyObject * MGLTextureArray_read(MGLTextureArray * self, PyObject * args) {
+	PyObject * viewport;
+	int level;
 	int alignment;
 
 	int args_ok = PyArg_ParseTuple(
 		args,
-		"I",
+		"OII",
+		&viewport,
+		&level,
 		&alignment
 	);
 
@@ -166,14 +201,39 @@ PyObject * MGLTextureArray_read(MGLTextureArray * self, PyObject * args) {
 		return 0;
 	}
 
-	int expected_size = self->width * self->components * self->data_type->size;
+	if (level < 0 || level > self->max_level) {
+		MGLError_Set("invalid level");
+		return 0;
+	}
+
+	int level_size[3] = {max(self->width >> level, 1), max(self->height >> level, 1), self->layers};
+	int offset[3] = {0, 0, 0};
+	int size[3] = {level_size[0], level_size[1], level_size[2]};
+
+	if (!parse_texture_viewport(viewport, 3, offset, size)) {
+		return 0;
+	}
+
+	if (!texture_viewport_ok(3, offset, size, level_size)) {
+		MGLError_Set("the viewport is out of range");
+		return 0;
+	}
+
+	int expected_size = size[0] * pixel_size(self->data_type, self->components);
 	expected_size = (expected_size + alignment - 1) / alignment * alignment;
-	expected_size = expected_size * self->height * self->layers;
+	expected_size = expected_size * size[1] * size[2];
+
+	if (self->data_type->block_size) {
+		if (!compressed_viewport_ok(offset[0], offset[1], size[0], size[1], level_size[0], level_size[1])) {
+			MGLError_Set("the viewport must be aligned to 4x4 blocks");
+			return 0;
+		}
+		expected_size = compressed_image_size(self->data_type, self->components, size[0], size[1]) * size[2];
+	}
 
 	PyObject * result = PyBytes_FromStringAndSize(0, expected_size);
 	char * data = PyBytes_AS_STRING(result);
 
-	int pixel_type = self->data_type->gl_type;
 	int base_format = self->data_type->base_format[self->components];
 
 	const GLMethods & gl = self->context->gl;
@@ -184,41 +244,35 @@ PyObject * MGLTextureArray_read(MGLTextureArray * self, PyObject * args) {
 	gl.PixelStorei(GL_PACK_ALIGNMENT, alignment);
 	gl.PixelStorei(GL_UNPACK_ALIGNMENT, alignment);
 
-	// To determine the required size of pixels, use glGetTexLevelParameter to determine
-	// the dimensions of the internal texture image, then scale the required number of pixels
-	// by the storage required for each pixel, based on format and type. Be sure to take the
-	// pixel storage parameters into account, especially GL_PACK_ALIGNMENT.
-
-	// int pack = 0;
-	// gl.GetIntegerv(GL_PACK_ALIGNMENT, &pack);
-	// printf("GL_PACK_ALIGNMENT: %d\n", pack);
-
-	// glGetTexLevelParameter with argument GL_TEXTURE_WIDTH
-	// glGetTexLevelParameter with argument GL_TEXTURE_HEIGHT
-	// glGetTexLevelParameter with argument GL_TEXTURE_INTERNAL_FORMAT
-
-	// int level_width = 0;
-	// int level_height = 0;
-	// gl.GetTexLevelParameteriv(GL_TEXTURE_2D_ARRAY, 0, GL_TEXTURE_WIDTH, &level_width);
-	// gl.GetTexLevelParameteriv(GL_TEXTURE_2D_ARRAY, 0, GL_TEXTURE_HEIGHT, &level_height);
-	// printf("level_width: %d\n", level_width);
-	// printf("level_height: %d\n", level_height);
+	bool region = viewport != Py_None;
 
-	gl.GetTexImage(GL_TEXTURE_2D_ARRAY, 0, base_format, pixel_type, data);
+	if (!MGLContext_read_texture(self->context, self->texture_obj, GL_TEXTURE_2D_ARRAY, level, region, offset, size, self->data_type, base_format, expected_size, data)) {
+		Py_DECREF(result);
+		return 0;
+	}
 
 	return result;
 }
 
 PyObject * MGLTextureArray_read_into(MGLTextureArray * self, PyObject * args) {
 	PyObject * data;
+	PyObject * viewport;
+	int level;
 	int alignment;
+	MGLPixelStore store;
 	Py_ssize_t write_offset;
 
 	int args_ok = PyArg_ParseTuple(
 		args,
-		"OIn",
+		"OOII(iiii)n",
 		&data,
+		&viewport,
+		&level,
 		&alignment,
+		&store.row_length,
+		&store.skip_pixels,
+		&store.skip_rows,
+		&store.image_height,
 		&write_offset
 	);
 
@@ -231,12 +285,51 @@ PyObject * MGLTextureArray_read_into(MGLTextureArray * self, PyObject * args) {
 		return 0;
 	}
 
-	int expected_size = self->width * self->components * self->data_type->size;
+	if (!pixel_store_ok(store)) {
+		MGLError_Set("the pixel store parameters must not be negative");
+		return 0;
+	}
+
+	if (level < 0 || level > self->max_level) {
+		MGLError_Set("invalid level");
+		return 0;
+	}
+
+	int level_size[3] = {max(self->width >> level, 1), max(self->height >> level, 1), self->layers};
+	int offset[3] = {0, 0, 0};
+	int size[3] = {level_size[0], level_size[1], level_size[2]};
+
+	if (!parse_texture_viewport(viewport, 3, offset, size)) {
+		return 0;
+	}
+
+	if (!texture_viewport_ok(3, offset, size, level_size)) {
+		MGLError_Set("the viewport is out of range");
+		return 0;
+	}
+
+	Py_ssize_t expected_size = (Py_ssize_t)size[0] * pixel_size(self->data_type, self->components);
 	expected_size = (expected_size + alignment - 1) / alignment * alignment;
-	expected_size = expected_size * self->height * self->layers;
+	expected_size = expected_size * size[1] * size[2];
+
+	if (self->data_type->block_size) {
+		if (!compressed_viewport_ok(offset[0], offset[1], size[0], size[1], level_size[0], level_size[1])) {
+			MGLError_Set("the viewport must be aligned to 4x4 blocks");
+			return 0;
+		}
+		expected_size = compressed_image_size(self->data_type, self->components, size[0], size[1]) * size[2];
+	}
+
+	if (!pixel_store_default(store)) {
+		if (self->data_type->block_size) {
+			MGLError_Set("pixel store parameters are not supported by compressed textures");
+			return 0;
+		}
+		expected_size = pixel_store_size(store, size[0], size[1], size[2], pixel_size(self->data_type, self->components), alignment);
+	}
 
-	int pixel_type = self->data_type->gl_type;
 	int format = self->data_type->base_format[self->components];
+	bool region = viewport != Py_None;
 
 	if (Py_TYPE(data) == &MGLBuffer_Type) {
 
@@ -249,9 +342,15 @@ PyObject * MGLTextureArray_read_into(MGLTextureArray * self, PyObject * args) {
 		gl.BindTexture(GL_TEXTURE_2D_ARRAY, self->texture_obj);
 		gl.PixelStorei(GL_PACK_ALIGNMENT, alignment);
 		gl.PixelStorei(GL_UNPACK_ALIGNMENT, alignment);
-		gl.GetTexImage(GL_TEXTURE_2D_ARRAY, 0, format, pixel_type, (void *)write_offset);
+		set_pixel_store(gl, true, store);
+		bool success = MGLContext_read_texture(self->context, self->texture_obj, GL_TEXTURE_2D_ARRAY, level, region, offset, size, self->data_type, format, expected_size, (void *)write_offset);
+		reset_pixel_store(gl, true, store);
 		gl.BindBuffer(GL_PIXEL_PACK_BUFFER, 0);
 
+		if (!success) {
+			return 0;
+		}
+
 	} else {
 
 		Py_buffer buffer_view;
@@ -276,10 +375,16 @@ PyObject * MGLTextureArray_read_into(MGLTextureArray * self, PyObject * args) {
 		gl.BindTexture(GL_TEXTURE_2D_ARRAY, self->texture_obj);
 		gl.PixelStorei(GL_PACK_ALIGNMENT, alignment);
 		gl.PixelStorei(GL_UNPACK_ALIGNMENT, alignment);
-		gl.GetTexImage(GL_TEXTURE_2D_ARRAY, 0, format, pixel_type, ptr);
+		set_pixel_store(gl, true, store);
+		bool success = MGLContext_read_texture(self->context, self->texture_obj, GL_TEXTURE_2D_ARRAY, level, region, offset, size, self->data_type, format, expected_size, ptr);
+		reset_pixel_store(gl, true, store);
 
 		PyBuffer_Release(&buffer_view);
 
+		if (!success) {
+			return 0;
+		}
+
 	}
 
 	Py_RETURN_NONE;
@@ -288,14 +393,25 @@ PyObject * MGLTextureArray_read_into(MGLTextureArray * self, PyObject * args) {
 PyObject * MGLTextureArray_write(MGLTextureArray * self, PyObject * args) {
 	PyObject * data;
 	PyObject * viewport;
+	int level;
 	int alignment;
+	MGLPixelStore store;
+	Py_ssize_t read_offset;
+	Py_ssize_t read_size;
 
 	int args_ok = PyArg_ParseTuple(
 		args,
-		"OOI",
+		"OOII(iiii)nn",
 		&data,
 		&viewport,
-		&alignment
+		&level,
+		&alignment,
+		&store.row_length,
+		&store.skip_pixels,
+		&store.skip_rows,
+		&store.image_height,
+		&read_offset,
+		&read_size
 	);
 
 	if (!args_ok) {
@@ -307,11 +423,21 @@ PyObject * MGLTextureArray_write(MGLTextureArray * self, PyObject * args) {
 		return 0;
 	}
 
+	if (!pixel_store_ok(store)) {
+		MGLError_Set("the pixel store parameters must not be negative");
+		return 0;
+	}
+
+	if (level < 0 || level > self->max_level) {
+		MGLError_Set("invalid level");
+		return 0;
+	}
+
 	int x = 0;
 	int y = 0;
 	int z = 0;
-	int width = self->width;
-	int height = self->height;
+	int width = max(self->width >> level, 1);
+	int height = max(self->height >> level, 1);
 	int layers = self->layers;
 
 	Py_buffer buffer_view;
@@ -351,10 +477,26 @@ PyObject * MGLTextureArray_write(MGLTextureArray * self, PyObject * args) {
 
 	}
 
-	int expected_size = width * self->components * self->data_type->size;
+	Py_ssize_t expected_size = (Py_ssize_t)width * pixel_size(self->data_type, self->components);
 	expected_size = (expected_size + alignment - 1) / alignment * alignment;
 	expected_size = expected_size * height * layers;
 
+	if (self->data_type->block_size) {
+		if (!compressed_viewport_ok(x, y, width, height, max(self->width >> level, 1), max(self->height >> level, 1))) {
+			MGLError_Set("the viewport must be aligned to 4x4 blocks");
+			return 0;
+		}
+		expected_size = compressed_image_size(self->data_type, self->components, width, height) * layers;
+	}
+
+	if (!pixel_store_default(store)) {
+		if (self->data_type->block_size) {
+			MGLError_Set("pixel store parameters are not supported by compressed textures");
+			return 0;
+		}
+		expected_size = pixel_store_size(store, width, height, layers, pixel_size(self->data_type, self->components), alignment);
+	}
+
 	int pixel_type = self->data_type->gl_type;
 	int format = self->data_type->base_format[self->components];
 
@@ -362,6 +504,17 @@ PyObject * MGLTextureArray_write(MGLTextureArray * self, PyObject * args) {
 
 		MGLBuffer * buffer = (MGLBuffer *)data;
 
+		if (read_offset < 0 || read_offset + expected_size > buffer->size) {
+			MGLError_Set("the buffer is too small");
+			return 0;
+		}
+
+		// The number of bytes staged for this transfer, -1 when the rest of the buffer is available
+		if (read_size >= 0 && read_size != expected_size) {
+			MGLError_Set("data size mismatch %zd != %zd", read_size, expected_size);
+			return 0;
+		}
+
 		const GLMethods & gl = self->context->gl;
 
 		gl.BindBuffer(GL_PIXEL_UNPACK_BUFFER, buffer->buffer_obj);
@@ -369,7 +522,13 @@ PyObject * MGLTextureArray_write(MGLTextureArray * self, PyObject * args) {
 		gl.BindTexture(GL_TEXTURE_2D_ARRAY, self->texture_obj);
 		gl.PixelStorei(GL_PACK_ALIGNMENT, alignment);
 		gl.PixelStorei(GL_UNPACK_ALIGNMENT, alignment);
-		gl.TexSubImage3D(GL_TEXTURE_2D_ARRAY, 0, x, y, z, width, height, layers, format, pixel_type, 0);
+		set_pixel_store(gl, false, store);
+		if (self->data_type->block_size) {
+			gl.CompressedTexSubImage3D(GL_TEXTURE_2D_ARRAY, level, x, y, z, width, height, layers, self->internal_format, expected_size, (void *)read_offset);
+		} else {
+			gl.TexSubImage3D(GL_TEXTURE_2D_ARRAY, level, x, y, z, width, height, layers, format, pixel_type, (void *)read_offset);
+		}
+		reset_pixel_store(gl, false, store);
 		gl.BindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
 
 	} else {
@@ -380,8 +539,8 @@ PyObject * MGLTextureArray_write(MGLTextureArray * self, PyObject * args) {
 			return 0;
 		}
 
-		if (buffer_view.len != expected_size) {
-			MGLError_Set("data size mismatch %d != %d", buffer_view.len, expected_size);
+		if (pixel_store_default(store) ? buffer_view.len != expected_size : buffer_view.len < expected_size) {
+			MGLError_Set("data size mismatch %zd != %zd", buffer_view.len, expected_size);
 			if (data != Py_None) {
 				PyBuffer_Release(&buffer_view);
 			}
@@ -394,7 +553,13 @@ PyObject * MGLTextureArray_write(MGLTextureArray * self, PyObject * args) {
 		gl.BindTexture(GL_TEXTURE_2D_ARRAY, self->texture_obj);
 		gl.PixelStorei(GL_PACK_ALIGNMENT, alignment);
 		gl.PixelStorei(GL_UNPACK_ALIGNMENT, alignment);
-		gl.TexSubImage3D(GL_TEXTURE_2D_ARRAY, 0, x, y, z, width, height, layers, format, pixel_type, buffer_view.buf);
+		set_pixel_store(gl, false, store);
+		if (self->data_type->block_size) {
+			gl.CompressedTexSubImage3D(GL_TEXTURE_2D_ARRAY, level, x, y, z, width, height, layers, self->internal_format, expected_size, buffer_view.buf);
+		} else {
+			gl.TexSubImage3D(GL_TEXTURE_2D_ARRAY, level, x, y, z, width, height, layers, format, pixel_type, buffer_view.buf);
+		}
+		reset_pixel_store(gl, false, store);
 
 		PyBuffer_Release(&buffer_view);
 
@@ -461,15 +626,67 @@ PyObject * MGLTextureArray_use(MGLTextureArray * self, PyObject * args) {
 	Py_RETURN_NONE;
 }
 
+PyObject * MGLTextureArray_clear(MGLTextureArray * self, PyObject * args) {
+	PyObject * value;
+	int level;
+	PyObject * viewport;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"OIO",
+		&value,
+		&level,
+		&viewport
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	if (level < 0 || level > self->max_level) {
+		MGLError_Set("invalid level");
+		return 0;
+	}
+
+	int level_size[3] = {max(self->width >> level, 1), max(self->height >> level, 1), self->layers};
+	int offset[3] = {0, 0, 0};
+	int size[3] = {level_size[0], level_size[1], level_size[2]};
+
+	if (!parse_texture_viewport(viewport, 3, offset, size)) {
+		return 0;
+	}
+
+	if (!texture_viewport_ok(3, offset, size, level_size)) {
+		MGLError_Set("the viewport is out of range");
+		return 0;
+	}
+
+	bool region = viewport != Py_None;
+
+	if (!MGLContext_clear_texture(self->context, self->texture_obj, self->data_type, self->components, false, value, level, region, offset, size)) {
+		return 0;
+	}
+
+	Py_RETURN_NONE;
+}
+
 PyObject * MGLTextureArray_build_mipmaps(MGLTextureArray * self, PyObject * args) {
 	int base = 0;
 	int max = 1000;
 
+	const char * method;
+	Py_ssize_t method_size;
+
+	int cpu;
+
 	int args_ok = PyArg_ParseTuple(
 		args,
-		"II",
+		"IIs#p",
 		&base,
-		&max
+		&max,
+		&method,
+		&method_size,
+		&cpu
 	);
 
 	if (!args_ok) {
@@ -481,38 +698,261 @@ PyObject * MGLTextureArray_build_mipmaps(MGLTextureArray * self, PyObject * args
 		return 0;
 	}
 
+	if (!cpu && (method_size != 3 || memcmp(method, "box", 3))) {
+		MGLError_Set("the %s method requires cpu=True", method);
+		return 0;
+	}
+
+	// Immutable textures keep their level count
+	if (self->levels && max > self->levels - 1) {
+		max = self->levels - 1;
+	}
+
 	const GLMethods & gl = self->context->gl;
 
-	gl.ActiveTexture(GL_TEXTURE0 + self->context->default_texture_unit);
-	gl.BindTexture(GL_TEXTURE_2D_ARRAY, self->texture_obj);
+	if (cpu) {
+		max = MGLContext_build_mipmaps(
+			self->context, GL_TEXTURE_2D_ARRAY, self->texture_obj, self->data_type, self->components,
+			self->internal_format, self->levels != 0, self->width, self->height, self->layers, base, max, method, method_size
+		);
 
-	gl.TexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_BASE_LEVEL, base);
-	gl.TexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAX_LEVEL, max);
+		if (max < 0) {
+			return 0;
+		}
+	} else {
+		gl.ActiveTexture(GL_TEXTURE0 + self->context->default_texture_unit);
+		gl.BindTexture(GL_TEXTURE_2D_ARRAY, self->texture_obj);
 
-	gl.GenerateMipmap(GL_TEXTURE_2D_ARRAY);
+		gl.TexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_BASE_LEVEL, base);
+		gl.TexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAX_LEVEL, max);
 
-	gl.TexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
-	gl.TexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+		gl.GenerateMipmap(GL_TEXTURE_2D_ARRAY);
+	}
+
+	// Integer textures cannot be filtered linearly
+	int min_filter = self->data_type->float_type ? GL_LINEAR_MIPMAP_LINEAR : GL_NEAREST_MIPMAP_NEAREST;
+	int mag_filter = self->data_type->float_type ? GL_LINEAR : GL_NEAREST;
 
-	self->min_filter = GL_LINEAR_MIPMAP_LINEAR;
-	self->mag_filter = GL_LINEAR;
-	self->max_level = max;
+	gl.TexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, min_filter);
+	gl.TexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, mag_filter);
+
+	self->min_filter = min_filter;
+	self->mag_filter = mag_filter;
+	self->max_level = self->levels ? self->levels - 1 : max;
+
+	// Immutable textures and views keep the storage they were created with
+	if (!self->levels) {
+		MGLContext_track_memory(self->context, MGL_MEMORY_TEXTURE_ARRAY, self->memory, MGLTextureArray_memory(self));
+	}
 
 	Py_RETURN_NONE;
 }
 
+PyObject * MGLContext_texture_view(
+	MGLContext * self,
+	int origin,
+	MGLDataType * data_type,
+	int components,
+	int internal_format,
+	int width,
+	int height,
+	int samples,
+	bool depth,
+	int first_level,
+	int levels,
+	int layer
+);
+
+PyObject * MGLTextureArray_view(MGLTextureArray * self, PyObject * args) {
+	const char * dtype;
+	Py_ssize_t dtype_size;
+	int components;
+	PyObject * levels;
+	PyObject * layers;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"s#IOO",
+		&dtype,
+		&dtype_size,
+		&components,
+		&levels,
+		&layers
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	MGLDataType * data_type = texture_view_dtype(
+		self->context, self->levels, self->data_type, self->components, false, dtype, dtype_size, components
+	);
+
+	if (!data_type) {
+		return 0;
+	}
+
+	int first_level;
+	int num_levels;
+
+	if (!parse_view_range(levels, self->levels, "levels", first_level, num_levels)) {
+		return 0;
+	}
+
+	bool same_format = data_type == self->data_type && components == self->components;
+	int internal_format = same_format ? self->internal_format : data_type->internal_format[components];
+
+	// A single layer is viewed as a 2D texture
+	if (PyLong_Check(layers)) {
+		int layer = PyLong_AsLong(layers);
+
+		if (layer < 0 || layer >= self->layers) {
+			MGLError_Set("the layer %d is out of range", layer);
+			return 0;
+		}
+
+		return MGLContext_texture_view(
+			self->context, self->texture_obj, data_type, components, internal_format,
+			self->width, self->height, 0, false, first_level, num_levels, layer
+		);
+	}
+
+	int first_layer;
+	int num_layers;
+
+	if (!parse_view_range(layers, self->layers, "layers", first_layer, num_layers)) {
+		return 0;
+	}
+
+	const GLMethods & gl = self->context->gl;
+
+	MGLTextureArray * texture = (MGLTextureArray *)MGLTextureArray_Type.tp_alloc(&MGLTextureArray_Type, 0);
+
+	texture->texture_obj = 0;
+	gl.GenTextures(1, (GLuint *)&texture->texture_obj);
+
+	if (!texture->texture_obj) {
+		MGLError_Set("cannot create texture");
+		Py_DECREF(texture);
+		return 0;
+	}
+
+	gl.TextureView(
+		texture->texture_obj, GL_TEXTURE_2D_ARRAY, self->texture_obj, internal_format,
+		first_level, num_levels, first_layer, num_layers
+	);
+
+	int filter = data_type->float_type ? GL_LINEAR : GL_NEAREST;
+
+	gl.ActiveTexture(GL_TEXTURE0 + self->context->default_texture_unit);
+	gl.BindTexture(GL_TEXTURE_2D_ARRAY, texture->texture_obj);
+	gl.TexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, filter);
+	gl.TexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, filter);
+
+	texture->width = max(self->width >> first_level, 1);
+	texture->height = max(self->height >> first_level, 1);
+	texture->layers = num_layers;
+	texture->components = components;
+	texture->internal_format = internal_format;
+	texture->data_type = data_type;
+
+	texture->min_filter = filter;
+	texture->mag_filter = filter;
+	texture->max_level = num_levels - 1;
+	texture->levels = num_levels;
+
+	texture->repeat_x = true;
+	texture->repeat_y = true;
+	texture->anisotropy = 1.0;
+
+	Py_INCREF(self->context);
+	texture->context = self->context;
+	MGLContext_track_object(self->context, MGL_MEMORY_TEXTURE_ARRAY, texture->memory, 0);
+
+	Py_INCREF(texture);
+
+	PyObject * result = PyTuple_New(2);
+	PyTuple_SET_ITEM(result, 0, (PyObject *)texture);
+	PyTuple_SET_ITEM(result, 1, PyLong_FromLong(texture->texture_obj));
+	return result;
+}
+
 PyObject * MGLTextureArray_release(MGLTextureArray * self) {
 	MGLTextureArray_Invalidate(self);
 	Py_RETURN_NONE;
 }
 
+PyObject * MGLTextureArray_evict(MGLTextureArray * self, PyObject * args) {
+	int keep;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"p",
+		&keep
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	PyObject * snapshot = MGLContext_evict_texture(
+		self->context, GL_TEXTURE_2D_ARRAY, self->texture_obj, self->data_type, self->components, self->internal_format,
+		self->levels != 0, self->width, self->height, self->layers, self->max_level + 1, keep
+	);
+
+	if (snapshot) {
+		MGLContext_track_memory(self->context, MGL_MEMORY_TEXTURE_ARRAY, self->memory, 0);
+	}
+
+	return snapshot;
+}
+
+PyObject * MGLTextureArray_check_evict(MGLTextureArray * self, PyObject * args) {
+	if (!MGLContext_check_evict(self->data_type, self->levels != 0, 0)) {
+		return 0;
+	}
+
+	Py_RETURN_NONE;
+}
+
+PyObject * MGLTextureArray_restore(MGLTextureArray * self, PyObject * args) {
+	PyObject * data;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"O",
+		&data
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	bool restored = MGLContext_restore_texture(
+		self->context, GL_TEXTURE_2D_ARRAY, self->texture_obj, self->data_type, self->components, self->internal_format,
+		self->levels != 0, self->width, self->height, self->layers, self->max_level + 1, data
+	);
+
+	if (!restored) {
+		return 0;
+	}
+
+	MGLContext_track_memory(self->context, MGL_MEMORY_TEXTURE_ARRAY, self->memory, MGLTextureArray_memory(self));
+	Py_RETURN_NONE;
+}
+
 PyMethodDef MGLTextureArray_tp_methods[] = {
 	{"write", (PyCFunction)MGLTextureArray_write, METH_VARARGS, 0},
+	{"clear", (PyCFunction)MGLTextureArray_clear, METH_VARARGS, 0},
 	{"bind", (PyCFunction)MGLTextureArray_meth_bind, METH_VARARGS, 0},
 	{"use", (PyCFunction)MGLTextureArray_use, METH_VARARGS, 0},
 	{"build_mipmaps", (PyCFunction)MGLTextureArray_build_mipmaps, METH_VARARGS, 0},
+	{"evict", (PyCFunction)MGLTextureArray_evict, METH_VARARGS, 0},
+	{"check_evict", (PyCFunction)MGLTextureArray_check_evict, METH_NOARGS, 0},
+	{"restore", (PyCFunction)MGLTextureArray_restore, METH_VARARGS, 0},
 	{"read", (PyCFunction)MGLTextureArray_read, METH_VARARGS, 0},
 	{"read_into", (PyCFunction)MGLTextureArray_read_into, METH_VARARGS, 0},
+	{"view", (PyCFunction)MGLTextureArray_view, METH_VARARGS, 0},
 	{"release", (PyCFunction)MGLTextureArray_release, METH_NOARGS, 0},
 	{0},
 };
@@ -682,12 +1122,17 @@ int MGLTextureArray_set_anisotropy(MGLTextureArray * self, PyObject * value) {
 	return 0;
 }
 
+PyObject * MGLTextureArray_get_memory(MGLTextureArray * self) {
+	return PyLong_FromLongLong(self->memory);
+}
+
 PyGetSetDef MGLTextureArray_tp_getseters[] = {
 	{(char *)"repeat_x", (getter)MGLTextureArray_get_repeat_x, (setter)MGLTextureArray_set_repeat_x, 0, 0},
 	{(char *)"repeat_y", (getter)MGLTextureArray_get_repeat_y, (setter)MGLTextureArray_set_repeat_y, 0, 0},
 	{(char *)"filter", (getter)MGLTextureArray_get_filter, (setter)MGLTextureArray_set_filter, 0, 0},
 	{(char *)"swizzle", (getter)MGLTextureArray_get_swizzle, (setter)MGLTextureArray_set_swizzle, 0, 0},
 	{(char *)"anisotropy", (getter)MGLTextureArray_get_anisotropy, (setter)MGLTextureArray_set_anisotropy, 0, 0},
+	{(char *)"memory", (getter)MGLTextureArray_get_memory, 0, 0, 0},
 	{0},
 };
 
@@ -741,6 +1186,7 @@ void MGLTextureArray_Invalidate(MGLTextureArray * texture) {
 
 	const GLMethods & gl = texture->context->gl;
 	gl.DeleteTextures(1, (GLuint *)&texture->texture_obj);
+	MGLContext_untrack_object(texture->context, MGL_MEMORY_TEXTURE_ARRAY, texture->memory);
 
 	Py_DECREF(texture->context);
 	Py_SET_TYPE(texture, &MGLInvalidObject_Type);
@@ -0,0 +1,493 @@
+#include <algorithm>
+#include <map>
+#include <vector>
+
+#include "Types.hpp"
+
+// Packs rectangles into the layers of a texture array.
+// Every layer keeps a skyline, the top edge of the packed rectangles as horizontal segments.
+// A new rectangle goes to the lowest position the skyline can hold it at, searching the layers in order.
+// Removed rectangles become free rectangles reused before the skyline grows, compaction repacks
+// the live rectangles into fresh skylines and moves their texels with glCopyImageSubData.
+
+struct MGLAtlasSegment {
+	int x;
+	int y;
+	int width;
+};
+
+// Rectangles include the padding on their right and bottom side
+struct MGLAtlasRect {
+	int layer;
+	int x;
+	int y;
+	int width;
+	int height;
+};
+
+struct MGLAtlasPacker {
+	int width;
+	int height;
+	int layers;
+	int padding;
+
+	std::vector<std::vector<MGLAtlasSegment>> skylines;
+	std::vector<MGLAtlasRect> free_rects;
+	std::vector<int> live;
+
+	// The allocated regions by id and their unpadded size
+	std::map<int, MGLAtlasRect> regions;
+	std::map<int, std::pair<int, int>> sizes;
+
+	int next_id;
+	long long allocated_area;
+};
+
+static void atlas_reset_layer(MGLAtlasPacker * packer, int layer) {
+	packer->skylines[layer].assign(1, {0, 0, packer->width});
+
+	for (size_t i = 0; i < packer->free_rects.size(); ) {
+		if (packer->free_rects[i].layer == layer) {
+			packer->free_rects.erase(packer->free_rects.begin() + i);
+		} else {
+			++i;
+		}
+	}
+}
+
+// Returns the lowest y the rectangle fits at when its left edge is the segment at index, -1 if it does not fit
+static int skyline_fit(const std::vector<MGLAtlasSegment> & skyline, size_t index, int width, int height, int atlas_width, int atlas_height) {
+	int x = skyline[index].x;
+	if (x + width > atlas_width) {
+		return -1;
+	}
+
+	int y = 0;
+	int remaining = width;
+	for (size_t i = index; remaining > 0; ++i) {
+		y = std::max(y, skyline[i].y);
+		if (y + height > atlas_height) {
+			return -1;
+		}
+		remaining -= skyline[i].width;
+	}
+
+	return y;
+}
+
+static void skyline_place(std::vector<MGLAtlasSegment> & skyline, size_t index, int x, int y, int width, int height) {
+	skyline.insert(skyline.begin() + index, {x, y + height, width});
+
+	// Trim the segments now covered by the new one
+	for (size_t i = index + 1; i < skyline.size(); ) {
+		int covered = skyline[i - 1].x + skyline[i - 1].width - skyline[i].x;
+		if (covered <= 0) {
+			break;
+		}
+		if (covered >= skyline[i].width) {
+			skyline.erase(skyline.begin() + i);
+			continue;
+		}
+		skyline[i].x += covered;
+		skyline[i].width -= covered;
+		break;
+	}
+
+	for (size_t i = 0; i + 1 < skyline.size(); ) {
+		if (skyline[i].y == skyline[i + 1].y) {
+			skyline[i].width += skyline[i + 1].width;
+			skyline.erase(skyline.begin() + i + 1);
+		} else {
+			++i;
+		}
+	}
+}
+
+static bool skyline_allocate(MGLAtlasPacker * packer, int width, int height, MGLAtlasRect & rect) {
+	for (int layer = 0; layer < packer->layers; ++layer) {
+		std::vector<MGLAtlasSegment> & skyline = packer->skylines[layer];
+
+		int best_index = -1;
+		int best_x = 0;
+		int best_y = 0;
+
+		for (size_t i = 0; i < skyline.size(); ++i) {
+			int y = skyline_fit(skyline, i, width, height, packer->width, packer->height);
+			if (y < 0) {
+				continue;
+			}
+			if (best_index < 0 || y < best_y || (y == best_y && skyline[i].x < best_x)) {
+				best_index = (int)i;
+				best_x = skyline[i].x;
+				best_y = y;
+			}
+		}
+
+		if (best_index >= 0) {
+			skyline_place(skyline, best_index, best_x, best_y, width, height);
+			rect = {layer, best_x, best_y, width, height};
+			return true;
+		}
+	}
+
+	return false;
+}
+
+// Takes the smallest free rectangle holding the size and splits the rest into a right and a bottom rectangle
+static bool free_rect_allocate(MGLAtlasPacker * packer, int width, int height, MGLAtlasRect & rect) {
+	int best = -1;
+	long long best_area = 0;
+
+	for (size_t i = 0; i < packer->free_rects.size(); ++i) {
+		const MGLAtlasRect & free_rect = packer->free_rects[i];
+		if (free_rect.width < width || free_rect.height < height) {
+			continue;
+		}
+		long long area = (long long)free_rect.width * free_rect.height;
+		if (best < 0 || area < best_area) {
+			best = (int)i;
+			best_area = area;
+		}
+	}
+
+	if (best < 0) {
+		return false;
+	}
+
+	MGLAtlasRect free_rect = packer->free_rects[best];
+	packer->free_rects.erase(packer->free_rects.begin() + best);
+
+	rect = {free_rect.layer, free_rect.x, free_rect.y, width, height};
+
+	if (free_rect.width > width) {
+		packer->free_rects.push_back({free_rect.layer, free_rect.x + width, free_rect.y, free_rect.width - width, height});
+	}
+	if (free_rect.height > height) {
+		packer->free_rects.push_back({free_rect.layer, free_rect.x, free_rect.y + height, free_rect.width, free_rect.height - height});
+	}
+
+	return true;
+}
+
+static PyObject * atlas_region_tuple(int id, const MGLAtlasRect & rect) {
+	return Py_BuildValue("(iiii)", id, rect.layer, rect.x, rect.y);
+}
+
+PyObject * MGLContext_texture_atlas(MGLContext * self, PyObject * args) {
+	MGLTextureArray * texture;
+	int padding;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"O!i",
+		&MGLTextureArray_Type,
+		&texture,
+		&padding
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	if (padding < 0) {
+		MGLError_Set("the padding must not be negative");
+		return 0;
+	}
+
+	if (texture->data_type->block_size) {
+		MGLError_Set("compressed dtypes cannot be used for texture atlases");
+		return 0;
+	}
+
+	MGLTextureAtlas * atlas = (MGLTextureAtlas *)MGLTextureAtlas_Type.tp_alloc(&MGLTextureAtlas_Type, 0);
+
+	MGLAtlasPacker * packer = new MGLAtlasPacker();
+	packer->width = texture->width;
+	packer->height = texture->height;
+	packer->layers = texture->layers;
+	packer->padding = padding;
+	packer->skylines.resize(texture->layers);
+	packer->live.assign(texture->layers, 0);
+	packer->next_id = 0;
+	packer->allocated_area = 0;
+
+	for (int layer = 0; layer < texture->layers; ++layer) {
+		atlas_reset_layer(packer, layer);
+	}
+
+	Py_INCREF(self);
+	atlas->context = self;
+
+	Py_INCREF(texture);
+	atlas->texture = texture;
+
+	atlas->packer = packer;
+
+	Py_INCREF(atlas);
+	return (PyObject *)atlas;
+}
+
+PyObject * MGLTextureAtlas_tp_new(PyTypeObject * type, PyObject * args, PyObject * kwargs) {
+	MGLTextureAtlas * self = (MGLTextureAtlas *)type->tp_alloc(type, 0);
+
+	if (self) {
+	}
+
+	return (PyObject *)self;
+}
+
+void MGLTextureAtlas_tp_dealloc(MGLTextureAtlas * self) {
+	Py_TYPE(self)->tp_free((PyObject *)self);
+}
+
+PyObject * MGLTextureAtlas_allocate(MGLTextureAtlas * self, PyObject * args) {
+	int width;
+	int height;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"(II)",
+		&width,
+		&height
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	MGLAtlasPacker * packer = self->packer;
+
+	if (width < 1 || height < 1 || width > packer->width || height > packer->height) {
+		MGLError_Set("the size %dx%d does not fit the %dx%d atlas", width, height, packer->width, packer->height);
+		return 0;
+	}
+
+	// The padding may be cut at the edges of the layer
+	int padded_width = std::min(width + packer->padding, packer->width);
+	int padded_height = std::min(height + packer->padding, packer->height);
+
+	MGLAtlasRect rect;
+
+	if (!free_rect_allocate(packer, padded_width, padded_height, rect) && !skyline_allocate(packer, padded_width, padded_height, rect)) {
+		Py_RETURN_NONE;
+	}
+
+	int id = packer->next_id++;
+	packer->regions[id] = rect;
+	packer->sizes[id] = std::make_pair(width, height);
+	packer->live[rect.layer] += 1;
+	packer->allocated_area += (long long)width * height;
+
+	return atlas_region_tuple(id, rect);
+}
+
+PyObject * MGLTextureAtlas_free(MGLTextureAtlas * self, PyObject * args) {
+	int id;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"i",
+		&id
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	MGLAtlasPacker * packer = self->packer;
+
+	std::map<int, MGLAtlasRect>::iterator it = packer->regions.find(id);
+
+	if (it == packer->regions.end()) {
+		MGLError_Set("the region %d is not allocated", id);
+		return 0;
+	}
+
+	MGLAtlasRect rect = it->second;
+	std::pair<int, int> size = packer->sizes[id];
+
+	packer->regions.erase(it);
+	packer->sizes.erase(id);
+	packer->allocated_area -= (long long)size.first * size.second;
+
+	// Empty layers start over with a flat skyline
+	if (--packer->live[rect.layer] == 0) {
+		atlas_reset_layer(packer, rect.layer);
+	} else {
+		packer->free_rects.push_back(rect);
+	}
+
+	Py_RETURN_NONE;
+}
+
+PyObject * MGLTextureAtlas_compact(MGLTextureAtlas * self, PyObject * args) {
+	MGLContext * context = self->context;
+	MGLTextureArray * texture = self->texture;
+	MGLAtlasPacker * packer = self->packer;
+
+	if (context->version_code < 430) {
+		MGLError_Set("compacting a texture atlas requires OpenGL 4.3");
+		return 0;
+	}
+
+	// Tall rectangles first keep the skylines flat
+	std::vector<int> order;
+	for (std::map<int, MGLAtlasRect>::iterator it = packer->regions.begin(); it != packer->regions.end(); ++it) {
+		order.push_back(it->first);
+	}
+
+	std::stable_sort(order.begin(), order.end(), [packer](int a, int b) {
+		const MGLAtlasRect & ra = packer->regions[a];
+		const MGLAtlasRect & rb = packer->regions[b];
+		return ra.height != rb.height ? ra.height > rb.height : ra.width > rb.width;
+	});
+
+	MGLAtlasPacker compacted = *packer;
+	compacted.free_rects.clear();
+	compacted.live.assign(packer->layers, 0);
+	for (int layer = 0; layer < packer->layers; ++layer) {
+		compacted.skylines[layer].assign(1, {0, 0, packer->width});
+	}
+
+	for (size_t i = 0; i < order.size(); ++i) {
+		const MGLAtlasRect & rect = packer->regions[order[i]];
+		MGLAtlasRect placed;
+		if (!skyline_allocate(&compacted, rect.width, rect.height, placed)) {
+			// The current layout is kept
+			Py_RETURN_NONE;
+		}
+		compacted.regions[order[i]] = placed;
+		compacted.live[placed.layer] += 1;
+	}
+
+	const GLMethods & gl = context->gl;
+
+	int base_format = texture->data_type->base_format[texture->components];
+	int pixel_type = texture->data_type->gl_type;
+
+	// The regions are copied to a scratch texture at their new place, then the scratch texture is copied back
+	int scratch = 0;
+	gl.GenTextures(1, (GLuint *)&scratch);
+
+	gl.ActiveTexture(GL_TEXTURE0 + context->default_texture_unit);
+	gl.BindTexture(GL_TEXTURE_2D_ARRAY, scratch);
+	gl.TexImage3D(GL_TEXTURE_2D_ARRAY, 0, texture->internal_format, packer->width, packer->height, packer->layers, 0, base_format, pixel_type, 0);
+	gl.TexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAX_LEVEL, 0);
+
+	// The padding is cleared so filtering does not bleed the previous contents
+	if (gl.ClearTexImage) {
+		gl.ClearTexImage(scratch, 0, base_format, pixel_type, 0);
+	}
+
+	PyObject * result = PyTuple_New(order.size());
+
+	for (size_t i = 0; i < order.size(); ++i) {
+		int id = order[i];
+		const MGLAtlasRect & src = packer->regions[id];
+		const MGLAtlasRect & dst = compacted.regions[id];
+		std::pair<int, int> size = packer->sizes[id];
+
+		gl.CopyImageSubData(
+			texture->texture_obj, GL_TEXTURE_2D_ARRAY, 0, src.x, src.y, src.layer,
+			scratch, GL_TEXTURE_2D_ARRAY, 0, dst.x, dst.y, dst.layer,
+			size.first, size.second, 1
+		);
+
+		PyTuple_SET_ITEM(result, i, atlas_region_tuple(id, dst));
+	}
+
+	gl.CopyImageSubData(
+		scratch, GL_TEXTURE_2D_ARRAY, 0, 0, 0, 0,
+		texture->texture_obj, GL_TEXTURE_2D_ARRAY, 0, 0, 0, 0,
+		packer->width, packer->height, packer->layers
+	);
+
+	gl.DeleteTextures(1, (GLuint *)&scratch);
+
+	*packer = compacted;
+
+	return result;
+}
+
+PyObject * MGLTextureAtlas_release(MGLTextureAtlas * self) {
+	MGLTextureAtlas_Invalidate(self);
+	Py_RETURN_NONE;
+}
+
+PyMethodDef MGLTextureAtlas_tp_methods[] = {
+	{"allocate", (PyCFunction)MGLTextureAtlas_allocate, METH_VARARGS, 0},
+	{"free", (PyCFunction)MGLTextureAtlas_free, METH_VARARGS, 0},
+	{"compact", (PyCFunction)MGLTextureAtlas_compact, METH_NOARGS, 0},
+	{"release", (PyCFunction)MGLTextureAtlas_release, METH_NOARGS, 0},
+	{0},
+};
+
+PyObject * MGLTextureAtlas_get_allocated_area(MGLTextureAtlas * self, void * closure) {
+	return PyLong_FromLongLong(self->packer->allocated_area);
+}
+
+PyObject * MGLTextureAtlas_get_free_rects(MGLTextureAtlas * self, void * closure) {
+	return PyLong_FromSize_t(self->packer->free_rects.size());
+}
+
+PyGetSetDef MGLTextureAtlas_tp_getseters[] = {
+	{(char *)"allocated_area", (getter)MGLTextureAtlas_get_allocated_area, 0, 0, 0},
+	{(char *)"free_rects", (getter)MGLTextureAtlas_get_free_rects, 0, 0, 0},
+	{0},
+};
+
+PyTypeObject MGLTextureAtlas_Type = {
+	PyVarObject_HEAD_INIT(0, 0)
+	"mgl.TextureAtlas",                                     // tp_name
+	sizeof(MGLTextureAtlas),                                // tp_basicsize
+	0,                                                      // tp_itemsize
+	(destructor)MGLTextureAtlas_tp_dealloc,                 // tp_dealloc
+	0,                                                      // tp_print
+	0,                                                      // tp_getattr
+	0,                                                      // tp_setattr
+	0,                                                      // tp_reserved
+	0,                                                      // tp_repr
+	0,                                                      // tp_as_number
+	0,                                                      // tp_as_sequence
+	0,                                                      // tp_as_mapping
+	0,                                                      // tp_hash
+	0,                                                      // tp_call
+	0,                                                      // tp_str
+	0,                                                      // tp_getattro
+	0,                                                      // tp_setattro
+	0,                                                      // tp_as_buffer
+	Py_TPFLAGS_DEFAULT,                                     // tp_flags
+	0,                                                      // tp_doc
+	0,                                                      // tp_traverse
+	0,                                                      // tp_clear
+	0,                                                      // tp_richcompare
+	0,                                                      // tp_weaklistoffset
+	0,                                                      // tp_iter
+	0,                                                      // tp_iternext
+	MGLTextureAtlas_tp_methods,                             // tp_methods
+	0,                                                      // tp_members
+	MGLTextureAtlas_tp_getseters,                           // tp_getset
+	0,                                                      // tp_base
+	0,                                                      // tp_dict
+	0,                                                      // tp_descr_get
+	0,                                                      // tp_descr_set
+	0,                                                      // tp_dictoffset
+	0,                                                      // tp_init
+	0,                                                      // tp_alloc
+	MGLTextureAtlas_tp_new,                                 // tp_new
+};
+
+void MGLTextureAtlas_Invalidate(MGLTextureAtlas * atlas) {
+	if (Py_TYPE(atlas) == &MGLInvalidObject_Type) {
+		return;
+	}
+
+	delete atlas->packer;
+	atlas->packer = 0;
+
+	Py_DECREF(atlas->texture);
+
+	Py_SET_TYPE(atlas, &MGLInvalidObject_Type);
+	Py_DECREF(atlas->context);
+	Py_DECREF(atlas);
+}
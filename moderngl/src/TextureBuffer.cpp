@@ -0,0 +1,275 @@
+#include "Types.hpp"
+
+// Sized internal formats accepted by glTexBuffer (OpenGL 4.6 table 8.16)
+static bool texel_buffer_format(int internal_format) {
+	switch (internal_format) {
+		case GL_R8: case GL_R16: case GL_R16F: case GL_R32F:
+		case GL_R8I: case GL_R16I: case GL_R32I:
+		case GL_R8UI: case GL_R16UI: case GL_R32UI:
+		case GL_RG8: case GL_RG16: case GL_RG16F: case GL_RG32F:
+		case GL_RG8I: case GL_RG16I: case GL_RG32I:
+		case GL_RG8UI: case GL_RG16UI: case GL_RG32UI:
+		case GL_RGB32F: case GL_RGB32I: case GL_RGB32UI:
+		case GL_RGBA8: case GL_RGBA16: case GL_RGBA16F: case GL_RGBA32F:
+		case GL_RGBA8I: case GL_RGBA16I: case GL_RGBA32I:
+		case GL_RGBA8UI: case GL_RGBA16UI: case GL_RGBA32UI:
+			return true;
+	}
+	return false;
+}
+
+PyObject * MGLContext_texture_buffer(MGLContext * self, PyObject * args) {
+	MGLBuffer * buffer;
+	const char * dtype;
+	Py_ssize_t dtype_size;
+	int components;
+	Py_ssize_t offset;
+	Py_ssize_t size;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"O!s#Inn",
+		&MGLBuffer_Type,
+		&buffer,
+		&dtype,
+		&dtype_size,
+		&components,
+		&offset,
+		&size
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	if (components < 1 || components > 4) {
+		MGLError_Set("the components must be 1, 2, 3 or 4");
+		return 0;
+	}
+
+	MGLDataType * data_type = from_dtype(dtype, dtype_size);
+
+	if (!data_type) {
+		MGLError_Set("invalid dtype");
+		return 0;
+	}
+
+	int internal_format = data_type->internal_format[components];
+
+	if (!texel_buffer_format(internal_format)) {
+		MGLError_Set("the dtype %s with %d components cannot be used in a texture buffer", dtype, components);
+		return 0;
+	}
+
+	if (size < 0) {
+		size = buffer->size - offset;
+	}
+
+	if (offset < 0 || size <= 0 || offset + size > buffer->size) {
+		MGLError_Set("out of range offset = %d or size = %d", (int)offset, (int)size);
+		return 0;
+	}
+
+	int pixel_size = data_type->size * components;
+
+	if (size % pixel_size) {
+		MGLError_Set("the size must be a multiple of %d bytes", pixel_size);
+		return 0;
+	}
+
+	const GLMethods & gl = self->gl;
+
+	int max_texels = 0;
+	gl.GetIntegerv(GL_MAX_TEXTURE_BUFFER_SIZE, (GLint *)&max_texels);
+
+	if (size / pixel_size > max_texels) {
+		MGLError_Set("the texture buffer is limited to %d texels", max_texels);
+		return 0;
+	}
+
+	bool whole_buffer = offset == 0 && size == buffer->size;
+
+	if (!whole_buffer) {
+		if (self->version_code < 430 || !gl.TexBufferRange) {
+			MGLError_Set("texture buffer ranges require OpenGL 4.3");
+			return 0;
+		}
+
+		int alignment = 1;
+		gl.GetIntegerv(GL_TEXTURE_BUFFER_OFFSET_ALIGNMENT, (GLint *)&alignment);
+
+		if (offset % alignment) {
+			MGLError_Set("the offset must be a multiple of %d bytes", alignment);
+			return 0;
+		}
+	}
+
+	MGLTextureBuffer * texture = (MGLTextureBuffer *)MGLTextureBuffer_Type.tp_alloc(&MGLTextureBuffer_Type, 0);
+
+	texture->texture_obj = 0;
+	gl.GenTextures(1, (GLuint *)&texture->texture_obj);
+
+	if (!texture->texture_obj) {
+		MGLError_Set("cannot create texture");
+		Py_DECREF(texture);
+		return 0;
+	}
+
+	gl.ActiveTexture(GL_TEXTURE0 + self->default_texture_unit);
+	gl.BindTexture(GL_TEXTURE_BUFFER, texture->texture_obj);
+
+	if (whole_buffer) {
+		gl.TexBuffer(GL_TEXTURE_BUFFER, internal_format, buffer->buffer_obj);
+	} else {
+		gl.TexBufferRange(GL_TEXTURE_BUFFER, internal_format, buffer->buffer_obj, offset, size);
+	}
+
+	texture->data_type = data_type;
+	texture->components = components;
+	texture->offset = offset;
+	texture->size = size;
+
+	Py_INCREF(self);
+	texture->context = self;
+
+	Py_INCREF(texture);
+
+	PyObject * result = PyTuple_New(2);
+	PyTuple_SET_ITEM(result, 0, (PyObject *)texture);
+	PyTuple_SET_ITEM(result, 1, PyLong_FromLong(texture->texture_obj));
+	return result;
+}
+
+PyObject * MGLTextureBuffer_tp_new(PyTypeObject * type, PyObject * args, PyObject * kwargs) {
+	MGLTextureBuffer * self = (MGLTextureBuffer *)type->tp_alloc(type, 0);
+
+	if (self) {
+	}
+
+	return (PyObject *)self;
+}
+
+void MGLTextureBuffer_tp_dealloc(MGLTextureBuffer * self) {
+	MGLTextureBuffer_Type.tp_free((PyObject *)self);
+}
+
+PyObject * MGLTextureBuffer_use(MGLTextureBuffer * self, PyObject * args) {
+	int index;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"I",
+		&index
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	const GLMethods & gl = self->context->gl;
+	gl.ActiveTexture(GL_TEXTURE0 + index);
+	gl.BindTexture(GL_TEXTURE_BUFFER, self->texture_obj);
+
+	Py_RETURN_NONE;
+}
+
+PyObject * MGLTextureBuffer_meth_bind(MGLTextureBuffer * self, PyObject * args) {
+	int unit;
+	int read;
+	int write;
+	int format;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"IppI",
+		&unit,
+		&read,
+		&write,
+		&format
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	int access = GL_READ_WRITE;
+	if (read && !write) access = GL_READ_ONLY;
+	else if (!read && write) access = GL_WRITE_ONLY;
+	else if (!read && !write) {
+		MGLError_Set("Illegal access mode. Read or write needs to be enabled.");
+		return 0;
+	}
+
+	int frmt = format ? format : self->data_type->internal_format[self->components];
+
+	const GLMethods & gl = self->context->gl;
+	gl.BindImageTexture(unit, self->texture_obj, 0, 0, 0, access, frmt);
+
+	Py_RETURN_NONE;
+}
+
+PyObject * MGLTextureBuffer_release(MGLTextureBuffer * self) {
+	MGLTextureBuffer_Invalidate(self);
+	Py_RETURN_NONE;
+}
+
+PyMethodDef MGLTextureBuffer_tp_methods[] = {
+	{"use", (PyCFunction)MGLTextureBuffer_use, METH_VARARGS, 0},
+	{"bind", (PyCFunction)MGLTextureBuffer_meth_bind, METH_VARARGS, 0},
+	{"release", (PyCFunction)MGLTextureBuffer_release, METH_NOARGS, 0},
+	{0},
+};
+
+PyTypeObject MGLTextureBuffer_Type = {
+	PyVarObject_HEAD_INIT(0, 0)
+	"mgl.TextureBuffer",                                    // tp_name
+	sizeof(MGLTextureBuffer),                               // tp_basicsize
+	0,                                                      // tp_itemsize
+	(destructor)MGLTextureBuffer_tp_dealloc,                // tp_dealloc
+	0,                                                      // tp_print
+	0,                                                      // tp_getattr
+	0,                                                      // tp_setattr
+	0,                                                      // tp_reserved
+	0,                                                      // tp_repr
+	0,                                                      // tp_as_number
+	0,                                                      // tp_as_sequence
+	0,                                                      // tp_as_mapping
+	0,                                                      // tp_hash
+	0,                                                      // tp_call
+	0,                                                      // tp_str
+	0,                                                      // tp_getattro
+	0,                                                      // tp_setattro
+	0,                                                      // tp_as_buffer
+	Py_TPFLAGS_DEFAULT,                                     // tp_flags
+	0,                                                      // tp_doc
+	0,                                                      // tp_traverse
+	0,                                                      // tp_clear
+	0,                                                      // tp_richcompare
+	0,                                                      // tp_weaklistoffset
+	0,                                                      // tp_iter
+	0,                                                      // tp_iternext
+	MGLTextureBuffer_tp_methods,                            // tp_methods
+	0,                                                      // tp_members
+	0,                                                      // tp_getset
+	0,                                                      // tp_base
+	0,                                                      // tp_dict
+	0,                                                      // tp_descr_get
+	0,                                                      // tp_descr_set
+	0,                                                      // tp_dictoffset
+	0,                                                      // tp_init
+	0,                                                      // tp_alloc
+	MGLTextureBuffer_tp_new,                                // tp_new
+};
+
+void MGLTextureBuffer_Invalidate(MGLTextureBuffer * texture) {
+	if (Py_TYPE(texture) == &MGLInvalidObject_Type) {
+		return;
+	}
+
+	const GLMethods & gl = texture->context->gl;
+	gl.DeleteTextures(1, (GLuint *)&texture->texture_obj);
+
+	Py_DECREF(texture->context);
+	Py_SET_TYPE(texture, &MGLInvalidObject_Type);
+	Py_DECREF(texture);
+}
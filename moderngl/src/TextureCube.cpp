@@ -15,16 +15,19 @@ PyObject * MGLContext_texture_cube(MGLContext * self, PyObject * args) {
 	const char * dtype;
 	Py_ssize_t dtype_size;
 
+	int levels;
+
 	int args_ok = PyArg_ParseTuple(
 		args,
-		"(II)IOIs#",
+		"(II)IOIs#i",
 		&width,
 		&height,
 		&components,
 		&data,
 		&alignment,
 		&dtype,
-		&dtype_size
+		&dtype_size,
+		&levels
 	);
 
 	if (!args_ok) {
@@ -48,10 +51,23 @@ PyObject * MGLContext_texture_cube(MGLContext * self, PyObject * args) {
 		return 0;
 	}
 
-	int expected_size = width * components * data_type->size;
+	if (!data_type->internal_format[components]) {
+		MGLError_Set("the %s dtype does not support %d components", dtype, components);
+		return 0;
+	}
+
+	if (!MGLContext_texture_levels(self, levels, width, height, 1)) {
+		return 0;
+	}
+
+	int expected_size = width * pixel_size(data_type, components);
 	expected_size = (expected_size + alignment - 1) / alignment * alignment;
 	expected_size = expected_size * height * 6;
 
+	if (data_type->block_size) {
+		expected_size = compressed_image_size(data_type, components, width, height) * 6;
+	}
+
 	Py_buffer buffer_view;
 
 	if (data != Py_None) {
@@ -108,12 +124,29 @@ PyObject * MGLContext_texture_cube(MGLContext * self, PyObject * args) {
 
 	gl.PixelStorei(GL_PACK_ALIGNMENT, alignment);
 	gl.PixelStorei(GL_UNPACK_ALIGNMENT, alignment);
-	gl.TexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X, 0, internal_format, width, height, 0, base_format, pixel_type, ptr[0]);
-	gl.TexImage2D(GL_TEXTURE_CUBE_MAP_NEGATIVE_X, 0, internal_format, width, height, 0, base_format, pixel_type, ptr[1]);
-	gl.TexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_Y, 0, internal_format, width, height, 0, base_format, pixel_type, ptr[2]);
-	gl.TexImage2D(GL_TEXTURE_CUBE_MAP_NEGATIVE_Y, 0, internal_format, width, height, 0, base_format, pixel_type, ptr[3]);
-	gl.TexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_Z, 0, internal_format, width, height, 0, base_format, pixel_type, ptr[4]);
-	gl.TexImage2D(GL_TEXTURE_CUBE_MAP_NEGATIVE_Z, 0, internal_format, width, height, 0, base_format, pixel_type, ptr[5]);
+	if (levels) {
+		gl.TexStorage2D(GL_TEXTURE_CUBE_MAP, levels, internal_format, width, height);
+		if (buffer_view.buf) {
+			for (int face = 0; face < 6; ++face) {
+				if (data_type->block_size) {
+					gl.CompressedTexSubImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + face, 0, 0, 0, width, height, internal_format, expected_size / 6, ptr[face]);
+				} else {
+					gl.TexSubImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + face, 0, 0, 0, width, height, base_format, pixel_type, ptr[face]);
+				}
+			}
+		}
+	} else if (buffer_view.buf && data_type->block_size) {
+		for (int face = 0; face < 6; ++face) {
+			gl.CompressedTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + face, 0, internal_format, width, height, 0, expected_size / 6, ptr[face]);
+		}
+	} else {
+		gl.TexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X, 0, internal_format, width, height, 0, base_format, pixel_type, ptr[0]);
+		gl.TexImage2D(GL_TEXTURE_CUBE_MAP_NEGATIVE_X, 0, internal_format, width, height, 0, base_format, pixel_type, ptr[1]);
+		gl.TexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_Y, 0, internal_format, width, height, 0, base_format, pixel_type, ptr[2]);
+		gl.TexImage2D(GL_TEXTURE_CUBE_MAP_NEGATIVE_Y, 0, internal_format, width, height, 0, base_format, pixel_type, ptr[3]);
+		gl.TexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_Z, 0, internal_format, width, height, 0, base_format, pixel_type, ptr[4]);
+		gl.TexImage2D(GL_TEXTURE_CUBE_MAP_NEGATIVE_Z, 0, internal_format, width, height, 0, base_format, pixel_type, ptr[5]);
+	}
 	if (data_type->float_type) {
 		gl.TexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
 		gl.TexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
@@ -129,15 +162,18 @@ PyObject * MGLContext_texture_cube(MGLContext * self, PyObject * args) {
 	texture->width = width;
 	texture->height = height;
 	texture->components = components;
+	texture->internal_format = internal_format;
 	texture->data_type = data_type;
 
 	texture->min_filter = data_type->float_type ? GL_LINEAR : GL_NEAREST;
 	texture->mag_filter = data_type->float_type ? GL_LINEAR : GL_NEAREST;
-	texture->max_level = 0;
+	texture->max_level = levels ? levels - 1 : 0;
+	texture->levels = levels;
 	texture->anisotropy = 1.0;
 
 	Py_INCREF(self);
 	texture->context = self;
+	MGLContext_track_object(self, MGL_MEMORY_TEXTURE_CUBE, texture->memory, MGLTextureCube_memory(texture));
 
 	Py_INCREF(texture);
 
@@ -162,12 +198,16 @@ void MGLTextureCube_tp_dealloc(MGLTextureCube * self) {
 
 PyObject * MGLTextureCube_read(MGLTextureCube * self, PyObject * args) {
 	int face;
+	PyObject * viewport;
+	int level;
 	int alignment;
 
 	int args_ok = PyArg_ParseTuple(
 		args,
-		"iI",
+		"iOII",
 		&face,
+		&viewport,
+		&level,
 		&alignment
 	);
 
@@ -185,14 +225,40 @@ PyObject * MGLTextureCube_read(MGLTextureCube * self, PyObject * args) {
 		return 0;
 	}
 
-	int expected_size = self->width * self->components * self->data_type->size;
+	if (level < 0 || level > self->max_level) {
+		MGLError_Set("invalid level");
+		return 0;
+	}
+
+	// The faces of a cube map are the layers of glGetTextureSubImage
+	int level_size[2] = {max(self->width >> level, 1), max(self->height >> level, 1)};
+	int offset[3] = {0, 0, face};
+	int size[3] = {level_size[0], level_size[1], 1};
+
+	if (!parse_texture_viewport(viewport, 2, offset, size)) {
+		return 0;
+	}
+
+	if (!texture_viewport_ok(2, offset, size, level_size)) {
+		MGLError_Set("the viewport is out of range");
+		return 0;
+	}
+
+	int expected_size = size[0] * pixel_size(self->data_type, self->components);
 	expected_size = (expected_size + alignment - 1) / alignment * alignment;
-	expected_size = expected_size * self->height;
+	expected_size = expected_size * size[1];
+
+	if (self->data_type->block_size) {
+		if (!compressed_viewport_ok(offset[0], offset[1], size[0], size[1], level_size[0], level_size[1])) {
+			MGLError_Set("the viewport must be aligned to 4x4 blocks");
+			return 0;
+		}
+		expected_size = compressed_image_size(self->data_type, self->components, size[0], size[1]);
+	}
 
 	PyObject * result = PyBytes_FromStringAndSize(0, expected_size);
 	char * data = PyBytes_AS_STRING(result);
 
-	int pixel_type = self->data_type->gl_type;
 	int format = self->data_type->base_format[self->components];
 
 	const GLMethods & gl = self->context->gl;
@@ -202,7 +268,13 @@ PyObject * MGLTextureCube_read(MGLTextureCube * self, PyObject * args) {
 
 	gl.PixelStorei(GL_PACK_ALIGNMENT, alignment);
 	gl.PixelStorei(GL_UNPACK_ALIGNMENT, alignment);
-	gl.GetTexImage(GL_TEXTURE_CUBE_MAP_POSITIVE_X + face, 0, format, pixel_type, data);
+
+	bool region = viewport != Py_None;
+
+	if (!MGLContext_read_texture(self->context, self->texture_obj, GL_TEXTURE_CUBE_MAP_POSITIVE_X + face, level, region, offset, size, self->data_type, format, expected_size, data)) {
+		Py_DECREF(result);
+		return 0;
+	}
 
 	return result;
 }
@@ -210,15 +282,24 @@ PyObject * MGLTextureCube_read(MGLTextureCube * self, PyObject * args) {
 PyObject * MGLTextureCube_read_into(MGLTextureCube * self, PyObject * args) {
 	PyObject * data;
 	int face;
+	PyObject * viewport;
+	int level;
 	int alignment;
+	MGLPixelStore store;
 	Py_ssize_t write_offset;
 
 	int args_ok = PyArg_ParseTuple(
 		args,
-		"OiIn",
+		"OiOII(iiii)n",
 		&data,
 		&face,
+		&viewport,
+		&level,
 		&alignment,
+		&store.row_length,
+		&store.skip_pixels,
+		&store.skip_rows,
+		&store.image_height,
 		&write_offset
 	);
 
@@ -236,12 +317,51 @@ PyObject * MGLTextureCube_read_into(MGLTextureCube * self, PyObject * args) {
 		return 0;
 	}
 
-	int expected_size = self->width * self->components * self->data_type->size;
+	if (!pixel_store_ok(store)) {
+		MGLError_Set("the pixel store parameters must not be negative");
+		return 0;
+	}
+
+	if (level < 0 || level > self->max_level) {
+		MGLError_Set("invalid level");
+		return 0;
+	}
+
+	int level_size[2] = {max(self->width >> level, 1), max(self->height >> level, 1)};
+	int offset[3] = {0, 0, face};
+	int size[3] = {level_size[0], level_size[1], 1};
+
+	if (!parse_texture_viewport(viewport, 2, offset, size)) {
+		return 0;
+	}
+
+	if (!texture_viewport_ok(2, offset, size, level_size)) {
+		MGLError_Set("the viewport is out of range");
+		return 0;
+	}
+
+	Py_ssize_t expected_size = (Py_ssize_t)size[0] * pixel_size(self->data_type, self->components);
 	expected_size = (expected_size + alignment - 1) / alignment * alignment;
-	expected_size = expected_size * self->height;
+	expected_size = expected_size * size[1];
+
+	if (self->data_type->block_size) {
+		if (!compressed_viewport_ok(offset[0], offset[1], size[0], size[1], level_size[0], level_size[1])) {
+			MGLError_Set("the viewport must be aligned to 4x4 blocks");
+			return 0;
+		}
+		expected_size = compressed_image_size(self->data_type, self->components, size[0], size[1]);
+	}
+
+	if (!pixel_store_default(store)) {
+		if (self->data_type->block_size) {
+			MGLError_Set("pixel store parameters are not supported by compressed textures");
+			return 0;
+		}
+		expected_size = pixel_store_size(store, size[0], size[1], 1, pixel_size(self->data_type, self->components), alignment);
+	}
 
-	int pixel_type = self->data_type->gl_type;
 	int format = self->data_type->base_format[self->components];
+	bool region = viewport != Py_None;
 
 	if (Py_TYPE(data) == &MGLBuffer_Type) {
 
@@ -254,9 +374,15 @@ PyObject * MGLTextureCube_read_into(MGLTextureCube * self, PyObject * args) {
 		gl.BindTexture(GL_TEXTURE_CUBE_MAP, self->texture_obj);
 		gl.PixelStorei(GL_PACK_ALIGNMENT, alignment);
 		gl.PixelStorei(GL_UNPACK_ALIGNMENT, alignment);
-		gl.GetTexImage(GL_TEXTURE_CUBE_MAP_POSITIVE_X + face, 0, format, pixel_type, (char *)write_offset);
+		set_pixel_store(gl, true, store);
+		bool success = MGLContext_read_texture(self->context, self->texture_obj, GL_TEXTURE_CUBE_MAP_POSITIVE_X + face, level, region, offset, size, self->data_type, format, expected_size, (char *)write_offset);
+		reset_pixel_store(gl, true, store);
 		gl.BindBuffer(GL_PIXEL_PACK_BUFFER, 0);
 
+		if (!success) {
+			return 0;
+		}
+
 	} else {
 
 		Py_buffer buffer_view;
@@ -280,10 +406,16 @@ PyObject * MGLTextureCube_read_into(MGLTextureCube * self, PyObject * args) {
 		gl.BindTexture(GL_TEXTURE_CUBE_MAP, self->texture_obj);
 		gl.PixelStorei(GL_PACK_ALIGNMENT, alignment);
 		gl.PixelStorei(GL_UNPACK_ALIGNMENT, alignment);
-		gl.GetTexImage(GL_TEXTURE_CUBE_MAP_POSITIVE_X + face, 0, format, pixel_type, ptr);
+		set_pixel_store(gl, true, store);
+		bool success = MGLContext_read_texture(self->context, self->texture_obj, GL_TEXTURE_CUBE_MAP_POSITIVE_X + face, level, region, offset, size, self->data_type, format, expected_size, ptr);
+		reset_pixel_store(gl, true, store);
 
 		PyBuffer_Release(&buffer_view);
 
+		if (!success) {
+			return 0;
+		}
+
 	}
 
 	Py_RETURN_NONE;
@@ -293,15 +425,26 @@ PyObject * MGLTextureCube_write(MGLTextureCube * self, PyObject * args) {
 	int face;
 	PyObject * data;
 	PyObject * viewport;
+	int level;
 	int alignment;
+	MGLPixelStore store;
+	Py_ssize_t read_offset;
+	Py_ssize_t read_size;
 
 	int args_ok = PyArg_ParseTuple(
 		args,
-		"iOOI",
+		"iOOII(iiii)nn",
 		&face,
 		&data,
 		&viewport,
-		&alignment
+		&level,
+		&alignment,
+		&store.row_length,
+		&store.skip_pixels,
+		&store.skip_rows,
+		&store.image_height,
+		&read_offset,
+		&read_size
 	);
 
 	if (!args_ok) {
@@ -318,10 +461,20 @@ PyObject * MGLTextureCube_write(MGLTextureCube * self, PyObject * args) {
 		return 0;
 	}
 
+	if (!pixel_store_ok(store)) {
+		MGLError_Set("the pixel store parameters must not be negative");
+		return 0;
+	}
+
+	if (level < 0 || level > self->max_level) {
+		MGLError_Set("invalid level");
+		return 0;
+	}
+
 	int x = 0;
 	int y = 0;
-	int width = self->width;
-	int height = self->height;
+	int width = max(self->width >> level, 1);
+	int height = max(self->height >> level, 1);
 
 	Py_buffer buffer_view;
 
@@ -357,10 +510,18 @@ PyObject * MGLTextureCube_write(MGLTextureCube * self, PyObject * args) {
 
 	}
 
-	int expected_size = width * self->components * self->data_type->size;
+	Py_ssize_t expected_size = (Py_ssize_t)width * pixel_size(self->data_type, self->components);
 	expected_size = (expected_size + alignment - 1) / alignment * alignment;
 	expected_size = expected_size * height;
 
+	if (self->data_type->block_size) {
+		if (!compressed_viewport_ok(x, y, width, height, max(self->width >> level, 1), max(self->height >> level, 1))) {
+			MGLError_Set("the viewport must be aligned to 4x4 blocks");
+			return 0;
+		}
+		expected_size = compressed_image_size(self->data_type, self->components, width, height);
+	}
+
 	// GL_TEXTURE_CUBE_MAP_POSITIVE_X = GL_TEXTURE_CUBE_MAP_POSITIVE_X + 0
 	// GL_TEXTURE_CUBE_MAP_NEGATIVE_X = GL_TEXTURE_CUBE_MAP_POSITIVE_X + 1
 	// GL_TEXTURE_CUBE_MAP_POSITIVE_Y = GL_TEXTURE_CUBE_MAP_POSITIVE_X + 2
@@ -368,6 +529,14 @@ PyObject * MGLTextureCube_write(MGLTextureCube * self, PyObject * args) {
 	// GL_TEXTURE_CUBE_MAP_POSITIVE_Z = GL_TEXTURE_CUBE_MAP_POSITIVE_X + 4
 	// GL_TEXTURE_CUBE_MAP_NEGATIVE_Z = GL_TEXTURE_CUBE_MAP_POSITIVE_X + 5
 
+	if (!pixel_store_default(store)) {
+		if (self->data_type->block_size) {
+			MGLError_Set("pixel store parameters are not supported by compressed textures");
+			return 0;
+		}
+		expected_size = pixel_store_size(store, width, height, 1, pixel_size(self->data_type, self->components), alignment);
+	}
+
 	int pixel_type = self->data_type->gl_type;
 	int format = self->data_type->base_format[self->components];
 
@@ -375,6 +544,17 @@ PyObject * MGLTextureCube_write(MGLTextureCube * self, PyObject * args) {
 
 		MGLBuffer * buffer = (MGLBuffer *)data;
 
+		if (read_offset < 0 || read_offset + expected_size > buffer->size) {
+			MGLError_Set("the buffer is too small");
+			return 0;
+		}
+
+		// The number of bytes staged for this transfer, -1 when the rest of the buffer is available
+		if (read_size >= 0 && read_size != expected_size) {
+			MGLError_Set("data size mismatch %zd != %zd", read_size, expected_size);
+			return 0;
+		}
+
 		const GLMethods & gl = self->context->gl;
 
 		gl.BindBuffer(GL_PIXEL_UNPACK_BUFFER, buffer->buffer_obj);
@@ -382,7 +562,13 @@ PyObject * MGLTextureCube_write(MGLTextureCube * self, PyObject * args) {
 		gl.BindTexture(GL_TEXTURE_CUBE_MAP, self->texture_obj);
 		gl.PixelStorei(GL_PACK_ALIGNMENT, alignment);
 		gl.PixelStorei(GL_UNPACK_ALIGNMENT, alignment);
-		gl.TexSubImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + face, 0, x, y, width, height, format, pixel_type, 0);
+		set_pixel_store(gl, false, store);
+		if (self->data_type->block_size) {
+			gl.CompressedTexSubImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + face, level, x, y, width, height, self->internal_format, expected_size, (void *)read_offset);
+		} else {
+			gl.TexSubImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + face, level, x, y, width, height, format, pixel_type, (void *)read_offset);
+		}
+		reset_pixel_store(gl, false, store);
 		gl.BindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
 
 	} else {
@@ -393,8 +579,8 @@ PyObject * MGLTextureCube_write(MGLTextureCube * self, PyObject * args) {
 			return 0;
 		}
 
-		if (buffer_view.len != expected_size) {
-			MGLError_Set("data size mismatch %d != %d", buffer_view.len, expected_size);
+		if (pixel_store_default(store) ? buffer_view.len != expected_size : buffer_view.len < expected_size) {
+			MGLError_Set("data size mismatch %zd != %zd", buffer_view.len, expected_size);
 			PyBuffer_Release(&buffer_view);
 			return 0;
 		}
@@ -406,7 +592,13 @@ PyObject * MGLTextureCube_write(MGLTextureCube * self, PyObject * args) {
 
 		gl.PixelStorei(GL_PACK_ALIGNMENT, alignment);
 		gl.PixelStorei(GL_UNPACK_ALIGNMENT, alignment);
-		gl.TexSubImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + face, 0, x, y, width, height, format, pixel_type, buffer_view.buf);
+		set_pixel_store(gl, false, store);
+		if (self->data_type->block_size) {
+			gl.CompressedTexSubImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + face, level, x, y, width, height, self->internal_format, expected_size, buffer_view.buf);
+		} else {
+			gl.TexSubImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + face, level, x, y, width, height, format, pixel_type, buffer_view.buf);
+		}
+		reset_pixel_store(gl, false, store);
 
 		PyBuffer_Release(&buffer_view);
 	}
@@ -451,6 +643,131 @@ PyObject * MGLTextureCube_meth_bind(MGLTextureCube * self, PyObject * args) {
     Py_RETURN_NONE;
 }
 
+PyObject * MGLTextureCube_clear(MGLTextureCube * self, PyObject * args) {
+	PyObject * value;
+	int level;
+	PyObject * viewport;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"OIO",
+		&value,
+		&level,
+		&viewport
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	if (level < 0 || level > self->max_level) {
+		MGLError_Set("invalid level");
+		return 0;
+	}
+
+	// The faces are the layers of glClearTexSubImage, a viewport without the third value clears every face
+	int level_size[3] = {max(self->width >> level, 1), max(self->height >> level, 1), 6};
+	int offset[3] = {0, 0, 0};
+	int size[3] = {level_size[0], level_size[1], level_size[2]};
+
+	int dims = Py_TYPE(viewport) == &PyTuple_Type && (PyTuple_GET_SIZE(viewport) == 2 || PyTuple_GET_SIZE(viewport) == 4) ? 2 : 3;
+
+	if (!parse_texture_viewport(viewport, dims, offset, size)) {
+		return 0;
+	}
+
+	if (!texture_viewport_ok(3, offset, size, level_size)) {
+		MGLError_Set("the viewport is out of range");
+		return 0;
+	}
+
+	bool region = viewport != Py_None;
+
+	if (!MGLContext_clear_texture(self->context, self->texture_obj, self->data_type, self->components, false, value, level, region, offset, size)) {
+		return 0;
+	}
+
+	Py_RETURN_NONE;
+}
+
+PyObject * MGLTextureCube_build_mipmaps(MGLTextureCube * self, PyObject * args) {
+	int base = 0;
+	int max = 1000;
+
+	const char * method;
+	Py_ssize_t method_size;
+
+	int cpu;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"IIs#p",
+		&base,
+		&max,
+		&method,
+		&method_size,
+		&cpu
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	if (base > self->max_level) {
+		MGLError_Set("invalid base");
+		return 0;
+	}
+
+	if (!cpu && (method_size != 3 || memcmp(method, "box", 3))) {
+		MGLError_Set("the %s method requires cpu=True", method);
+		return 0;
+	}
+
+	// Immutable textures keep their level count
+	if (self->levels && max > self->levels - 1) {
+		max = self->levels - 1;
+	}
+
+	const GLMethods & gl = self->context->gl;
+
+	if (cpu) {
+		max = MGLContext_build_mipmaps(
+			self->context, GL_TEXTURE_CUBE_MAP, self->texture_obj, self->data_type, self->components,
+			self->internal_format, self->levels != 0, self->width, self->height, 6, base, max, method, method_size
+		);
+
+		if (max < 0) {
+			return 0;
+		}
+	} else {
+		gl.ActiveTexture(GL_TEXTURE0 + self->context->default_texture_unit);
+		gl.BindTexture(GL_TEXTURE_CUBE_MAP, self->texture_obj);
+
+		gl.TexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_BASE_LEVEL, base);
+		gl.TexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAX_LEVEL, max);
+
+		gl.GenerateMipmap(GL_TEXTURE_CUBE_MAP);
+	}
+
+	// Integer textures cannot be filtered linearly
+	int min_filter = self->data_type->float_type ? GL_LINEAR_MIPMAP_LINEAR : GL_NEAREST_MIPMAP_NEAREST;
+	int mag_filter = self->data_type->float_type ? GL_LINEAR : GL_NEAREST;
+
+	gl.TexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MIN_FILTER, min_filter);
+	gl.TexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAG_FILTER, mag_filter);
+
+	self->min_filter = min_filter;
+	self->mag_filter = mag_filter;
+	self->max_level = self->levels ? self->levels - 1 : max;
+
+	// Immutable textures and views keep the storage they were created with
+	if (!self->levels) {
+		MGLContext_track_memory(self->context, MGL_MEMORY_TEXTURE_CUBE, self->memory, MGLTextureCube_memory(self));
+	}
+
+	Py_RETURN_NONE;
+}
+
 PyObject * MGLTextureCube_use(MGLTextureCube * self, PyObject * args) {
 	int index;
 
@@ -476,11 +793,74 @@ PyObject * MGLTextureCube_release(MGLTextureCube * self) {
 	Py_RETURN_NONE;
 }
 
+PyObject * MGLTextureCube_evict(MGLTextureCube * self, PyObject * args) {
+	int keep;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"p",
+		&keep
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	PyObject * snapshot = MGLContext_evict_texture(
+		self->context, GL_TEXTURE_CUBE_MAP, self->texture_obj, self->data_type, self->components, self->internal_format,
+		self->levels != 0, self->width, self->height, 1, self->max_level + 1, keep
+	);
+
+	if (snapshot) {
+		MGLContext_track_memory(self->context, MGL_MEMORY_TEXTURE_CUBE, self->memory, 0);
+	}
+
+	return snapshot;
+}
+
+PyObject * MGLTextureCube_check_evict(MGLTextureCube * self, PyObject * args) {
+	if (!MGLContext_check_evict(self->data_type, self->levels != 0, 0)) {
+		return 0;
+	}
+
+	Py_RETURN_NONE;
+}
+
+PyObject * MGLTextureCube_restore(MGLTextureCube * self, PyObject * args) {
+	PyObject * data;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"O",
+		&data
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	bool restored = MGLContext_restore_texture(
+		self->context, GL_TEXTURE_CUBE_MAP, self->texture_obj, self->data_type, self->components, self->internal_format,
+		self->levels != 0, self->width, self->height, 1, self->max_level + 1, data
+	);
+
+	if (!restored) {
+		return 0;
+	}
+
+	MGLContext_track_memory(self->context, MGL_MEMORY_TEXTURE_CUBE, self->memory, MGLTextureCube_memory(self));
+	Py_RETURN_NONE;
+}
+
 PyMethodDef MGLTextureCube_tp_methods[] = {
 	{"write", (PyCFunction)MGLTextureCube_write, METH_VARARGS, 0},
+	{"clear", (PyCFunction)MGLTextureCube_clear, METH_VARARGS, 0},
 	{"use", (PyCFunction)MGLTextureCube_use, METH_VARARGS, 0},
 	{"bind", (PyCFunction)MGLTextureCube_meth_bind, METH_VARARGS, 0},
-//	{"build_mipmaps", (PyCFunction)MGLTextureCube_build_mipmaps, METH_VARARGS, 0},
+	{"build_mipmaps", (PyCFunction)MGLTextureCube_build_mipmaps, METH_VARARGS, 0},
+	{"evict", (PyCFunction)MGLTextureCube_evict, METH_VARARGS, 0},
+	{"check_evict", (PyCFunction)MGLTextureCube_check_evict, METH_NOARGS, 0},
+	{"restore", (PyCFunction)MGLTextureCube_restore, METH_VARARGS, 0},
 	{"read", (PyCFunction)MGLTextureCube_read, METH_VARARGS, 0},
 	{"read_into", (PyCFunction)MGLTextureCube_read_into, METH_VARARGS, 0},
 	{"release", (PyCFunction)MGLTextureCube_release, METH_NOARGS, 0},
@@ -601,10 +981,15 @@ int MGLTextureCube_set_anisotropy(MGLTextureCube * self, PyObject * value) {
 	return 0;
 }
 
+PyObject * MGLTextureCube_get_memory(MGLTextureCube * self) {
+	return PyLong_FromLongLong(self->memory);
+}
+
 PyGetSetDef MGLTextureCube_tp_getseters[] = {
 	{(char *)"filter", (getter)MGLTextureCube_get_filter, (setter)MGLTextureCube_set_filter, 0, 0},
 	{(char *)"swizzle", (getter)MGLTextureCube_get_swizzle, (setter)MGLTextureCube_set_swizzle, 0, 0},
 	{(char *)"anisotropy", (getter)MGLTextureCube_get_anisotropy, (setter)MGLTextureCube_set_anisotropy, 0, 0},
+	{(char *)"memory", (getter)MGLTextureCube_get_memory, 0, 0, 0},
 	{0},
 };
 
@@ -658,6 +1043,7 @@ void MGLTextureCube_Invalidate(MGLTextureCube * texture) {
 
 	const GLMethods & gl = texture->context->gl;
 	gl.DeleteTextures(1, (GLuint *)&texture->texture_obj);
+	MGLContext_untrack_object(texture->context, MGL_MEMORY_TEXTURE_CUBE, texture->memory);
 
 	Py_SET_TYPE(texture, &MGLInvalidObject_Type);
 	Py_DECREF(texture);
@@ -0,0 +1,743 @@
+#include <chrono>
+#include <vector>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "MappedFile.hpp"
+#include "Types.hpp"
+
+#include "InlineMethods.hpp"
+
+// Loads KTX, KTX2 and DDS files into immutable textures.
+// The file is memory mapped and every image is uploaded straight from the mapping.
+
+enum MGLTextureFileKind {
+	TEXTURE_FILE_2D,
+	TEXTURE_FILE_ARRAY,
+	TEXTURE_FILE_CUBE,
+	TEXTURE_FILE_3D,
+};
+
+struct MGLTextureFileFormat {
+	int internal_format;
+	int vk_format;
+	int dxgi_format;
+	const char * dtype;
+	int components;
+};
+
+// Zero means the container has no code for the format
+static const MGLTextureFileFormat texture_file_formats[] = {
+	{GL_R8, 9, 61, "f1", 1},
+	{GL_RG8, 16, 49, "f1", 2},
+	{GL_RGBA8, 37, 28, "f1", 4},
+	{GL_SRGB8_ALPHA8, 43, 29, "f1", 4},
+	{GL_R16F, 76, 54, "f2", 1},
+	{GL_RG16F, 83, 34, "f2", 2},
+	{GL_RGBA16F, 97, 10, "f2", 4},
+	{GL_R32F, 100, 41, "f4", 1},
+	{GL_RG32F, 103, 16, "f4", 2},
+	{GL_RGB32F, 106, 6, "f4", 3},
+	{GL_RGBA32F, 109, 2, "f4", 4},
+	{GL_COMPRESSED_RGB_S3TC_DXT1_EXT, 131, 0, "bc1", 3},
+	{GL_COMPRESSED_SRGB_S3TC_DXT1_EXT, 132, 0, "bc1", 3},
+	{GL_COMPRESSED_RGBA_S3TC_DXT1_EXT, 133, 71, "bc1", 4},
+	{GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT1_EXT, 134, 72, "bc1", 4},
+	{GL_COMPRESSED_RGBA_S3TC_DXT3_EXT, 135, 74, "bc2", 4},
+	{GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT3_EXT, 136, 75, "bc2", 4},
+	{GL_COMPRESSED_RGBA_S3TC_DXT5_EXT, 137, 77, "bc3", 4},
+	{GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT, 138, 78, "bc3", 4},
+	{GL_COMPRESSED_RED_RGTC1, 139, 80, "bc4", 1},
+	{GL_COMPRESSED_SIGNED_RED_RGTC1, 140, 81, "bc4s", 1},
+	{GL_COMPRESSED_RG_RGTC2, 141, 83, "bc5", 2},
+	{GL_COMPRESSED_SIGNED_RG_RGTC2, 142, 84, "bc5s", 2},
+	{GL_COMPRESSED_RGB_BPTC_UNSIGNED_FLOAT, 143, 95, "bc6h", 3},
+	{GL_COMPRESSED_RGB_BPTC_SIGNED_FLOAT, 144, 96, "bc6s", 3},
+	{GL_COMPRESSED_RGBA_BPTC_UNORM, 145, 98, "bc7", 4},
+	{GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM, 146, 99, "bc7", 4},
+	{GL_COMPRESSED_RGB8_ETC2, 147, 0, "etc2", 3},
+	{GL_COMPRESSED_SRGB8_ETC2, 148, 0, "etc2", 3},
+	{GL_COMPRESSED_RGBA8_ETC2_EAC, 151, 0, "etc2", 4},
+	{GL_COMPRESSED_SRGB8_ALPHA8_ETC2_EAC, 152, 0, "etc2", 4},
+	{GL_COMPRESSED_R11_EAC, 153, 0, "eac", 1},
+	{GL_COMPRESSED_SIGNED_R11_EAC, 154, 0, "eacs", 1},
+	{GL_COMPRESSED_RG11_EAC, 155, 0, "eac", 2},
+	{GL_COMPRESSED_SIGNED_RG11_EAC, 156, 0, "eacs", 2},
+};
+
+static const int num_texture_file_formats = sizeof(texture_file_formats) / sizeof(texture_file_formats[0]);
+
+struct MGLTextureFileImage {
+	int level;
+	int layer;
+	int face;
+	const unsigned char * data;
+	size_t size;
+};
+
+struct MGLTextureFile {
+	const unsigned char * data;
+	size_t size;
+
+	int kind;
+	const MGLTextureFileFormat * format;
+	MGLDataType * data_type;
+
+	int width;
+	int height;
+	int depth;
+	int layers;
+	int levels;
+	int alignment;
+	int max_layers;
+	bool generate_mipmaps;
+
+	std::vector<MGLTextureFileImage> images;
+};
+
+bool MGLMappedFile_Open(MGLMappedFile & mapped, const char * path) {
+	mapped.data = 0;
+	mapped.size = 0;
+
+#ifdef _WIN32
+	int path_len = MultiByteToWideChar(CP_UTF8, 0, path, -1, 0, 0);
+	std::vector<wchar_t> wide_path(path_len > 0 ? path_len : 1);
+	MultiByteToWideChar(CP_UTF8, 0, path, -1, wide_path.data(), path_len);
+
+	mapped.file = CreateFileW(wide_path.data(), GENERIC_READ, FILE_SHARE_READ, 0, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, 0);
+	if (mapped.file == INVALID_HANDLE_VALUE) {
+		return false;
+	}
+
+	LARGE_INTEGER file_size;
+	if (!GetFileSizeEx(mapped.file, &file_size) || !file_size.QuadPart) {
+		CloseHandle(mapped.file);
+		return false;
+	}
+
+	mapped.mapping = CreateFileMappingW(mapped.file, 0, PAGE_READONLY, 0, 0, 0);
+	if (!mapped.mapping) {
+		CloseHandle(mapped.file);
+		return false;
+	}
+
+	mapped.data = (const unsigned char *)MapViewOfFile(mapped.mapping, FILE_MAP_READ, 0, 0, 0);
+	if (!mapped.data) {
+		CloseHandle(mapped.mapping);
+		CloseHandle(mapped.file);
+		return false;
+	}
+
+	mapped.size = (size_t)file_size.QuadPart;
+#else
+	int fd = open(path, O_RDONLY);
+	if (fd < 0) {
+		return false;
+	}
+
+	struct stat file_stat;
+	if (fstat(fd, &file_stat) < 0 || !file_stat.st_size) {
+		close(fd);
+		return false;
+	}
+
+	void * data = mmap(0, (size_t)file_stat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+	// The mapping keeps the file alive
+	close(fd);
+
+	if (data == MAP_FAILED) {
+		return false;
+	}
+
+	mapped.data = (const unsigned char *)data;
+	mapped.size = (size_t)file_stat.st_size;
+#endif
+
+	return true;
+}
+
+void MGLMappedFile_Close(MGLMappedFile & mapped) {
+#ifdef _WIN32
+	UnmapViewOfFile(mapped.data);
+	CloseHandle(mapped.mapping);
+	CloseHandle(mapped.file);
+#else
+	munmap((void *)mapped.data, mapped.size);
+#endif
+	mapped.data = 0;
+	mapped.size = 0;
+}
+
+inline unsigned read_u32(const unsigned char * ptr) {
+	return ptr[0] | (ptr[1] << 8) | (ptr[2] << 16) | ((unsigned)ptr[3] << 24);
+}
+
+inline unsigned long long read_u64(const unsigned char * ptr) {
+	return read_u32(ptr) | ((unsigned long long)read_u32(ptr + 4) << 32);
+}
+
+inline int level_size(int size, int level) {
+	size >>= level;
+	return size > 1 ? size : 1;
+}
+
+const MGLTextureFileFormat * texture_file_format(int internal_format, int vk_format, int dxgi_format) {
+	for (int i = 0; i < num_texture_file_formats; ++i) {
+		const MGLTextureFileFormat & format = texture_file_formats[i];
+		if (internal_format && format.internal_format == internal_format) {
+			return &format;
+		}
+		if (vk_format && format.vk_format == vk_format) {
+			return &format;
+		}
+		if (dxgi_format && format.dxgi_format == dxgi_format) {
+			return &format;
+		}
+	}
+	return 0;
+}
+
+// Size of a single layer or face of a level, 3D textures include every slice
+size_t MGLTextureFile_ImageSize(const MGLTextureFile & file, int level) {
+	int width = level_size(file.width, level);
+	int height = level_size(file.height, level);
+	int depth = file.kind == TEXTURE_FILE_3D ? level_size(file.depth, level) : 1;
+
+	if (file.data_type->block_size) {
+		return (size_t)compressed_image_size(file.data_type, file.format->components, width, height) * depth;
+	}
+
+	size_t row = (size_t)width * file.format->components * file.data_type->size;
+	row = (row + file.alignment - 1) / file.alignment * file.alignment;
+	return row * height * depth;
+}
+
+bool MGLTextureFile_AddImage(MGLTextureFile & file, int level, int layer, int face, size_t offset) {
+	size_t size = MGLTextureFile_ImageSize(file, level);
+
+	if (offset > file.size || size > file.size - offset) {
+		MGLError_Set("the file is truncated");
+		return false;
+	}
+
+	MGLTextureFileImage image = {level, layer, face, file.data + offset, size};
+	file.images.push_back(image);
+	return true;
+}
+
+bool MGLTextureFile_SetFormat(MGLTextureFile & file, const MGLTextureFileFormat * format) {
+	if (!format) {
+		MGLError_Set("the pixel format is not supported");
+		return false;
+	}
+
+	file.format = format;
+	file.data_type = from_dtype(format->dtype, strlen(format->dtype));
+	return true;
+}
+
+bool MGLTextureFile_SetKind(MGLTextureFile & file, int faces, bool array) {
+	if (faces != 1 && faces != 6) {
+		MGLError_Set("the number of faces must be 1 or 6");
+		return false;
+	}
+
+	if (file.width < 1 || file.height < 1 || file.depth < 1 || file.layers < 1) {
+		MGLError_Set("the texture size is invalid");
+		return false;
+	}
+
+	if ((faces == 6) + (file.depth > 1) + array > 1) {
+		MGLError_Set("cube map arrays and 3D arrays are not supported");
+		return false;
+	}
+
+	if (faces == 6) {
+		file.kind = TEXTURE_FILE_CUBE;
+	} else if (file.depth > 1) {
+		file.kind = TEXTURE_FILE_3D;
+	} else if (array) {
+		file.kind = TEXTURE_FILE_ARRAY;
+	} else {
+		file.kind = TEXTURE_FILE_2D;
+	}
+
+	if (file.kind == TEXTURE_FILE_3D && file.data_type->block_size) {
+		MGLError_Set("compressed dtypes are not supported by 3D textures");
+		return false;
+	}
+
+	if (file.levels < 1) {
+		file.levels = 1;
+		file.generate_mipmaps = true;
+	}
+
+	// The counts drive the image loops, bound them before any image is read
+	int full_levels = 1;
+	for (int size = max(max(file.width, file.height), file.kind == TEXTURE_FILE_3D ? file.depth : 1); size > 1; size >>= 1) {
+		full_levels += 1;
+	}
+
+	if (file.levels > full_levels) {
+		MGLError_Set("the number of levels %d exceeds the %d levels of the mipmap chain", file.levels, full_levels);
+		return false;
+	}
+
+	if (file.layers > file.max_layers) {
+		MGLError_Set("the number of layers %d exceeds GL_MAX_ARRAY_TEXTURE_LAYERS (%d)", file.layers, file.max_layers);
+		return false;
+	}
+
+	return true;
+}
+
+bool MGLTextureFile_ParseKTX(MGLTextureFile & file) {
+	const unsigned char * header = file.data + 12;
+
+	if (file.size < 64) {
+		MGLError_Set("the file is truncated");
+		return false;
+	}
+
+	if (read_u32(header) != 0x04030201) {
+		MGLError_Set("big endian KTX files are not supported");
+		return false;
+	}
+
+	if (!MGLTextureFile_SetFormat(file, texture_file_format(read_u32(header + 16), 0, 0))) {
+		return false;
+	}
+
+	int array_elements = read_u32(header + 36);
+	int faces = read_u32(header + 40);
+
+	file.width = read_u32(header + 24);
+	file.height = max((int)read_u32(header + 28), 1);
+	file.depth = max((int)read_u32(header + 32), 1);
+	file.layers = max(array_elements, 1);
+	file.levels = read_u32(header + 44);
+	file.alignment = 4;
+
+	if (!MGLTextureFile_SetKind(file, faces, array_elements > 0)) {
+		return false;
+	}
+
+	// Each level starts with its image size, layers and faces are padded to 4 bytes
+	size_t offset = 64 + (size_t)read_u32(header + 48);
+
+	for (int level = 0; level < file.levels; ++level) {
+		offset += 4;
+		for (int layer = 0; layer < file.layers; ++layer) {
+			for (int face = 0; face < faces; ++face) {
+				if (!MGLTextureFile_AddImage(file, level, layer, face, offset)) {
+					return false;
+				}
+				offset += (file.images.back().size + 3) / 4 * 4;
+			}
+		}
+	}
+
+	return true;
+}
+
+bool MGLTextureFile_ParseKTX2(MGLTextureFile & file) {
+	const unsigned char * header = file.data + 12;
+
+	if (file.size < 80) {
+		MGLError_Set("the file is truncated");
+		return false;
+	}
+
+	if (read_u32(header + 32)) {
+		MGLError_Set("supercompressed KTX2 files are not supported");
+		return false;
+	}
+
+	if (!MGLTextureFile_SetFormat(file, texture_file_format(0, read_u32(header), 0))) {
+		return false;
+	}
+
+	int layer_count = read_u32(header + 20);
+	int faces = read_u32(header + 24);
+
+	file.width = read_u32(header + 8);
+	file.height = max((int)read_u32(header + 12), 1);
+	file.depth = max((int)read_u32(header + 16), 1);
+	file.layers = max(layer_count, 1);
+	file.levels = read_u32(header + 28);
+	file.alignment = 1;
+
+	if (!MGLTextureFile_SetKind(file, faces, layer_count > 0)) {
+		return false;
+	}
+
+	if (80 + (size_t)file.levels * 24 > file.size) {
+		MGLError_Set("the file is truncated");
+		return false;
+	}
+
+	// The level index holds the offset of each level, layers and faces are tightly packed
+	for (int level = 0; level < file.levels; ++level) {
+		size_t offset = (size_t)read_u64(file.data + 80 + level * 24);
+		for (int layer = 0; layer < file.layers; ++layer) {
+			for (int face = 0; face < faces; ++face) {
+				if (!MGLTextureFile_AddImage(file, level, layer, face, offset)) {
+					return false;
+				}
+				offset += file.images.back().size;
+			}
+		}
+	}
+
+	return true;
+}
+
+const MGLTextureFileFormat * dds_legacy_format(const unsigned char * pixel_format) {
+	unsigned flags = read_u32(pixel_format + 4);
+	unsigned four_cc = read_u32(pixel_format + 8);
+	unsigned bit_count = read_u32(pixel_format + 12);
+	unsigned red_mask = read_u32(pixel_format + 16);
+
+	if (flags & 0x4) {
+		switch (four_cc) {
+			case 0x31545844: return texture_file_format(GL_COMPRESSED_RGBA_S3TC_DXT1_EXT, 0, 0); // DXT1
+			case 0x33545844: return texture_file_format(GL_COMPRESSED_RGBA_S3TC_DXT3_EXT, 0, 0); // DXT3
+			case 0x35545844: return texture_file_format(GL_COMPRESSED_RGBA_S3TC_DXT5_EXT, 0, 0); // DXT5
+			case 0x31495441: return texture_file_format(GL_COMPRESSED_RED_RGTC1, 0, 0); // ATI1
+			case 0x55344342: return texture_file_format(GL_COMPRESSED_RED_RGTC1, 0, 0); // BC4U
+			case 0x53344342: return texture_file_format(GL_COMPRESSED_SIGNED_RED_RGTC1, 0, 0); // BC4S
+			case 0x32495441: return texture_file_format(GL_COMPRESSED_RG_RGTC2, 0, 0); // ATI2
+			case 0x55354342: return texture_file_format(GL_COMPRESSED_RG_RGTC2, 0, 0); // BC5U
+			case 0x53354342: return texture_file_format(GL_COMPRESSED_SIGNED_RG_RGTC2, 0, 0); // BC5S
+			case 111: return texture_file_format(GL_R16F, 0, 0);
+			case 112: return texture_file_format(GL_RG16F, 0, 0);
+			case 113: return texture_file_format(GL_RGBA16F, 0, 0);
+			case 114: return texture_file_format(GL_R32F, 0, 0);
+			case 115: return texture_file_format(GL_RG32F, 0, 0);
+			case 116: return texture_file_format(GL_RGBA32F, 0, 0);
+		}
+		return 0;
+	}
+
+	// Only the RGBA byte order is supported, BGRA would need a swizzle
+	if ((flags & 0x40) && bit_count == 32 && red_mask == 0xff) {
+		return texture_file_format(GL_RGBA8, 0, 0);
+	}
+
+	if ((flags & 0x20000) && bit_count == 8) {
+		return texture_file_format(GL_R8, 0, 0);
+	}
+
+	return 0;
+}
+
+bool MGLTextureFile_ParseDDS(MGLTextureFile & file) {
+	const unsigned char * header = file.data + 4;
+
+	if (file.size < 128) {
+		MGLError_Set("the file is truncated");
+		return false;
+	}
+
+	unsigned flags = read_u32(header + 4);
+	unsigned caps2 = read_u32(header + 108);
+	bool dx10 = read_u32(header + 80) == 0x30315844;
+
+	size_t offset = 128;
+	int faces = (caps2 & 0x200) ? 6 : 1;
+	bool array = false;
+
+	file.width = read_u32(header + 12);
+	file.height = max((int)read_u32(header + 8), 1);
+	file.depth = (flags & 0x800000) ? max((int)read_u32(header + 20), 1) : 1;
+	file.layers = 1;
+	file.levels = (flags & 0x20000) ? max((int)read_u32(header + 24), 1) : 1;
+	file.alignment = 1;
+
+	if (faces == 6 && (caps2 & 0xFC00) != 0xFC00) {
+		MGLError_Set("cube maps must have all six faces");
+		return false;
+	}
+
+	if (dx10) {
+		if (file.size < 148) {
+			MGLError_Set("the file is truncated");
+			return false;
+		}
+
+		const unsigned char * header10 = file.data + 128;
+		if (!MGLTextureFile_SetFormat(file, texture_file_format(0, 0, read_u32(header10)))) {
+			return false;
+		}
+
+		if (read_u32(header10 + 8) & 0x4) {
+			faces = 6;
+		}
+
+		file.layers = max((int)read_u32(header10 + 12), 1);
+		array = file.layers > 1;
+		offset = 148;
+	} else if (!MGLTextureFile_SetFormat(file, dds_legacy_format(header + 72))) {
+		return false;
+	}
+
+	if (!MGLTextureFile_SetKind(file, faces, array)) {
+		return false;
+	}
+
+	// Every layer and face stores its whole mipmap chain
+	for (int layer = 0; layer < file.layers; ++layer) {
+		for (int face = 0; face < faces; ++face) {
+			for (int level = 0; level < file.levels; ++level) {
+				if (!MGLTextureFile_AddImage(file, level, layer, face, offset)) {
+					return false;
+				}
+				offset += file.images.back().size;
+			}
+		}
+	}
+
+	return true;
+}
+
+bool MGLTextureFile_Parse(MGLTextureFile & file) {
+	static const unsigned char ktx_identifier[12] = {0xAB, 'K', 'T', 'X', ' ', '1', '1', 0xBB, '\r', '\n', 0x1A, '\n'};
+	static const unsigned char ktx2_identifier[12] = {0xAB, 'K', 'T', 'X', ' ', '2', '0', 0xBB, '\r', '\n', 0x1A, '\n'};
+
+	file.generate_mipmaps = false;
+
+	if (file.size >= 12 && !memcmp(file.data, ktx_identifier, 12)) {
+		return MGLTextureFile_ParseKTX(file);
+	}
+
+	if (file.size >= 12 && !memcmp(file.data, ktx2_identifier, 12)) {
+		return MGLTextureFile_ParseKTX2(file);
+	}
+
+	if (file.size >= 4 && !memcmp(file.data, "DDS ", 4)) {
+		return MGLTextureFile_ParseDDS(file);
+	}
+
+	MGLError_Set("the file is not a KTX, KTX2 or DDS file");
+	return false;
+}
+
+void MGLTextureFile_Upload(const MGLTextureFile & file, const GLMethods & gl, int texture_target) {
+	int internal_format = file.format->internal_format;
+	int base_format = file.data_type->base_format[file.format->components];
+	int pixel_type = file.data_type->gl_type;
+
+	for (size_t i = 0; i < file.images.size(); ++i) {
+		const MGLTextureFileImage & image = file.images[i];
+
+		int width = level_size(file.width, image.level);
+		int height = level_size(file.height, image.level);
+		int target = file.kind == TEXTURE_FILE_CUBE ? GL_TEXTURE_CUBE_MAP_POSITIVE_X + image.face : texture_target;
+
+		if (file.kind == TEXTURE_FILE_3D) {
+			int depth = level_size(file.depth, image.level);
+			gl.TexSubImage3D(target, image.level, 0, 0, 0, width, height, depth, base_format, pixel_type, image.data);
+		} else if (file.kind == TEXTURE_FILE_ARRAY && file.data_type->block_size) {
+			gl.CompressedTexSubImage3D(target, image.level, 0, 0, image.layer, width, height, 1, internal_format, (int)image.size, image.data);
+		} else if (file.kind == TEXTURE_FILE_ARRAY) {
+			gl.TexSubImage3D(target, image.level, 0, 0, image.layer, width, height, 1, base_format, pixel_type, image.data);
+		} else if (file.data_type->block_size) {
+			gl.CompressedTexSubImage2D(target, image.level, 0, 0, width, height, internal_format, (int)image.size, image.data);
+		} else {
+			gl.TexSubImage2D(target, image.level, 0, 0, width, height, base_format, pixel_type, image.data);
+		}
+	}
+}
+
+PyObject * MGLContext_texture_from_file(MGLContext * self, PyObject * args) {
+	const char * path;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"s",
+		&path
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+	MGLMappedFile mapped;
+
+	if (!MGLMappedFile_Open(mapped, path)) {
+		MGLError_Set("cannot open %s", path);
+		return 0;
+	}
+
+	MGLTextureFile file;
+	file.data = mapped.data;
+	file.size = mapped.size;
+	file.max_layers = 1;
+	self->gl.GetIntegerv(GL_MAX_ARRAY_TEXTURE_LAYERS, &file.max_layers);
+
+	if (!MGLTextureFile_Parse(file)) {
+		MGLMappedFile_Close(mapped);
+		return 0;
+	}
+
+	int levels = file.generate_mipmaps ? -1 : file.levels;
+
+	if (!MGLContext_texture_levels(self, levels, file.width, file.height, file.kind == TEXTURE_FILE_3D ? file.depth : 1)) {
+		MGLMappedFile_Close(mapped);
+		return 0;
+	}
+
+	static const int texture_targets[] = {GL_TEXTURE_2D, GL_TEXTURE_2D_ARRAY, GL_TEXTURE_CUBE_MAP, GL_TEXTURE_3D};
+	int texture_target = texture_targets[file.kind];
+
+	const GLMethods & gl = self->gl;
+
+	int texture_obj = 0;
+	gl.GenTextures(1, (GLuint *)&texture_obj);
+
+	if (!texture_obj) {
+		MGLError_Set("cannot create texture");
+		MGLMappedFile_Close(mapped);
+		return 0;
+	}
+
+	gl.ActiveTexture(GL_TEXTURE0 + self->default_texture_unit);
+	gl.BindTexture(texture_target, texture_obj);
+
+	if (file.kind == TEXTURE_FILE_ARRAY) {
+		gl.TexStorage3D(texture_target, levels, file.format->internal_format, file.width, file.height, file.layers);
+	} else if (file.kind == TEXTURE_FILE_3D) {
+		gl.TexStorage3D(texture_target, levels, file.format->internal_format, file.width, file.height, file.depth);
+	} else {
+		gl.TexStorage2D(texture_target, levels, file.format->internal_format, file.width, file.height);
+	}
+
+	gl.PixelStorei(GL_UNPACK_ALIGNMENT, file.alignment);
+	MGLTextureFile_Upload(file, gl, texture_target);
+
+	if (file.generate_mipmaps) {
+		gl.GenerateMipmap(texture_target);
+	}
+
+	int min_filter = levels > 1 ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR;
+	gl.TexParameteri(texture_target, GL_TEXTURE_MIN_FILTER, min_filter);
+	gl.TexParameteri(texture_target, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+
+	size_t file_size = file.size;
+	MGLMappedFile_Close(mapped);
+
+	PyObject * texture = 0;
+	PyObject * size = 0;
+	const char * kind = 0;
+
+	if (file.kind == TEXTURE_FILE_2D) {
+		MGLTexture * texture_2d = (MGLTexture *)MGLTexture_Type.tp_alloc(&MGLTexture_Type, 0);
+		texture_2d->texture_obj = texture_obj;
+		texture_2d->width = file.width;
+		texture_2d->height = file.height;
+		texture_2d->components = file.format->components;
+		texture_2d->samples = 0;
+		texture_2d->internal_format = file.format->internal_format;
+		texture_2d->data_type = file.data_type;
+		texture_2d->min_filter = min_filter;
+		texture_2d->mag_filter = GL_LINEAR;
+		texture_2d->max_level = levels - 1;
+		texture_2d->levels = levels;
+		texture_2d->compare_func = 0;
+		texture_2d->anisotropy = 1.0f;
+		texture_2d->depth = false;
+		texture_2d->repeat_x = true;
+		texture_2d->repeat_y = true;
+		texture_2d->context = self;
+		MGLContext_track_object(self, MGL_MEMORY_TEXTURE, texture_2d->memory, MGLTexture_memory(texture_2d));
+		texture = (PyObject *)texture_2d;
+		size = Py_BuildValue("(ii)", file.width, file.height);
+		kind = "texture";
+	} else if (file.kind == TEXTURE_FILE_ARRAY) {
+		MGLTextureArray * texture_array = (MGLTextureArray *)MGLTextureArray_Type.tp_alloc(&MGLTextureArray_Type, 0);
+		texture_array->texture_obj = texture_obj;
+		texture_array->width = file.width;
+		texture_array->height = file.height;
+		texture_array->layers = file.layers;
+		texture_array->components = file.format->components;
+		texture_array->internal_format = file.format->internal_format;
+		texture_array->data_type = file.data_type;
+		texture_array->min_filter = min_filter;
+		texture_array->mag_filter = GL_LINEAR;
+		texture_array->max_level = levels - 1;
+		texture_array->levels = levels;
+		texture_array->repeat_x = true;
+		texture_array->repeat_y = true;
+		texture_array->anisotropy = 1.0f;
+		texture_array->context = self;
+		MGLContext_track_object(self, MGL_MEMORY_TEXTURE_ARRAY, texture_array->memory, MGLTextureArray_memory(texture_array));
+		texture = (PyObject *)texture_array;
+		size = Py_BuildValue("(iii)", file.width, file.height, file.layers);
+		kind = "texture_array";
+	} else if (file.kind == TEXTURE_FILE_CUBE) {
+		MGLTextureCube * texture_cube = (MGLTextureCube *)MGLTextureCube_Type.tp_alloc(&MGLTextureCube_Type, 0);
+		texture_cube->texture_obj = texture_obj;
+		texture_cube->width = file.width;
+		texture_cube->height = file.height;
+		texture_cube->depth = 0;
+		texture_cube->components = file.format->components;
+		texture_cube->internal_format = file.format->internal_format;
+		texture_cube->data_type = file.data_type;
+		texture_cube->min_filter = min_filter;
+		texture_cube->mag_filter = GL_LINEAR;
+		texture_cube->max_level = levels - 1;
+		texture_cube->levels = levels;
+		texture_cube->anisotropy = 1.0f;
+		texture_cube->context = self;
+		MGLContext_track_object(self, MGL_MEMORY_TEXTURE_CUBE, texture_cube->memory, MGLTextureCube_memory(texture_cube));
+		texture = (PyObject *)texture_cube;
+		size = Py_BuildValue("(ii)", file.width, file.height);
+		kind = "texture_cube";
+	} else {
+		MGLTexture3D * texture_3d = (MGLTexture3D *)MGLTexture3D_Type.tp_alloc(&MGLTexture3D_Type, 0);
+		texture_3d->texture_obj = texture_obj;
+		texture_3d->width = file.width;
+		texture_3d->height = file.height;
+		texture_3d->depth = file.depth;
+		texture_3d->components = file.format->components;
+		texture_3d->internal_format = file.format->internal_format;
+		texture_3d->data_type = file.data_type;
+		texture_3d->min_filter = min_filter;
+		texture_3d->mag_filter = GL_LINEAR;
+		texture_3d->max_level = levels - 1;
+		texture_3d->levels = levels;
+		texture_3d->repeat_x = true;
+		texture_3d->repeat_y = true;
+		texture_3d->repeat_z = true;
+		texture_3d->context = self;
+		MGLContext_track_object(self, MGL_MEMORY_TEXTURE_3D, texture_3d->memory, MGLTexture3D_memory(texture_3d));
+		texture = (PyObject *)texture_3d;
+		size = Py_BuildValue("(iii)", file.width, file.height, file.depth);
+		kind = "texture3d";
+	}
+
+	Py_INCREF(self);
+	Py_INCREF(texture);
+
+	double load_time = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+	PyObject * result = PyTuple_New(9);
+	PyTuple_SET_ITEM(result, 0, texture);
+	PyTuple_SET_ITEM(result, 1, PyLong_FromLong(texture_obj));
+	PyTuple_SET_ITEM(result, 2, PyUnicode_FromString(kind));
+	PyTuple_SET_ITEM(result, 3, size);
+	PyTuple_SET_ITEM(result, 4, PyLong_FromLong(file.format->components));
+	PyTuple_SET_ITEM(result, 5, PyUnicode_FromString(file.format->dtype));
+	PyTuple_SET_ITEM(result, 6, PyLong_FromLong(levels));
+	PyTuple_SET_ITEM(result, 7, PyFloat_FromDouble(load_time));
+	PyTuple_SET_ITEM(result, 8, PyLong_FromSize_t(file_size));
+	return result;
+}
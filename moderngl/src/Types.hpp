@@ -33,20 +33,32 @@ static const int SHADER_TYPE[] = {
 	GL_TESS_EVALUATION_SHADER,
 };
 
+static const int UNIFORM_STREAM_SEGMENTS = 4;
+static const int UPLOAD_QUEUE_SLOTS = 64;
+static const int FRAME_CAPTURE_MAX_DEPTH = 16;
+
 struct MGLAttribute;
+struct MGLBlockWriter;
+struct MGLBrickVolume;
 struct MGLBuffer;
 struct MGLComputeShader;
 struct MGLContext;
 struct MGLFramebuffer;
+struct MGLFrameCapture;
 struct MGLInvalidObject;
 struct MGLProgram;
 struct MGLRenderbuffer;
 struct MGLTexture;
 struct MGLTexture3D;
 struct MGLTextureArray;
+struct MGLTextureAtlas;
+struct MGLTextureBuffer;
 struct MGLTextureCube;
 struct MGLUniform;
+struct MGLUniformBatch;
 struct MGLUniformBlock;
+struct MGLUniformStream;
+struct MGLUploadQueue;
 struct MGLVertexArray;
 struct MGLSampler;
 
@@ -56,6 +68,16 @@ struct MGLDataType {
 	int gl_type;
 	int size;
 	bool float_type;
+	int * block_size;
+	int packed_size;
+};
+
+// GL_PACK_* and GL_UNPACK_* pixel store parameters, zero keeps the tightly packed layout
+struct MGLPixelStore {
+	int row_length;
+	int skip_pixels;
+	int skip_rows;
+	int image_height;
 };
 
 struct MGLAttribute {
@@ -81,6 +103,33 @@ struct MGLAttribute {
 	bool normalizable;
 };
 
+struct MGLBlockMember {
+	PyObject * name;
+
+	int gl_type;
+	int scalar_type;
+	int rows;
+	int columns;
+
+	int offset;
+	int array_length;
+	int array_stride;
+	int matrix_stride;
+
+	bool row_major;
+};
+
+struct MGLBlockWriter {
+	PyObject_HEAD
+
+	PyObject * lookup;
+
+	MGLBlockMember * members;
+	int num_members;
+
+	int size;
+};
+
 struct MGLBuffer {
 	PyObject_HEAD
 
@@ -90,6 +139,8 @@ struct MGLBuffer {
 
 	Py_ssize_t size;
 	bool dynamic;
+
+	long long memory;
 };
 
 struct MGLComputeShader {
@@ -101,6 +152,17 @@ struct MGLComputeShader {
 	int shader_obj;
 };
 
+// The object kinds of the memory ledger
+enum MGLMemoryKind {
+	MGL_MEMORY_BUFFER,
+	MGL_MEMORY_TEXTURE,
+	MGL_MEMORY_TEXTURE_3D,
+	MGL_MEMORY_TEXTURE_ARRAY,
+	MGL_MEMORY_TEXTURE_CUBE,
+	MGL_MEMORY_RENDERBUFFER,
+	MGL_MEMORY_KINDS,
+};
+
 struct MGLContext {
 	PyObject_HEAD
 
@@ -139,6 +201,18 @@ struct MGLContext {
 	float polygon_offset_factor;
 	float polygon_offset_units;
 
+	int bound_program;
+
+	unsigned * bound_subroutines;
+	int num_bound_subroutines;
+	int bound_subroutines_capacity;
+
+	// The bytes allocated by the live objects of each kind, their peaks and the number of objects
+	long long memory[MGL_MEMORY_KINDS];
+	long long memory_peak[MGL_MEMORY_KINDS];
+	long long memory_total_peak;
+	int memory_objects[MGL_MEMORY_KINDS];
+
 	GLMethods gl;
 };
 
@@ -174,15 +248,77 @@ struct MGLFramebuffer {
 	bool depth_mask;
 };
 
+struct MGLFrameCapture {
+	PyObject_HEAD
+
+	MGLContext * context;
+	MGLFramebuffer * framebuffer;
+
+	int buffer_obj;
+	char * mapped;
+
+	// Without a persistent mapping only the frame handed out is mapped
+	char * frame_map;
+
+	// The frame handed out is exported through the buffer protocol, its slot is kept while exported
+	char * frame;
+	int exports;
+
+	int x;
+	int y;
+	int width;
+	int height;
+	int read_buffer;
+	int base_format;
+	int pixel_type;
+	int alignment;
+	int frame_size;
+
+	// Slots are read in order, the oldest pending slot is handed out next
+	int depth;
+	int head;
+	int num_pending;
+	int out_slot;
+	GLsync fences[FRAME_CAPTURE_MAX_DEPTH];
+
+	long long frames;
+	long long stalls;
+	double stall_time;
+};
+
 struct MGLInvalidObject {
 	PyObject_HEAD
 };
 
+enum MGLProgramMemberKind {
+	MGL_ATTRIBUTE_MEMBER,
+	MGL_VARYING_MEMBER,
+	MGL_UNIFORM_MEMBER,
+	MGL_UNIFORM_BLOCK_MEMBER,
+	MGL_STORAGE_BLOCK_MEMBER,
+	MGL_SUBROUTINE_MEMBER,
+};
+
+struct MGLProgramMember {
+	PyObject * name;
+	PyObject * mglo;
+
+	int kind;
+	int location;
+	int type;
+	int array_length;
+	int size;
+};
+
 struct MGLProgram {
 	PyObject_HEAD
 
 	MGLContext * context;
 
+	MGLProgramMember * members;
+	PyObject * member_lookup;
+	int num_members;
+
 	int geometry_input;
 	int geometry_output;
 
@@ -230,6 +366,8 @@ struct MGLRenderbuffer {
 
 	int samples;
 	bool depth;
+
+	long long memory;
 };
 
 struct MGLScope {
@@ -266,10 +404,12 @@ struct MGLTexture {
 	int components;
 
 	int samples;
+	int internal_format;
 
 	int min_filter;
 	int mag_filter;
 	int max_level;
+	int levels;
 
 	int compare_func;
 	float anisotropy;
@@ -278,6 +418,8 @@ struct MGLTexture {
 
 	bool repeat_x;
 	bool repeat_y;
+
+	long long memory;
 };
 
 struct MGLTexture3D {
@@ -293,14 +435,18 @@ struct MGLTexture3D {
 	int depth;
 
 	int components;
+	int internal_format;
 
 	int min_filter;
 	int mag_filter;
 	int max_level;
+	int levels;
 
 	bool repeat_x;
 	bool repeat_y;
 	bool repeat_z;
+
+	long long memory;
 };
 
 struct MGLTextureArray {
@@ -318,14 +464,18 @@ struct MGLTextureArray {
 	int height;
 	int layers;
 	int components;
+	int internal_format;
 
 	int min_filter;
 	int mag_filter;
 	int max_level;
+	int levels;
 
 	bool repeat_x;
 	bool repeat_y;
 	float anisotropy;
+
+	long long memory;
 };
 
 struct MGLTextureCube {
@@ -341,11 +491,49 @@ struct MGLTextureCube {
 	int depth;
 
 	int components;
+	int internal_format;
 
 	int min_filter;
 	int mag_filter;
 	int max_level;
+	int levels;
 	float anisotropy;
+
+	long long memory;
+};
+
+struct MGLAtlasPacker;
+
+struct MGLTextureAtlas {
+	PyObject_HEAD
+
+	MGLContext * context;
+	MGLTextureArray * texture;
+	MGLAtlasPacker * packer;
+};
+
+struct MGLBrickCache;
+
+struct MGLBrickVolume {
+	PyObject_HEAD
+
+	MGLContext * context;
+	MGLTexture3D * texture;
+	MGLTexture3D * indirection;
+	MGLBrickCache * cache;
+};
+
+struct MGLTextureBuffer {
+	PyObject_HEAD
+
+	MGLContext * context;
+	MGLDataType * data_type;
+
+	int texture_obj;
+	int components;
+
+	Py_ssize_t offset;
+	Py_ssize_t size;
 };
 
 struct MGLUniform {
@@ -362,6 +550,8 @@ struct MGLUniform {
 	int location;
 	int type;
 
+	int scalar_type;
+
 	int dimension;
 	int element_size;
 	int array_length;
@@ -369,6 +559,13 @@ struct MGLUniform {
 	bool matrix;
 };
 
+struct MGLUniformBatch {
+	PyObject_HEAD
+
+	MGLUniform ** uniforms;
+	int num_uniforms;
+};
+
 struct MGLUniformBlock {
 	PyObject_HEAD
 
@@ -378,6 +575,53 @@ struct MGLUniformBlock {
 
 	int index;
 	int size;
+
+	bool storage_block;
+};
+
+struct MGLUniformStream {
+	PyObject_HEAD
+
+	MGLContext * context;
+	MGLBlockWriter * writer;
+
+	int buffer_obj;
+	char * mapped;
+
+	int capacity;
+	int block_size;
+	int record_size;
+	int records_per_segment;
+
+	int head;
+	int current;
+	int binding;
+
+	GLsync fences[UNIFORM_STREAM_SEGMENTS];
+};
+
+struct MGLUploadQueue {
+	PyObject_HEAD
+
+	MGLContext * context;
+	MGLBuffer * staging;
+
+	char * mapped;
+
+	Py_ssize_t capacity;
+	Py_ssize_t head;
+
+	// Pending uploads in submission order, each one fenced after its TexSubImage call
+	int first_slot;
+	int num_slots;
+	Py_ssize_t slot_begin[UPLOAD_QUEUE_SLOTS];
+	Py_ssize_t slot_end[UPLOAD_QUEUE_SLOTS];
+	GLsync fences[UPLOAD_QUEUE_SLOTS];
+
+	long long uploads;
+	long long uploaded_bytes;
+	long long stalls;
+	double stall_time;
 };
 
 struct MGLVertexArray {
@@ -393,6 +637,8 @@ struct MGLVertexArray {
 	unsigned * subroutines;
 	int num_subroutines;
 
+	MGLUniformStream * uniform_stream;
+
 	int vertex_array_obj;
 	int num_vertices;
 	int num_instances;
@@ -421,35 +667,63 @@ struct MGLSampler {
 };
 
 MGLDataType * from_dtype(const char * dtype, Py_ssize_t size);
+MGLDataType * from_depth_dtype(const char * dtype, Py_ssize_t size);
 
 void MGLAttribute_Invalidate(MGLAttribute * attribute);
+void MGLBrickVolume_Invalidate(MGLBrickVolume * volume);
 void MGLBuffer_Invalidate(MGLBuffer * buffer);
 void MGLComputeShader_Invalidate(MGLComputeShader * program);
 void MGLContext_Invalidate(MGLContext * context);
 void MGLFramebuffer_Invalidate(MGLFramebuffer * framebuffer);
+void MGLFrameCapture_Invalidate(MGLFrameCapture * capture);
 void MGLProgram_Invalidate(MGLProgram * program);
 void MGLRenderbuffer_Invalidate(MGLRenderbuffer * renderbuffer);
 void MGLTexture3D_Invalidate(MGLTexture3D * texture);
 void MGLTextureCube_Invalidate(MGLTextureCube * texture);
 void MGLTexture_Invalidate(MGLTexture * texture);
 void MGLTextureArray_Invalidate(MGLTextureArray * texture);
+void MGLTextureAtlas_Invalidate(MGLTextureAtlas * atlas);
+void MGLTextureBuffer_Invalidate(MGLTextureBuffer * texture);
 void MGLUniform_Invalidate(MGLUniform * uniform);
+void MGLUniformStream_Invalidate(MGLUniformStream * stream);
+void MGLUploadQueue_Invalidate(MGLUploadQueue * queue);
 void MGLVertexArray_Invalidate(MGLVertexArray * vertex_array);
 void MGLSampler_Invalidate(MGLSampler * sampler);
 void MGLScope_Invalidate(MGLScope * scope);
 
 void MGLAttribute_Complete(MGLAttribute * attribute, const GLMethods & gl);
 void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl);
+int MGLUniform_Write(MGLUniform * self, PyObject * value);
 void MGLUniformBlock_Complete(MGLUniformBlock * uniform_block, const GLMethods & gl);
+int MGLUniformBlock_Reflect(MGLUniformBlock * self, MGLBlockMember ** members);
+PyObject * MGLUniformBlock_StorageBlocks(const GLMethods & gl, int program_obj);
+bool MGLBlockWriter_Pack(MGLBlockWriter * self, char * map, PyObject * values);
 void MGLVertexArray_Complete(MGLVertexArray * vertex_array);
 
 void MGLContext_Initialize(MGLContext * self);
+int MGLContext_build_mipmaps(
+	MGLContext * context, int target, int texture_obj, MGLDataType * data_type, int components,
+	int internal_format, bool immutable, int width, int height, int depth, int base, int max,
+	const char * method, Py_ssize_t method_size
+);
+bool MGLContext_check_evict(MGLDataType * data_type, bool immutable, int samples);
+PyObject * MGLContext_evict_texture(
+	MGLContext * context, int target, int texture_obj, MGLDataType * data_type, int components, int internal_format,
+	bool immutable, int width, int height, int depth, int levels, bool keep
+);
+bool MGLContext_restore_texture(
+	MGLContext * context, int target, int texture_obj, MGLDataType * data_type, int components, int internal_format,
+	bool immutable, int width, int height, int depth, int levels, PyObject * data
+);
 
 extern PyTypeObject MGLAttribute_Type;
+extern PyTypeObject MGLBlockWriter_Type;
+extern PyTypeObject MGLBrickVolume_Type;
 extern PyTypeObject MGLBuffer_Type;
 extern PyTypeObject MGLComputeShader_Type;
 extern PyTypeObject MGLContext_Type;
 extern PyTypeObject MGLFramebuffer_Type;
+extern PyTypeObject MGLFrameCapture_Type;
 extern PyTypeObject MGLInvalidObject_Type;
 extern PyTypeObject MGLProgram_Type;
 extern PyTypeObject MGLQuery_Type;
@@ -459,7 +733,12 @@ extern PyTypeObject MGLTexture3D_Type;
 extern PyTypeObject MGLTextureCube_Type;
 extern PyTypeObject MGLTexture_Type;
 extern PyTypeObject MGLTextureArray_Type;
+extern PyTypeObject MGLTextureAtlas_Type;
+extern PyTypeObject MGLTextureBuffer_Type;
+extern PyTypeObject MGLUniformBatch_Type;
 extern PyTypeObject MGLUniformBlock_Type;
+extern PyTypeObject MGLUniformStream_Type;
+extern PyTypeObject MGLUploadQueue_Type;
 extern PyTypeObject MGLUniform_Type;
 extern PyTypeObject MGLVertexArray_Type;
 extern PyTypeObject MGLSampler_Type;
@@ -1,5 +1,6 @@
 #include "Types.hpp"
 
+#include "InlineMethods.hpp"
 #include "UniformGetSetters.hpp"
 
 PyObject * MGLUniform_tp_new(PyTypeObject * type, PyObject * args, PyObject * kwargs) {
@@ -55,6 +56,138 @@ int MGLUniform_set_data(MGLUniform * self, PyObject * value, void * closure) {
 	return 0;
 }
 
+template <typename T, typename S>
+inline void MGLUniform_cast_values(T * dst, const S * src, int count) {
+	for (int i = 0; i < count; ++i) {
+		dst[i] = (T)src[i];
+	}
+}
+
+template <typename T>
+bool MGLUniform_cast_buffer(T * dst, const Py_buffer & view, char kind, int count) {
+	switch (kind) {
+		case 'f':
+			switch (view.itemsize) {
+				case 4: MGLUniform_cast_values(dst, (const float *)view.buf, count); return true;
+				case 8: MGLUniform_cast_values(dst, (const double *)view.buf, count); return true;
+			}
+			return false;
+
+		case 'i':
+			switch (view.itemsize) {
+				case 1: MGLUniform_cast_values(dst, (const int8_t *)view.buf, count); return true;
+				case 2: MGLUniform_cast_values(dst, (const int16_t *)view.buf, count); return true;
+				case 4: MGLUniform_cast_values(dst, (const int32_t *)view.buf, count); return true;
+				case 8: MGLUniform_cast_values(dst, (const int64_t *)view.buf, count); return true;
+			}
+			return false;
+
+		case 'u':
+			switch (view.itemsize) {
+				case 1: MGLUniform_cast_values(dst, (const uint8_t *)view.buf, count); return true;
+				case 2: MGLUniform_cast_values(dst, (const uint16_t *)view.buf, count); return true;
+				case 4: MGLUniform_cast_values(dst, (const uint32_t *)view.buf, count); return true;
+				case 8: MGLUniform_cast_values(dst, (const uint64_t *)view.buf, count); return true;
+			}
+			return false;
+	}
+	return false;
+}
+
+// Writes a uniform from a tuple, a list or any contiguous buffer.
+// Buffers matching the uniform's scalar type are passed to the driver as is,
+// other numeric buffers (numpy arrays of a different dtype) are converted first.
+
+int MGLUniform_Write(MGLUniform * self, PyObject * value) {
+	if (!PyObject_CheckBuffer(value)) {
+		return ((MGLUniform_Setter)self->value_setter)(self, value);
+	}
+
+	if (!self->scalar_type) {
+		MGLError_Set("cannot detect uniform type");
+		return -1;
+	}
+
+	Py_buffer buffer_view;
+
+	int get_buffer = PyObject_GetBuffer(value, &buffer_view, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT);
+	if (get_buffer < 0) {
+		// Propagate the default error
+		return -1;
+	}
+
+	int size = self->array_length * self->element_size;
+	int scalar_size = self->scalar_type == GL_DOUBLE ? 8 : 4;
+	int count = size / scalar_size;
+	char kind = buffer_format_kind(buffer_view);
+
+	bool same_type = false;
+	switch (self->scalar_type) {
+		case GL_FLOAT:
+			same_type = kind == 'f' && buffer_view.itemsize == 4;
+			break;
+
+		case GL_DOUBLE:
+			same_type = kind == 'f' && buffer_view.itemsize == 8;
+			break;
+
+		default:
+			same_type = (kind == 'i' || kind == 'u') && buffer_view.itemsize == 4;
+			break;
+	}
+
+	const void * data = buffer_view.buf;
+	char * temp = 0;
+
+	if (buffer_view.len == size && (same_type || buffer_view.itemsize == 1)) {
+		// Raw data or matching type
+	} else if (kind && buffer_view.len == (Py_ssize_t)count * buffer_view.itemsize) {
+		temp = new char[size];
+		bool converted = false;
+
+		switch (self->scalar_type) {
+			case GL_FLOAT:
+				converted = MGLUniform_cast_buffer((float *)temp, buffer_view, kind, count);
+				break;
+
+			case GL_DOUBLE:
+				converted = MGLUniform_cast_buffer((double *)temp, buffer_view, kind, count);
+				break;
+
+			case GL_UNSIGNED_INT:
+				converted = MGLUniform_cast_buffer((unsigned *)temp, buffer_view, kind, count);
+				break;
+
+			default:
+				converted = MGLUniform_cast_buffer((int *)temp, buffer_view, kind, count);
+				break;
+		}
+
+		if (!converted) {
+			MGLError_Set("invalid buffer format '%s'", buffer_view.format);
+			delete[] temp;
+			PyBuffer_Release(&buffer_view);
+			return -1;
+		}
+
+		data = temp;
+	} else {
+		MGLError_Set("data size mismatch %d != %d", buffer_view.len, size);
+		PyBuffer_Release(&buffer_view);
+		return -1;
+	}
+
+	if (self->matrix) {
+		((gl_uniform_matrix_writer_proc)self->gl_value_writer_proc)(self->program_obj, self->location, self->array_length, false, data);
+	} else {
+		((gl_uniform_vector_writer_proc)self->gl_value_writer_proc)(self->program_obj, self->location, self->array_length, data);
+	}
+
+	delete[] temp;
+	PyBuffer_Release(&buffer_view);
+	return 0;
+}
+
 PyGetSetDef MGLUniform_tp_getseters[] = {
 	{(char *)"value", (getter)MGLUniform_get_value, (setter)MGLUniform_set_value, 0, 0},
 	{(char *)"data", (getter)MGLUniform_get_data, (setter)MGLUniform_set_data, 0, 0},
@@ -117,6 +250,7 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 	switch (self->type) {
 		case GL_BOOL:
 			self->matrix = false;
+			self->scalar_type = GL_BOOL;
 			self->dimension = 1;
 			self->element_size = 4;
 			self->gl_value_reader_proc = (MGLProc)gl.GetUniformiv;
@@ -132,6 +266,7 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 
 		case GL_BOOL_VEC2:
 			self->matrix = false;
+			self->scalar_type = GL_BOOL;
 			self->dimension = 2;
 			self->element_size = 8;
 			self->gl_value_reader_proc = (MGLProc)gl.GetUniformiv;
@@ -147,6 +282,7 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 
 		case GL_BOOL_VEC3:
 			self->matrix = false;
+			self->scalar_type = GL_BOOL;
 			self->dimension = 3;
 			self->element_size = 12;
 			self->gl_value_reader_proc = (MGLProc)gl.GetUniformiv;
@@ -162,6 +298,7 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 
 		case GL_BOOL_VEC4:
 			self->matrix = false;
+			self->scalar_type = GL_BOOL;
 			self->dimension = 4;
 			self->element_size = 16;
 			self->gl_value_reader_proc = (MGLProc)gl.GetUniformiv;
@@ -177,6 +314,7 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 
 		case GL_INT:
 			self->matrix = false;
+			self->scalar_type = GL_INT;
 			self->dimension = 1;
 			self->element_size = 4;
 			self->gl_value_reader_proc = (MGLProc)gl.GetUniformiv;
@@ -192,6 +330,7 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 
 		case GL_INT_VEC2:
 			self->matrix = false;
+			self->scalar_type = GL_INT;
 			self->dimension = 2;
 			self->element_size = 8;
 			self->gl_value_reader_proc = (MGLProc)gl.GetUniformiv;
@@ -207,6 +346,7 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 
 		case GL_INT_VEC3:
 			self->matrix = false;
+			self->scalar_type = GL_INT;
 			self->dimension = 3;
 			self->element_size = 12;
 			self->gl_value_reader_proc = (MGLProc)gl.GetUniformiv;
@@ -222,6 +362,7 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 
 		case GL_INT_VEC4:
 			self->matrix = false;
+			self->scalar_type = GL_INT;
 			self->dimension = 4;
 			self->element_size = 16;
 			self->gl_value_reader_proc = (MGLProc)gl.GetUniformiv;
@@ -237,6 +378,7 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 
 		case GL_UNSIGNED_INT:
 			self->matrix = false;
+			self->scalar_type = GL_UNSIGNED_INT;
 			self->dimension = 1;
 			self->element_size = 4;
 			self->gl_value_reader_proc = (MGLProc)gl.GetUniformuiv;
@@ -252,6 +394,7 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 
 		case GL_UNSIGNED_INT_VEC2:
 			self->matrix = false;
+			self->scalar_type = GL_UNSIGNED_INT;
 			self->dimension = 2;
 			self->element_size = 8;
 			self->gl_value_reader_proc = (MGLProc)gl.GetUniformuiv;
@@ -267,6 +410,7 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 
 		case GL_UNSIGNED_INT_VEC3:
 			self->matrix = false;
+			self->scalar_type = GL_UNSIGNED_INT;
 			self->dimension = 3;
 			self->element_size = 12;
 			self->gl_value_reader_proc = (MGLProc)gl.GetUniformuiv;
@@ -282,6 +426,7 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 
 		case GL_UNSIGNED_INT_VEC4:
 			self->matrix = false;
+			self->scalar_type = GL_UNSIGNED_INT;
 			self->dimension = 4;
 			self->element_size = 16;
 			self->gl_value_reader_proc = (MGLProc)gl.GetUniformuiv;
@@ -297,6 +442,7 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 
 		case GL_FLOAT:
 			self->matrix = false;
+			self->scalar_type = GL_FLOAT;
 			self->dimension = 1;
 			self->element_size = 4;
 			self->gl_value_reader_proc = (MGLProc)gl.GetUniformfv;
@@ -312,6 +458,7 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 
 		case GL_FLOAT_VEC2:
 			self->matrix = false;
+			self->scalar_type = GL_FLOAT;
 			self->dimension = 2;
 			self->element_size = 8;
 			self->gl_value_reader_proc = (MGLProc)gl.GetUniformfv;
@@ -327,6 +474,7 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 
 		case GL_FLOAT_VEC3:
 			self->matrix = false;
+			self->scalar_type = GL_FLOAT;
 			self->dimension = 3;
 			self->element_size = 12;
 			self->gl_value_reader_proc = (MGLProc)gl.GetUniformfv;
@@ -342,6 +490,7 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 
 		case GL_FLOAT_VEC4:
 			self->matrix = false;
+			self->scalar_type = GL_FLOAT;
 			self->dimension = 4;
 			self->element_size = 16;
 			self->gl_value_reader_proc = (MGLProc)gl.GetUniformfv;
@@ -357,6 +506,7 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 
 		case GL_DOUBLE:
 			self->matrix = false;
+			self->scalar_type = GL_DOUBLE;
 			self->dimension = 1;
 			self->element_size = 8;
 			self->gl_value_reader_proc = (MGLProc)gl.GetUniformdv;
@@ -372,6 +522,7 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 
 		case GL_DOUBLE_VEC2:
 			self->matrix = false;
+			self->scalar_type = GL_DOUBLE;
 			self->dimension = 2;
 			self->element_size = 16;
 			self->gl_value_reader_proc = (MGLProc)gl.GetUniformdv;
@@ -387,6 +538,7 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 
 		case GL_DOUBLE_VEC3:
 			self->matrix = false;
+			self->scalar_type = GL_DOUBLE;
 			self->dimension = 3;
 			self->element_size = 24;
 			self->gl_value_reader_proc = (MGLProc)gl.GetUniformdv;
@@ -402,6 +554,7 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 
 		case GL_DOUBLE_VEC4:
 			self->matrix = false;
+			self->scalar_type = GL_DOUBLE;
 			self->dimension = 4;
 			self->element_size = 32;
 			self->gl_value_reader_proc = (MGLProc)gl.GetUniformdv;
@@ -420,6 +573,7 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 		case GL_INT_SAMPLER_1D:
 		case GL_INT_SAMPLER_1D_ARRAY:
 			self->matrix = false;
+			self->scalar_type = GL_INT;
 			self->dimension = 1;
 			self->element_size = 4;
 			self->gl_value_reader_proc = (MGLProc)gl.GetUniformiv;
@@ -437,6 +591,7 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 		case GL_INT_SAMPLER_2D:
 		case GL_UNSIGNED_INT_SAMPLER_2D:
 			self->matrix = false;
+			self->scalar_type = GL_INT;
 			self->dimension = 1;
 			self->element_size = 4;
 			self->gl_value_reader_proc = (MGLProc)gl.GetUniformiv;
@@ -454,6 +609,7 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 		case GL_INT_SAMPLER_2D_ARRAY:
 		case GL_UNSIGNED_INT_SAMPLER_2D_ARRAY:
 			self->matrix = false;
+			self->scalar_type = GL_INT;
 			self->dimension = 1;
 			self->element_size = 4;
 			self->gl_value_reader_proc = (MGLProc)gl.GetUniformiv;
@@ -471,6 +627,7 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 		case GL_INT_SAMPLER_3D:
 		case GL_UNSIGNED_INT_SAMPLER_3D:
 			self->matrix = false;
+			self->scalar_type = GL_INT;
 			self->dimension = 1;
 			self->element_size = 4;
 			self->gl_value_reader_proc = (MGLProc)gl.GetUniformiv;
@@ -486,6 +643,7 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 
 		case GL_SAMPLER_2D_SHADOW:
 			self->matrix = false;
+			self->scalar_type = GL_INT;
 			self->dimension = 1;
 			self->element_size = 4;
 			self->gl_value_reader_proc = (MGLProc)gl.GetUniformiv;
@@ -503,6 +661,7 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 		case GL_INT_SAMPLER_2D_MULTISAMPLE:
 		case GL_UNSIGNED_INT_SAMPLER_2D_MULTISAMPLE:
 			self->matrix = false;
+			self->scalar_type = GL_INT;
 			self->dimension = 1;
 			self->element_size = 4;
 			self->gl_value_reader_proc = (MGLProc)gl.GetUniformiv;
@@ -520,6 +679,7 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 		case GL_INT_SAMPLER_2D_MULTISAMPLE_ARRAY:
 		case GL_UNSIGNED_INT_SAMPLER_2D_MULTISAMPLE_ARRAY:
 			self->matrix = false;
+			self->scalar_type = GL_INT;
 			self->dimension = 1;
 			self->element_size = 4;
 			self->gl_value_reader_proc = (MGLProc)gl.GetUniformiv;
@@ -537,6 +697,43 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 		case GL_INT_SAMPLER_CUBE:
 		case GL_UNSIGNED_INT_SAMPLER_CUBE:
 			self->matrix = false;
+			self->scalar_type = GL_INT;
+			self->dimension = 1;
+			self->element_size = 4;
+			self->gl_value_reader_proc = (MGLProc)gl.GetUniformiv;
+			self->gl_value_writer_proc = (MGLProc)gl.ProgramUniform1iv;
+			if (self->array_length > 1) {
+				self->value_getter = (MGLProc)MGLUniform_sampler_array_value_getter;
+				self->value_setter = (MGLProc)MGLUniform_sampler_array_value_setter;
+			} else {
+				self->value_getter = (MGLProc)MGLUniform_sampler_value_getter;
+				self->value_setter = (MGLProc)MGLUniform_sampler_value_setter;
+			}
+			break;
+
+		case GL_SAMPLER_BUFFER:
+		case GL_INT_SAMPLER_BUFFER:
+		case GL_UNSIGNED_INT_SAMPLER_BUFFER:
+			self->matrix = false;
+			self->scalar_type = GL_INT;
+			self->dimension = 1;
+			self->element_size = 4;
+			self->gl_value_reader_proc = (MGLProc)gl.GetUniformiv;
+			self->gl_value_writer_proc = (MGLProc)gl.ProgramUniform1iv;
+			if (self->array_length > 1) {
+				self->value_getter = (MGLProc)MGLUniform_sampler_array_value_getter;
+				self->value_setter = (MGLProc)MGLUniform_sampler_array_value_setter;
+			} else {
+				self->value_getter = (MGLProc)MGLUniform_sampler_value_getter;
+				self->value_setter = (MGLProc)MGLUniform_sampler_value_setter;
+			}
+			break;
+
+		case GL_IMAGE_BUFFER:
+		case GL_INT_IMAGE_BUFFER:
+		case GL_UNSIGNED_INT_IMAGE_BUFFER:
+			self->matrix = false;
+			self->scalar_type = GL_INT;
 			self->dimension = 1;
 			self->element_size = 4;
 			self->gl_value_reader_proc = (MGLProc)gl.GetUniformiv;
@@ -552,6 +749,7 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 
 		case GL_IMAGE_2D:
 			self->matrix = false;
+			self->scalar_type = GL_INT;
 			self->dimension = 1;
 			self->element_size = 4;
 			self->gl_value_reader_proc = (MGLProc)gl.GetUniformiv;
@@ -567,6 +765,7 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 
 		case GL_FLOAT_MAT2:
 			self->matrix = true;
+			self->scalar_type = GL_FLOAT;
 			self->dimension = 4;
 			self->element_size = 16;
 			self->gl_value_reader_proc = (MGLProc)gl.GetUniformfv;
@@ -582,6 +781,7 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 
 		case GL_FLOAT_MAT2x3:
 			self->matrix = true;
+			self->scalar_type = GL_FLOAT;
 			self->dimension = 6;
 			self->element_size = 24;
 			self->gl_value_reader_proc = (MGLProc)gl.GetUniformfv;
@@ -597,6 +797,7 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 
 		case GL_FLOAT_MAT2x4:
 			self->matrix = true;
+			self->scalar_type = GL_FLOAT;
 			self->dimension = 8;
 			self->element_size = 32;
 			self->gl_value_reader_proc = (MGLProc)gl.GetUniformfv;
@@ -612,6 +813,7 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 
 		case GL_FLOAT_MAT3x2:
 			self->matrix = true;
+			self->scalar_type = GL_FLOAT;
 			self->dimension = 6;
 			self->element_size = 24;
 			self->gl_value_reader_proc = (MGLProc)gl.GetUniformfv;
@@ -627,6 +829,7 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 
 		case GL_FLOAT_MAT3:
 			self->matrix = true;
+			self->scalar_type = GL_FLOAT;
 			self->dimension = 9;
 			self->element_size = 36;
 			self->gl_value_reader_proc = (MGLProc)gl.GetUniformfv;
@@ -642,6 +845,7 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 
 		case GL_FLOAT_MAT3x4:
 			self->matrix = true;
+			self->scalar_type = GL_FLOAT;
 			self->dimension = 12;
 			self->element_size = 48;
 			self->gl_value_reader_proc = (MGLProc)gl.GetUniformfv;
@@ -657,6 +861,7 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 
 		case GL_FLOAT_MAT4x2:
 			self->matrix = true;
+			self->scalar_type = GL_FLOAT;
 			self->dimension = 8;
 			self->element_size = 32;
 			self->gl_value_reader_proc = (MGLProc)gl.GetUniformfv;
@@ -672,6 +877,7 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 
 		case GL_FLOAT_MAT4x3:
 			self->matrix = true;
+			self->scalar_type = GL_FLOAT;
 			self->dimension = 12;
 			self->element_size = 48;
 			self->gl_value_reader_proc = (MGLProc)gl.GetUniformfv;
@@ -687,6 +893,7 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 
 		case GL_FLOAT_MAT4:
 			self->matrix = true;
+			self->scalar_type = GL_FLOAT;
 			self->dimension = 16;
 			self->element_size = 64;
 			self->gl_value_reader_proc = (MGLProc)gl.GetUniformfv;
@@ -702,6 +909,7 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 
 		case GL_DOUBLE_MAT2:
 			self->matrix = true;
+			self->scalar_type = GL_DOUBLE;
 			self->dimension = 4;
 			self->element_size = 32;
 			self->gl_value_reader_proc = (MGLProc)gl.GetUniformdv;
@@ -717,6 +925,7 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 
 		case GL_DOUBLE_MAT2x3:
 			self->matrix = true;
+			self->scalar_type = GL_DOUBLE;
 			self->dimension = 6;
 			self->element_size = 48;
 			self->gl_value_reader_proc = (MGLProc)gl.GetUniformdv;
@@ -732,6 +941,7 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 
 		case GL_DOUBLE_MAT2x4:
 			self->matrix = true;
+			self->scalar_type = GL_DOUBLE;
 			self->dimension = 8;
 			self->element_size = 64;
 			self->gl_value_reader_proc = (MGLProc)gl.GetUniformdv;
@@ -747,6 +957,7 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 
 		case GL_DOUBLE_MAT3x2:
 			self->matrix = true;
+			self->scalar_type = GL_DOUBLE;
 			self->dimension = 6;
 			self->element_size = 48;
 			self->gl_value_reader_proc = (MGLProc)gl.GetUniformdv;
@@ -762,6 +973,7 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 
 		case GL_DOUBLE_MAT3:
 			self->matrix = true;
+			self->scalar_type = GL_DOUBLE;
 			self->dimension = 9;
 			self->element_size = 72;
 			self->gl_value_reader_proc = (MGLProc)gl.GetUniformdv;
@@ -777,6 +989,7 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 
 		case GL_DOUBLE_MAT3x4:
 			self->matrix = true;
+			self->scalar_type = GL_DOUBLE;
 			self->dimension = 12;
 			self->element_size = 96;
 			self->gl_value_reader_proc = (MGLProc)gl.GetUniformdv;
@@ -792,6 +1005,7 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 
 		case GL_DOUBLE_MAT4x2:
 			self->matrix = true;
+			self->scalar_type = GL_DOUBLE;
 			self->dimension = 8;
 			self->element_size = 64;
 			self->gl_value_reader_proc = (MGLProc)gl.GetUniformdv;
@@ -807,6 +1021,7 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 
 		case GL_DOUBLE_MAT4x3:
 			self->matrix = true;
+			self->scalar_type = GL_DOUBLE;
 			self->dimension = 12;
 			self->element_size = 96;
 			self->gl_value_reader_proc = (MGLProc)gl.GetUniformdv;
@@ -822,6 +1037,7 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 
 		case GL_DOUBLE_MAT4:
 			self->matrix = true;
+			self->scalar_type = GL_DOUBLE;
 			self->dimension = 16;
 			self->element_size = 128;
 			self->gl_value_reader_proc = (MGLProc)gl.GetUniformdv;
@@ -837,6 +1053,7 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 
 		default:
 			self->matrix = false;
+			self->scalar_type = 0;
 			self->dimension = 1;
 			self->element_size = 4;
 			self->gl_value_reader_proc = (MGLProc)gl.GetUniformfv;
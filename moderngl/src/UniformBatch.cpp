@@ -0,0 +1,130 @@
+#include "Types.hpp"
+
+PyObject * MGLProgram_uniform_setter(MGLProgram * self, PyObject * args) {
+	PyObject * uniforms;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"O!",
+		&PyTuple_Type,
+		&uniforms
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	int num_uniforms = (int)PyTuple_GET_SIZE(uniforms);
+
+	for (int i = 0; i < num_uniforms; ++i) {
+		PyObject * item = PyTuple_GET_ITEM(uniforms, i);
+
+		if (Py_TYPE(item) != &MGLUniform_Type) {
+			MGLError_Set("uniforms[%d] must be a Uniform not %s", i, Py_TYPE(item)->tp_name);
+			return 0;
+		}
+
+		if (((MGLUniform *)item)->program_obj != self->program_obj) {
+			MGLError_Set("uniforms[%d] belongs to a different program", i);
+			return 0;
+		}
+	}
+
+	MGLUniformBatch * batch = (MGLUniformBatch *)MGLUniformBatch_Type.tp_alloc(&MGLUniformBatch_Type, 0);
+
+	batch->num_uniforms = num_uniforms;
+	batch->uniforms = new MGLUniform * [num_uniforms];
+
+	for (int i = 0; i < num_uniforms; ++i) {
+		PyObject * item = PyTuple_GET_ITEM(uniforms, i);
+		Py_INCREF(item);
+		batch->uniforms[i] = (MGLUniform *)item;
+	}
+
+	return (PyObject *)batch;
+}
+
+PyObject * MGLUniformBatch_tp_new(PyTypeObject * type, PyObject * args, PyObject * kwargs) {
+	MGLUniformBatch * self = (MGLUniformBatch *)type->tp_alloc(type, 0);
+
+	if (self) {
+	}
+
+	return (PyObject *)self;
+}
+
+void MGLUniformBatch_tp_dealloc(MGLUniformBatch * self) {
+	for (int i = 0; i < self->num_uniforms; ++i) {
+		Py_DECREF(self->uniforms[i]);
+	}
+
+	delete[] self->uniforms;
+	Py_TYPE(self)->tp_free((PyObject *)self);
+}
+
+PyObject * MGLUniformBatch_tp_call(MGLUniformBatch * self, PyObject * args, PyObject * kwargs) {
+	if (kwargs && PyDict_Size(kwargs)) {
+		MGLError_Set("keyword arguments are not supported");
+		return 0;
+	}
+
+	int num_values = (int)PyTuple_GET_SIZE(args);
+
+	if (num_values != self->num_uniforms) {
+		MGLError_Set("expected %d values not %d", self->num_uniforms, num_values);
+		return 0;
+	}
+
+	for (int i = 0; i < num_values; ++i) {
+		if (MGLUniform_Write(self->uniforms[i], PyTuple_GET_ITEM(args, i)) < 0) {
+			return 0;
+		}
+	}
+
+	Py_RETURN_NONE;
+}
+
+PyMethodDef MGLUniformBatch_tp_methods[] = {
+	{0},
+};
+
+PyTypeObject MGLUniformBatch_Type = {
+	PyVarObject_HEAD_INIT(0, 0)
+	"mgl.UniformBatch",                                     // tp_name
+	sizeof(MGLUniformBatch),                                // tp_basicsize
+	0,                                                      // tp_itemsize
+	(destructor)MGLUniformBatch_tp_dealloc,                 // tp_dealloc
+	0,                                                      // tp_print
+	0,                                                      // tp_getattr
+	0,                                                      // tp_setattr
+	0,                                                      // tp_reserved
+	0,                                                      // tp_repr
+	0,                                                      // tp_as_number
+	0,                                                      // tp_as_sequence
+	0,                                                      // tp_as_mapping
+	0,                                                      // tp_hash
+	(ternaryfunc)MGLUniformBatch_tp_call,                   // tp_call
+	0,                                                      // tp_str
+	0,                                                      // tp_getattro
+	0,                                                      // tp_setattro
+	0,                                                      // tp_as_buffer
+	Py_TPFLAGS_DEFAULT,                                     // tp_flags
+	0,                                                      // tp_doc
+	0,                                                      // tp_traverse
+	0,                                                      // tp_clear
+	0,                                                      // tp_richcompare
+	0,                                                      // tp_weaklistoffset
+	0,                                                      // tp_iter
+	0,                                                      // tp_iternext
+	MGLUniformBatch_tp_methods,                             // tp_methods
+	0,                                                      // tp_members
+	0,                                                      // tp_getset
+	0,                                                      // tp_base
+	0,                                                      // tp_dict
+	0,                                                      // tp_descr_get
+	0,                                                      // tp_descr_set
+	0,                                                      // tp_dictoffset
+	0,                                                      // tp_init
+	0,                                                      // tp_alloc
+	MGLUniformBatch_tp_new,                                 // tp_new
+};
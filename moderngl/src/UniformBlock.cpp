@@ -1,5 +1,7 @@
 #include "Types.hpp"
 
+#include "InlineMethods.hpp"
+
 PyObject * MGLUniformBlock_tp_new(PyTypeObject * type, PyObject * args, PyObject * kwargs) {
 	MGLUniformBlock * self = (MGLUniformBlock *)type->tp_alloc(type, 0);
 
@@ -14,13 +16,15 @@ void MGLUniformBlock_tp_dealloc(MGLUniformBlock * self) {
 	Py_TYPE(self)->tp_free((PyObject *)self);
 }
 
-PyMethodDef MGLUniformBlock_tp_methods[] = {
-	{0},
-};
 
 PyObject * MGLUniformBlock_get_binding(MGLUniformBlock * self, void * closure) {
 	int binding = 0;
-	self->gl->GetActiveUniformBlockiv(self->program_obj, self->index, GL_UNIFORM_BLOCK_BINDING, &binding);
+	if (self->storage_block) {
+		GLenum prop = GL_BUFFER_BINDING;
+		self->gl->GetProgramResourceiv(self->program_obj, GL_SHADER_STORAGE_BLOCK, self->index, 1, &prop, 1, 0, &binding);
+	} else {
+		self->gl->GetActiveUniformBlockiv(self->program_obj, self->index, GL_UNIFORM_BLOCK_BINDING, &binding);
+	}
 	return PyLong_FromLong(binding);
 }
 
@@ -32,7 +36,11 @@ int MGLUniformBlock_set_binding(MGLUniformBlock * self, PyObject * value, void *
 		return -1;
 	}
 
-	self->gl->UniformBlockBinding(self->program_obj, self->index, binding);
+	if (self->storage_block) {
+		self->gl->ShaderStorageBlockBinding(self->program_obj, self->index, binding);
+	} else {
+		self->gl->UniformBlockBinding(self->program_obj, self->index, binding);
+	}
 	return 0;
 }
 
@@ -41,6 +49,50 @@ PyGetSetDef MGLUniformBlock_tp_getseters[] = {
 	{0},
 };
 
+PyObject * MGLUniformBlock_members(MGLUniformBlock * self) {
+	MGLBlockMember * members = 0;
+	int num_members = MGLUniformBlock_Reflect(self, &members);
+
+	PyObject * result = PyTuple_New(num_members);
+
+	for (int i = 0; i < num_members; ++i) {
+		PyObject * item = PyTuple_New(7);
+		PyTuple_SET_ITEM(item, 0, members[i].name);
+		PyTuple_SET_ITEM(item, 1, PyLong_FromLong(members[i].gl_type));
+		PyTuple_SET_ITEM(item, 2, PyLong_FromLong(members[i].offset));
+		PyTuple_SET_ITEM(item, 3, PyLong_FromLong(members[i].array_length));
+		PyTuple_SET_ITEM(item, 4, PyLong_FromLong(members[i].array_stride));
+		PyTuple_SET_ITEM(item, 5, PyLong_FromLong(members[i].matrix_stride));
+		PyTuple_SET_ITEM(item, 6, PyBool_FromLong(members[i].row_major));
+		PyTuple_SET_ITEM(result, i, item);
+	}
+
+	delete[] members;
+	return result;
+}
+
+PyObject * MGLUniformBlock_writer(MGLUniformBlock * self) {
+	MGLBlockWriter * writer = (MGLBlockWriter *)MGLBlockWriter_Type.tp_alloc(&MGLBlockWriter_Type, 0);
+
+	writer->num_members = MGLUniformBlock_Reflect(self, &writer->members);
+	writer->lookup = PyDict_New();
+	writer->size = self->size;
+
+	for (int i = 0; i < writer->num_members; ++i) {
+		PyObject * index = PyLong_FromLong(i);
+		PyDict_SetItem(writer->lookup, writer->members[i].name, index);
+		Py_DECREF(index);
+	}
+
+	return (PyObject *)writer;
+}
+
+PyMethodDef MGLUniformBlock_tp_methods[] = {
+	{"members", (PyCFunction)MGLUniformBlock_members, METH_NOARGS, 0},
+	{"writer", (PyCFunction)MGLUniformBlock_writer, METH_NOARGS, 0},
+	{0},
+};
+
 PyTypeObject MGLUniformBlock_Type = {
 	PyVarObject_HEAD_INIT(0, 0)
 	"mgl.UniformBlock",                                     // tp_name
@@ -84,3 +136,190 @@ PyTypeObject MGLUniformBlock_Type = {
 
 void MGLUniformBlock_Complete(MGLUniformBlock * uniform_block, const GLMethods & gl) {
 }
+
+void MGLBlockMember_SetType(MGLBlockMember * member) {
+	int scalar_type = 0;
+	int columns = 1;
+	int rows = 1;
+
+	switch (member->gl_type) {
+		case GL_FLOAT: scalar_type = GL_FLOAT; break;
+		case GL_FLOAT_VEC2: scalar_type = GL_FLOAT; rows = 2; break;
+		case GL_FLOAT_VEC3: scalar_type = GL_FLOAT; rows = 3; break;
+		case GL_FLOAT_VEC4: scalar_type = GL_FLOAT; rows = 4; break;
+		case GL_DOUBLE: scalar_type = GL_DOUBLE; break;
+		case GL_DOUBLE_VEC2: scalar_type = GL_DOUBLE; rows = 2; break;
+		case GL_DOUBLE_VEC3: scalar_type = GL_DOUBLE; rows = 3; break;
+		case GL_DOUBLE_VEC4: scalar_type = GL_DOUBLE; rows = 4; break;
+		case GL_INT: scalar_type = GL_INT; break;
+		case GL_INT_VEC2: scalar_type = GL_INT; rows = 2; break;
+		case GL_INT_VEC3: scalar_type = GL_INT; rows = 3; break;
+		case GL_INT_VEC4: scalar_type = GL_INT; rows = 4; break;
+		case GL_UNSIGNED_INT: scalar_type = GL_UNSIGNED_INT; break;
+		case GL_UNSIGNED_INT_VEC2: scalar_type = GL_UNSIGNED_INT; rows = 2; break;
+		case GL_UNSIGNED_INT_VEC3: scalar_type = GL_UNSIGNED_INT; rows = 3; break;
+		case GL_UNSIGNED_INT_VEC4: scalar_type = GL_UNSIGNED_INT; rows = 4; break;
+		case GL_BOOL: scalar_type = GL_BOOL; break;
+		case GL_BOOL_VEC2: scalar_type = GL_BOOL; rows = 2; break;
+		case GL_BOOL_VEC3: scalar_type = GL_BOOL; rows = 3; break;
+		case GL_BOOL_VEC4: scalar_type = GL_BOOL; rows = 4; break;
+		case GL_FLOAT_MAT2: scalar_type = GL_FLOAT; columns = 2; rows = 2; break;
+		case GL_FLOAT_MAT2x3: scalar_type = GL_FLOAT; columns = 2; rows = 3; break;
+		case GL_FLOAT_MAT2x4: scalar_type = GL_FLOAT; columns = 2; rows = 4; break;
+		case GL_FLOAT_MAT3x2: scalar_type = GL_FLOAT; columns = 3; rows = 2; break;
+		case GL_FLOAT_MAT3: scalar_type = GL_FLOAT; columns = 3; rows = 3; break;
+		case GL_FLOAT_MAT3x4: scalar_type = GL_FLOAT; columns = 3; rows = 4; break;
+		case GL_FLOAT_MAT4x2: scalar_type = GL_FLOAT; columns = 4; rows = 2; break;
+		case GL_FLOAT_MAT4x3: scalar_type = GL_FLOAT; columns = 4; rows = 3; break;
+		case GL_FLOAT_MAT4: scalar_type = GL_FLOAT; columns = 4; rows = 4; break;
+		case GL_DOUBLE_MAT2: scalar_type = GL_DOUBLE; columns = 2; rows = 2; break;
+		case GL_DOUBLE_MAT2x3: scalar_type = GL_DOUBLE; columns = 2; rows = 3; break;
+		case GL_DOUBLE_MAT2x4: scalar_type = GL_DOUBLE; columns = 2; rows = 4; break;
+		case GL_DOUBLE_MAT3x2: scalar_type = GL_DOUBLE; columns = 3; rows = 2; break;
+		case GL_DOUBLE_MAT3: scalar_type = GL_DOUBLE; columns = 3; rows = 3; break;
+		case GL_DOUBLE_MAT3x4: scalar_type = GL_DOUBLE; columns = 3; rows = 4; break;
+		case GL_DOUBLE_MAT4x2: scalar_type = GL_DOUBLE; columns = 4; rows = 2; break;
+		case GL_DOUBLE_MAT4x3: scalar_type = GL_DOUBLE; columns = 4; rows = 3; break;
+		case GL_DOUBLE_MAT4: scalar_type = GL_DOUBLE; columns = 4; rows = 4; break;
+	}
+
+	member->scalar_type = scalar_type;
+	member->columns = columns;
+	member->rows = rows;
+}
+
+PyObject * MGLBlockMember_Name(char * name, int name_len, const char * block_name, int block_name_len) {
+	// Members of named block instances are prefixed with the block name
+	if (name_len > block_name_len && name[block_name_len] == '.' && !strncmp(name, block_name, block_name_len)) {
+		name += block_name_len + 1;
+		name_len -= block_name_len + 1;
+	}
+
+	clean_glsl_name(name, name_len);
+	return PyUnicode_FromStringAndSize(name, name_len);
+}
+
+int MGLUniformBlock_Reflect(MGLUniformBlock * self, MGLBlockMember ** members) {
+	const GLMethods & gl = *self->gl;
+
+	int block_name_len = 0;
+	char block_name[256];
+
+	int name_len = 0;
+	char name[256];
+
+	int num_members = 0;
+
+	if (self->storage_block) {
+		gl.GetProgramResourceName(self->program_obj, GL_SHADER_STORAGE_BLOCK, self->index, 256, &block_name_len, block_name);
+
+		GLenum num_prop = GL_NUM_ACTIVE_VARIABLES;
+		gl.GetProgramResourceiv(self->program_obj, GL_SHADER_STORAGE_BLOCK, self->index, 1, &num_prop, 1, 0, &num_members);
+
+		int * indices = new int[num_members];
+		GLenum indices_prop = GL_ACTIVE_VARIABLES;
+		gl.GetProgramResourceiv(self->program_obj, GL_SHADER_STORAGE_BLOCK, self->index, 1, &indices_prop, num_members, 0, indices);
+
+		*members = new MGLBlockMember[num_members];
+
+		for (int i = 0; i < num_members; ++i) {
+			GLenum props[] = {GL_TYPE, GL_ARRAY_SIZE, GL_OFFSET, GL_ARRAY_STRIDE, GL_MATRIX_STRIDE, GL_IS_ROW_MAJOR};
+			int values[6] = {};
+
+			gl.GetProgramResourceiv(self->program_obj, GL_BUFFER_VARIABLE, indices[i], 6, props, 6, 0, values);
+			gl.GetProgramResourceName(self->program_obj, GL_BUFFER_VARIABLE, indices[i], 256, &name_len, name);
+
+			MGLBlockMember & member = (*members)[i];
+			member.name = MGLBlockMember_Name(name, name_len, block_name, block_name_len);
+			member.gl_type = values[0];
+			member.array_length = values[1];
+			member.offset = values[2];
+			member.array_stride = values[3];
+			member.matrix_stride = values[4];
+			member.row_major = values[5] != 0;
+			MGLBlockMember_SetType(&member);
+		}
+
+		delete[] indices;
+
+	} else {
+		gl.GetActiveUniformBlockName(self->program_obj, self->index, 256, &block_name_len, block_name);
+		gl.GetActiveUniformBlockiv(self->program_obj, self->index, GL_UNIFORM_BLOCK_ACTIVE_UNIFORMS, &num_members);
+
+		int * indices = new int[num_members * 7];
+		int * types = indices + num_members;
+		int * sizes = types + num_members;
+		int * offsets = sizes + num_members;
+		int * array_strides = offsets + num_members;
+		int * matrix_strides = array_strides + num_members;
+		int * row_majors = matrix_strides + num_members;
+
+		gl.GetActiveUniformBlockiv(self->program_obj, self->index, GL_UNIFORM_BLOCK_ACTIVE_UNIFORM_INDICES, indices);
+		gl.GetActiveUniformsiv(self->program_obj, num_members, (GLuint *)indices, GL_UNIFORM_TYPE, types);
+		gl.GetActiveUniformsiv(self->program_obj, num_members, (GLuint *)indices, GL_UNIFORM_SIZE, sizes);
+		gl.GetActiveUniformsiv(self->program_obj, num_members, (GLuint *)indices, GL_UNIFORM_OFFSET, offsets);
+		gl.GetActiveUniformsiv(self->program_obj, num_members, (GLuint *)indices, GL_UNIFORM_ARRAY_STRIDE, array_strides);
+		gl.GetActiveUniformsiv(self->program_obj, num_members, (GLuint *)indices, GL_UNIFORM_MATRIX_STRIDE, matrix_strides);
+		gl.GetActiveUniformsiv(self->program_obj, num_members, (GLuint *)indices, GL_UNIFORM_IS_ROW_MAJOR, row_majors);
+
+		*members = new MGLBlockMember[num_members];
+
+		for (int i = 0; i < num_members; ++i) {
+			gl.GetActiveUniformName(self->program_obj, indices[i], 256, &name_len, name);
+
+			MGLBlockMember & member = (*members)[i];
+			member.name = MGLBlockMember_Name(name, name_len, block_name, block_name_len);
+			member.gl_type = types[i];
+			member.array_length = sizes[i];
+			member.offset = offsets[i];
+			member.array_stride = array_strides[i];
+			member.matrix_stride = matrix_strides[i];
+			member.row_major = row_majors[i] != 0;
+			MGLBlockMember_SetType(&member);
+		}
+
+		delete[] indices;
+	}
+
+	return num_members;
+}
+
+PyObject * MGLUniformBlock_StorageBlocks(const GLMethods & gl, int program_obj) {
+	int num_storage_blocks = 0;
+
+	if (gl.GetProgramInterfaceiv) {
+		gl.GetProgramInterfaceiv(program_obj, GL_SHADER_STORAGE_BLOCK, GL_ACTIVE_RESOURCES, &num_storage_blocks);
+	}
+
+	PyObject * storage_blocks_lst = PyTuple_New(num_storage_blocks);
+
+	for (int i = 0; i < num_storage_blocks; ++i) {
+		int size = 0;
+		int name_len = 0;
+		char name[256];
+
+		GLenum prop = GL_BUFFER_DATA_SIZE;
+		gl.GetProgramResourceName(program_obj, GL_SHADER_STORAGE_BLOCK, i, 256, &name_len, name);
+		gl.GetProgramResourceiv(program_obj, GL_SHADER_STORAGE_BLOCK, i, 1, &prop, 1, 0, &size);
+
+		clean_glsl_name(name, name_len);
+
+		MGLUniformBlock * mglo = (MGLUniformBlock *)MGLUniformBlock_Type.tp_alloc(&MGLUniformBlock_Type, 0);
+
+		mglo->index = i;
+		mglo->size = size;
+		mglo->program_obj = program_obj;
+		mglo->storage_block = true;
+		mglo->gl = &gl;
+
+		PyObject * item = PyTuple_New(4);
+		PyTuple_SET_ITEM(item, 0, (PyObject *)mglo);
+		PyTuple_SET_ITEM(item, 1, PyLong_FromLong(i));
+		PyTuple_SET_ITEM(item, 2, PyLong_FromLong(size));
+		PyTuple_SET_ITEM(item, 3, PyUnicode_FromStringAndSize(name, name_len));
+
+		PyTuple_SET_ITEM(storage_blocks_lst, i, item);
+	}
+
+	return storage_blocks_lst;
+}
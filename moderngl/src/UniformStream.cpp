@@ -0,0 +1,280 @@
+#include "Types.hpp"
+
+PyObject * MGLContext_uniform_stream(MGLContext * self, PyObject * args) {
+	MGLBlockWriter * writer;
+	int capacity;
+	int binding;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"O!II",
+		&MGLBlockWriter_Type,
+		&writer,
+		&capacity,
+		&binding
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	const GLMethods & gl = self->gl;
+
+	int alignment = 256;
+	gl.GetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &alignment);
+
+	if (alignment < 1) {
+		alignment = 1;
+	}
+
+	int record_size = (writer->size + alignment - 1) / alignment * alignment;
+	int num_records = capacity / record_size;
+
+	if (num_records < UNIFORM_STREAM_SEGMENTS) {
+		MGLError_Set("the capacity must hold at least %d records of %d bytes", UNIFORM_STREAM_SEGMENTS, record_size);
+		return 0;
+	}
+
+	capacity = num_records * record_size;
+
+	int buffer_obj = 0;
+	gl.GenBuffers(1, (GLuint *)&buffer_obj);
+
+	if (!buffer_obj) {
+		MGLError_Set("cannot create buffer");
+		return 0;
+	}
+
+	char * mapped = 0;
+
+	gl.BindBuffer(GL_UNIFORM_BUFFER, buffer_obj);
+
+	if (self->version_code >= 440 && gl.BufferStorage) {
+		// Persistent coherent mapping, the records are written in place without map calls
+		const int flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+		gl.BufferStorage(GL_UNIFORM_BUFFER, capacity, 0, flags);
+		mapped = (char *)gl.MapBufferRange(GL_UNIFORM_BUFFER, 0, capacity, flags);
+	} else {
+		gl.BufferData(GL_UNIFORM_BUFFER, capacity, 0, GL_STREAM_DRAW);
+	}
+
+	MGLUniformStream * stream = (MGLUniformStream *)MGLUniformStream_Type.tp_alloc(&MGLUniformStream_Type, 0);
+
+	Py_INCREF(self);
+	stream->context = self;
+
+	Py_INCREF(writer);
+	stream->writer = writer;
+
+	stream->buffer_obj = buffer_obj;
+	stream->mapped = mapped;
+	stream->capacity = capacity;
+	stream->block_size = writer->size;
+	stream->record_size = record_size;
+	stream->records_per_segment = num_records / UNIFORM_STREAM_SEGMENTS;
+	stream->head = 0;
+	stream->current = -1;
+	stream->binding = binding;
+
+	Py_INCREF(stream);
+
+	PyObject * result = PyTuple_New(3);
+	PyTuple_SET_ITEM(result, 0, (PyObject *)stream);
+	PyTuple_SET_ITEM(result, 1, PyLong_FromLong(record_size));
+	PyTuple_SET_ITEM(result, 2, PyLong_FromLong(capacity));
+	return result;
+}
+
+PyObject * MGLUniformStream_tp_new(PyTypeObject * type, PyObject * args, PyObject * kwargs) {
+	MGLUniformStream * self = (MGLUniformStream *)type->tp_alloc(type, 0);
+
+	if (self) {
+	}
+
+	return (PyObject *)self;
+}
+
+void MGLUniformStream_tp_dealloc(MGLUniformStream * self) {
+	Py_TYPE(self)->tp_free((PyObject *)self);
+}
+
+inline int MGLUniformStream_segment(MGLUniformStream * self, int offset) {
+	int segment = offset / self->record_size / self->records_per_segment;
+	return segment < UNIFORM_STREAM_SEGMENTS ? segment : UNIFORM_STREAM_SEGMENTS - 1;
+}
+
+PyObject * MGLUniformStream_push(MGLUniformStream * self, PyObject * args) {
+	PyObject * values;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"O",
+		&values
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	const GLMethods & gl = self->context->gl;
+
+	int offset = self->head;
+
+	if (offset + self->record_size > self->capacity) {
+		offset = 0;
+	}
+
+	int segment = MGLUniformStream_segment(self, offset);
+	int previous_segment = self->current >= 0 ? MGLUniformStream_segment(self, self->current) : -1;
+
+	if (segment != previous_segment) {
+		// Fence the draws reading the segment we leave and wait for the draws reading the segment we enter
+		if (previous_segment >= 0) {
+			self->fences[previous_segment] = gl.FenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+		}
+
+		if (self->fences[segment]) {
+			gl.ClientWaitSync(self->fences[segment], GL_SYNC_FLUSH_COMMANDS_BIT, GL_TIMEOUT_IGNORED);
+			gl.DeleteSync(self->fences[segment]);
+			self->fences[segment] = 0;
+		}
+	}
+
+	bool success = false;
+
+	if (self->mapped) {
+		success = MGLBlockWriter_Pack(self->writer, self->mapped + offset, values);
+	} else {
+		const int flags = GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT;
+		gl.BindBuffer(GL_UNIFORM_BUFFER, self->buffer_obj);
+		char * map = (char *)gl.MapBufferRange(GL_UNIFORM_BUFFER, offset, self->record_size, flags);
+
+		if (!map) {
+			MGLError_Set("cannot map the buffer");
+			return 0;
+		}
+
+		success = MGLBlockWriter_Pack(self->writer, map, values);
+		gl.UnmapBuffer(GL_UNIFORM_BUFFER);
+	}
+
+	self->current = offset;
+	self->head = offset + self->record_size;
+
+	if (!success) {
+		return 0;
+	}
+
+	return PyLong_FromLong(offset);
+}
+
+PyObject * MGLUniformStream_bind(MGLUniformStream * self) {
+	if (self->current >= 0) {
+		const GLMethods & gl = self->context->gl;
+		gl.BindBufferRange(GL_UNIFORM_BUFFER, self->binding, self->buffer_obj, self->current, self->block_size);
+	}
+	Py_RETURN_NONE;
+}
+
+PyObject * MGLUniformStream_release(MGLUniformStream * self) {
+	MGLUniformStream_Invalidate(self);
+	Py_RETURN_NONE;
+}
+
+PyMethodDef MGLUniformStream_tp_methods[] = {
+	{"push", (PyCFunction)MGLUniformStream_push, METH_VARARGS, 0},
+	{"bind", (PyCFunction)MGLUniformStream_bind, METH_NOARGS, 0},
+	{"release", (PyCFunction)MGLUniformStream_release, METH_NOARGS, 0},
+	{0},
+};
+
+PyObject * MGLUniformStream_get_binding(MGLUniformStream * self, void * closure) {
+	return PyLong_FromLong(self->binding);
+}
+
+int MGLUniformStream_set_binding(MGLUniformStream * self, PyObject * value, void * closure) {
+	int binding = PyLong_AsUnsignedLong(value);
+
+	if (PyErr_Occurred()) {
+		MGLError_Set("invalid value for binding");
+		return -1;
+	}
+
+	self->binding = binding;
+	return 0;
+}
+
+PyGetSetDef MGLUniformStream_tp_getseters[] = {
+	{(char *)"binding", (getter)MGLUniformStream_get_binding, (setter)MGLUniformStream_set_binding, 0, 0},
+	{0},
+};
+
+PyTypeObject MGLUniformStream_Type = {
+	PyVarObject_HEAD_INIT(0, 0)
+	"mgl.UniformStream",                                    // tp_name
+	sizeof(MGLUniformStream),                               // tp_basicsize
+	0,                                                      // tp_itemsize
+	(destructor)MGLUniformStream_tp_dealloc,                // tp_dealloc
+	0,                                                      // tp_print
+	0,                                                      // tp_getattr
+	0,                                                      // tp_setattr
+	0,                                                      // tp_reserved
+	0,                                                      // tp_repr
+	0,                                                      // tp_as_number
+	0,                                                      // tp_as_sequence
+	0,                                                      // tp_as_mapping
+	0,                                                      // tp_hash
+	0,                                                      // tp_call
+	0,                                                      // tp_str
+	0,                                                      // tp_getattro
+	0,                                                      // tp_setattro
+	0,                                                      // tp_as_buffer
+	Py_TPFLAGS_DEFAULT,                                     // tp_flags
+	0,                                                      // tp_doc
+	0,                                                      // tp_traverse
+	0,                                                      // tp_clear
+	0,                                                      // tp_richcompare
+	0,                                                      // tp_weaklistoffset
+	0,                                                      // tp_iter
+	0,                                                      // tp_iternext
+	MGLUniformStream_tp_methods,                            // tp_methods
+	0,                                                      // tp_members
+	MGLUniformStream_tp_getseters,                          // tp_getset
+	0,                                                      // tp_base
+	0,                                                      // tp_dict
+	0,                                                      // tp_descr_get
+	0,                                                      // tp_descr_set
+	0,                                                      // tp_dictoffset
+	0,                                                      // tp_init
+	0,                                                      // tp_alloc
+	MGLUniformStream_tp_new,                                // tp_new
+};
+
+void MGLUniformStream_Invalidate(MGLUniformStream * stream) {
+	if (Py_TYPE(stream) == &MGLInvalidObject_Type) {
+		return;
+	}
+
+	const GLMethods & gl = stream->context->gl;
+
+	for (int i = 0; i < UNIFORM_STREAM_SEGMENTS; ++i) {
+		if (stream->fences[i]) {
+			gl.DeleteSync(stream->fences[i]);
+			stream->fences[i] = 0;
+		}
+	}
+
+	if (stream->mapped) {
+		gl.BindBuffer(GL_UNIFORM_BUFFER, stream->buffer_obj);
+		gl.UnmapBuffer(GL_UNIFORM_BUFFER);
+		stream->mapped = 0;
+	}
+
+	gl.DeleteBuffers(1, (GLuint *)&stream->buffer_obj);
+	stream->current = -1;
+
+	Py_SET_TYPE(stream, &MGLInvalidObject_Type);
+	Py_DECREF(stream->writer);
+	Py_DECREF(stream->context);
+	Py_DECREF(stream);
+}
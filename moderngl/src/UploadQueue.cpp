@@ -0,0 +1,368 @@
+#include <chrono>
+
+#include "Types.hpp"
+
+#include "InlineMethods.hpp"
+
+// Offsets of the staged images are aligned for every pixel type and compressed block size
+static const int UPLOAD_QUEUE_ALIGNMENT = 16;
+
+PyObject * MGLContext_upload_queue(MGLContext * self, PyObject * args) {
+	Py_ssize_t capacity;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"n",
+		&capacity
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	if (capacity < UPLOAD_QUEUE_ALIGNMENT) {
+		MGLError_Set("the staging size must be at least %d bytes", UPLOAD_QUEUE_ALIGNMENT);
+		return 0;
+	}
+
+	capacity = capacity / UPLOAD_QUEUE_ALIGNMENT * UPLOAD_QUEUE_ALIGNMENT;
+
+	const GLMethods & gl = self->gl;
+
+	MGLBuffer * staging = (MGLBuffer *)MGLBuffer_Type.tp_alloc(&MGLBuffer_Type, 0);
+
+	staging->size = capacity;
+	staging->dynamic = true;
+
+	staging->buffer_obj = 0;
+	gl.GenBuffers(1, (GLuint *)&staging->buffer_obj);
+
+	if (!staging->buffer_obj) {
+		MGLError_Set("cannot create buffer");
+		Py_DECREF(staging);
+		return 0;
+	}
+
+	char * mapped = 0;
+
+	gl.BindBuffer(GL_ARRAY_BUFFER, staging->buffer_obj);
+
+	if (self->version_code >= 440 && gl.BufferStorage) {
+		// Persistent coherent mapping, the images are copied in place without map calls
+		const int flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+		gl.BufferStorage(GL_ARRAY_BUFFER, capacity, 0, flags);
+		mapped = (char *)gl.MapBufferRange(GL_ARRAY_BUFFER, 0, capacity, flags);
+	} else {
+		gl.BufferData(GL_ARRAY_BUFFER, capacity, 0, GL_STREAM_DRAW);
+	}
+
+	Py_INCREF(self);
+	staging->context = self;
+
+	MGLContext_track_object(self, MGL_MEMORY_BUFFER, staging->memory, capacity);
+
+	MGLUploadQueue * queue = (MGLUploadQueue *)MGLUploadQueue_Type.tp_alloc(&MGLUploadQueue_Type, 0);
+
+	Py_INCREF(self);
+	queue->context = self;
+
+	queue->staging = staging;
+	queue->mapped = mapped;
+	queue->capacity = capacity;
+	queue->head = 0;
+	queue->first_slot = 0;
+	queue->num_slots = 0;
+	queue->uploads = 0;
+	queue->uploaded_bytes = 0;
+	queue->stalls = 0;
+	queue->stall_time = 0.0;
+
+	Py_INCREF(staging);
+	Py_INCREF(queue);
+
+	PyObject * result = PyTuple_New(3);
+	PyTuple_SET_ITEM(result, 0, (PyObject *)queue);
+	PyTuple_SET_ITEM(result, 1, (PyObject *)staging);
+	PyTuple_SET_ITEM(result, 2, PyLong_FromSsize_t(capacity));
+	return result;
+}
+
+PyObject * MGLUploadQueue_tp_new(PyTypeObject * type, PyObject * args, PyObject * kwargs) {
+	MGLUploadQueue * self = (MGLUploadQueue *)type->tp_alloc(type, 0);
+
+	if (self) {
+	}
+
+	return (PyObject *)self;
+}
+
+void MGLUploadQueue_tp_dealloc(MGLUploadQueue * self) {
+	Py_TYPE(self)->tp_free((PyObject *)self);
+}
+
+// Waits for the oldest pending upload and frees its slot
+void MGLUploadQueue_retire(MGLUploadQueue * self) {
+	const GLMethods & gl = self->context->gl;
+
+	GLsync fence = self->fences[self->first_slot];
+
+	if (fence) {
+		int status = gl.ClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 0);
+
+		if (status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED) {
+			std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+			gl.ClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, GL_TIMEOUT_IGNORED);
+			self->stall_time += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+			self->stalls += 1;
+		}
+
+		gl.DeleteSync(fence);
+		self->fences[self->first_slot] = 0;
+	}
+
+	self->first_slot = (self->first_slot + 1) % UPLOAD_QUEUE_SLOTS;
+	self->num_slots -= 1;
+}
+
+// Frees the slots of the uploads the GPU already finished without waiting
+void MGLUploadQueue_retire_completed(MGLUploadQueue * self) {
+	const GLMethods & gl = self->context->gl;
+
+	while (self->num_slots) {
+		GLsync fence = self->fences[self->first_slot];
+
+		if (!fence) {
+			break;
+		}
+
+		int status = gl.ClientWaitSync(fence, 0, 0);
+
+		if (status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED) {
+			break;
+		}
+
+		MGLUploadQueue_retire(self);
+	}
+}
+
+PyObject * MGLUploadQueue_stage(MGLUploadQueue * self, PyObject * args) {
+	PyObject * data;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"O",
+		&data
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	Py_buffer buffer_view;
+
+	int get_buffer = PyObject_GetBuffer(data, &buffer_view, PyBUF_SIMPLE);
+	if (get_buffer < 0) {
+		// Propagate the default error
+		return 0;
+	}
+
+	Py_ssize_t size = buffer_view.len;
+
+	if (size > self->capacity) {
+		MGLError_Set("the data is larger than the staging buffer %zd > %zd", size, self->capacity);
+		PyBuffer_Release(&buffer_view);
+		return 0;
+	}
+
+	const GLMethods & gl = self->context->gl;
+
+	// The claimed range starts at the head, wrapping around also claims the tail of the buffer
+	Py_ssize_t offset = (self->head + UPLOAD_QUEUE_ALIGNMENT - 1) / UPLOAD_QUEUE_ALIGNMENT * UPLOAD_QUEUE_ALIGNMENT;
+	Py_ssize_t claim_begin = self->head;
+	Py_ssize_t claim_wrap = 0;
+
+	if (offset + size > self->capacity) {
+		offset = 0;
+		claim_wrap = size;
+	}
+
+	Py_ssize_t claim_end = claim_wrap ? self->capacity : offset + size;
+
+	while (self->num_slots) {
+		Py_ssize_t begin = self->slot_begin[self->first_slot];
+		Py_ssize_t end = self->slot_end[self->first_slot];
+
+		bool overlaps = (begin < claim_end && end > claim_begin) || begin < claim_wrap;
+
+		if (!overlaps && self->num_slots < UPLOAD_QUEUE_SLOTS) {
+			break;
+		}
+
+		MGLUploadQueue_retire(self);
+	}
+
+	if (self->mapped) {
+		memcpy(self->mapped + offset, buffer_view.buf, size);
+	} else if (size) {
+		// Unsynchronized is safe, the fences above guarantee the range is no longer read
+		const int flags = GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT;
+		gl.BindBuffer(GL_ARRAY_BUFFER, self->staging->buffer_obj);
+		char * map = (char *)gl.MapBufferRange(GL_ARRAY_BUFFER, offset, size, flags);
+
+		if (!map) {
+			MGLError_Set("cannot map the buffer");
+			PyBuffer_Release(&buffer_view);
+			return 0;
+		}
+
+		memcpy(map, buffer_view.buf, size);
+		gl.UnmapBuffer(GL_ARRAY_BUFFER);
+	}
+
+	PyBuffer_Release(&buffer_view);
+
+	int slot = (self->first_slot + self->num_slots) % UPLOAD_QUEUE_SLOTS;
+	self->slot_begin[slot] = offset;
+	self->slot_end[slot] = offset + size;
+	self->fences[slot] = 0;
+	self->num_slots += 1;
+
+	self->head = offset + size;
+	self->uploads += 1;
+	self->uploaded_bytes += size;
+
+	return PyLong_FromSsize_t(offset);
+}
+
+PyObject * MGLUploadQueue_fence(MGLUploadQueue * self) {
+	if (self->num_slots) {
+		int slot = (self->first_slot + self->num_slots - 1) % UPLOAD_QUEUE_SLOTS;
+
+		if (!self->fences[slot]) {
+			const GLMethods & gl = self->context->gl;
+			self->fences[slot] = gl.FenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+		}
+	}
+
+	Py_RETURN_NONE;
+}
+
+PyObject * MGLUploadQueue_finish(MGLUploadQueue * self) {
+	while (self->num_slots) {
+		MGLUploadQueue_retire(self);
+	}
+
+	Py_RETURN_NONE;
+}
+
+PyObject * MGLUploadQueue_release(MGLUploadQueue * self) {
+	MGLUploadQueue_Invalidate(self);
+	Py_RETURN_NONE;
+}
+
+PyMethodDef MGLUploadQueue_tp_methods[] = {
+	{"stage", (PyCFunction)MGLUploadQueue_stage, METH_VARARGS, 0},
+	{"fence", (PyCFunction)MGLUploadQueue_fence, METH_NOARGS, 0},
+	{"finish", (PyCFunction)MGLUploadQueue_finish, METH_NOARGS, 0},
+	{"release", (PyCFunction)MGLUploadQueue_release, METH_NOARGS, 0},
+	{0},
+};
+
+PyObject * MGLUploadQueue_get_pending(MGLUploadQueue * self, void * closure) {
+	MGLUploadQueue_retire_completed(self);
+	return PyLong_FromLong(self->num_slots);
+}
+
+PyObject * MGLUploadQueue_get_uploads(MGLUploadQueue * self, void * closure) {
+	return PyLong_FromLongLong(self->uploads);
+}
+
+PyObject * MGLUploadQueue_get_uploaded_bytes(MGLUploadQueue * self, void * closure) {
+	return PyLong_FromLongLong(self->uploaded_bytes);
+}
+
+PyObject * MGLUploadQueue_get_stalls(MGLUploadQueue * self, void * closure) {
+	return PyLong_FromLongLong(self->stalls);
+}
+
+PyObject * MGLUploadQueue_get_stall_time(MGLUploadQueue * self, void * closure) {
+	return PyFloat_FromDouble(self->stall_time);
+}
+
+PyGetSetDef MGLUploadQueue_tp_getseters[] = {
+	{(char *)"pending", (getter)MGLUploadQueue_get_pending, 0, 0, 0},
+	{(char *)"uploads", (getter)MGLUploadQueue_get_uploads, 0, 0, 0},
+	{(char *)"uploaded_bytes", (getter)MGLUploadQueue_get_uploaded_bytes, 0, 0, 0},
+	{(char *)"stalls", (getter)MGLUploadQueue_get_stalls, 0, 0, 0},
+	{(char *)"stall_time", (getter)MGLUploadQueue_get_stall_time, 0, 0, 0},
+	{0},
+};
+
+PyTypeObject MGLUploadQueue_Type = {
+	PyVarObject_HEAD_INIT(0, 0)
+	"mgl.UploadQueue",                                      // tp_name
+	sizeof(MGLUploadQueue),                                 // tp_basicsize
+	0,                                                      // tp_itemsize
+	(destructor)MGLUploadQueue_tp_dealloc,                  // tp_dealloc
+	0,                                                      // tp_print
+	0,                                                      // tp_getattr
+	0,                                                      // tp_setattr
+	0,                                                      // tp_reserved
+	0,                                                      // tp_repr
+	0,                                                      // tp_as_number
+	0,                                                      // tp_as_sequence
+	0,                                                      // tp_as_mapping
+	0,                                                      // tp_hash
+	0,                                                      // tp_call
+	0,                                                      // tp_str
+	0,                                                      // tp_getattro
+	0,                                                      // tp_setattro
+	0,                                                      // tp_as_buffer
+	Py_TPFLAGS_DEFAULT,                                     // tp_flags
+	0,                                                      // tp_doc
+	0,                                                      // tp_traverse
+	0,                                                      // tp_clear
+	0,                                                      // tp_richcompare
+	0,                                                      // tp_weaklistoffset
+	0,                                                      // tp_iter
+	0,                                                      // tp_iternext
+	MGLUploadQueue_tp_methods,                              // tp_methods
+	0,                                                      // tp_members
+	MGLUploadQueue_tp_getseters,                            // tp_getset
+	0,                                                      // tp_base
+	0,                                                      // tp_dict
+	0,                                                      // tp_descr_get
+	0,                                                      // tp_descr_set
+	0,                                                      // tp_dictoffset
+	0,                                                      // tp_init
+	0,                                                      // tp_alloc
+	MGLUploadQueue_tp_new,                                  // tp_new
+};
+
+void MGLUploadQueue_Invalidate(MGLUploadQueue * queue) {
+	if (Py_TYPE(queue) == &MGLInvalidObject_Type) {
+		return;
+	}
+
+	const GLMethods & gl = queue->context->gl;
+
+	for (int i = 0; i < UPLOAD_QUEUE_SLOTS; ++i) {
+		if (queue->fences[i]) {
+			gl.DeleteSync(queue->fences[i]);
+			queue->fences[i] = 0;
+		}
+	}
+
+	if (queue->mapped) {
+		gl.BindBuffer(GL_ARRAY_BUFFER, queue->staging->buffer_obj);
+		gl.UnmapBuffer(GL_ARRAY_BUFFER);
+		queue->mapped = 0;
+	}
+
+	MGLBuffer_Invalidate(queue->staging);
+	queue->num_slots = 0;
+
+	Py_SET_TYPE(queue, &MGLInvalidObject_Type);
+	Py_DECREF(queue->context);
+	Py_DECREF(queue);
+}
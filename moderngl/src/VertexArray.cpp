@@ -1,6 +1,7 @@
 #include "Types.hpp"
 
 #include "BufferFormat.hpp"
+#include "InlineMethods.hpp"
 
 typedef void (GLAPI * gl_attribute_normal_ptr_proc)(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void * pointer);
 typedef void (GLAPI * gl_attribute_ptr_proc)(GLuint index, GLint size, GLenum type, GLsizei stride, const void * pointer);
@@ -235,6 +236,7 @@ void MGLVertexArray_tp_dealloc(MGLVertexArray * self) {
 }
 
 inline void MGLVertexArray_SET_SUBROUTINES(MGLVertexArray * self, const GLMethods & gl);
+inline void MGLVertexArray_SET_UNIFORM_STREAM(MGLVertexArray * self, const GLMethods & gl);
 
 PyObject * MGLVertexArray_render(MGLVertexArray * self, PyObject * args) {
 	int mode;
@@ -270,10 +272,11 @@ PyObject * MGLVertexArray_render(MGLVertexArray * self, PyObject * args) {
 
 	const GLMethods & gl = self->context->gl;
 
-	gl.UseProgram(self->program->program_obj);
+	MGLContext_use_program(self->context, self->program->program_obj);
 	gl.BindVertexArray(self->vertex_array_obj);
 
 	MGLVertexArray_SET_SUBROUTINES(self, gl);
+	MGLVertexArray_SET_UNIFORM_STREAM(self, gl);
 
 	if (self->index_buffer != (MGLBuffer *)Py_None) {
 		const void * ptr = (const void *)((GLintptr)first * self->index_element_size);
@@ -311,11 +314,12 @@ PyObject * MGLVertexArray_render_indirect(MGLVertexArray * self, PyObject * args
 
 	const GLMethods & gl = self->context->gl;
 
-	gl.UseProgram(self->program->program_obj);
+	MGLContext_use_program(self->context, self->program->program_obj);
 	gl.BindVertexArray(self->vertex_array_obj);
 	gl.BindBuffer(GL_DRAW_INDIRECT_BUFFER, buffer->buffer_obj);
 
 	MGLVertexArray_SET_SUBROUTINES(self, gl);
+	MGLVertexArray_SET_UNIFORM_STREAM(self, gl);
 
 	const void * ptr = (const void *)((GLintptr)first * 20);
 
@@ -445,7 +449,7 @@ PyObject * MGLVertexArray_transform(MGLVertexArray * self, PyObject * args) {
 
 	const GLMethods & gl = self->context->gl;
 
-	gl.UseProgram(self->program->program_obj);
+	MGLContext_use_program(self->context, self->program->program_obj);
 	gl.BindVertexArray(self->vertex_array_obj);
 
 	if (buffer_offset > 0) {
@@ -458,6 +462,7 @@ PyObject * MGLVertexArray_transform(MGLVertexArray * self, PyObject * args) {
 	gl.BeginTransformFeedback(output_mode);
 
 	MGLVertexArray_SET_SUBROUTINES(self, gl);
+	MGLVertexArray_SET_UNIFORM_STREAM(self, gl);
 
 	if (self->index_buffer != (MGLBuffer *)Py_None) {
 		const void * ptr = (const void *)((GLintptr)first * self->index_element_size);
@@ -614,6 +619,24 @@ int MGLVertexArray_set_instances(MGLVertexArray * self, PyObject * value, void *
 	return 0;
 }
 
+int MGLVertexArray_set_uniform_stream(MGLVertexArray * self, PyObject * value, void * closure) {
+	if (value != Py_None && Py_TYPE(value) != &MGLUniformStream_Type) {
+		MGLError_Set("the uniform_stream must be a UniformStream not %s", Py_TYPE(value)->tp_name);
+		return -1;
+	}
+
+	Py_XDECREF(self->uniform_stream);
+
+	if (value == Py_None) {
+		self->uniform_stream = 0;
+	} else {
+		Py_INCREF(value);
+		self->uniform_stream = (MGLUniformStream *)value;
+	}
+
+	return 0;
+}
+
 int MGLVertexArray_set_subroutines(MGLVertexArray * self, PyObject * value, void * closure) {
 	if (PyTuple_GET_SIZE(value) != self->num_subroutines) {
 		MGLError_Set("the number of subroutines is %d not %d", self->num_subroutines, PyTuple_GET_SIZE(value));
@@ -648,6 +671,7 @@ PyGetSetDef MGLVertexArray_tp_getseters[] = {
 	{(char *)"vertices", (getter)MGLVertexArray_get_vertices, (setter)MGLVertexArray_set_vertices, 0, 0},
 	{(char *)"instances", (getter)MGLVertexArray_get_instances, (setter)MGLVertexArray_set_instances, 0, 0},
 	{(char *)"subroutines", 0, (setter)MGLVertexArray_set_subroutines, 0, 0},
+	{(char *)"uniform_stream", 0, (setter)MGLVertexArray_set_uniform_stream, 0, 0},
 	{0},
 };
 
@@ -705,6 +729,7 @@ void MGLVertexArray_Invalidate(MGLVertexArray * array) {
 	Py_SET_TYPE(array, &MGLInvalidObject_Type);
 	Py_DECREF(array->program);
 	Py_XDECREF(array->index_buffer);
+	Py_XDECREF(array->uniform_stream);
 	Py_DECREF(array);
 }
 
@@ -724,7 +749,23 @@ void MGLVertexArray_Complete(MGLVertexArray * vertex_array) {
 }
 
 inline void MGLVertexArray_SET_SUBROUTINES(MGLVertexArray * self, const GLMethods & gl) {
-		if (self->subroutines) {
+	if (self->subroutines) {
+		MGLContext * ctx = self->context;
+
+		// The context keeps the subroutines applied since the last UseProgram of the bound program
+		if (ctx->num_bound_subroutines == self->num_subroutines && !memcmp(ctx->bound_subroutines, self->subroutines, self->num_subroutines * sizeof(unsigned))) {
+			return;
+		}
+
+		if (ctx->bound_subroutines_capacity < self->num_subroutines) {
+			delete[] ctx->bound_subroutines;
+			ctx->bound_subroutines = new unsigned[self->num_subroutines];
+			ctx->bound_subroutines_capacity = self->num_subroutines;
+		}
+
+		memcpy(ctx->bound_subroutines, self->subroutines, self->num_subroutines * sizeof(unsigned));
+		ctx->num_bound_subroutines = self->num_subroutines;
+
 		unsigned * subroutines = self->subroutines;
 
 		if (self->program->num_vertex_shader_subroutines) {
@@ -772,3 +813,10 @@ inline void MGLVertexArray_SET_SUBROUTINES(MGLVertexArray * self, const GLMethod
 		}
 	}
 }
+
+inline void MGLVertexArray_SET_UNIFORM_STREAM(MGLVertexArray * self, const GLMethods & gl) {
+	MGLUniformStream * stream = self->uniform_stream;
+	if (stream && stream->current >= 0) {
+		gl.BindBufferRange(GL_UNIFORM_BUFFER, stream->binding, stream->buffer_obj, stream->current, stream->block_size);
+	}
+}
@@ -1,8 +1,10 @@
 from typing import Any, Optional, Tuple, Union
 
+from moderngl import mgl  # type: ignore
 from moderngl.mgl import InvalidObject  # type: ignore
 
 from .buffer import Buffer
+from .pixel_format import _pixel_transfer
 
 __all__ = ['Texture',
            'NEAREST', 'LINEAR', 'NEAREST_MIPMAP_NEAREST', 'LINEAR_MIPMAP_NEAREST', 'NEAREST_MIPMAP_LINEAR',
@@ -54,7 +56,9 @@ class Texture:
     to create one.
     """
 
-    __slots__ = ['mglo', '_size', '_components', '_samples', '_dtype', '_depth', '_glo', 'ctx', 'extra']
+    __slots__ = [
+        'mglo', '_size', '_components', '_samples', '_dtype', '_depth', '_depth_format', '_glo', 'ctx', 'extra',
+    ]
 
     def __init__(self):
         self.mglo = None  #: Internal representation for debug purposes only.
@@ -63,6 +67,7 @@ class Texture:
         self._samples = None
         self._dtype = None
         self._depth = None
+        self._depth_format = None
         self._glo = None
         self.ctx = None  #: The context this object belongs to
         self.extra = None  #: Any - Attribute for storing user defined objects
@@ -268,7 +273,7 @@ class Texture:
 
     @property
     def dtype(self) -> str:
-        """str: Data type."""
+        """str: Data type, the pixel type read and written by a depth texture."""
         return self._dtype
 
     @property
@@ -276,6 +281,11 @@ class Texture:
         """bool: Is the texture a depth texture?."""
         return self._depth
 
+    @property
+    def depth_format(self) -> Optional[str]:
+        """str: The depth format ``d16``, ``d24``, ``d32f``, ``d24s8`` or ``d32fs8``, None for color textures."""
+        return self._depth_format
+
     @property
     def glo(self) -> int:
         """
@@ -301,6 +311,8 @@ class Texture:
         Returns:
             bytes
         """
+        if self.ctx._residency is not None:
+            self.ctx._residency.touch(self)
         return self.mglo.read(level, alignment)
 
     def read_into(
@@ -309,7 +321,13 @@ class Texture:
         *,
         level: int = 0,
         alignment: int = 1,
+        row_length: int = 0,
+        skip_pixels: int = 0,
+        skip_rows: int = 0,
         write_offset: int = 0,
+        dst_dtype: Optional[str] = None,
+        dst_layout: Optional[str] = None,
+        flip: bool = False,
     ) -> None:
         """
         Read the content of the texture into a bytearray or :py:class:`~moderngl.Buffer`.
@@ -327,18 +345,46 @@ class Texture:
             texture = ctx.texture((2, 2), 1)
             texture.read_into(data)
 
+        ``dst_dtype``, ``dst_layout`` and ``flip`` convert the pixels of ``f1``, ``f2`` and ``f4``
+        textures while they are copied into the buffer, see :py:func:`convert_pixels`::
+
+            # Top-down BGRA rows for a video encoder
+            texture.read_into(frame, dst_layout='bgra', flip=True)
+
         Args:
             buffer (Union[bytearray, Buffer]): The buffer that will receive the pixels.
 
         Keyword Args:
             level (int): The mipmap level.
             alignment (int): The byte alignment of the pixels.
+            row_length (int): The number of pixels in a row of the client memory, 0 uses the width.
+            skip_pixels (int): The number of pixels skipped at the start of each row.
+            skip_rows (int): The number of rows skipped at the start of the client memory.
             write_offset (int): The write offset.
+            dst_dtype (str): The dtype of the pixels written to the buffer, defaults to the texture dtype.
+            dst_layout (str): The channel layout of the pixels written to the buffer.
+            flip (bool): Flip the image vertically.
         """
+        if self.ctx._residency is not None:
+            self.ctx._residency.touch(self)
+        if dst_dtype is not None or dst_layout is not None or flip:
+            size = (max(self.width >> level, 1), max(self.height >> level, 1))
+            src = _pixel_transfer(size[0], self._dtype, None, self._components)
+            dst = _pixel_transfer(
+                size[0], dst_dtype or self._dtype, dst_layout, self._components,
+                alignment, row_length, skip_pixels, skip_rows,
+            )
+            data = self.mglo.read(level, 1)
+            if type(buffer) is Buffer:
+                buffer.write(mgl.convert_pixels(data, None, size, src, dst, flip), offset=write_offset)
+            else:
+                mgl.convert_pixels(data, buffer, size, src, dst[:3] + (dst[3] + write_offset, dst[4]), flip)
+            return
+
         if type(buffer) is Buffer:
             buffer = buffer.mglo
 
-        return self.mglo.read_into(buffer, level, alignment, write_offset)
+        return self.mglo.read_into(buffer, level, alignment, (row_length, skip_pixels, skip_rows, 0), write_offset)
 
     def write(
         self,
@@ -347,6 +393,12 @@ class Texture:
         *,
         level: int = 0,
         alignment: int = 1,
+        row_length: int = 0,
+        skip_pixels: int = 0,
+        skip_rows: int = 0,
+        src_dtype: Optional[str] = None,
+        src_layout: Optional[str] = None,
+        flip: bool = False,
     ) -> None:
         r"""
         Update the content of the texture from byte data or a moderngl :py:class:`~moderngl.Buffer`.
@@ -368,6 +420,13 @@ class Texture:
             # Fill the lower left 50x50 pixels with new data
             texture.write(data, viewport=(0, 0, 50, 50))
 
+        ``src_dtype``, ``src_layout`` and ``flip`` convert host pixels to the dtype of
+        ``f1``, ``f2`` and ``f4`` textures before the upload, see :py:func:`convert_pixels`::
+
+            # float32 RGB pixels into a half float RGBA texture
+            texture = ctx.texture((512, 512), 4, dtype='f2')
+            texture.write(pixels, src_dtype='f4', src_layout='rgb')
+
         Args:
             data (Union[bytes, Buffer]): The pixel data.
             viewport (tuple): The sub-section of the texture to update
@@ -377,23 +436,88 @@ class Texture:
         Keyword Args:
             level (int): The mipmap level.
             alignment (int): The byte alignment of the pixels.
+            row_length (int): The number of pixels in a row of the client memory, 0 uses the width.
+            skip_pixels (int): The number of pixels skipped at the start of each row.
+            skip_rows (int): The number of rows skipped at the start of the client memory.
+            src_dtype (str): The dtype of the data, defaults to the texture dtype.
+            src_layout (str): The channel layout of the data.
+            flip (bool): Flip the image vertically.
         """
+        if self.ctx._residency is not None:
+            self.ctx._residency.touch(self)
+        if src_dtype is not None or src_layout is not None or flip:
+            if type(data) is Buffer:
+                raise ValueError('pixel conversions require the data in host memory')
+
+            if viewport is None:
+                size = (max(self.width >> level, 1), max(self.height >> level, 1))
+            else:
+                size = tuple(viewport[-2:])
+
+            src = _pixel_transfer(
+                size[0], src_dtype or self._dtype, src_layout, self._components,
+                alignment, row_length, skip_pixels, skip_rows,
+            )
+            dst = _pixel_transfer(size[0], self._dtype, None, self._components)
+            data = mgl.convert_pixels(data, None, size, src, dst, flip)
+            alignment, row_length, skip_pixels, skip_rows = 1, 0, 0, 0
+
         if type(data) is Buffer:
             data = data.mglo
 
-        self.mglo.write(data, viewport, level, alignment)
+        self.mglo.write(data, viewport, level, alignment, (row_length, skip_pixels, skip_rows, 0), 0, -1)
 
-    def build_mipmaps(self, base: int = 0, max_level: int = 1000) -> None:
+    def clear(
+        self,
+        value: Any = 0,
+        *,
+        level: int = 0,
+        viewport: Optional[Union[Tuple[int, int], Tuple[int, int, int, int]]] = None,
+    ) -> None:
+        """
+        Clear the texture without a framebuffer using ``glClearTexImage``.
+
+        Textures with an integer ``dtype`` take integers, the other ones take floats.
+        A single number is used for every component. Requires OpenGL 4.4.
+
+        .. code-block:: python
+
+            texture = ctx.texture((256, 256), 4)
+            texture.clear((1.0, 0.0, 0.0, 1.0))
+
+            counters = ctx.texture((64, 64), 1, dtype='u4')
+            counters.clear(0, viewport=(0, 0, 32, 32))
+
+        Args:
+            value: A number or a sequence with a value for every component.
+
+        Keyword Args:
+            level (int): The mipmap level.
+            viewport (tuple): The region to clear, ``(width, height)`` or ``(x, y, width, height)``.
+        """
+        self.mglo.clear(value, level, viewport)
+
+    def build_mipmaps(self, base: int = 0, max_level: int = 1000, *, method: str = 'box', cpu: bool = False) -> None:
         """
         Generate mipmaps.
 
         This also changes the texture filter to ``LINEAR_MIPMAP_LINEAR, LINEAR``
 
+        Integer textures get the ``NEAREST_MIPMAP_NEAREST, NEAREST`` filter instead.
+        The driver cannot filter integer textures, with ``cpu=True`` the levels are
+        reduced on the CPU and uploaded in a single pass. The ``'min'`` and ``'max'`` methods
+        keep the smallest or largest texel of each footprint and build conservative
+        depth pyramids, ``'kaiser'`` is a sharper windowed sinc filter.
+
         Keyword Args:
             base (int): The base level
             max_level (int): The maximum levels to generate
+            method (str): ``'box'``, ``'min'``, ``'max'`` or ``'kaiser'``, only ``'box'`` is available on the GPU
+            cpu (bool): Build the levels on the CPU
         """
-        self.mglo.build_mipmaps(base, max_level)
+        if self.ctx._residency is not None:
+            self.ctx._residency.touch(self)
+        self.mglo.build_mipmaps(base, max_level, method, cpu)
 
     def use(self, location: int = 0) -> None:
         """
@@ -414,6 +538,8 @@ class Texture:
         Args:
             location (int): The texture location/unit.
         """
+        if self.ctx._residency is not None:
+            self.ctx._residency.touch(self)
         self.mglo.use(location)
 
     def bind_to_image(self, unit: int, read: bool = True, write: bool = True, level: int = 0, format: int = 0) -> None:
@@ -455,8 +581,63 @@ class Texture:
             level (int): Level of the texture to bind (default: ``0``).
             format (int): (optional) The OpenGL enum value representing the format (defaults to the texture's format)
         """
+        if self.ctx._residency is not None:
+            self.ctx._residency.touch(self)
         self.mglo.bind(unit, read, write, level, format)
 
+    def view(
+        self,
+        *,
+        dtype: Optional[str] = None,
+        components: Optional[int] = None,
+        levels: Optional[Tuple[int, int]] = None,
+    ) -> 'Texture':
+        """
+        Create a texture sharing the storage of this texture (OpenGL 4.3 required).
+
+        The view is created with ``glTextureView`` and works like any other texture.
+        Writes through the view are visible in this texture and the other way around.
+        Only textures with immutable storage can be viewed.
+
+        The ``dtype`` and ``components`` reinterpret the pixels without a copy,
+        the pixel size must stay the same. For example an ``f1`` texture with 4 components
+        can be viewed as a ``u4`` texture with 1 component. Depth and compressed
+        textures can only be viewed with their own format.
+
+        .. code-block:: python
+
+            texture = ctx.texture((256, 256), 4, immutable=True)
+            counters = texture.view(dtype='u4', components=1)
+            counters.bind_to_image(0)
+
+            # The second mip level as a 128x128 texture
+            mip = texture.view(levels=(1, 1))
+
+        Keyword Args:
+            dtype (str): The data type of the view. Defaults to the dtype of this texture.
+            components (int): The number of components of the view.
+            levels (tuple): The first level and the number of levels. Defaults to all of them.
+
+        Returns:
+            :py:class:`Texture` object
+        """
+        # Depth textures are viewed with their depth format
+        dtype = (self._depth_format or self._dtype) if dtype is None else dtype
+        components = self._components if components is None else components
+        first = levels[0] if levels is not None else 0
+
+        res = Texture.__new__(Texture)
+        res.mglo, res._glo = self.mglo.view(dtype, components, levels)
+        res._size = (max(self.width >> first, 1), max(self.height >> first, 1))
+        res._components = components
+        res._samples = self._samples
+        res._dtype = self._dtype if self._depth else dtype
+        res._depth = self._depth
+        res._depth_format = self._depth_format
+        res.ctx = self.ctx
+        res.extra = None
+        return res
+
     def release(self) -> None:
         """Release the ModernGL object."""
         if not isinstance(self.mglo, InvalidObject):
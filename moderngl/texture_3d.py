@@ -191,23 +191,41 @@ class Texture3D:
         """
         return self._glo
 
-    def read(self, *, alignment: int = 1) -> bytes:
+    def read(
+        self,
+        *,
+        viewport: Optional[Union[Tuple[int, int, int], Tuple[int, int, int, int, int, int]]] = None,
+        level: int = 0,
+        alignment: int = 1,
+    ) -> bytes:
         """
         Read the pixel data as bytes into system memory.
 
         Keyword Args:
+            viewport (tuple): The sub-region to read, ``(width, height, depth)`` or
+                              ``(x, y, z, width, height, depth)``.
+                              Reading a sub-region requires OpenGL 4.5.
+            level (int): The mipmap level.
             alignment (int): The byte alignment of the pixels.
 
         Returns:
             bytes
         """
-        return self.mglo.read(alignment)
+        if self.ctx._residency is not None:
+            self.ctx._residency.touch(self)
+        return self.mglo.read(viewport, level, alignment)
 
     def read_into(
         self,
         buffer: Any,
         *,
+        viewport: Optional[Union[Tuple[int, int, int], Tuple[int, int, int, int, int, int]]] = None,
+        level: int = 0,
         alignment: int = 1,
+        row_length: int = 0,
+        skip_pixels: int = 0,
+        skip_rows: int = 0,
+        image_height: int = 0,
         write_offset: int = 0,
     ) -> None:
         """
@@ -230,20 +248,35 @@ class Texture3D:
             buffer (Union[bytearray, Buffer]): The buffer that will receive the pixels.
 
         Keyword Args:
+            viewport (tuple): The sub-region to read, ``(width, height, depth)`` or
+                              ``(x, y, z, width, height, depth)``.
+                              Reading a sub-region requires OpenGL 4.5.
+            level (int): The mipmap level.
             alignment (int): The byte alignment of the pixels.
+            row_length (int): The number of pixels in a row of the client memory, 0 uses the width.
+            skip_pixels (int): The number of pixels skipped at the start of each row.
+            skip_rows (int): The number of rows skipped at the start of the client memory.
+            image_height (int): The number of rows in an image of the client memory, 0 uses the height.
             write_offset (int): The write offset.
         """
+        if self.ctx._residency is not None:
+            self.ctx._residency.touch(self)
         if type(buffer) is Buffer:
             buffer = buffer.mglo
 
-        return self.mglo.read_into(buffer, alignment, write_offset)
+        return self.mglo.read_into(buffer, viewport, level, alignment, (row_length, skip_pixels, skip_rows, image_height), write_offset)
 
     def write(
         self,
         data: Any,
         viewport: Optional[Union[Tuple[int, int, int], Tuple[int, int, int, int, int, int]]] = None,
         *,
+        level: int = 0,
         alignment: int = 1,
+        row_length: int = 0,
+        skip_pixels: int = 0,
+        skip_rows: int = 0,
+        image_height: int = 0,
     ) -> None:
         r"""
         Update the content of the texture from byte data or a moderngl :py:class:`~moderngl.Buffer`.
@@ -265,25 +298,71 @@ class Texture3D:
             viewport (tuple): The viewport.
 
         Keyword Args:
+            level (int): The mipmap level.
             alignment (int): The byte alignment of the pixels.
+            row_length (int): The number of pixels in a row of the client memory, 0 uses the width.
+            skip_pixels (int): The number of pixels skipped at the start of each row.
+            skip_rows (int): The number of rows skipped at the start of the client memory.
+            image_height (int): The number of rows in an image of the client memory, 0 uses the height.
         """
+        if self.ctx._residency is not None:
+            self.ctx._residency.touch(self)
         if type(data) is Buffer:
             data = data.mglo
 
-        self.mglo.write(data, viewport, alignment)
+        self.mglo.write(data, viewport, level, alignment, (row_length, skip_pixels, skip_rows, image_height), 0, -1)
+
+    def clear(
+        self,
+        value: Any = 0,
+        *,
+        level: int = 0,
+        viewport: Optional[Union[Tuple[int, int, int], Tuple[int, int, int, int, int, int]]] = None,
+    ) -> None:
+        """
+        Clear the texture without a framebuffer using ``glClearTexImage``.
+
+        Textures with an integer ``dtype`` take integers, the other ones take floats.
+        A single number is used for every component. Requires OpenGL 4.4.
+
+        .. code-block:: python
+
+            volume = ctx.texture3d((64, 64, 64), 1, dtype='f2')
+            volume.clear(0.5)
+
+        Args:
+            value: A number or a sequence with a value for every component.
 
-    def build_mipmaps(self, base: int = 0, max_level: int = 1000) -> None:
+        Keyword Args:
+            level (int): The mipmap level.
+            viewport (tuple): The region to clear, ``(width, height, depth)`` or
+                              ``(x, y, z, width, height, depth)``.
+        """
+        self.mglo.clear(value, level, viewport)
+
+    def build_mipmaps(self, base: int = 0, max_level: int = 1000, *, method: str = 'box', cpu: bool = False) -> None:
         """
         Generate mipmaps.
 
         This also changes the texture filter to ``LINEAR_MIPMAP_LINEAR, LINEAR``
         (Will be removed in ``6.x``)
 
+        Integer textures get the ``NEAREST_MIPMAP_NEAREST, NEAREST`` filter instead.
+        The driver cannot filter integer textures, with ``cpu=True`` the levels are
+        reduced on the CPU and uploaded in a single pass. The ``'min'`` and ``'max'`` methods
+        keep the smallest or largest texel of each footprint and build conservative
+        depth pyramids, ``'kaiser'`` is a sharper windowed sinc filter.
+        The depth is reduced together with the width and height.
+
         Keyword Args:
             base (int): The base level
             max_level (int): The maximum levels to generate
+            method (str): ``'box'``, ``'min'``, ``'max'`` or ``'kaiser'``, only ``'box'`` is available on the GPU
+            cpu (bool): Build the levels on the CPU
         """
-        self.mglo.build_mipmaps(base, max_level)
+        if self.ctx._residency is not None:
+            self.ctx._residency.touch(self)
+        self.mglo.build_mipmaps(base, max_level, method, cpu)
 
     def use(self, location: int = 0) -> None:
         """
@@ -304,6 +383,8 @@ class Texture3D:
         Args:
             location (int): The texture location/unit.
         """
+        if self.ctx._residency is not None:
+            self.ctx._residency.touch(self)
         self.mglo.use(location)
 
     def bind_to_image(self, unit: int, read: bool = True, write: bool = True, level: int = 0, format: int = 0) -> None:
@@ -349,6 +430,8 @@ class Texture3D:
             level (int): Level of the texture to bind (default: ``0``).
             format (int): (optional) The OpenGL enum value representing the format (defaults to the texture's format)
         """
+        if self.ctx._residency is not None:
+            self.ctx._residency.touch(self)
         self.mglo.bind(unit, read, write, level, format)
 
     def release(self) -> None:
@@ -3,6 +3,7 @@ from typing import Any, Optional, Tuple, Union
 from moderngl.mgl import InvalidObject  # type: ignore
 
 from .buffer import Buffer
+from .texture import Texture
 
 __all__ = ['TextureArray']
 
@@ -204,23 +205,41 @@ class TextureArray:
         """
         return self._glo
 
-    def read(self, *, alignment: int = 1) -> bytes:
+    def read(
+        self,
+        *,
+        viewport: Optional[Union[Tuple[int, int, int], Tuple[int, int, int, int, int, int]]] = None,
+        level: int = 0,
+        alignment: int = 1,
+    ) -> bytes:
         """
         Read the pixel data as bytes into system memory.
 
         Keyword Args:
+            viewport (tuple): The sub-region to read, ``(width, height, layers)`` or
+                              ``(x, y, z, width, height, layers)``.
+                              Reading a sub-region requires OpenGL 4.5.
+            level (int): The mipmap level.
             alignment (int): The byte alignment of the pixels.
 
         Returns:
             bytes
         """
-        return self.mglo.read(alignment)
+        if self.ctx._residency is not None:
+            self.ctx._residency.touch(self)
+        return self.mglo.read(viewport, level, alignment)
 
     def read_into(
         self,
         buffer: Any,
         *,
+        viewport: Optional[Union[Tuple[int, int, int], Tuple[int, int, int, int, int, int]]] = None,
+        level: int = 0,
         alignment: int = 1,
+        row_length: int = 0,
+        skip_pixels: int = 0,
+        skip_rows: int = 0,
+        image_height: int = 0,
         write_offset: int = 0,
     ) -> None:
         """
@@ -243,20 +262,35 @@ class TextureArray:
             buffer (Union[bytearray, Buffer]): The buffer that will receive the pixels.
 
         Keyword Args:
+            viewport (tuple): The sub-region to read, ``(width, height, layers)`` or
+                              ``(x, y, z, width, height, layers)``.
+                              Reading a sub-region requires OpenGL 4.5.
+            level (int): The mipmap level.
             alignment (int): The byte alignment of the pixels.
+            row_length (int): The number of pixels in a row of the client memory, 0 uses the width.
+            skip_pixels (int): The number of pixels skipped at the start of each row.
+            skip_rows (int): The number of rows skipped at the start of the client memory.
+            image_height (int): The number of rows in an image of the client memory, 0 uses the height.
             write_offset (int): The write offset.
         """
+        if self.ctx._residency is not None:
+            self.ctx._residency.touch(self)
         if type(buffer) is Buffer:
             buffer = buffer.mglo
 
-        return self.mglo.read_into(buffer, alignment, write_offset)
+        return self.mglo.read_into(buffer, viewport, level, alignment, (row_length, skip_pixels, skip_rows, image_height), write_offset)
 
     def write(
         self,
         data: Any,
         viewport: Optional[Union[Tuple[int, int, int], Tuple[int, int, int, int, int, int]]] = None,
         *,
+        level: int = 0,
         alignment: int = 1,
+        row_length: int = 0,
+        skip_pixels: int = 0,
+        skip_rows: int = 0,
+        image_height: int = 0,
     ) -> None:
         r"""
         Update the content of the texture array from byte data or a moderngl :py:class:`~moderngl.Buffer`.
@@ -288,25 +322,71 @@ class TextureArray:
             viewport (tuple): The viewport.
 
         Keyword Args:
+            level (int): The mipmap level.
             alignment (int): The byte alignment of the pixels.
+            row_length (int): The number of pixels in a row of the client memory, 0 uses the width.
+            skip_pixels (int): The number of pixels skipped at the start of each row.
+            skip_rows (int): The number of rows skipped at the start of the client memory.
+            image_height (int): The number of rows in an image of the client memory, 0 uses the height.
         """
+        if self.ctx._residency is not None:
+            self.ctx._residency.touch(self)
         if type(data) is Buffer:
             data = data.mglo
 
-        self.mglo.write(data, viewport, alignment)
+        self.mglo.write(data, viewport, level, alignment, (row_length, skip_pixels, skip_rows, image_height), 0, -1)
 
-    def build_mipmaps(self, base: int = 0, max_level: int = 1000) -> None:
+    def clear(
+        self,
+        value: Any = 0,
+        *,
+        level: int = 0,
+        viewport: Optional[Union[Tuple[int, int, int], Tuple[int, int, int, int, int, int]]] = None,
+    ) -> None:
+        """
+        Clear the texture without a framebuffer using ``glClearTexImage``.
+
+        Textures with an integer ``dtype`` take integers, the other ones take floats.
+        A single number is used for every component. Requires OpenGL 4.4.
+
+        .. code-block:: python
+
+            # Clear the third layer
+            array.clear((0.0, 0.0, 0.0, 1.0), viewport=(0, 0, 2, 256, 256, 1))
+
+        Args:
+            value: A number or a sequence with a value for every component.
+
+        Keyword Args:
+            level (int): The mipmap level.
+            viewport (tuple): The region to clear, ``(width, height, layers)`` or
+                              ``(x, y, z, width, height, layers)``.
+        """
+        self.mglo.clear(value, level, viewport)
+
+    def build_mipmaps(self, base: int = 0, max_level: int = 1000, *, method: str = 'box', cpu: bool = False) -> None:
         """
         Generate mipmaps.
 
         This also changes the texture filter to ``LINEAR_MIPMAP_LINEAR, LINEAR``
         (Will be removed in ``6.x``)
 
+        Integer textures get the ``NEAREST_MIPMAP_NEAREST, NEAREST`` filter instead.
+        The driver cannot filter integer textures, with ``cpu=True`` the levels are
+        reduced on the CPU and uploaded in a single pass. The ``'min'`` and ``'max'`` methods
+        keep the smallest or largest texel of each footprint and build conservative
+        depth pyramids, ``'kaiser'`` is a sharper windowed sinc filter.
+        The layers are reduced separately.
+
         Keyword Args:
             base (int): The base level
             max_level (int): The maximum levels to generate
+            method (str): ``'box'``, ``'min'``, ``'max'`` or ``'kaiser'``, only ``'box'`` is available on the GPU
+            cpu (bool): Build the levels on the CPU
         """
-        self.mglo.build_mipmaps(base, max_level)
+        if self.ctx._residency is not None:
+            self.ctx._residency.touch(self)
+        self.mglo.build_mipmaps(base, max_level, method, cpu)
 
     def use(self, location: int = 0) -> None:
         """
@@ -327,6 +407,8 @@ class TextureArray:
         Args:
             location (int): The texture location/unit.
         """
+        if self.ctx._residency is not None:
+            self.ctx._residency.touch(self)
         self.mglo.use(location)
 
     def bind_to_image(self, unit: int, read: bool = True, write: bool = True, level: int = 0, format: int = 0) -> None:
@@ -372,8 +454,71 @@ class TextureArray:
             level (int): Level of the texture to bind (default: ``0``).
             format (int): (optional) The OpenGL enum value representing the format (defaults to the texture's format)
         """
+        if self.ctx._residency is not None:
+            self.ctx._residency.touch(self)
         self.mglo.bind(unit, read, write, level, format)
 
+    def view(
+        self,
+        *,
+        dtype: Optional[str] = None,
+        components: Optional[int] = None,
+        levels: Optional[Tuple[int, int]] = None,
+        layers: Optional[Union[int, Tuple[int, int]]] = None,
+    ) -> Union[Texture, 'TextureArray']:
+        """
+        Create a texture sharing the storage of this texture array (OpenGL 4.3 required).
+
+        The view is created with ``glTextureView`` and shares the memory of this texture array.
+        Only texture arrays with immutable storage can be viewed.
+        The ``dtype`` and ``components`` reinterpret the pixels like :py:meth:`Texture.view`.
+
+        A single layer is viewed as a :py:class:`Texture`, a range of layers as a :py:class:`TextureArray`.
+        Both can be used as framebuffer attachments, a layer of a shadow map array can be rendered directly.
+
+        .. code-block:: python
+
+            shadows = ctx.texture_array((1024, 1024, 4), 1, dtype='f4', immutable=True)
+            cascade = shadows.view(layers=2)
+            fbo = ctx.framebuffer([cascade])
+
+        Keyword Args:
+            dtype (str): The data type of the view. Defaults to the dtype of this texture.
+            components (int): The number of components of the view.
+            levels (tuple): The first level and the number of levels. Defaults to all of them.
+            layers: A single layer or a tuple of the first layer and the number of layers.
+                    Defaults to all of them.
+
+        Returns:
+            :py:class:`Texture` or :py:class:`TextureArray` object
+        """
+        dtype = self._dtype if dtype is None else dtype
+        components = self._components if components is None else components
+        first = levels[0] if levels is not None else 0
+        size = (max(self.width >> first, 1), max(self.height >> first, 1))
+
+        if isinstance(layers, int):
+            texture = Texture.__new__(Texture)
+            texture.mglo, texture._glo = self.mglo.view(dtype, components, levels, layers)
+            texture._size = size
+            texture._components = components
+            texture._samples = 0
+            texture._dtype = dtype
+            texture._depth = False
+            texture._depth_format = None
+            texture.ctx = self.ctx
+            texture.extra = None
+            return texture
+
+        res = TextureArray.__new__(TextureArray)
+        res.mglo, res._glo = self.mglo.view(dtype, components, levels, layers)
+        res._size = size + (layers[1] if layers is not None else self.layers,)
+        res._components = components
+        res._dtype = dtype
+        res.ctx = self.ctx
+        res.extra = None
+        return res
+
     def release(self) -> None:
         """Release the ModernGL object."""
         if not isinstance(self.mglo, InvalidObject):
@@ -0,0 +1,225 @@
+from typing import Any, List, Optional, Tuple
+
+from moderngl.mgl import InvalidObject  # type: ignore
+
+from .texture_array import TextureArray
+
+__all__ = ['TextureAtlas', 'AtlasRegion']
+
+
+class AtlasRegion:
+    """
+    A rectangle allocated in a :py:class:`TextureAtlas`.
+
+    The region keeps its identity when :py:meth:`TextureAtlas.compact` moves it,
+    read the :py:attr:`layer` and :py:attr:`uv` again after compacting.
+
+    An AtlasRegion object cannot be instantiated directly.
+    Use :py:meth:`TextureAtlas.add` to create one.
+    """
+
+    __slots__ = ['_atlas', '_id', '_layer', '_x', '_y', '_width', '_height', 'extra']
+
+    def __init__(self):
+        self._atlas = None
+        self._id = None
+        self._layer = None
+        self._x = None
+        self._y = None
+        self._width = None
+        self._height = None
+        self.extra = None  #: Any - Attribute for storing user defined objects
+        raise TypeError()
+
+    def __repr__(self):
+        return '<AtlasRegion: %d %dx%d at (%d, %d, %d)>' % (
+            self._id, self._width, self._height, self._x, self._y, self._layer,
+        )
+
+    @property
+    def layer(self) -> int:
+        """int: The texture array layer holding the region."""
+        return self._layer
+
+    @property
+    def viewport(self) -> Tuple[int, int, int, int]:
+        """tuple: The ``(x, y, width, height)`` of the region in texels."""
+        return (self._x, self._y, self._width, self._height)
+
+    @property
+    def uv(self) -> Tuple[float, float, float, float]:
+        """tuple: The ``(u0, v0, u1, v1)`` texture coordinates of the region."""
+        width, height = self._atlas._size
+        return (
+            self._x / width,
+            self._y / height,
+            (self._x + self._width) / width,
+            (self._y + self._height) / height,
+        )
+
+
+class TextureAtlas:
+    """
+    A TextureAtlas packs many small images into the layers of one :py:class:`TextureArray`.
+
+    Sprites and glyphs stored in separate textures need a texture switch and a new draw call
+    each. Packed into an atlas they are sampled from the same texture array with the
+    ``layer`` and ``uv`` of their :py:class:`AtlasRegion`, so a whole sprite set can be
+    rendered with a single instanced draw call.
+
+    .. code-block:: python
+
+        atlas = ctx.texture_atlas((2048, 2048), 4)
+
+        regions = [atlas.add(image.size, image.tobytes()) for image in sprites]
+        instances = [region.uv + (region.layer,) for region in regions]
+
+    The images are placed with skyline packing, each layer keeps the top edge of its images
+    and new images are placed as low as possible. Removed regions are reused by later images
+    and :py:meth:`compact` repacks the remaining images with GPU copies.
+
+    A TextureAtlas object cannot be instantiated directly, it requires a context.
+    Use :py:meth:`Context.texture_atlas` to create one.
+    """
+
+    __slots__ = ['mglo', '_texture', '_size', '_layers', '_padding', '_regions', 'ctx', 'extra']
+
+    def __init__(self):
+        self.mglo = None  #: Internal representation for debug purposes only.
+        self._texture = None
+        self._size = None
+        self._layers = None
+        self._padding = None
+        self._regions = None
+        self.ctx = None  #: The context this object belongs to
+        self.extra = None  #: Any - Attribute for storing user defined objects
+        raise TypeError()
+
+    def __repr__(self):
+        return '<TextureAtlas: %dx%dx%d>' % (self._size[0], self._size[1], self._layers)
+
+    def __hash__(self) -> int:
+        return id(self)
+
+    def __del__(self) -> None:
+        if not hasattr(self, "ctx"):
+            return
+
+        if self.ctx.gc_mode == "auto":
+            self.release()
+        elif self.ctx.gc_mode == "context_gc":
+            self.ctx.objects.append(self.mglo)
+
+    @property
+    def texture(self) -> TextureArray:
+        """TextureArray: The texture array holding the images."""
+        return self._texture
+
+    @property
+    def size(self) -> Tuple[int, int]:
+        """tuple: The size of a layer."""
+        return self._size
+
+    @property
+    def layers(self) -> int:
+        """int: The number of layers."""
+        return self._layers
+
+    @property
+    def padding(self) -> int:
+        """int: The number of texels kept empty between the regions."""
+        return self._padding
+
+    @property
+    def regions(self) -> List[AtlasRegion]:
+        """list: The allocated regions."""
+        return list(self._regions.values())
+
+    @property
+    def occupancy(self) -> float:
+        """float: The ratio of the allocated texels to all texels, padding excluded."""
+        return self.mglo.allocated_area / (self._size[0] * self._size[1] * self._layers)
+
+    def add(self, size: Tuple[int, int], data: Optional[Any] = None, *, alignment: int = 1) -> Optional[AtlasRegion]:
+        """
+        Allocate a region and write the image into it.
+
+        Returns ``None`` when no layer has room for the image. Remove unused regions
+        or call :py:meth:`compact` to make room.
+
+        Args:
+            size (tuple): The width and height of the image.
+            data (bytes): The pixels of the image, the region is left uninitialized if ``None``.
+
+        Keyword Args:
+            alignment (int): The byte alignment of the pixel data 1, 2, 4 or 8.
+
+        Returns:
+            :py:class:`AtlasRegion` object or ``None``
+        """
+        allocation = self.mglo.allocate(tuple(size))
+        if allocation is None:
+            return None
+
+        region = AtlasRegion.__new__(AtlasRegion)
+        region._atlas = self
+        region._id, region._layer, region._x, region._y = allocation
+        region._width, region._height = size
+        region.extra = None
+        self._regions[region._id] = region
+
+        if data is not None:
+            try:
+                self._texture.write(data, (region._x, region._y, region._layer, size[0], size[1], 1), alignment=alignment)
+            except Exception:
+                # The region is not handed out, its space must not leak
+                self.remove(region)
+                raise
+
+        return region
+
+    def remove(self, region: AtlasRegion) -> None:
+        """
+        Free a region, later images can be placed in its place.
+
+        Args:
+            region (AtlasRegion): The region to free.
+        """
+        self.mglo.free(region._id)
+        del self._regions[region._id]
+
+    def compact(self) -> bool:
+        """
+        Repack the regions to reclaim the space left by removed regions (OpenGL 4.3 required).
+
+        The regions are repacked from the tallest to the shortest and their texels are moved
+        with ``glCopyImageSubData``, the pixel data does not leave the GPU. Only the first
+        mipmap level is moved. The :py:class:`AtlasRegion` objects are updated in place.
+
+        Returns:
+            bool: ``False`` if the regions do not fit a new layout, the old layout is kept.
+        """
+        moved = self.mglo.compact()
+        if moved is None:
+            return False
+
+        for region_id, layer, x, y in moved:
+            region = self._regions[region_id]
+            region._layer, region._x, region._y = layer, x, y
+
+        return True
+
+    def use(self, location: int = 0) -> None:
+        """
+        Bind the texture array of the atlas to a texture unit.
+
+        Args:
+            location (int): The texture location/unit.
+        """
+        self._texture.use(location)
+
+    def release(self) -> None:
+        """Release the ModernGL object and its texture array."""
+        if not isinstance(self.mglo, InvalidObject):
+            self.mglo.release()
+            self._texture.release()
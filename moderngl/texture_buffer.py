@@ -0,0 +1,143 @@
+from typing import Any
+
+from moderngl.mgl import InvalidObject  # type: ignore
+
+from .buffer import Buffer
+
+__all__ = ['TextureBuffer']
+
+
+class TextureBuffer:
+    """
+    A TextureBuffer exposes the contents of a :py:class:`Buffer` as a one dimensional texture.
+
+    The texels are read in shaders with ``texelFetch`` from a ``samplerBuffer``,
+    ``isamplerBuffer`` or ``usamplerBuffer`` uniform. Texture buffers are not
+    limited by the uniform block size and do not require storage buffer support,
+    large lookup tables can be streamed into the buffer and fetched directly.
+
+    .. code-block:: python
+
+        palette = ctx.buffer(reserve=bones * 64)
+        bones = ctx.texture_buffer(palette, 'f4', 4)
+
+        palette.write(matrices)
+        bones.use(location=0)
+
+    The texture buffer does not own a copy of the data, writes to the buffer
+    are visible to the texture buffer. Texture buffers cannot be filtered or mipmapped.
+
+    A TextureBuffer object cannot be instantiated directly, it requires a context.
+    Use :py:meth:`Context.texture_buffer` to create one.
+    """
+
+    __slots__ = ['mglo', '_buffer', '_dtype', '_components', '_offset', '_size', '_glo', 'ctx', 'extra']
+
+    def __init__(self):
+        self.mglo = None  #: Internal representation for debug purposes only.
+        self._buffer = None
+        self._dtype = None
+        self._components = None
+        self._offset = None
+        self._size = None
+        self._glo = None
+        self.ctx = None  #: The context this object belongs to
+        self.extra = None  #: Any - Attribute for storing user defined objects
+        raise TypeError()
+
+    def __repr__(self):
+        if hasattr(self, '_glo'):
+            return f"<{self.__class__.__name__}: {self._glo}>"
+        else:
+            return f"<{self.__class__.__name__}: INCOMPLETE>"
+
+    def __eq__(self, other: Any):
+        return type(self) is type(other) and self.mglo is other.mglo
+
+    def __hash__(self) -> int:
+        return id(self)
+
+    def __del__(self):
+        if not hasattr(self, "ctx"):
+            return
+
+        if self.ctx.gc_mode == "auto":
+            self.release()
+        elif self.ctx.gc_mode == "context_gc":
+            self.ctx.objects.append(self.mglo)
+
+    @property
+    def buffer(self) -> Buffer:
+        """Buffer: The buffer holding the texels."""
+        return self._buffer
+
+    @property
+    def dtype(self) -> str:
+        """str: Data type."""
+        return self._dtype
+
+    @property
+    def components(self) -> int:
+        """int: The number of components of a texel."""
+        return self._components
+
+    @property
+    def offset(self) -> int:
+        """int: The offset of the first texel in the buffer in bytes."""
+        return self._offset
+
+    @property
+    def size(self) -> int:
+        """int: The size of the texel range in bytes."""
+        return self._size
+
+    @property
+    def texels(self) -> int:
+        """int: The number of texels, the valid ``texelFetch`` indices are ``0`` to ``texels - 1``."""
+        return self._size // (int(self._dtype[-1]) * self._components)
+
+    @property
+    def glo(self) -> int:
+        """
+        int: The internal OpenGL object.
+
+        This values is provided for debug purposes only.
+        """
+        return self._glo
+
+    def use(self, location: int = 0) -> None:
+        """
+        Bind the texture buffer to a texture unit.
+
+        The location should correspond with the value of the
+        ``samplerBuffer`` uniform in the shader::
+
+            program['lookup'] = 0
+            texture_buffer.use(location=0)
+
+        Args:
+            location (int): The texture location/unit.
+        """
+        self.mglo.use(location)
+
+    def bind_to_image(self, unit: int, read: bool = True, write: bool = True, format: int = 0) -> None:
+        """
+        Bind the texture buffer to an image unit (OpenGL 4.2 required).
+
+        The texels can then be accessed with ``imageLoad`` and ``imageStore``
+        from an ``imageBuffer`` uniform. Three component texture buffers
+        cannot be bound to image units.
+
+        Args:
+            unit (int): Specifies the index of the image unit to which to bind the texture buffer
+        Keyword Args:
+            read (bool): Allows the shader to read the image (default: ``True``)
+            write (bool): Allows the shader to write to the image (default: ``True``)
+            format (int): (optional) The OpenGL enum value representing the format (defaults to the texture's format)
+        """
+        self.mglo.bind(unit, read, write, format)
+
+    def release(self) -> None:
+        """Release the ModernGL object."""
+        if not isinstance(self.mglo, InvalidObject):
+            self.mglo.release()
@@ -156,7 +156,14 @@ class TextureCube:
         """
         return self._glo
 
-    def read(self, face: int, *, alignment: int = 1) -> bytes:
+    def read(
+        self,
+        face: int,
+        *,
+        viewport: Optional[Union[Tuple[int, int], Tuple[int, int, int, int]]] = None,
+        level: int = 0,
+        alignment: int = 1,
+    ) -> bytes:
         """
         Read a face from the cubemap as bytes into system memory.
 
@@ -173,16 +180,27 @@ class TextureCube:
             face (int): The face to read.
 
         Keyword Args:
+            viewport (tuple): The sub-region to read, ``(width, height)`` or
+                              ``(x, y, width, height)``.
+                              Reading a sub-region requires OpenGL 4.5.
+            level (int): The mipmap level.
             alignment (int): The byte alignment of the pixels.
         """
-        return self.mglo.read(face, alignment)
+        if self.ctx._residency is not None:
+            self.ctx._residency.touch(self)
+        return self.mglo.read(face, viewport, level, alignment)
 
     def read_into(
         self,
         buffer: Any,
         face: int,
         *,
+        viewport: Optional[Union[Tuple[int, int], Tuple[int, int, int, int]]] = None,
+        level: int = 0,
         alignment: int = 1,
+        row_length: int = 0,
+        skip_pixels: int = 0,
+        skip_rows: int = 0,
         write_offset: int = 0,
     ) -> None:
         """
@@ -207,13 +225,22 @@ class TextureCube:
             face (int): The face to read.
 
         Keyword Args:
+            viewport (tuple): The sub-region to read, ``(width, height)`` or
+                              ``(x, y, width, height)``.
+                              Reading a sub-region requires OpenGL 4.5.
+            level (int): The mipmap level.
             alignment (int): The byte alignment of the pixels.
+            row_length (int): The number of pixels in a row of the client memory, 0 uses the width.
+            skip_pixels (int): The number of pixels skipped at the start of each row.
+            skip_rows (int): The number of rows skipped at the start of the client memory.
             write_offset (int): The write offset.
         """
+        if self.ctx._residency is not None:
+            self.ctx._residency.touch(self)
         if type(buffer) is Buffer:
             buffer = buffer.mglo
 
-        return self.mglo.read_into(buffer, face, alignment, write_offset)
+        return self.mglo.read_into(buffer, face, viewport, level, alignment, (row_length, skip_pixels, skip_rows, 0), write_offset)
 
     def write(
         self,
@@ -221,7 +248,11 @@ class TextureCube:
         data: Any,
         viewport: Optional[Union[Tuple[int, int], Tuple[int, int, int, int]]] = None,
         *,
+        level: int = 0,
         alignment: int = 1,
+        row_length: int = 0,
+        skip_pixels: int = 0,
+        skip_rows: int = 0,
     ) -> None:
         r"""
         Update the content of the texture.
@@ -245,12 +276,69 @@ class TextureCube:
             viewport (tuple): The viewport.
 
         Keyword Args:
+            level (int): The mipmap level.
             alignment (int): The byte alignment of the pixels.
+            row_length (int): The number of pixels in a row of the client memory, 0 uses the width.
+            skip_pixels (int): The number of pixels skipped at the start of each row.
+            skip_rows (int): The number of rows skipped at the start of the client memory.
         """
+        if self.ctx._residency is not None:
+            self.ctx._residency.touch(self)
         if type(data) is Buffer:
             data = data.mglo
 
-        self.mglo.write(face, data, viewport, alignment)
+        self.mglo.write(face, data, viewport, level, alignment, (row_length, skip_pixels, skip_rows, 0), 0, -1)
+
+    def clear(
+        self,
+        value: Any = 0,
+        *,
+        level: int = 0,
+        viewport: Optional[Tuple[int, ...]] = None,
+    ) -> None:
+        """
+        Clear the texture without a framebuffer using ``glClearTexImage``.
+
+        Textures with an integer ``dtype`` take integers, the other ones take floats.
+        A single number is used for every component. Requires OpenGL 4.4.
+
+        .. code-block:: python
+
+            # Clear the negative Y face
+            cube.clear(0.0, viewport=(0, 0, 3, 512, 512, 1))
+
+        Args:
+            value: A number or a sequence with a value for every component.
+
+        Keyword Args:
+            level (int): The mipmap level.
+            viewport (tuple): The region to clear, ``(x, y, width, height)`` on every face or
+                              ``(x, y, face, width, height, faces)``.
+        """
+        self.mglo.clear(value, level, viewport)
+
+    def build_mipmaps(self, base: int = 0, max_level: int = 1000, *, method: str = 'box', cpu: bool = False) -> None:
+        """
+        Generate mipmaps.
+
+        This also changes the texture filter to ``LINEAR_MIPMAP_LINEAR, LINEAR``
+
+        Integer textures get the ``NEAREST_MIPMAP_NEAREST, NEAREST`` filter instead.
+        The driver cannot filter integer textures, with ``cpu=True`` the levels are
+        reduced on the CPU and uploaded in a single pass. The ``'min'`` and ``'max'`` methods
+        keep the smallest or largest texel of each footprint and build conservative
+        depth pyramids, ``'kaiser'`` is a sharper windowed sinc filter.
+        The faces are reduced separately.
+
+        Keyword Args:
+            base (int): The base level
+            max_level (int): The maximum levels to generate
+            method (str): ``'box'``, ``'min'``, ``'max'`` or ``'kaiser'``, only ``'box'`` is available on the GPU
+            cpu (bool): Build the levels on the CPU
+        """
+        if self.ctx._residency is not None:
+            self.ctx._residency.touch(self)
+        self.mglo.build_mipmaps(base, max_level, method, cpu)
 
     def use(self, location: int = 0) -> None:
         """
@@ -271,6 +359,8 @@ class TextureCube:
         Args:
             location (int): The texture location/unit.
         """
+        if self.ctx._residency is not None:
+            self.ctx._residency.touch(self)
         self.mglo.use(location)
 
     def bind_to_image(self, unit: int, read: bool = True, write: bool = True, level: int = 0, format: int = 0) -> None:
@@ -317,6 +407,8 @@ class TextureCube:
             level (int): Level of the texture to bind (default: ``0``).
             format (int): (optional) The OpenGL enum value representing the format (defaults to the texture's format)
         """
+        if self.ctx._residency is not None:
+            self.ctx._residency.touch(self)
         self.mglo.bind(unit, read, write, level, format)
 
     def release(self) -> None:
@@ -0,0 +1,100 @@
+from typing import Any
+
+from moderngl.mgl import InvalidObject  # type: ignore
+
+__all__ = ['UniformStream']
+
+
+class UniformStream:
+    """
+    A ring of per-draw uniform block records stored in a single uniform buffer.
+
+    Each record is aligned to ``GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT`` and packed with
+    the layout of the uniform block it was created from. A :py:class:`VertexArray`
+    with :py:attr:`VertexArray.uniform_stream` set binds the last pushed record
+    with ``glBindBufferRange`` before every draw call.
+
+    The buffer is split into segments guarded by fences, pushing into a segment
+    still in use by the GPU waits for the draw calls reading it to complete.
+
+    .. code-block:: python
+
+        stream = ctx.uniform_stream(program['PerDraw'])
+        vao.uniform_stream = stream
+
+        for obj in objects:
+            stream.push({'mvp': obj.mvp, 'color': obj.color})
+            vao.render()
+
+    A UniformStream object cannot be instantiated directly, it requires a context.
+    Use :py:meth:`Context.uniform_stream` to create one.
+    """
+
+    __slots__ = ['mglo', '_record_size', '_capacity', 'ctx', 'extra']
+
+    def __init__(self):
+        self.mglo = None  #: Internal representation for debug purposes only.
+        self._record_size = None
+        self._capacity = None
+        self.ctx = None  #: The context this object belongs to
+        self.extra = None  #: Any - Attribute for storing user defined objects
+        raise TypeError()
+
+    def __repr__(self):
+        return '<UniformStream: %d>' % self._capacity
+
+    def __hash__(self) -> int:
+        return id(self)
+
+    def __del__(self) -> None:
+        if not hasattr(self, "ctx"):
+            return
+
+        if self.ctx.gc_mode == "auto":
+            self.release()
+        elif self.ctx.gc_mode == "context_gc":
+            self.ctx.objects.append(self.mglo)
+
+    @property
+    def binding(self) -> int:
+        """int: The uniform buffer binding point the records are bound to."""
+        return self.mglo.binding
+
+    @binding.setter
+    def binding(self, value: int) -> None:
+        self.mglo.binding = value
+
+    @property
+    def record_size(self) -> int:
+        """int: The aligned size of a single record in bytes."""
+        return self._record_size
+
+    @property
+    def capacity(self) -> int:
+        """int: The size of the ring in bytes."""
+        return self._capacity
+
+    def push(self, values: Any) -> int:
+        """
+        Pack the values into the next record and make it the current one.
+
+        Args:
+            values (dict): A mapping of block member names to values or a numpy record.
+
+        Returns:
+            int: The byte offset of the record in the ring.
+        """
+        names = getattr(getattr(values, 'dtype', None), 'names', None)
+        if names is not None:
+            values = {name: values[name] for name in names}
+
+        return self.mglo.push(values)
+
+    def bind(self) -> None:
+        """Bind the current record to the binding point."""
+        self.mglo.bind()
+
+    def release(self) -> None:
+        """Release the ModernGL object."""
+        if not isinstance(self.mglo, InvalidObject):
+            self.mglo.release()
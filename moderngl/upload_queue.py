@@ -0,0 +1,139 @@
+from typing import Any, Optional, Tuple, Union
+
+from moderngl.mgl import InvalidObject  # type: ignore
+
+from .texture import Texture
+from .texture_3d import Texture3D
+from .texture_array import TextureArray
+from .texture_cube import TextureCube
+
+__all__ = ['UploadQueue']
+
+
+class UploadQueue:
+    """
+    Asynchronous texture uploads through a ring of pixel unpack buffer memory.
+
+    :py:meth:`write` copies the pixel data into the staging ring and issues
+    ``glTexSubImage*`` from its offset in the ring. The call returns as soon as
+    the data is copied, the driver transfers it to the texture later.
+    Each upload is fenced, writing into a range of the ring still read by an
+    earlier upload waits for it to complete. Such waits are counted in
+    :py:attr:`stalls` and :py:attr:`stall_time`.
+
+    With OpenGL 4.4 the ring is mapped once with a persistent mapping.
+
+    .. code-block:: python
+
+        queue = ctx.upload_queue(64 * 1024 * 1024)
+
+        for frame in video:
+            queue.write(texture, frame)
+            vao.render()
+
+    An UploadQueue object cannot be instantiated directly, it requires a context.
+    Use :py:meth:`Context.upload_queue` to create one.
+    """
+
+    __slots__ = ['mglo', '_staging', '_staging_size', 'ctx', 'extra']
+
+    def __init__(self):
+        self.mglo = None  #: Internal representation for debug purposes only.
+        self._staging = None
+        self._staging_size = None
+        self.ctx = None  #: The context this object belongs to
+        self.extra = None  #: Any - Attribute for storing user defined objects
+        raise TypeError()
+
+    def __repr__(self):
+        return '<UploadQueue: %d>' % self._staging_size
+
+    def __hash__(self) -> int:
+        return id(self)
+
+    def __del__(self) -> None:
+        if not hasattr(self, "ctx"):
+            return
+
+        if self.ctx.gc_mode == "auto":
+            self.release()
+        elif self.ctx.gc_mode == "context_gc":
+            self.ctx.objects.append(self.mglo)
+
+    @property
+    def staging_size(self) -> int:
+        """int: The size of the staging ring in bytes."""
+        return self._staging_size
+
+    @property
+    def pending(self) -> int:
+        """int: The number of uploads not yet completed by the GPU."""
+        return self.mglo.pending
+
+    @property
+    def uploads(self) -> int:
+        """int: The number of uploads issued."""
+        return self.mglo.uploads
+
+    @property
+    def uploaded_bytes(self) -> int:
+        """int: The number of bytes copied into the staging ring."""
+        return self.mglo.uploaded_bytes
+
+    @property
+    def stalls(self) -> int:
+        """int: The number of uploads that had to wait for a previous upload to complete."""
+        return self.mglo.stalls
+
+    @property
+    def stall_time(self) -> float:
+        """float: The time spent waiting for previous uploads in seconds."""
+        return self.mglo.stall_time
+
+    def write(
+        self,
+        texture: Union[Texture, Texture3D, TextureArray, TextureCube],
+        data: Any,
+        viewport: Optional[Tuple[int, ...]] = None,
+        *,
+        face: int = 0,
+        level: int = 0,
+        alignment: int = 1,
+    ) -> None:
+        """
+        Queue an update of the texture content.
+
+        The arguments are the same as the ``write`` method of the texture.
+        The data must be a bytes-like object no larger than the staging ring
+        and its size must match the viewport.
+
+        Args:
+            texture: The :py:class:`Texture`, :py:class:`Texture3D`,
+                     :py:class:`TextureArray` or :py:class:`TextureCube` to update.
+            data (bytes): The pixel data.
+            viewport (tuple): The viewport.
+
+        Keyword Args:
+            face (int): The face of a :py:class:`TextureCube`.
+            level (int): The mipmap level.
+            alignment (int): The byte alignment of the pixels.
+        """
+        size = memoryview(data).nbytes
+        offset = self.mglo.stage(data)
+
+        try:
+            if type(texture) is TextureCube:
+                texture.mglo.write(face, self._staging, viewport, level, alignment, (0, 0, 0, 0), offset, size)
+            else:
+                texture.mglo.write(self._staging, viewport, level, alignment, (0, 0, 0, 0), offset, size)
+        finally:
+            self.mglo.fence()
+
+    def finish(self) -> None:
+        """Wait for all pending uploads to complete."""
+        self.mglo.finish()
+
+    def release(self) -> None:
+        """Release the ModernGL object."""
+        if not isinstance(self.mglo, InvalidObject):
+            self.mglo.release()
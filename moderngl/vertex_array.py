@@ -5,6 +5,7 @@ from moderngl.mgl import InvalidObject  # type: ignore
 if TYPE_CHECKING:
     from .program import Program
     from .buffer import Buffer
+    from .uniform_stream import UniformStream
 
 __all__ = ['VertexArray',
            'POINTS', 'LINES', 'LINE_LOOP', 'LINE_STRIP', 'TRIANGLES', 'TRIANGLE_STRIP', 'TRIANGLE_FAN',
@@ -75,7 +76,7 @@ class VertexArray:
 
     __slots__ = [
         'mglo', '_program', '_index_buffer', '_content', '_index_element_size',
-        '_glo', '_mode', 'ctx', 'extra', 'scope'
+        '_uniform_stream', '_glo', '_mode', 'ctx', 'extra', 'scope'
     ]
 
     def __init__(self):
@@ -84,6 +85,7 @@ class VertexArray:
         self._index_buffer = None
         self._content = None
         self._index_element_size = None
+        self._uniform_stream = None
         self._glo = None
         self._mode = None  #: int: The default rendering mode
         self.ctx = None  #: The context this object belongs to
@@ -185,6 +187,21 @@ class VertexArray:
     def subroutines(self, value: Tuple[int, ...]) -> None:
         self.mglo.subroutines = tuple(value)
 
+    @property
+    def uniform_stream(self) -> Optional['UniformStream']:
+        """
+        UniformStream: The uniform stream bound before every draw call.
+
+        The current record of the stream is bound with ``glBindBufferRange``
+        when rendering or transforming primitives.
+        """
+        return self._uniform_stream
+
+    @uniform_stream.setter
+    def uniform_stream(self, value: Optional['UniformStream']) -> None:
+        self.mglo.uniform_stream = value.mglo if value is not None else None
+        self._uniform_stream = value
+
     @property
     def glo(self) -> int:
         """
@@ -323,4 +340,5 @@ class VertexArray:
             self._program = None
             self._index_buffer = None
             self._content = None
+            self._uniform_stream = None
             self.mglo.release()
@@ -84,27 +84,40 @@ mgl = Extension(
     sources=[
         'moderngl/src/Sampler.cpp',
         'moderngl/src/Attribute.cpp',
+        'moderngl/src/BlockWriter.cpp',
+        'moderngl/src/BrickVolume.cpp',
         'moderngl/src/Buffer.cpp',
         'moderngl/src/BufferFormat.cpp',
         'moderngl/src/ComputeShader.cpp',
         'moderngl/src/Context.cpp',
         'moderngl/src/DataType.cpp',
         'moderngl/src/Error.cpp',
+        'moderngl/src/FrameCapture.cpp',
         'moderngl/src/Framebuffer.cpp',
         'moderngl/src/InvalidObject.cpp',
+        'moderngl/src/Mipmaps.cpp',
         'moderngl/src/ModernGL.cpp',
+        'moderngl/src/PixelConvert.cpp',
+        'moderngl/src/PixelFormat.cpp',
         'moderngl/src/Program.cpp',
         'moderngl/src/Query.cpp',
         'moderngl/src/Renderbuffer.cpp',
+        'moderngl/src/Residency.cpp',
         'moderngl/src/Scope.cpp',
         'moderngl/src/Texture.cpp',
         'moderngl/src/Texture3D.cpp',
         'moderngl/src/TextureArray.cpp',
+        'moderngl/src/TextureAtlas.cpp',
+        'moderngl/src/TextureBuffer.cpp',
         'moderngl/src/TextureCube.cpp',
+        'moderngl/src/TextureLoader.cpp',
         'moderngl/src/Uniform.cpp',
+        'moderngl/src/UniformBatch.cpp',
         'moderngl/src/UniformBlock.cpp',
         'moderngl/src/UniformGetters.cpp',
         'moderngl/src/UniformSetters.cpp',
+        'moderngl/src/UniformStream.cpp',
+        'moderngl/src/UploadQueue.cpp',
         'moderngl/src/VertexArray.cpp',
     ],
     depends=[
@@ -114,6 +127,7 @@ mgl = Extension(
         'moderngl/src/BufferFormat.hpp',
         'moderngl/src/Error.hpp',
         'moderngl/src/InlineMethods.hpp',
+        'moderngl/src/MappedFile.hpp',
         'moderngl/src/OpenGL.hpp',
         'moderngl/src/Python.hpp',
         'moderngl/src/Types.hpp',
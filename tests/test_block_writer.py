@@ -0,0 +1,145 @@
+import struct
+import unittest
+
+import moderngl
+import numpy as np
+
+from common import get_context
+
+
+class TestCase(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        cls.ctx = get_context()
+
+    def test_uniform_block_std140(self):
+        prog = self.ctx.program(
+            vertex_shader='''
+                #version 330
+
+                layout (std140) uniform Params {
+                    vec3 color;
+                    float scale;
+                    mat3 rotation;
+                    float weights[3];
+                    ivec2 offset;
+                };
+
+                void main() {
+                    vec3 pos = rotation * color * scale + vec3(offset, weights[0] + weights[1] + weights[2]);
+                    gl_Position = vec4(pos, 1.0);
+                }
+            ''',
+            fragment_shader='''
+                #version 330
+
+                out vec4 color;
+
+                void main() {
+                    color = vec4(1.0);
+                }
+            ''',
+        )
+
+        block = prog['Params']
+        members = block.members
+        self.assertEqual(members['color']['offset'], 0)
+        self.assertEqual(members['scale']['offset'], 12)
+        self.assertEqual(members['rotation']['offset'], 16)
+        self.assertEqual(members['rotation']['matrix_stride'], 16)
+        self.assertEqual(members['weights']['offset'], 64)
+        self.assertEqual(members['weights']['array_length'], 3)
+        self.assertEqual(members['weights']['array_stride'], 16)
+        self.assertEqual(members['offset']['offset'], 112)
+
+        buf = self.ctx.buffer(reserve=block.size + 16)
+        writer = block.writer()
+        self.assertEqual(writer.size, block.size)
+
+        writer.write(buf, {
+            'color': (1.0, 2.0, 3.0),
+            'scale': 4.0,
+            'rotation': np.arange(9, dtype='f8'),
+            'weights': [5.0, 6.0, 7.0],
+            'offset': (-1, 2),
+        }, offset=16)
+
+        data = buf.read(offset=16)
+        self.assertEqual(struct.unpack_from('4f', data, 0), (1.0, 2.0, 3.0, 4.0))
+        self.assertEqual(struct.unpack_from('3f', data, 16), (0.0, 1.0, 2.0))
+        self.assertEqual(struct.unpack_from('3f', data, 32), (3.0, 4.0, 5.0))
+        self.assertEqual(struct.unpack_from('3f', data, 48), (6.0, 7.0, 8.0))
+        self.assertEqual(struct.unpack_from('f', data, 64), (5.0,))
+        self.assertEqual(struct.unpack_from('f', data, 80), (6.0,))
+        self.assertEqual(struct.unpack_from('f', data, 96), (7.0,))
+        self.assertEqual(struct.unpack_from('2i', data, 112), (-1, 2))
+
+        with self.assertRaises(moderngl.Error):
+            writer.write(buf, {'missing': 1.0})
+
+        with self.assertRaises(moderngl.Error):
+            writer.write(buf, {'color': (1.0, 2.0)})
+
+        # Nested raw bytes cannot write past the member
+        buf.write(b'\xab' * (block.size + 16))
+        with self.assertRaises(moderngl.Error):
+            writer.write(buf, {'color': [struct.pack('3f', 1.0, 2.0, 3.0), struct.pack('3f', 4.0, 5.0, 6.0)]})
+
+        with self.assertRaises(moderngl.Error):
+            writer.write(buf, {'color': [1.0, struct.pack('3f', 2.0, 3.0, 4.0)]})
+
+        self.assertEqual(buf.read(offset=12), b'\xab' * (block.size + 4))
+
+    def test_storage_block_std430(self):
+        if self.ctx.version_code < 430:
+            self.skipTest('storage blocks require OpenGL 4.3')
+
+        compute_shader = self.ctx.compute_shader('''
+            #version 430
+
+            layout (local_size_x = 1) in;
+
+            layout (std430, binding = 0) buffer Input {
+                vec2 direction;
+                float speeds[4];
+                uvec3 flags;
+            } inp;
+
+            layout (std430, binding = 1) buffer Output {
+                float result[4];
+            };
+
+            void main() {
+                for (int i = 0; i < 4; ++i) {
+                    result[i] = inp.speeds[i] * inp.direction.x + float(inp.flags.z);
+                }
+            }
+        ''')
+
+        block = compute_shader['Input']
+        self.assertIsInstance(block, moderngl.StorageBlock)
+        members = block.members
+        self.assertEqual(members['direction']['offset'], 0)
+        self.assertEqual(members['speeds']['offset'], 8)
+        self.assertEqual(members['speeds']['array_stride'], 4)
+        self.assertEqual(members['flags']['offset'], 32)
+
+        record = np.zeros(1, dtype=[('direction', 'f4', 2), ('speeds', 'f4', 4), ('flags', 'u4', 3)])[0]
+        record['direction'] = (2.0, 0.0)
+        record['speeds'] = (1.0, 2.0, 3.0, 4.0)
+        record['flags'] = (0, 0, 10)
+
+        inp = self.ctx.buffer(reserve=block.size)
+        out = self.ctx.buffer(reserve=16)
+        block.writer().write(inp, record)
+
+        inp.bind_to_storage_buffer(0)
+        out.bind_to_storage_buffer(1)
+        compute_shader.run()
+
+        self.assertEqual(struct.unpack('4f', out.read()), (12.0, 14.0, 16.0, 18.0))
+
+
+if __name__ == '__main__':
+    unittest.main()
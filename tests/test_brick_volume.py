@@ -0,0 +1,130 @@
+import os
+import shutil
+import struct
+import tempfile
+import unittest
+
+import moderngl
+
+from common import get_context
+
+SIZE = (10, 9, 7)
+
+
+def texel(x, y, z):
+    x = min(max(x, 0), SIZE[0] - 1)
+    y = min(max(y, 0), SIZE[1] - 1)
+    z = min(max(z, 0), SIZE[2] - 1)
+    return (x + 11 * y + 37 * z) % 251
+
+
+class TestCase(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        cls.ctx = get_context()
+
+    def setUp(self):
+        self.tempdir = tempfile.mkdtemp()
+        self.path = os.path.join(self.tempdir, 'volume.raw')
+        with open(self.path, 'wb') as f:
+            f.write(b'header')
+            f.write(bytes(texel(x, y, z) for z in range(SIZE[2]) for y in range(SIZE[1]) for x in range(SIZE[0])))
+
+    def tearDown(self):
+        shutil.rmtree(self.tempdir)
+
+    def create(self, **kwargs):
+        return self.ctx.brick_volume(self.path, SIZE, 1, brick_size=4, border=1, cache_bricks=(2, 2, 1), offset=6, **kwargs)
+
+    def read_slot(self, volume, slot):
+        cache = volume.cache.read()
+        width, height, _ = volume.cache.size
+        return bytes(
+            cache[((slot[2] * 6 + z) * height + slot[1] * 6 + y) * width + slot[0] * 6 + x]
+            for z in range(6) for y in range(6) for x in range(6)
+        )
+
+    def expected_brick(self, brick):
+        x0, y0, z0 = (axis * 4 - 1 for axis in brick)
+        return bytes(texel(x0 + x, y0 + y, z0 + z) for z in range(6) for y in range(6) for x in range(6))
+
+    def entry(self, volume, brick):
+        entries = volume.indirection.read()
+        gx, gy, _ = volume.grid
+        index = (brick[2] * gy + brick[1]) * gx + brick[0]
+        return struct.unpack_from('4H', entries, index * 8)
+
+    def test_stream(self):
+        volume = self.create()
+        self.assertEqual(volume.grid, (3, 3, 2))
+        self.assertEqual(volume.cache.size, (12, 12, 6))
+        self.assertEqual(self.entry(volume, (2, 2, 1)), (0, 0, 0, 0))
+
+        bricks = [(0, 0, 0), (2, 2, 1), (1, 0, 1)]
+        self.assertEqual(volume.request(bricks), 3)
+        self.assertEqual(volume.resident, 3)
+
+        for brick in bricks:
+            slot = volume.slot(brick)
+            self.assertEqual(self.entry(volume, brick), slot + (1,))
+            self.assertEqual(self.read_slot(volume, slot), self.expected_brick(brick))
+
+        # Resident bricks are not loaded again
+        self.assertEqual(volume.request(bricks), 0)
+        self.assertEqual(volume.uploads, 3)
+        volume.release()
+        self.assertIsInstance(volume.cache.mglo, moderngl.mgl.InvalidObject)
+
+    def test_priority(self):
+        volume = self.create()
+        volume.request([(0, 0, 0), (1, 0, 0), (2, 0, 0), (0, 1, 0)])
+        self.assertEqual(volume.resident, 4)
+
+        # The least recently requested bricks are evicted first
+        self.assertEqual(volume.request([(0, 0, 0), (1, 1, 0)]), 1)
+        self.assertIsNone(volume.slot((1, 0, 0)))
+        self.assertEqual(volume.evictions, 1)
+        self.assertEqual(self.entry(volume, (1, 0, 0)), (0, 0, 0, 0))
+
+        # Higher priority bricks take the slots of the lower priority ones
+        bricks = [(0, 0, 1), (1, 0, 1), (2, 0, 1), (0, 1, 1), (0, 0, 0), (1, 1, 0)]
+        self.assertEqual(volume.request(bricks), 4)
+        self.assertEqual(volume.misses, 2)
+        self.assertEqual([volume.slot(brick) is not None for brick in bricks], [True] * 4 + [False] * 2)
+        self.assertEqual(self.read_slot(volume, volume.slot((2, 0, 1))), self.expected_brick((2, 0, 1)))
+
+    def test_max_uploads(self):
+        volume = self.create()
+        self.assertEqual(volume.request([(0, 0, 0), (1, 0, 0), (2, 0, 0)], max_uploads=2), 2)
+        self.assertEqual(volume.misses, 1)
+        self.assertIsNone(volume.slot((2, 0, 0)))
+
+    def test_invalid(self):
+        with self.assertRaises(moderngl.Error):
+            self.ctx.brick_volume(self.path, (10, 9, 8), 1, brick_size=4, cache_bricks=(1, 1, 1))
+
+        with self.assertRaises(moderngl.Error):
+            self.ctx.brick_volume(os.path.join(self.tempdir, 'missing.raw'), SIZE, 1)
+
+        with self.assertRaises(ValueError):
+            self.ctx.brick_volume(self.path, SIZE, 1, brick_size=0)
+
+        with self.assertRaises(ValueError):
+            self.ctx.brick_volume(self.path, SIZE, 1, brick_size=4, border=-1)
+
+        with self.assertRaises(ValueError):
+            self.ctx.brick_volume(self.path, (0, 9, 8), 1, brick_size=4)
+
+        # The native checks hold for the internal interface too
+        cache = self.ctx.texture3d((8, 8, 8), 1)
+        indirection = self.ctx.texture3d((1, 1, 1), 4, dtype='u2')
+        for brick_size, border in [(4, -2), (0, 4), (4, 1 << 30), (-8, 0)]:
+            with self.assertRaises(moderngl.Error):
+                self.ctx.mglo.brick_volume(cache.mglo, indirection.mglo, self.path, SIZE, brick_size, border, 0)
+        cache.release()
+        indirection.release()
+
+        volume = self.create()
+        with self.assertRaises(moderngl.Error):
+            volume.request([(3, 0, 0)])
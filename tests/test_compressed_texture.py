@@ -0,0 +1,87 @@
+import os
+import unittest
+
+import moderngl
+
+from common import get_context
+
+
+class TestCase(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        # RGTC (bc4 and bc5) is core since OpenGL 3.0
+        cls.ctx = get_context()
+
+    def test_texture(self):
+        # 8x12 pixels are 2x3 blocks of 8 bytes
+        data = os.urandom(2 * 3 * 8)
+        texture = self.ctx.texture((8, 12), 1, data, dtype='bc4')
+        self.assertEqual(texture.read(), data)
+
+        buf = bytearray(len(data))
+        texture.read_into(buf)
+        self.assertEqual(buf, data)
+        self.assertEqual(self.ctx.error, 'GL_NO_ERROR')
+
+    def test_partial_blocks(self):
+        # 6x6 pixels are stored in 2x2 blocks
+        data = os.urandom(2 * 2 * 16)
+        texture = self.ctx.texture((6, 6), 2, data, dtype='bc5')
+        self.assertEqual(texture.read(), data)
+        self.assertEqual(self.ctx.error, 'GL_NO_ERROR')
+
+    def test_write(self):
+        texture = self.ctx.texture((8, 8), 1, dtype='bc4')
+        block = os.urandom(8)
+        texture.write(block, viewport=(4, 4, 4, 4))
+        self.assertEqual(texture.read()[24:], block)
+
+        with self.assertRaises(moderngl.Error):
+            texture.write(block, viewport=(2, 0, 4, 4))
+
+        with self.assertRaises(moderngl.Error):
+            texture.write(block * 2, viewport=(0, 0, 4, 4))
+
+    def test_mipmap_chain(self):
+        mips = [os.urandom(4 * 4 * 8), os.urandom(2 * 2 * 8), os.urandom(8)]
+        texture = self.ctx.texture((16, 16), 1, dtype='bc4', levels=3)
+        for level, mip in enumerate(mips):
+            texture.write(mip, level=level)
+
+        for level, mip in enumerate(mips):
+            self.assertEqual(texture.read(level=level), mip)
+
+        self.assertEqual(self.ctx.error, 'GL_NO_ERROR')
+
+    def test_texture_array(self):
+        data = os.urandom(2 * 2 * 8 * 3)
+        texture = self.ctx.texture_array((8, 8, 3), 1, data, dtype='bc4')
+        self.assertEqual(texture.read(), data)
+
+        layer = os.urandom(2 * 2 * 8)
+        texture.write(layer, viewport=(0, 0, 1, 8, 8, 1))
+        self.assertEqual(texture.read(), data[:32] + layer + data[64:])
+        self.assertEqual(self.ctx.error, 'GL_NO_ERROR')
+
+    def test_texture_cube(self):
+        data = os.urandom(2 * 2 * 16 * 6)
+        texture = self.ctx.texture_cube((8, 8), 2, data, dtype='bc5')
+        for face in range(6):
+            self.assertEqual(texture.read(face), data[face * 64:face * 64 + 64])
+        self.assertEqual(self.ctx.error, 'GL_NO_ERROR')
+
+    def test_invalid_components(self):
+        with self.assertRaises(moderngl.Error):
+            self.ctx.texture((4, 4), 4, dtype='bc4')
+
+    def test_not_supported(self):
+        with self.assertRaises(moderngl.Error):
+            self.ctx.texture3d((4, 4, 4), 1, dtype='bc4')
+
+        with self.assertRaises(moderngl.Error):
+            self.ctx.renderbuffer((4, 4), 1, dtype='bc4')
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,96 @@
+import unittest
+
+import moderngl
+
+from common import get_context
+
+
+class TestCase(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        cls.ctx = get_context()
+        if cls.ctx.version_code < 430:
+            raise unittest.SkipTest('glCopyImageSubData requires OpenGL 4.3')
+
+    def test_texture_to_texture(self):
+        src = self.ctx.texture((4, 4), 1, bytes(range(16)))
+        dst = self.ctx.texture((4, 4), 1, b'\x00' * 16)
+        self.ctx.copy_texture(dst, src, src_region=(1, 1, 2, 2), dst_offset=(2, 0))
+        self.assertEqual(dst.read(), bytes([0, 0, 5, 6, 0, 0, 9, 10]) + b'\x00' * 8)
+        self.assertEqual(self.ctx.error, 'GL_NO_ERROR')
+
+    def test_whole_level(self):
+        src = self.ctx.texture((2, 2), 4, bytes(range(16)))
+        dst = self.ctx.texture((2, 2), 4)
+        self.ctx.copy_texture(dst, src)
+        self.assertEqual(dst.read(), bytes(range(16)))
+
+    def test_compatible_formats(self):
+        src = self.ctx.texture((2, 1), 4, bytes(range(8)))
+        dst = self.ctx.texture((2, 1), 1, dtype='u4')
+        self.ctx.copy_texture(dst, src)
+        self.assertEqual(dst.read(), bytes(range(8)))
+
+        with self.assertRaises(moderngl.Error):
+            self.ctx.copy_texture(self.ctx.texture((2, 1), 1), src)
+
+    def test_array_layers(self):
+        array = self.ctx.texture_array((2, 2, 3), 1, bytes(range(12)))
+        self.ctx.copy_texture(array, array, src_region=(0, 0, 2, 2, 2, 1), dst_offset=(0, 0, 0))
+        self.assertEqual(array.read(), bytes([8, 9, 10, 11, 4, 5, 6, 7, 8, 9, 10, 11]))
+
+        cube = self.ctx.texture_cube((2, 2), 1)
+        self.ctx.copy_texture(cube, array, src_region=(0, 0, 1, 2, 2, 1), dst_offset=(0, 0, 4))
+        self.assertEqual(cube.read(4), bytes([4, 5, 6, 7]))
+
+        texture = self.ctx.texture((2, 2), 1)
+        self.ctx.copy_texture(texture, cube, src_region=(0, 0, 4, 2, 2, 1))
+        self.assertEqual(texture.read(), bytes([4, 5, 6, 7]))
+
+        volume = self.ctx.texture3d((2, 2, 2), 1)
+        self.ctx.copy_texture(volume, array, src_region=(0, 0, 1, 2, 2, 2))
+        self.assertEqual(volume.read(), bytes([4, 5, 6, 7, 8, 9, 10, 11]))
+        self.assertEqual(self.ctx.error, 'GL_NO_ERROR')
+
+    def test_mipmap_levels(self):
+        src = self.ctx.texture((2, 2), 1, b'\x07' * 4)
+        dst = self.ctx.texture((4, 4), 1, levels=2)
+        self.ctx.copy_texture(dst, src, dst_level=1)
+        self.assertEqual(dst.read(level=1), b'\x07' * 4)
+
+        with self.assertRaises(moderngl.Error):
+            self.ctx.copy_texture(dst, src, dst_level=2)
+
+        with self.assertRaises(moderngl.Error):
+            self.ctx.copy_texture(dst, src, src_level=-1)
+
+        with self.assertRaises(moderngl.Error):
+            self.ctx.copy_texture(dst, src, dst_level=-40)
+
+    def test_renderbuffer(self):
+        fbo = self.ctx.framebuffer([self.ctx.renderbuffer((2, 2), 4)])
+        fbo.clear(0.0, 1.0, 0.0, 1.0)
+        texture = self.ctx.texture((2, 2), 4)
+        self.ctx.copy_texture(texture, fbo.color_attachments[0])
+        self.assertEqual(texture.read(), b'\x00\xff\x00\xff' * 4)
+
+    def test_out_of_range(self):
+        src = self.ctx.texture((4, 4), 1)
+        dst = self.ctx.texture((2, 2), 1)
+
+        with self.assertRaises(moderngl.Error):
+            self.ctx.copy_texture(dst, src)
+
+        with self.assertRaises(moderngl.Error):
+            self.ctx.copy_texture(dst, src, src_region=(3, 3, 2, 2))
+
+        with self.assertRaises(moderngl.Error):
+            self.ctx.copy_texture(dst, src, src_region=(2, 2), dst_offset=(1, 0))
+
+        with self.assertRaises(moderngl.Error):
+            self.ctx.copy_texture(dst, self.ctx.buffer(reserve=4))
+
+
+if __name__ == '__main__':
+    unittest.main()
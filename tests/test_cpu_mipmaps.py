@@ -0,0 +1,94 @@
+import unittest
+
+import numpy as np
+
+import moderngl
+
+from common import get_context
+
+
+class TestCase(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        cls.ctx = get_context()
+
+    def test_box_integer(self):
+        pixels = np.arange(8 * 4 * 2, dtype='u1').reshape(4, 8, 2) * 3
+        texture = self.ctx.texture((8, 4), 2, pixels.tobytes(), dtype='u1')
+        texture.build_mipmaps(cpu=True)
+        self.assertEqual(texture.filter, (moderngl.NEAREST_MIPMAP_NEAREST, moderngl.NEAREST))
+
+        level = np.frombuffer(texture.read(level=1), 'u1').reshape(2, 4, 2)
+        expected = np.floor(pixels.reshape(2, 2, 4, 2, 2).mean(axis=(1, 3)) + 0.5).astype('u1')
+        np.testing.assert_array_equal(level, expected)
+
+        level = np.frombuffer(texture.read(level=3), 'u1')
+        np.testing.assert_array_equal(level, np.floor(pixels.reshape(-1, 2).mean(axis=0) + 0.5))
+
+    def test_depth_pyramid(self):
+        # Odd sizes fold the last row and column into the last texel
+        depth = np.random.RandomState(7).random_sample((5, 7)).astype('f4')
+        texture = self.ctx.texture((7, 5), 1, depth.tobytes(), dtype='f4')
+
+        texture.build_mipmaps(method='max', cpu=True)
+        level = np.frombuffer(texture.read(level=1), 'f4').reshape(2, 3)
+        self.assertEqual(level[0, 0], depth[0:2, 0:2].max())
+        self.assertEqual(level[1, 2], depth[2:5, 4:7].max())
+        self.assertEqual(np.frombuffer(texture.read(level=2), 'f4')[0], depth.max())
+
+        texture.build_mipmaps(method='min', cpu=True)
+        self.assertEqual(np.frombuffer(texture.read(level=2), 'f4')[0], depth.min())
+
+    def test_kaiser(self):
+        pixels = np.full((16, 16, 4), 0.25, 'f4')
+        texture = self.ctx.texture((16, 16), 4, pixels.tobytes(), dtype='f4')
+        texture.build_mipmaps(method='kaiser', cpu=True)
+        self.assertEqual(texture.filter, (moderngl.LINEAR_MIPMAP_LINEAR, moderngl.LINEAR))
+
+        for level in range(1, 5):
+            np.testing.assert_allclose(np.frombuffer(texture.read(level=level), 'f4'), 0.25, rtol=1e-5)
+
+    def test_texture_3d(self):
+        pixels = np.arange(4 * 4 * 4, dtype='f4')
+        texture = self.ctx.texture3d((4, 4, 4), 1, pixels.tobytes(), dtype='f4')
+        texture.build_mipmaps(cpu=True)
+        level = np.frombuffer(texture.read(level=2), 'f4')
+        self.assertAlmostEqual(level[0], pixels.mean())
+
+    def test_texture_array(self):
+        pixels = np.zeros((2, 2, 2), 'i2')
+        pixels[1] = [[-4, 8], [2, 1000]]
+        texture = self.ctx.texture_array((2, 2, 2), 1, pixels.tobytes(), dtype='i2')
+        texture.build_mipmaps(method='max', cpu=True)
+        self.assertEqual(np.frombuffer(texture.read(level=1), 'i2').tolist(), [0, 1000])
+
+    def test_texture_cube(self):
+        cube = self.ctx.texture_cube((2, 2), 1, dtype='u4')
+        for face in range(6):
+            cube.write(face, np.array([face, 1, 2, 3 + face * 10], 'u4').tobytes())
+        cube.build_mipmaps(method='min', cpu=True)
+        for face in range(6):
+            self.assertEqual(np.frombuffer(cube.read(face, level=1), 'u4').tolist(), [min(face, 1)])
+
+        cube = self.ctx.texture_cube((4, 4), 4)
+        cube.build_mipmaps()
+        self.assertEqual(cube.filter, (moderngl.LINEAR_MIPMAP_LINEAR, moderngl.LINEAR))
+
+    def test_immutable(self):
+        pixels = np.arange(4 * 4, dtype='u2').reshape(4, 4)
+        texture = self.ctx.texture((4, 4), 1, pixels.tobytes(), dtype='u2', immutable=True, levels=2)
+        texture.build_mipmaps(method='max', cpu=True)
+        self.assertEqual(np.frombuffer(texture.read(level=1), 'u2').tolist(), [5, 7, 13, 15])
+
+    def test_invalid(self):
+        texture = self.ctx.texture((4, 4), 4, dtype='u1')
+
+        with self.assertRaises(moderngl.Error):
+            texture.build_mipmaps(method='max')
+
+        with self.assertRaises(moderngl.Error):
+            texture.build_mipmaps(method='median', cpu=True)
+
+        with self.assertRaises(moderngl.Error):
+            self.ctx.texture((4, 4), 4, samples=2).build_mipmaps(cpu=True)
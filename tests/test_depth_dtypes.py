@@ -0,0 +1,81 @@
+import struct
+import unittest
+
+import moderngl
+
+from common import get_context
+
+
+class TestCase(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        cls.ctx = get_context()
+
+    def test_read_sizes(self):
+        for dtype, pixel_type, pixel_size in [
+            ('d16', 'u2', 2), ('d24', 'f4', 4), ('d32f', 'f4', 4), ('d24s8', 'u4', 4), ('d32fs8', 'u8', 8),
+        ]:
+            texture = self.ctx.depth_texture((4, 4), dtype=dtype)
+            self.assertEqual((texture.dtype, texture.depth_format), (pixel_type, dtype))
+            self.assertEqual(len(texture.read()), 16 * pixel_size)
+
+            renderbuffer = self.ctx.depth_renderbuffer((4, 4), dtype=dtype)
+            self.assertEqual((renderbuffer.dtype, renderbuffer.depth_format), (pixel_type, dtype))
+
+        self.assertIsNone(self.ctx.texture((4, 4), 1).depth_format)
+        self.assertIsNone(self.ctx.renderbuffer((4, 4), 1).depth_format)
+
+        self.assertEqual(self.ctx.error, 'GL_NO_ERROR')
+
+    def test_default_dtype(self):
+        texture = self.ctx.depth_texture((4, 4), struct.pack('f', 0.5) * 16)
+        self.assertEqual((texture.dtype, texture.depth_format), ('f4', 'd24'))
+        self.assertAlmostEqual(struct.unpack('f', texture.read()[:4])[0], 0.5, places=5)
+
+        # The dtype describes the pixels read() returns
+        rows = struct.pack('4f', 0.0, 0.0, 0.0, 0.0) + struct.pack('4f', 1.0, 1.0, 1.0, 1.0)
+        texture = self.ctx.depth_texture((4, 2), rows)
+        buffer = bytearray(32)
+        texture.read_into(buffer, flip=True)
+        self.assertEqual(bytes(buffer), rows[16:] + rows[:16])
+
+    def test_write_d16(self):
+        texture = self.ctx.depth_texture((4, 4), struct.pack('H', 0x8000) * 16, dtype='d16')
+        self.assertEqual(texture.read(), struct.pack('H', 0x8000) * 16)
+
+    def test_framebuffer_attachment(self):
+        for dtype in ('d16', 'd32f', 'd24s8', 'd32fs8'):
+            for depth in (self.ctx.depth_texture((4, 4), dtype=dtype), self.ctx.depth_renderbuffer((4, 4), dtype=dtype)):
+                fbo = self.ctx.framebuffer([self.ctx.texture((4, 4), 4)], depth)
+                fbo.clear(depth=0.25)
+                value = struct.unpack('f', fbo.read(attachment=-1, dtype='f4')[:4])[0]
+                self.assertAlmostEqual(value, 0.25, places=4)
+
+        self.assertEqual(self.ctx.error, 'GL_NO_ERROR')
+
+    def test_d32fs8_layout(self):
+        texture = self.ctx.depth_texture((4, 4), dtype='d32fs8')
+        self.ctx.framebuffer(depth_attachment=texture).clear(depth=0.5)
+        self.assertEqual(texture.read()[:8], struct.pack('fI', 0.5, 0))
+
+    def test_view(self):
+        if self.ctx.version_code < 430:
+            self.skipTest('texture views require OpenGL 4.3')
+
+        view = self.ctx.depth_texture((4, 4), dtype='d16', immutable=True).view()
+        self.assertEqual((view.dtype, view.depth_format, view.depth), ('u2', 'd16', True))
+
+    def test_invalid_dtype(self):
+        with self.assertRaises(moderngl.Error):
+            self.ctx.depth_texture((4, 4), dtype='f4')
+
+        with self.assertRaises(moderngl.Error):
+            self.ctx.depth_renderbuffer((4, 4), dtype='d8')
+
+        with self.assertRaises(moderngl.Error):
+            self.ctx.texture((4, 4), 1, dtype='d16')
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -76,6 +76,13 @@ class TestCase(unittest.TestCase):
     def test_texture_cube_docs(self):
         self.validate_cls('texture_cube.rst', 'TextureCube', [])
 
+    def test_texture_atlas_docs(self):
+        self.validate_cls('texture_atlas.rst', 'TextureAtlas', [])
+        self.validate_cls('texture_atlas.rst', 'AtlasRegion', [])
+
+    def test_texture_buffer_docs(self):
+        self.validate_cls('texture_buffer.rst', 'TextureBuffer', [])
+
     def test_framebuffer_docs(self):
         self.validate_cls('framebuffer.rst', 'Framebuffer', [])
 
@@ -100,6 +107,12 @@ class TestCase(unittest.TestCase):
     def test_uniform_block_docs(self):
         self.validate_cls('uniform_block.rst', 'UniformBlock', [])
 
+    def test_storage_block_docs(self):
+        self.validate_cls('storage_block.rst', 'StorageBlock', [])
+
+    def test_block_writer_docs(self):
+        self.validate_cls('block_writer.rst', 'BlockWriter', [])
+
     def test_varying_docs(self):
         self.validate_cls('varying.rst', 'Varying', [])
 
@@ -109,6 +122,24 @@ class TestCase(unittest.TestCase):
     def test_sampler_docs(self):
         self.validate_cls('sampler.rst', 'Sampler', [])
 
+    def test_uniform_stream_docs(self):
+        self.validate_cls('uniform_stream.rst', 'UniformStream', [])
+
+    def test_upload_queue_docs(self):
+        self.validate_cls('upload_queue.rst', 'UploadQueue', [])
+
+    def test_render_target_pool_docs(self):
+        self.validate_cls('render_target_pool.rst', 'RenderTargetPool', [])
+
+    def test_brick_volume_docs(self):
+        self.validate_cls('brick_volume.rst', 'BrickVolume', [])
+
+    def test_residency_docs(self):
+        self.validate_cls('residency.rst', 'ResidencyManager', [])
+
+    def test_frame_capture_docs(self):
+        self.validate_cls('frame_capture.rst', 'FrameCapture', [])
+
     def test_moderngl_docs(self):
         self.validate_module(
             'moderngl.rst',
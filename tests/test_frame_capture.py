@@ -0,0 +1,108 @@
+import struct
+import unittest
+
+import moderngl
+
+from common import get_context
+
+
+class TestCase(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        cls.ctx = get_context()
+
+    def test_frames_in_order(self):
+        fbo = self.ctx.simple_framebuffer((4, 4), components=4)
+        capture = moderngl.FrameCapture(fbo, depth=3, components=4)
+        self.assertEqual(capture.frame_size, 64)
+
+        frames = []
+        for i in range(8):
+            fbo.clear(color=(i / 255, 0.0, 0.0, 1.0))
+            frame = capture.read()
+            if frame is not None:
+                self.assertEqual(len(frame), 64)
+                frames.append(frame[0])
+            self.assertLess(capture.pending, 3)
+
+        frames.extend(frame[0] for frame in capture.flush())
+        self.assertEqual(frames, list(range(8)))
+        self.assertEqual(capture.frames, 8)
+        self.assertEqual(capture.pending, 0)
+        self.assertEqual(self.ctx.error, 'GL_NO_ERROR')
+        capture.release()
+        fbo.release()
+
+    def test_viewport_and_dtype(self):
+        fbo = self.ctx.simple_framebuffer((8, 8), components=4, dtype='f4')
+        fbo.clear(color=(0.25, 0.5, 0.75, 1.0))
+        capture = moderngl.FrameCapture(fbo, 2, viewport=(2, 2, 2, 2), components=4, dtype='f4')
+        frame = capture.read() or capture.next(wait=True)
+        self.assertEqual(struct.unpack('4f', frame[:16]), (0.25, 0.5, 0.75, 1.0))
+        self.assertIsNone(capture.next(wait=True))
+        capture.release()
+
+    def test_frame_released(self):
+        # A kept frame must not reach the memory of a recycled or released slot
+        fbo = self.ctx.simple_framebuffer((4, 4), components=4)
+        capture = moderngl.FrameCapture(fbo, 2, components=4)
+        frame = capture.read() or capture.next(wait=True)
+        self.assertEqual(len(frame), 64)
+        capture.read()
+        with self.assertRaises(ValueError):
+            frame[0]
+
+        frame = capture.read() or capture.next(wait=True)
+        capture.release()
+        with self.assertRaises(ValueError):
+            frame[0]
+
+        fbo.release()
+
+    def test_frame_slice(self):
+        # A slice shares the memory of the frame, the slot must not be recycled under it
+        fbo = self.ctx.simple_framebuffer((4, 4), components=4)
+        fbo.clear(color=(1.0, 0.0, 0.0, 1.0))
+        capture = moderngl.FrameCapture(fbo, 2, components=4)
+        frame = capture.read() or capture.next(wait=True)
+        part = frame[:16]
+        cast = frame.cast('I')
+
+        with self.assertRaises(BufferError):
+            capture.read()
+
+        with self.assertRaises(BufferError):
+            capture.release()
+
+        self.assertEqual(bytes(part), b'\xff\x00\x00\xff' * 4)
+        self.assertEqual(cast[0], 0xff0000ff)
+
+        del part, cast
+        capture.read()
+        capture.release()
+        fbo.release()
+
+    def test_read_async(self):
+        fbo = self.ctx.simple_framebuffer((4, 4), components=4)
+        pixels = []
+        for i in range(4):
+            fbo.clear(color=(i / 255, 0.0, 0.0, 1.0))
+            frame = fbo.read_async(components=4, depth=2)
+            if frame is not None:
+                pixels.append(frame[0])
+
+        self.assertEqual(pixels, list(range(len(pixels))))
+        self.assertGreaterEqual(len(pixels), 3)
+        fbo.release()
+        self.assertEqual(self.ctx.error, 'GL_NO_ERROR')
+
+    def test_invalid_depth(self):
+        fbo = self.ctx.simple_framebuffer((4, 4))
+        with self.assertRaises(moderngl.Error):
+            moderngl.FrameCapture(fbo, depth=1)
+        fbo.release()
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,91 @@
+import struct
+import unittest
+
+import moderngl
+
+from common import get_context
+
+
+class TestCase(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        cls.ctx = get_context(require=420)
+        if not cls.ctx:
+            raise unittest.SkipTest('Immutable textures are not supported')
+
+    def test_texture_levels(self):
+        pixels = bytes(range(64)) * 4
+        texture = self.ctx.texture((8, 8), 4, pixels, levels=3)
+        self.assertEqual(texture.read(), pixels)
+        self.assertEqual(len(texture.read(level=2)), 2 * 2 * 4)
+
+        with self.assertRaises(moderngl.Error):
+            texture.read(level=3)
+
+        texture.write(b'\xff' * 16, level=2)
+        self.assertEqual(texture.read(level=2), b'\xff' * 16)
+        self.assertEqual(self.ctx.error, 'GL_NO_ERROR')
+
+    def test_full_mipmap_chain(self):
+        texture = self.ctx.texture((16, 4), 1, b'\x80' * 64, immutable=True)
+        texture.build_mipmaps()
+        self.assertEqual(texture.read(level=4), b'\x80')
+
+        with self.assertRaises(moderngl.Error):
+            texture.read(level=5)
+
+        self.assertEqual(self.ctx.error, 'GL_NO_ERROR')
+
+    def test_too_many_levels(self):
+        with self.assertRaises(moderngl.Error):
+            self.ctx.texture((4, 4), 4, levels=4)
+
+        with self.assertRaises(ValueError):
+            self.ctx.texture((4, 4), 4, levels=0)
+
+    def test_depth_texture(self):
+        texture = self.ctx.depth_texture((4, 4), immutable=True)
+        fbo = self.ctx.framebuffer(depth_attachment=texture)
+        fbo.clear(depth=0.5)
+        self.assertAlmostEqual(struct.unpack('f', texture.read()[:4])[0], 0.5, places=5)
+        self.assertEqual(self.ctx.error, 'GL_NO_ERROR')
+
+    def test_multisample_texture(self):
+        if self.ctx.max_samples < 2:
+            self.skipTest('multisampling is not supported')
+
+        if self.ctx.version_code < 430:
+            with self.assertRaises(moderngl.Error):
+                self.ctx.texture((4, 4), 4, samples=2, immutable=True)
+            return
+
+        self.ctx.texture((4, 4), 4, samples=2, immutable=True)
+        self.assertEqual(self.ctx.error, 'GL_NO_ERROR')
+
+        with self.assertRaises(moderngl.Error):
+            self.ctx.texture((4, 4), 4, samples=2, levels=2)
+
+    def test_texture3d(self):
+        pixels = bytes(range(4 * 4 * 4))
+        texture = self.ctx.texture3d((4, 4, 4), 1, pixels, immutable=True)
+        texture.build_mipmaps()
+        self.assertEqual(texture.read(), pixels)
+        self.assertEqual(self.ctx.error, 'GL_NO_ERROR')
+
+    def test_texture_array(self):
+        pixels = bytes(range(4 * 4 * 3))
+        texture = self.ctx.texture_array((4, 4, 3), 1, pixels, levels=1)
+        self.assertEqual(texture.read(), pixels)
+        self.assertEqual(self.ctx.error, 'GL_NO_ERROR')
+
+    def test_texture_cube(self):
+        pixels = bytes(range(4 * 4 * 6))
+        texture = self.ctx.texture_cube((4, 4), 1, pixels, immutable=True)
+        for face in range(6):
+            self.assertEqual(texture.read(face), pixels[face * 16:face * 16 + 16])
+        self.assertEqual(self.ctx.error, 'GL_NO_ERROR')
+
+
+if __name__ == '__main__':
+    unittest.main()
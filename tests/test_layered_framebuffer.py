@@ -0,0 +1,116 @@
+import struct
+import unittest
+
+import moderngl
+
+from common import get_context
+
+
+class TestCase(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        cls.ctx = get_context()
+
+    def test_layered_array(self):
+        # Every layer is filled with its index by a single draw
+        program = self.ctx.program(
+            vertex_shader='''
+                #version 330
+
+                void main() {
+                    gl_Position = vec4(0.0);
+                }
+            ''',
+            geometry_shader='''
+                #version 330
+
+                layout (points) in;
+                layout (triangle_strip, max_vertices = 12) out;
+
+                out float value;
+
+                void main() {
+                    for (int layer = 0; layer < 3; ++layer) {
+                        for (int i = 0; i < 4; ++i) {
+                            gl_Layer = layer;
+                            value = float(layer + 1) / 255.0;
+                            gl_Position = vec4(float(i % 2) * 4.0 - 2.0, float(i / 2) * 4.0 - 2.0, 0.0, 1.0);
+                            EmitVertex();
+                        }
+                        EndPrimitive();
+                    }
+                }
+            ''',
+            fragment_shader='''
+                #version 330
+
+                in float value;
+                out vec4 color;
+
+                void main() {
+                    color = vec4(value);
+                }
+            ''',
+        )
+
+        texture = self.ctx.texture_array((4, 4, 3), 1)
+        fbo = self.ctx.framebuffer(texture)
+        self.assertEqual(fbo.size, (4, 4))
+        fbo.use()
+        self.ctx.vertex_array(program, []).render(moderngl.POINTS, vertices=1)
+
+        self.assertEqual(texture.read(), bytes([1]) * 16 + bytes([2]) * 16 + bytes([3]) * 16)
+
+    def test_array_layer(self):
+        texture = self.ctx.texture_array((4, 4, 3), 4)
+        fbo = self.ctx.framebuffer((texture, 1))
+        fbo.clear(1.0, 0.0, 0.0, 1.0)
+        self.assertEqual(fbo.color_attachments, ((texture, 1),))
+
+        self.assertEqual(texture.read(), bytes(64) + b'\xff\x00\x00\xff' * 16 + bytes(64))
+
+    def test_cube_face_level(self):
+        cube = self.ctx.texture_cube((8, 8), 4, dtype='f4')
+        cube.build_mipmaps()
+        fbo = self.ctx.framebuffer([(cube, 3, 1)])
+        self.assertEqual(fbo.size, (4, 4))
+        fbo.clear(0.5, 0.25, 0.0, 1.0)
+
+        self.assertEqual(cube.read(3, level=1), struct.pack('4f', 0.5, 0.25, 0.0, 1.0) * 16)
+        self.assertEqual(cube.read(2, level=1), bytes(16 * 16))
+
+    def test_texture_level_and_depth(self):
+        texture = self.ctx.texture((8, 8), 4)
+        texture.build_mipmaps()
+        depth = self.ctx.depth_texture((8, 8))
+        depth.build_mipmaps()
+        fbo = self.ctx.framebuffer([(texture, None, 2)], (depth, None, 2))
+        self.assertEqual(fbo.size, (2, 2))
+        fbo.clear(0.0, 1.0, 0.0, 1.0)
+        self.assertEqual(texture.read(level=2), b'\x00\xff\x00\xff' * 4)
+
+    def test_texture_3d_slice(self):
+        texture = self.ctx.texture3d((2, 2, 4), 1)
+        fbo = self.ctx.framebuffer((texture, 2))
+        fbo.clear(1.0)
+        self.assertEqual(texture.read(), bytes(8) + b'\xff' * 4 + bytes(4))
+
+        layered = self.ctx.framebuffer(texture)
+        layered.clear(1.0)
+        self.assertEqual(texture.read(), b'\xff' * 16)
+
+    def test_invalid(self):
+        texture = self.ctx.texture_array((4, 4, 2), 4)
+
+        with self.assertRaises(moderngl.Error):
+            self.ctx.framebuffer((texture, 2))
+
+        with self.assertRaises(moderngl.Error):
+            self.ctx.framebuffer([(texture, 0, 1)])
+
+        with self.assertRaises(moderngl.Error):
+            self.ctx.framebuffer([(self.ctx.texture((4, 4), 4), 0)])
+
+        with self.assertRaises(moderngl.Error):
+            self.ctx.framebuffer([self.ctx.buffer(reserve=4)])
@@ -0,0 +1,74 @@
+import unittest
+
+from common import get_context
+
+
+class TestCase(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        cls.ctx = get_context()
+
+    def test_keys(self):
+        stats = self.ctx.memory_stats()
+        kinds = ['buffer', 'texture', 'texture3d', 'texture_array', 'texture_cube', 'renderbuffer']
+        self.assertEqual(sorted(stats), sorted(kinds + ['total']))
+        self.assertEqual(stats['total']['bytes'], sum(stats[kind]['bytes'] for kind in kinds))
+
+    def test_buffer(self):
+        before = self.ctx.memory_stats()['buffer']
+        buffer = self.ctx.buffer(reserve=1000)
+        stats = self.ctx.memory_stats()['buffer']
+        self.assertEqual(stats['bytes'], before['bytes'] + 1000)
+        self.assertEqual(stats['objects'], before['objects'] + 1)
+        self.assertGreaterEqual(stats['peak'], stats['bytes'])
+
+        buffer.release()
+        self.assertEqual(self.ctx.memory_stats()['buffer']['bytes'], before['bytes'])
+        self.assertEqual(self.ctx.memory_stats()['buffer']['objects'], before['objects'])
+
+    def test_textures(self):
+        before = self.ctx.memory_stats()
+        textures = [
+            self.ctx.texture((16, 8), 4),
+            self.ctx.texture((16, 16), 1, dtype='f4'),
+            self.ctx.depth_texture((8, 8)),
+            self.ctx.texture3d((4, 4, 4), 2),
+            self.ctx.texture_array((8, 8, 3), 4),
+            self.ctx.texture_cube((4, 4), 4),
+            self.ctx.renderbuffer((8, 8), 4),
+        ]
+        stats = self.ctx.memory_stats()
+
+        def grown(kind):
+            return stats[kind]['bytes'] - before[kind]['bytes']
+
+        self.assertEqual(grown('texture'), 16 * 8 * 4 + 16 * 16 * 4 + 8 * 8 * 4)
+        self.assertEqual(grown('texture3d'), 4 * 4 * 4 * 2)
+        self.assertEqual(grown('texture_array'), 8 * 8 * 3 * 4)
+        self.assertEqual(grown('texture_cube'), 4 * 4 * 6 * 4)
+        self.assertEqual(grown('renderbuffer'), 8 * 8 * 4)
+
+        for texture in textures:
+            texture.release()
+
+        stats = self.ctx.memory_stats()
+        self.assertEqual(stats['total']['bytes'], before['total']['bytes'])
+        self.assertGreaterEqual(stats['total']['peak'], before['total']['bytes'] + 2000)
+
+    def test_mipmaps(self):
+        texture = self.ctx.texture((8, 8), 4)
+        before = self.ctx.memory_stats()['texture']['bytes']
+        texture.build_mipmaps()
+        # 8x8, 4x4, 2x2 and 1x1 levels
+        self.assertEqual(self.ctx.memory_stats()['texture']['bytes'], before + (16 + 4 + 1) * 4)
+        texture.release()
+
+    def test_immutable(self):
+        if self.ctx.version_code < 420:
+            self.skipTest('immutable textures require OpenGL 4.2')
+
+        before = self.ctx.memory_stats()['texture_array']['bytes']
+        texture = self.ctx.texture_array((4, 4, 2), 1, immutable=True)
+        self.assertEqual(self.ctx.memory_stats()['texture_array']['bytes'], before + (16 + 4 + 1) * 2)
+        texture.release()
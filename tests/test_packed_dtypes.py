@@ -0,0 +1,84 @@
+import struct
+import unittest
+
+import moderngl
+import numpy as np
+
+from common import get_context
+
+
+class TestCase(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        cls.ctx = get_context()
+
+    def test_texture_write_read(self):
+        for dtype, components in [('r11g11b10f', 3), ('rgb9e5', 3), ('rgb10a2', 4), ('srgb8', 3), ('srgb8', 4)]:
+            pixels = np.random.rand(16, components).astype('f4')
+            data = moderngl.encode_pixels(pixels, dtype, components)
+            texture = self.ctx.texture((4, 4), components, data, dtype=dtype)
+            self.assertEqual(texture.read(), data)
+
+        texture = self.ctx.texture3d((2, 2, 2), 3, dtype='r11g11b10f')
+        self.assertEqual(len(texture.read()), 32)
+        self.assertEqual(self.ctx.error, 'GL_NO_ERROR')
+
+    def test_invalid_components(self):
+        with self.assertRaises(moderngl.Error):
+            self.ctx.texture((4, 4), 4, dtype='r11g11b10f')
+
+        with self.assertRaises(moderngl.Error):
+            self.ctx.renderbuffer((4, 4), 3, dtype='rgb10a2')
+
+        with self.assertRaises(moderngl.Error):
+            moderngl.encode_pixels(b'\x00' * 16, 'rgb9e5', 4)
+
+        with self.assertRaises(moderngl.Error):
+            moderngl.encode_pixels(b'\x00' * 16, 'f4', 4)
+
+    def test_framebuffer_read(self):
+        fbo = self.ctx.framebuffer([self.ctx.renderbuffer((4, 4), 4, dtype='rgb10a2')])
+        fbo.clear(1.0, 0.0, 0.0, 1.0)
+        self.assertEqual(fbo.read(components=4, dtype='rgb10a2'), struct.pack('I', 0xc00003ff) * 16)
+
+        fbo = self.ctx.framebuffer([self.ctx.texture((4, 4), 3, dtype='r11g11b10f')])
+        fbo.clear(2.0, 0.5, 1008.0)
+        pixels = moderngl.decode_pixels(fbo.read(components=3, dtype='r11g11b10f'), 'r11g11b10f')
+        self.assertEqual(pixels, np.array([2.0, 0.5, 1008.0] * 16, 'f4').tobytes())
+
+        with self.assertRaises(moderngl.Error):
+            fbo.read(components=4, dtype='r11g11b10f')
+
+    def test_encode_decode(self):
+        # 17 pixels cover both the 4 pixel and the single pixel paths
+        pixels = np.random.rand(17, 3).astype('f4') * 100.0
+        for dtype, tolerance in [('r11g11b10f', 1.0 / 32.0), ('rgb9e5', 1.0 / 256.0)]:
+            data = moderngl.encode_pixels(pixels, dtype)
+            self.assertEqual(len(data), 17 * 4)
+            decoded = np.frombuffer(moderngl.decode_pixels(data, dtype), 'f4').reshape(17, 3)
+            error = np.abs(decoded - pixels) / pixels.max(axis=1, keepdims=True)
+            self.assertLess(error.max(), tolerance)
+            self.assertEqual(data[:4], moderngl.encode_pixels(pixels[0], dtype))
+            self.assertEqual(data[-4:], moderngl.encode_pixels(pixels[-1], dtype))
+
+        pixels = np.random.rand(17, 4).astype('f4')
+        decoded = moderngl.decode_pixels(moderngl.encode_pixels(pixels, 'rgb10a2'), 'rgb10a2')
+        self.assertLess(np.abs(np.frombuffer(decoded, 'f4').reshape(17, 4) - pixels)[:, :3].max(), 0.5 / 1023.0 + 1e-6)
+
+        decoded = moderngl.decode_pixels(moderngl.encode_pixels(pixels, 'srgb8'), 'srgb8')
+        self.assertLess(np.abs(np.frombuffer(decoded, 'f4').reshape(17, 4) - pixels).max(), 0.005)
+
+    def test_special_values(self):
+        pixels = np.array([np.nan, -1.0, 1e9], 'f4')
+        decoded = moderngl.decode_pixels(moderngl.encode_pixels(pixels, 'r11g11b10f'), 'r11g11b10f')
+        self.assertEqual(decoded, np.array([0.0, 0.0, 64512.0], 'f4').tobytes())
+
+        self.assertEqual(moderngl.encode_pixels(np.ones(3, 'f4'), 'rgb9e5'), struct.pack('I', 0x84020100))
+
+        infinity = np.frombuffer(moderngl.decode_pixels(struct.pack('I', 0x7c0), 'r11g11b10f'), 'f4')
+        self.assertEqual(infinity[0], np.inf)
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,119 @@
+import struct
+import unittest
+
+import numpy as np
+
+import moderngl
+
+from common import get_context
+
+
+class TestCase(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        cls.ctx = get_context()
+
+    def test_half_float(self):
+        # 19 values cover the SSE2 path and the scalar tail
+        values = np.array([
+            0.0, 1.0, -2.5, 65504.0, 1e-7, 6e-8, np.inf, -np.inf, np.nan, 3.14159,
+            70000.0, -0.0, 1e-5, 0.1, 100.5, 2049.0, 2051.0, 1.0 / 3.0, -1e-6,
+        ], 'f4')
+        halves = moderngl.convert_pixels(values.tobytes(), (19, 1), 1, 'f4', 'f2')
+        with np.errstate(over='ignore'):
+            self.assertEqual(halves, values.astype('f2').tobytes())
+
+        every_half = np.arange(65536, dtype='u2')
+        floats = np.frombuffer(moderngl.convert_pixels(every_half.tobytes(), (256, 256), 1, 'f2', 'f4'), 'f4')
+        expected = every_half.view('f2').astype('f4')
+        np.testing.assert_array_equal(floats, expected)
+
+    def test_normalize(self):
+        values = np.arange(256, dtype='u1')
+        floats = moderngl.convert_pixels(values.tobytes(), (64, 1), 4, 'f1', 'f4')
+        self.assertEqual(floats, (values.astype('f4') / np.float32(255.0)).tobytes())
+        self.assertEqual(moderngl.convert_pixels(floats, (64, 1), 4, 'f4', 'f1'), values.tobytes())
+
+        clamped = struct.pack('4f', -1.0, 2.0, float('nan'), 0.5)
+        self.assertEqual(moderngl.convert_pixels(clamped, (1, 1), 4, 'f4', 'f1'), b'\x00\xff\x00\x80')
+
+    def test_layouts(self):
+        rgba = bytes(range(1, 21))
+        self.assertEqual(
+            moderngl.convert_pixels(rgba, (5, 1), 4, dst_layout='bgra'),
+            bytes([3, 2, 1, 4, 7, 6, 5, 8, 11, 10, 9, 12, 15, 14, 13, 16, 19, 18, 17, 20]),
+        )
+        self.assertEqual(moderngl.convert_pixels(rgba[:8], (2, 1), 4, dst_layout='rgb'), bytes([1, 2, 3, 5, 6, 7]))
+        self.assertEqual(
+            moderngl.convert_pixels(bytes([1, 2, 3, 5, 6, 7]), (2, 1), 4, src_layout='bgr'),
+            bytes([3, 2, 1, 255, 7, 6, 5, 255]),
+        )
+        self.assertEqual(
+            moderngl.convert_pixels(bytes([1, 2, 3, 5, 6, 7]), (2, 1), 3, dst_layout='planar'),
+            bytes([1, 5, 2, 6, 3, 7]),
+        )
+        self.assertEqual(
+            moderngl.convert_pixels(bytes([1, 2, 3, 4]), (1, 2), 2, 'f1', 'f2', dst_layout='ga', flip=True),
+            np.array([4 / 255, 1.0, 2 / 255, 1.0], 'f2').tobytes(),
+        )
+
+    def test_invalid(self):
+        with self.assertRaises(moderngl.Error):
+            moderngl.convert_pixels(bytes(4), (1, 1), 4, 'u1', 'f1')
+
+        with self.assertRaises(moderngl.Error):
+            moderngl.convert_pixels(bytes(4), (1, 1), 4, dst_layout='rgbx')
+
+        with self.assertRaises(moderngl.Error):
+            moderngl.convert_pixels(bytes(3), (1, 1), 4)
+
+    def test_texture_write(self):
+        pixels = np.linspace(0.0, 1.0, 4 * 3 * 3, dtype='f4').reshape(4, 3, 3)
+        texture = self.ctx.texture((3, 4), 4, dtype='f2')
+        texture.write(pixels, src_dtype='f4', src_layout='rgb', flip=True)
+
+        expected = np.ones((4, 3, 4), 'f4')
+        expected[:, :, :3] = pixels[::-1]
+        self.assertEqual(texture.read(), expected.astype('f2').tobytes())
+
+        texture.write(pixels, (1, 1, 2, 2), src_dtype='f4', src_layout='rgb', row_length=3)
+        expected[1:3, 1:3, :3] = pixels[:2, :2]
+        self.assertEqual(texture.read(), expected.astype('f2').tobytes())
+
+        with self.assertRaises(ValueError):
+            texture.write(self.ctx.buffer(pixels), src_dtype='f4')
+
+    def test_texture_read_into(self):
+        texture = self.ctx.texture((2, 2), 4, bytes(range(16)))
+
+        data = bytearray(20)
+        texture.read_into(data, dst_layout='bgra', flip=True, write_offset=4)
+        self.assertEqual(data, bytes(4) + bytes([10, 9, 8, 11, 14, 13, 12, 15, 2, 1, 0, 3, 6, 5, 4, 7]))
+
+        floats = bytearray(2 * 2 * 3 * 4)
+        texture.read_into(floats, dst_dtype='f4', dst_layout='rgb')
+        expected = np.frombuffer(bytes(range(16)), 'u1').reshape(4, 4)[:, :3].astype('f4') / np.float32(255.0)
+        self.assertEqual(floats, expected.tobytes())
+
+        buffer = self.ctx.buffer(reserve=20)
+        texture.read_into(buffer, dst_layout='planar', write_offset=4)
+        self.assertEqual(buffer.read(size=16, offset=4), bytes([0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15]))
+
+    def test_framebuffer_read_into(self):
+        fbo = self.ctx.simple_framebuffer((3, 2), components=4)
+        fbo.use()
+        fbo.clear(1.0, 0.0, 0.0, 1.0)
+        fbo.clear(0.0, 0.0, 1.0, 1.0, viewport=(0, 1, 3, 1))
+
+        data = bytearray(3 * 2 * 4)
+        fbo.read_into(data, components=4, dst_layout='bgra', flip=True)
+        self.assertEqual(data, b'\xff\x00\x00\xff' * 3 + b'\x00\x00\xff\xff' * 3)
+
+        planes = bytearray(3 * 2 * 3)
+        fbo.read_into(planes, components=3, dst_layout='planar')
+        self.assertEqual(planes, b'\xff\xff\xff\x00\x00\x00' + bytes(6) + b'\x00\x00\x00\xff\xff\xff')
+
+        buffer = self.ctx.buffer(reserve=3 * 2 * 3)
+        fbo.read_into(buffer, components=3, dst_layout='bgr')
+        self.assertEqual(buffer.read(), b'\x00\x00\xff' * 3 + b'\xff\x00\x00' * 3)
@@ -0,0 +1,90 @@
+import unittest
+
+import moderngl
+
+from common import get_context
+
+
+class TestCase(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        cls.ctx = get_context()
+
+    def test_write_tile(self):
+        # A 2x2 tile at (3, 1) of an 8x4 single channel image
+        image = bytes(range(32))
+        texture = self.ctx.texture((2, 2), 1)
+        texture.write(image, row_length=8, skip_pixels=3, skip_rows=1)
+        self.assertEqual(texture.read(), bytes([11, 12, 19, 20]))
+
+        with self.assertRaises(moderngl.Error):
+            texture.write(image[:20], row_length=8, skip_pixels=3, skip_rows=1)
+
+    def test_read_into_tile(self):
+        texture = self.ctx.texture((2, 2), 2, b'\x01\x02\x03\x04\x05\x06\x07\x08')
+        image = bytearray(32)
+        texture.read_into(image, row_length=4, skip_pixels=1, skip_rows=2)
+        expected = bytearray(32)
+        expected[18:22] = b'\x01\x02\x03\x04'
+        expected[26:30] = b'\x05\x06\x07\x08'
+        self.assertEqual(image, expected)
+
+        with self.assertRaises(moderngl.Error):
+            texture.read_into(bytearray(29), row_length=4, skip_pixels=1, skip_rows=2)
+
+        # The pixel store parameters are restored after the transfer
+        self.assertEqual(texture.read(), b'\x01\x02\x03\x04\x05\x06\x07\x08')
+
+    def test_texture3d_image_height(self):
+        # A 2x2x2 block out of a 4x3x2 volume
+        volume = bytes(range(24))
+        texture = self.ctx.texture3d((2, 2, 2), 1)
+        texture.write(volume, row_length=4, image_height=3, skip_pixels=1)
+        self.assertEqual(texture.read(), bytes([1, 2, 5, 6, 13, 14, 17, 18]))
+
+        out = bytearray(24)
+        texture.read_into(out, row_length=4, image_height=3, skip_pixels=1)
+        self.assertEqual(bytes(out[1:3] + out[5:7] + out[13:15] + out[17:19]), bytes([1, 2, 5, 6, 13, 14, 17, 18]))
+
+    def test_texture_array_and_cube(self):
+        image = bytes(range(16))
+        texture = self.ctx.texture_array((2, 2, 2), 1)
+        texture.write(image, row_length=4, image_height=2, skip_pixels=2)
+        self.assertEqual(texture.read(), bytes([2, 3, 6, 7, 10, 11, 14, 15]))
+
+        cube = self.ctx.texture_cube((2, 2), 1)
+        cube.write(1, image, row_length=4, skip_rows=2)
+        self.assertEqual(cube.read(1), bytes([8, 9, 12, 13]))
+
+    def test_framebuffer_read_into(self):
+        fbo = self.ctx.simple_framebuffer((2, 2), components=4)
+        fbo.use()
+        fbo.clear(1.0, 0.0, 0.0, 1.0)
+        image = bytearray(4 * 4 * 4)
+        fbo.read_into(image, components=4, row_length=4, skip_pixels=2, skip_rows=2)
+        self.assertEqual(image[32:40], b'\x00' * 8)
+        self.assertEqual(image[40:48], b'\xff\x00\x00\xff' * 2)
+        self.assertEqual(image[56:64], b'\xff\x00\x00\xff' * 2)
+
+    def test_negative(self):
+        texture = self.ctx.texture((2, 2), 1)
+        with self.assertRaises(moderngl.Error):
+            texture.write(b'\x00' * 4, row_length=-1)
+
+    def test_size_overflow(self):
+        # The client memory spans more than 2 GiB, it must not wrap around to a small size
+        texture = self.ctx.texture((4, 4), 4)
+        with self.assertRaises(moderngl.Error):
+            texture.write(b'\x00' * 64, row_length=1 << 28)
+
+        with self.assertRaises(moderngl.Error):
+            texture.read_into(bytearray(64), row_length=1 << 28)
+
+        fbo = self.ctx.simple_framebuffer((4, 4), components=4)
+        with self.assertRaises(moderngl.Error):
+            fbo.read_into(bytearray(64), components=4, row_length=1 << 28)
+
+
+if __name__ == '__main__':
+    unittest.main()
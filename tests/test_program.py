@@ -85,6 +85,36 @@ class TestCase(unittest.TestCase):
                 self.assertEqual(p.geometry_input, in_type)
                 self.assertEqual(p.geometry_output, out_type, msg=f"input: {in_name}, output: {out_name}")
 
+    def test_lazy_members(self):
+        program = self.ctx.program(
+            vertex_shader="""
+                #version 330
+
+                in vec2 in_vert;
+                uniform vec2 offset;
+                uniform float scale[4];
+
+                void main() {
+                    gl_Position = vec4(in_vert * scale[0] * scale[3] + offset, 0.0, 1.0);
+                }
+            """,
+        )
+
+        self.assertEqual(list(program), ['in_vert', 'offset', 'scale'])
+        self.assertIn('offset', program)
+        self.assertNotIn('missing', program)
+        self.assertIsNone(program.get('missing', None))
+
+        with self.assertRaises(KeyError):
+            program['missing']
+
+        program.set_uniforms({'offset': (1.0, 2.0)})
+        offset = program['offset']
+        self.assertIs(program['offset'], offset)
+        self.assertEqual(offset.value, (1.0, 2.0))
+        self.assertEqual(program['scale'].array_length, 4)
+        self.assertIsInstance(program['in_vert'], moderngl.Attribute)
+
 
 if __name__ == '__main__':
     unittest.main()
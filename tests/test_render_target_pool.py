@@ -0,0 +1,118 @@
+import unittest
+
+import moderngl
+
+from common import get_context
+
+
+class TestCase(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        cls.ctx = get_context()
+
+    def test_recycle(self):
+        pool = self.ctx.render_target_pool()
+        a = pool.texture((64, 64), 4, dtype='f2')
+        pool.recycle(a)
+        b = pool.texture((64, 64), 4, dtype='f2')
+        c = pool.texture((64, 64), 4, dtype='f2')
+        self.assertIs(a, b)
+        self.assertIsNot(b, c)
+        self.assertEqual((pool.hits, pool.misses), (1, 2))
+        self.assertAlmostEqual(pool.hit_rate, 1 / 3)
+        self.assertEqual(pool.active, 2)
+        self.assertEqual(pool.memory, 2 * 64 * 64 * 4 * 2)
+
+        # Another shape is a miss
+        d = pool.texture((64, 64), 4, dtype='f1')
+        pool.recycle(d)
+        self.assertIsNot(pool.texture((64, 64), 3), d)
+
+        with self.assertRaises(ValueError):
+            pool.recycle(self.ctx.texture((4, 4), 1))
+
+        pool.release()
+        self.assertEqual(pool.memory, 0)
+
+    def test_framebuffer(self):
+        pool = self.ctx.render_target_pool()
+        fbo = pool.framebuffer((32, 16), 4)
+        self.assertEqual(fbo.size, (32, 16))
+        self.assertIsNotNone(fbo.depth_attachment)
+        fbo.viewport = (0, 0, 4, 4)
+        pool.recycle(fbo)
+
+        again = pool.framebuffer((32, 16), 4)
+        self.assertIs(again, fbo)
+        self.assertEqual(again.viewport, (0, 0, 32, 16))
+
+        no_depth = pool.framebuffer((32, 16), 4, depth=False)
+        self.assertIsNone(no_depth.depth_attachment)
+
+        depth = pool.depth_texture((32, 16))
+        pool.recycle(depth)
+        self.assertIs(pool.depth_texture((32, 16)), depth)
+        pool.release()
+
+    def test_aging(self):
+        pool = self.ctx.render_target_pool(max_age=2)
+        texture = pool.texture((8, 8), 1)
+        glo = texture.glo
+        pool.recycle(texture)
+        pool.next_frame()
+        pool.next_frame()
+        self.assertEqual(pool.idle, 1)
+        pool.next_frame()
+        self.assertEqual(pool.idle, 0)
+        self.assertEqual(pool.memory, 0)
+        self.assertIsInstance(texture.mglo, moderngl.mgl.InvalidObject)
+        self.assertNotEqual(glo, 0)
+
+    def test_memory_cap(self):
+        pool = self.ctx.render_target_pool(max_memory=2 * 1024)
+        textures = [pool.texture((16, 16), 4) for _ in range(3)]
+        for texture in textures:
+            pool.recycle(texture)
+
+        # Only two 1 KiB textures fit, the first one recycled is released
+        self.assertEqual(pool.idle, 2)
+        self.assertEqual(pool.idle_memory, 2 * 1024)
+        self.assertIsInstance(textures[0].mglo, moderngl.mgl.InvalidObject)
+        pool.clear()
+        self.assertEqual(pool.idle, 0)
+        pool.release()
+
+    def test_released(self):
+        pool = self.ctx.render_target_pool()
+        texture = pool.texture((16, 16), 4)
+        fbo = pool.framebuffer((16, 16), 4)
+        color, depth = fbo.color_attachments[0], fbo.depth_attachment
+        self.assertEqual(pool.active, 2)
+
+        # Releasing an object does not return it to the pool, it is dropped from the statistics
+        texture.release()
+        self.assertEqual(pool.active, 1)
+        self.assertEqual(pool.memory, 16 * 16 * 4 * 2)
+        with self.assertRaises(ValueError):
+            pool.recycle(texture)
+
+        # A released framebuffer takes its attachments with it
+        fbo.release()
+        with self.assertRaises(ValueError):
+            pool.recycle(fbo)
+        self.assertEqual((pool.active, pool.memory), (0, 0))
+        self.assertIsInstance(color.mglo, moderngl.mgl.InvalidObject)
+        self.assertIsInstance(depth.mglo, moderngl.mgl.InvalidObject)
+
+        # An object released after it is recycled is never handed out again
+        again = pool.texture((16, 16), 4)
+        pool.recycle(again)
+        again.release()
+        self.assertEqual((pool.idle, pool.idle_memory, pool.memory), (0, 0, 0))
+        self.assertIsNot(pool.texture((16, 16), 4), again)
+        pool.release()
+
+
+if __name__ == '__main__':
+    unittest.main()
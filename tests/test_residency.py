@@ -0,0 +1,241 @@
+import struct
+import unittest
+
+import moderngl
+
+from common import get_context
+
+
+class TestCase(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        cls.ctx = get_context()
+
+    def tearDown(self):
+        self.ctx._residency = None
+
+    def test_evict_restore(self):
+        residency = self.ctx.residency_manager(1 << 40)
+        texture = self.ctx.texture((4, 4), 4, bytes(range(64)))
+        residency.manage(texture)
+
+        before = self.ctx.memory_stats()['texture']['bytes']
+        residency.evict(texture)
+        self.assertTrue(residency.is_evicted(texture))
+        self.assertEqual(self.ctx.memory_stats()['texture']['bytes'], before - 64)
+
+        texture.use(0)
+        self.assertFalse(residency.is_evicted(texture))
+        self.assertEqual(self.ctx.memory_stats()['texture']['bytes'], before)
+        self.assertEqual(texture.read(), bytes(range(64)))
+        self.assertEqual((residency.evictions, residency.restores), (1, 1))
+        texture.release()
+
+    def test_lru(self):
+        textures = [self.ctx.texture((16, 16), 4, bytes([i]) * 1024) for i in range(4)]
+        total = self.ctx.memory_stats()['total']['bytes']
+
+        # Room for two of the four managed textures
+        residency = self.ctx.residency_manager(total - 2 * 1024)
+        for texture in textures:
+            residency.manage(texture)
+
+        textures[0].use(0)
+        self.assertEqual(residency.enforce(), 2)
+        self.assertEqual([residency.is_evicted(texture) for texture in textures], [False, True, True, False])
+        self.assertEqual(residency.textures, [textures[1], textures[2], textures[3], textures[0]])
+
+        # Restoring a texture does not evict the others, enforce evicts the least recently used one
+        textures[1].bind_to_image(0, read=True, write=False)
+        self.assertEqual([residency.is_evicted(texture) for texture in textures], [False, False, True, False])
+        self.assertEqual(residency.enforce(), 1)
+        self.assertEqual([residency.is_evicted(texture) for texture in textures], [False, False, True, True])
+        self.assertLessEqual(self.ctx.memory_stats()['total']['bytes'], residency.budget)
+
+        for i, texture in enumerate(textures):
+            residency.unmanage(texture)
+            self.assertEqual(texture.read(), bytes([i]) * 1024)
+            texture.release()
+
+    def test_render_under_pressure(self):
+        program = self.ctx.program(
+            vertex_shader='''
+                #version 330 core
+                void main() {
+                    gl_Position = vec4(float(gl_VertexID % 2) * 4.0 - 1.0, float(gl_VertexID / 2) * 4.0 - 1.0, 0.0, 1.0);
+                }
+            ''',
+            fragment_shader='''
+                #version 330 core
+                uniform sampler2D texture_a;
+                uniform sampler2D texture_b;
+                out vec4 color;
+                void main() {
+                    color = vec4(texture(texture_a, vec2(0.5)).r, texture(texture_b, vec2(0.5)).r, 0.0, 1.0);
+                }
+            ''',
+        )
+        program['texture_a'] = 0
+        program['texture_b'] = 1
+        vao = self.ctx.vertex_array(program, [])
+        fbo = self.ctx.simple_framebuffer((1, 1), components=4)
+
+        a = self.ctx.texture((16, 16), 1, b'\x10' * 256)
+        b = self.ctx.texture((16, 16), 1, b'\x20' * 256)
+
+        # Room for one of the two textures, both are bound for the same draw
+        residency = self.ctx.residency_manager(self.ctx.memory_stats()['total']['bytes'] - 256)
+        residency.manage(a)
+        residency.manage(b)
+        residency.evict(a)
+        residency.evict(b)
+
+        self.ctx.enable_only(moderngl.NOTHING)
+        fbo.use()
+        a.use(0)
+        b.use(1)
+        vao.render(moderngl.TRIANGLES, vertices=3)
+        self.assertEqual(fbo.read(components=4), b'\x10\x20\x00\xff')
+
+        self.assertEqual(residency.enforce(), 1)
+        self.assertTrue(residency.is_evicted(a))
+
+        for texture in (a, b):
+            residency.unmanage(texture)
+            texture.release()
+        fbo.release()
+        vao.release()
+        program.release()
+
+    def test_storage_access(self):
+        residency = self.ctx.residency_manager(1 << 40)
+        texture = self.ctx.texture((2, 2), 4, bytes(range(16)))
+        residency.manage(texture)
+
+        # Every access to the texels restores the storage first
+        residency.evict(texture)
+        self.assertEqual(texture.read(), bytes(range(16)))
+
+        residency.evict(texture)
+        texture.write(bytes(16))
+        self.assertFalse(residency.is_evicted(texture))
+        self.assertEqual(texture.read(), bytes(16))
+
+        residency.evict(texture)
+        out = bytearray(16)
+        texture.read_into(out)
+        self.assertEqual(out, bytes(16))
+
+        residency.evict(texture)
+        texture.build_mipmaps()
+        self.assertFalse(residency.is_evicted(texture))
+
+        other = self.ctx.simple_framebuffer((2, 2))
+        residency.evict(texture)
+        with self.ctx.scope(other, textures=((texture, 0),)):
+            self.assertFalse(residency.is_evicted(texture))
+        other.release()
+
+        residency.evict(texture)
+        fbo = self.ctx.framebuffer([texture])
+        self.assertFalse(residency.is_evicted(texture))
+
+        residency.evict(texture)
+        fbo.clear(1.0, 0.0, 0.0, 1.0)
+        self.assertEqual(texture.read(), b'\xff\x00\x00\xff' * 4)
+
+        residency.evict(texture)
+        self.assertEqual(fbo.read(components=4), b'\xff\x00\x00\xff' * 4)
+        fbo.release()
+        texture.release()
+
+    def test_bound_attachments(self):
+        textures = [self.ctx.texture((16, 16), 4) for _ in range(2)]
+        residency = self.ctx.residency_manager(0)
+        for texture in textures:
+            residency.manage(texture)
+
+        fbo = self.ctx.framebuffer([textures[0]])
+        fbo.use()
+        textures[1].use(0)
+
+        # The attachment of the bound framebuffer is not the most recently used one but is kept
+        self.assertEqual(residency.enforce(), 0)
+        self.assertFalse(residency.is_evicted(textures[0]))
+
+        other = self.ctx.simple_framebuffer((2, 2))
+        other.use()
+        self.assertEqual(residency.enforce(), 1)
+        self.assertTrue(residency.is_evicted(textures[0]))
+
+        fbo.use()
+        self.assertFalse(residency.is_evicted(textures[0]))
+
+        for texture in textures:
+            residency.unmanage(texture)
+            texture.release()
+        other.release()
+        fbo.release()
+
+    def test_reload(self):
+        reloaded = []
+
+        def reload(texture):
+            reloaded.append(texture)
+            texture.write(0, struct.pack('4f', 1.0, 2.0, 3.0, 4.0))
+
+        residency = self.ctx.residency_manager(0)
+        cube = self.ctx.texture_cube((2, 2), 1, dtype='f4')
+        residency.manage(cube, reload=reload)
+        residency.evict(cube)
+        cube.use(0)
+
+        self.assertEqual(reloaded, [cube])
+        self.assertEqual(cube.read(0), struct.pack('4f', 1.0, 2.0, 3.0, 4.0))
+        cube.release()
+
+    def test_mipmapped_volume(self):
+        residency = self.ctx.residency_manager(0)
+        texture = self.ctx.texture3d((4, 4, 4), 1, bytes(range(64)))
+        texture.build_mipmaps()
+        level = texture.read()
+        residency.manage(texture)
+        before = self.ctx.memory_stats()['texture3d']['bytes']
+        residency.evict(texture)
+        self.assertEqual(self.ctx.memory_stats()['texture3d']['bytes'], before - (64 + 8 + 1))
+
+        texture.use(0)
+        self.assertEqual(texture.read(), level)
+        self.assertEqual(texture.mglo.memory, 64 + 8 + 1)
+        texture.release()
+
+    def test_immutable(self):
+        if self.ctx.version_code < 420:
+            self.skipTest('immutable textures require OpenGL 4.2')
+
+        residency = self.ctx.residency_manager(0)
+        texture = self.ctx.texture((4, 4), 4, levels=1)
+
+        with self.assertRaises(moderngl.Error):
+            residency.manage(texture)
+
+        self.assertEqual(residency.textures, [])
+        texture.release()
+
+    def test_not_evictable(self):
+        residency = self.ctx.residency_manager(0)
+        textures = [
+            self.ctx.texture((4, 4), 4, samples=self.ctx.max_samples) if self.ctx.max_samples > 1 else None,
+            self.ctx.texture((4, 4), 4, dtype='bc1'),
+            self.ctx.texture_array((4, 4, 2), 4, dtype='bc3'),
+        ]
+
+        for texture in textures:
+            if texture is None:
+                continue
+            with self.assertRaises(moderngl.Error):
+                residency.manage(texture)
+            texture.release()
+
+        self.assertEqual(residency.textures, [])
@@ -0,0 +1,84 @@
+import struct
+import unittest
+
+import moderngl
+import numpy as np
+
+from common import get_context
+
+
+class TestCase(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        cls.ctx = get_context()
+        cls.prog = cls.ctx.program(
+            vertex_shader='''
+                #version 330
+
+                uniform mat4 Mvp;
+                uniform vec3 Color;
+                uniform float Scale;
+                uniform ivec2 Offset;
+                uniform float Weights[3];
+
+                void main() {
+                    vec4 pos = vec4(Color * Scale + vec3(Offset, 0.0), Weights[0] + Weights[1] + Weights[2]);
+                    gl_Position = Mvp * pos;
+                }
+            ''',
+            fragment_shader='''
+                #version 330
+
+                out vec4 color;
+
+                void main() {
+                    color = vec4(1.0);
+                }
+            ''',
+        )
+
+    def test_set_uniforms_tuples(self):
+        self.prog.set_uniforms({
+            'Color': (0.25, 0.5, 0.75),
+            'Scale': 2.0,
+            'Offset': (3, -4),
+            'Weights': [1.0, 2.0, 3.0],
+        })
+        self.assertEqual(self.prog['Color'].value, (0.25, 0.5, 0.75))
+        self.assertEqual(self.prog['Scale'].value, 2.0)
+        self.assertEqual(self.prog['Offset'].value, (3, -4))
+        self.assertEqual(self.prog['Weights'].value, [1.0, 2.0, 3.0])
+
+    def test_set_uniforms_buffers(self):
+        mvp = np.arange(16, dtype='f4')
+        self.prog.set_uniforms({
+            'Mvp': mvp,
+            'Color': np.array([1.5, 2.5, 3.5]),
+            'Offset': np.array([7, 8], dtype='i8'),
+            'Weights': struct.pack('3f', 4.0, 5.0, 6.0),
+        })
+        self.assertEqual(self.prog['Mvp'].value, tuple(mvp.tolist()))
+        self.assertEqual(self.prog['Color'].value, (1.5, 2.5, 3.5))
+        self.assertEqual(self.prog['Offset'].value, (7, 8))
+        self.assertEqual(self.prog['Weights'].value, [4.0, 5.0, 6.0])
+
+    def test_set_uniforms_errors(self):
+        with self.assertRaises(moderngl.Error):
+            self.prog.set_uniforms({'Missing': 1.0})
+
+        with self.assertRaises(moderngl.Error):
+            self.prog.set_uniforms({'Color': np.zeros(4, dtype='f4')})
+
+    def test_uniform_setter(self):
+        setter = self.prog.uniform_setter(['Scale', 'Color'])
+        setter(0.5, np.array([0.1, 0.2, 0.3], dtype='f4'))
+        self.assertEqual(self.prog['Scale'].value, 0.5)
+        np.testing.assert_almost_equal(self.prog['Color'].value, (0.1, 0.2, 0.3))
+
+        with self.assertRaises(moderngl.Error):
+            setter(1.0)
+
+
+if __name__ == '__main__':
+    unittest.main()
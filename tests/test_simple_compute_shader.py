@@ -65,7 +65,7 @@ class TestCase(unittest.TestCase):
         compute_shader.run()
         self.assertIsNotNone(compute_shader.get('multiplier', None))
         self.assertEqual(compute_shader, compute_shader)
-        self.assertEqual([i for i in compute_shader], ['multiplier'])
+        self.assertEqual([i for i in compute_shader], ['multiplier', 'something_in', 'something_out'])
         compute_shader.release()
 
 
@@ -77,6 +77,74 @@ class TestCase(unittest.TestCase):
         self.assertAlmostEqual(z, 0.0)
         self.assertAlmostEqual(w, 1.0)
 
+    def test_cached_subroutines(self):
+        vbo1 = self.ctx.buffer(struct.pack('4f', 0.0, 0.0, 0.0, 0.0))
+        vbo2 = self.ctx.buffer(reserve=16)
+
+        prog = self.ctx.program(
+            vertex_shader='''
+                #version 400
+
+                in vec4 vert;
+                out vec4 color;
+
+                subroutine vec4 color_t();
+
+                subroutine(color_t)
+                vec4 ColorRed() {
+                    return vec4(1, 0, 0, 1);
+                }
+
+                subroutine(color_t)
+                vec4 ColorBlue() {
+                    return vec4(0, 0.5, 1, 1);
+                }
+
+                subroutine uniform color_t Color;
+
+                void main() {
+                    color = vert + Color();
+                }
+            ''',
+            varyings=['color']
+        )
+        other = self.ctx.program(
+            vertex_shader='''
+                #version 400
+
+                in vec4 vert;
+                out vec4 color;
+
+                void main() {
+                    color = vert;
+                }
+            ''',
+            varyings=['color']
+        )
+
+        red = self.ctx.simple_vertex_array(prog, vbo1, 'vert')
+        red.subroutines = [prog['ColorRed'].index]
+        blue = self.ctx.simple_vertex_array(prog, vbo1, 'vert')
+        blue.subroutines = [prog['ColorBlue'].index]
+        plain = self.ctx.simple_vertex_array(other, vbo1, 'vert')
+
+        for vao, expected in [
+            (red, (1.0, 0.0, 0.0, 1.0)),
+            (red, (1.0, 0.0, 0.0, 1.0)),
+            (blue, (0.0, 0.5, 1.0, 1.0)),
+            (red, (1.0, 0.0, 0.0, 1.0)),
+            (plain, (0.0, 0.0, 0.0, 0.0)),
+            (red, (1.0, 0.0, 0.0, 1.0)),
+        ]:
+            vao.transform(vbo2)
+            for a, b in zip(struct.unpack('4f', vbo2.read()), expected):
+                self.assertAlmostEqual(a, b)
+
+        self.ctx.reset_program_state()
+        blue.transform(vbo2)
+        for a, b in zip(struct.unpack('4f', vbo2.read()), (0.0, 0.5, 1.0, 1.0)):
+            self.assertAlmostEqual(a, b)
+
 
 if __name__ == '__main__':
     unittest.main()
@@ -0,0 +1,101 @@
+import unittest
+
+import moderngl
+
+from common import get_context
+
+
+class TestCase(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        cls.ctx = get_context()
+
+    def read_region(self, atlas, region):
+        x, y, width, height = region.viewport
+        return atlas.texture.read(viewport=(x, y, region.layer, width, height, 1))
+
+    def test_pack(self):
+        atlas = self.ctx.texture_atlas((16, 16), 1, layers=2, padding=1)
+        self.assertIsInstance(atlas.texture, moderngl.TextureArray)
+
+        regions = [atlas.add((7, 7), bytes([i + 1]) * 49) for i in range(8)]
+        self.assertTrue(all(regions))
+
+        # Four padded 7x7 images fill a layer
+        self.assertEqual([region.layer for region in regions], [0, 0, 0, 0, 1, 1, 1, 1])
+        self.assertEqual(sorted(region.viewport[:2] for region in regions[:4]), [(0, 0), (0, 8), (8, 0), (8, 8)])
+        self.assertIsNone(atlas.add((7, 7)))
+        self.assertAlmostEqual(atlas.occupancy, 8 * 49 / (16 * 16 * 2))
+
+        for i, region in enumerate(regions):
+            self.assertEqual(self.read_region(atlas, region), bytes([i + 1]) * 49)
+
+        x, y, _, _ = regions[5].viewport
+        self.assertEqual(regions[5].uv, (x / 16, y / 16, (x + 7) / 16, (y + 7) / 16))
+
+    def test_skyline(self):
+        atlas = self.ctx.texture_atlas((8, 8), 1, padding=0)
+        tall = atlas.add((2, 6))
+        wide = atlas.add((6, 2))
+        small = atlas.add((6, 4))
+        self.assertEqual(tall.viewport, (0, 0, 2, 6))
+        self.assertEqual(wide.viewport, (2, 0, 6, 2))
+        self.assertEqual(small.viewport, (2, 2, 6, 4))
+        self.assertEqual(atlas.add((8, 2)).viewport, (0, 6, 8, 2))
+        self.assertIsNone(atlas.add((1, 1)))
+
+    def test_remove(self):
+        atlas = self.ctx.texture_atlas((8, 8), 1, padding=0)
+        regions = [atlas.add((4, 4)) for _ in range(4)]
+        self.assertIsNone(atlas.add((2, 2)))
+
+        atlas.remove(regions[1])
+        self.assertEqual(len(atlas.regions), 3)
+        reused = [atlas.add((2, 2)) for _ in range(4)]
+        self.assertEqual(sorted(region.viewport[:2] for region in reused), [(4, 0), (4, 2), (6, 0), (6, 2)])
+
+        with self.assertRaises(moderngl.Error):
+            atlas.remove(regions[1])
+
+        with self.assertRaises(moderngl.Error):
+            atlas.add((9, 1))
+
+    def test_failed_write(self):
+        atlas = self.ctx.texture_atlas((4, 4), 1, padding=0)
+
+        # The region of an image that cannot be written is freed again
+        with self.assertRaises(moderngl.Error):
+            atlas.add((4, 4), bytes(15))
+
+        self.assertEqual(atlas.regions, [])
+        self.assertEqual(atlas.occupancy, 0.0)
+        self.assertIsNotNone(atlas.add((4, 4), bytes(16)))
+
+    def test_negative_padding(self):
+        with self.assertRaises(moderngl.Error):
+            self.ctx.texture_atlas((4, 4), 1, padding=-1)
+
+    def test_compact(self):
+        if self.ctx.version_code < 430:
+            self.skipTest('compaction requires OpenGL 4.3')
+
+        atlas = self.ctx.texture_atlas((8, 8), 1, layers=2, padding=0)
+        regions = [atlas.add((4, 4), bytes([i + 1]) * 16) for i in range(8)]
+        for region in regions[:6]:
+            atlas.remove(region)
+        self.assertEqual([region.layer for region in atlas.regions], [1, 1])
+
+        self.assertTrue(atlas.compact())
+        self.assertEqual([region.layer for region in atlas.regions], [0, 0])
+        self.assertEqual(self.read_region(atlas, regions[6]), bytes([7]) * 16)
+        self.assertEqual(self.read_region(atlas, regions[7]), bytes([8]) * 16)
+
+        big = atlas.add((8, 8), bytes([9]) * 64)
+        self.assertEqual(big.layer, 1)
+
+    def test_release(self):
+        atlas = self.ctx.texture_atlas((8, 8), 4)
+        atlas.release()
+        self.assertIsInstance(atlas.mglo, moderngl.mgl.InvalidObject)
+        self.assertIsInstance(atlas.texture.mglo, moderngl.mgl.InvalidObject)
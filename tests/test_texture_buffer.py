@@ -0,0 +1,88 @@
+import struct
+import unittest
+
+import moderngl
+
+from common import get_context
+
+
+class TestCase(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        cls.ctx = get_context()
+
+    def fetch(self, texture, sampler, count):
+        program = self.ctx.program(
+            vertex_shader='''
+                #version 330
+
+                uniform %s lookup;
+                out vec4 value;
+
+                void main() {
+                    value = vec4(texelFetch(lookup, gl_VertexID));
+                }
+            ''' % sampler,
+            varyings=['value'],
+        )
+        program['lookup'] = 3
+        texture.use(3)
+        output = self.ctx.buffer(reserve=count * 16)
+        self.ctx.vertex_array(program, []).transform(output, moderngl.POINTS, vertices=count)
+        return struct.unpack('%df' % (count * 4), output.read())
+
+    def test_whole_buffer(self):
+        buffer = self.ctx.buffer(struct.pack('8f', *range(8)))
+        texture = self.ctx.texture_buffer(buffer, 'f4', 4)
+        self.assertEqual(texture.size, 32)
+        self.assertEqual(texture.texels, 2)
+        self.assertIs(texture.buffer, buffer)
+        self.assertEqual(self.fetch(texture, 'samplerBuffer', 2), tuple(float(x) for x in range(8)))
+
+        buffer.write(struct.pack('4f', 10.0, 11.0, 12.0, 13.0), offset=16)
+        self.assertEqual(self.fetch(texture, 'samplerBuffer', 2)[4:], (10.0, 11.0, 12.0, 13.0))
+
+    def test_integer_components(self):
+        buffer = self.ctx.buffer(struct.pack('6I', 1, 2, 3, 4, 5, 6))
+        texture = self.ctx.texture_buffer(buffer, 'u4', 3)
+        self.assertEqual(texture.texels, 2)
+        self.assertEqual(self.fetch(texture, 'usamplerBuffer', 2), (1.0, 2.0, 3.0, 1.0, 4.0, 5.0, 6.0, 1.0))
+
+    def test_range(self):
+        if self.ctx.version_code < 430:
+            self.skipTest('texture buffer ranges require OpenGL 4.3')
+
+        alignment = self.ctx.info['GL_TEXTURE_BUFFER_OFFSET_ALIGNMENT']
+        buffer = self.ctx.buffer(bytes(alignment) + bytes([0, 64, 128, 255]))
+        texture = self.ctx.texture_buffer(buffer, 'f1', 1, offset=alignment, size=4)
+        self.assertEqual(texture.offset, alignment)
+        self.assertEqual([round(x * 255) for x in self.fetch(texture, 'samplerBuffer', 4)[::4]], [0, 64, 128, 255])
+
+    def test_bind_to_image(self):
+        if self.ctx.version_code < 420:
+            self.skipTest('image load/store requires OpenGL 4.2')
+
+        texture = self.ctx.texture_buffer(self.ctx.buffer(reserve=64), 'f4', 4)
+        texture.bind_to_image(0, read=True, write=False)
+        self.assertEqual(self.ctx.error, 'GL_NO_ERROR')
+
+    def test_invalid(self):
+        buffer = self.ctx.buffer(reserve=64)
+
+        with self.assertRaises(moderngl.Error):
+            self.ctx.texture_buffer(buffer, 'f1', 3)
+
+        with self.assertRaises(moderngl.Error):
+            self.ctx.texture_buffer(buffer, 'srgb8', 4)
+
+        with self.assertRaises(moderngl.Error):
+            self.ctx.texture_buffer(buffer, 'f4', 4, size=20)
+
+        with self.assertRaises(moderngl.Error):
+            self.ctx.texture_buffer(buffer, 'f4', 4, offset=64, size=16)
+
+    def test_release(self):
+        texture = self.ctx.texture_buffer(self.ctx.buffer(reserve=16), 'f4', 4)
+        texture.release()
+        self.assertIsInstance(texture.mglo, moderngl.mgl.InvalidObject)
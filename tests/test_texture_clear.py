@@ -0,0 +1,94 @@
+import struct
+import unittest
+
+import moderngl
+
+from common import get_context
+
+
+class TestCase(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        cls.ctx = get_context()
+        if cls.ctx.version_code < 440:
+            raise unittest.SkipTest('glClearTexImage requires OpenGL 4.4')
+
+    def test_float(self):
+        texture = self.ctx.texture((4, 4), 4)
+        texture.clear((1.0, 0.0, 0.5, 1.0))
+        self.assertEqual(texture.read(), b'\xff\x00\x80\xff' * 16)
+
+        texture.clear(0.0, viewport=(2, 2, 2, 2))
+        data = texture.read()
+        self.assertEqual(data[40:48], b'\x00' * 8)
+        self.assertEqual(data[32:40], b'\xff\x00\x80\xff' * 2)
+
+    def test_integer(self):
+        texture = self.ctx.texture((2, 2), 2, dtype='i4')
+        texture.clear((-3, 70000))
+        self.assertEqual(texture.read(), struct.pack('2i', -3, 70000) * 4)
+
+        texture = self.ctx.texture((2, 2), 1, dtype='u2')
+        texture.clear(513)
+        self.assertEqual(texture.read(), struct.pack('4H', 513, 513, 513, 513))
+
+    def test_depth(self):
+        texture = self.ctx.depth_texture((2, 2))
+        texture.clear(0.25)
+        for depth in struct.unpack('4f', texture.read()):
+            self.assertAlmostEqual(depth, 0.25, places=5)
+
+    def test_level(self):
+        texture = self.ctx.texture((4, 4), 1, levels=2)
+        texture.clear(1.0, level=1)
+        self.assertEqual(texture.read(level=1), b'\xff' * 4)
+
+        with self.assertRaises(moderngl.Error):
+            texture.clear(1.0, level=2)
+
+        for obj in (texture, self.ctx.texture3d((2, 2, 2), 1), self.ctx.texture_array((2, 2, 2), 1),
+                    self.ctx.texture_cube((2, 2), 1)):
+            with self.assertRaises(moderngl.Error):
+                obj.clear(1.0, level=-1)
+
+        self.assertEqual(self.ctx.error, 'GL_NO_ERROR')
+
+    def test_texture3d_and_array(self):
+        volume = self.ctx.texture3d((2, 2, 2), 1, dtype='f4')
+        volume.clear(0.0)
+        volume.clear(2.0, viewport=(0, 0, 1, 2, 2, 1))
+        self.assertEqual(struct.unpack('8f', volume.read()), (0.0,) * 4 + (2.0,) * 4)
+
+        array = self.ctx.texture_array((1, 1, 3), 1, dtype='u1')
+        array.clear(7)
+        array.clear(9, viewport=(0, 0, 1, 1, 1, 1))
+        self.assertEqual(array.read(), b'\x07\x09\x07')
+
+    def test_cube(self):
+        cube = self.ctx.texture_cube((2, 2), 1)
+        cube.clear(0.0)
+        cube.clear(1.0, viewport=(0, 0, 3, 2, 2, 1))
+        self.assertEqual(cube.read(3), b'\xff' * 4)
+        self.assertEqual(cube.read(2), b'\x00' * 4)
+
+        cube.clear(1.0, viewport=(1, 1, 1, 1))
+        self.assertEqual(cube.read(0), b'\x00\x00\x00\xff')
+
+    def test_errors(self):
+        texture = self.ctx.texture((2, 2), 3)
+
+        with self.assertRaises(moderngl.Error):
+            texture.clear((1.0, 0.0))
+
+        with self.assertRaises(moderngl.Error):
+            texture.clear(0.0, viewport=(1, 1, 2, 2))
+
+        with self.assertRaises(moderngl.Error):
+            texture.clear('red')
+
+        self.assertEqual(self.ctx.error, 'GL_NO_ERROR')
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,146 @@
+import os
+import shutil
+import struct
+import tempfile
+import unittest
+
+import moderngl
+
+from common import get_context
+
+KTX_IDENTIFIER = b'\xabKTX 11\xbb\r\n\x1a\n'
+KTX2_IDENTIFIER = b'\xabKTX 20\xbb\r\n\x1a\n'
+
+
+def ktx(internal_format, width, height, levels, faces=1, layers=0):
+    header = struct.pack('13I', 0x04030201, 0, 1, 0, internal_format, 0, width, height, 0, layers, faces, levels, 0)
+    return KTX_IDENTIFIER + header
+
+
+def ktx2(vk_format, width, height, levels, layers=0, faces=1):
+    header = struct.pack('9I', vk_format, 1, width, height, 0, layers, faces, levels, 0)
+    return KTX2_IDENTIFIER + header + bytes(32)
+
+
+def dds(four_cc, width, height, levels, caps2=0):
+    pixel_format = struct.pack('8I', 32, 0x4, four_cc, 0, 0, 0, 0, 0)
+    header = struct.pack('7I', 124, 0x20000, height, width, 0, 0, levels) + bytes(44)
+    return b'DDS ' + header + pixel_format + struct.pack('5I', 0, caps2, 0, 0, 0)
+
+
+class TestCase(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        cls.ctx = get_context(require=420)
+        if not cls.ctx:
+            raise unittest.SkipTest('Immutable textures are not supported')
+
+    def setUp(self):
+        self.tempdir = tempfile.mkdtemp()
+
+    def tearDown(self):
+        shutil.rmtree(self.tempdir)
+
+    def write_file(self, name, data):
+        path = os.path.join(self.tempdir, name)
+        with open(path, 'wb') as f:
+            f.write(data)
+        return path
+
+    def test_ktx(self):
+        # 3x2 RGBA8 rows are already 4 byte aligned
+        level0 = bytes(range(24))
+        level1 = bytes(range(100, 104))
+        data = ktx(0x8058, 3, 2, 2) + struct.pack('I', 24) + level0 + struct.pack('I', 4) + level1
+        stats = {}
+        texture = self.ctx.texture_from_file(self.write_file('a.ktx', data), stats=stats)
+        self.assertIsInstance(texture, moderngl.Texture)
+        self.assertEqual(texture.size, (3, 2))
+        self.assertEqual(texture.components, 4)
+        self.assertEqual(texture.read(), level0)
+        self.assertEqual(texture.read(level=1), level1)
+        self.assertEqual(stats['kind'], 'texture')
+        self.assertEqual(stats['levels'], 2)
+        self.assertEqual(stats['bytes'], len(data))
+        self.assertGreaterEqual(stats['seconds'], 0.0)
+        self.assertEqual(self.ctx.error, 'GL_NO_ERROR')
+
+    def test_ktx_cube(self):
+        faces = [bytes([face]) * 16 for face in range(6)]
+        data = ktx(0x8229, 4, 4, 1, faces=6) + struct.pack('I', 16) + b''.join(faces)
+        texture = self.ctx.texture_from_file(self.write_file('cube.ktx', data))
+        self.assertIsInstance(texture, moderngl.TextureCube)
+        for face in range(6):
+            self.assertEqual(texture.read(face), faces[face])
+        self.assertEqual(self.ctx.error, 'GL_NO_ERROR')
+
+    def test_ktx2_compressed(self):
+        # A 8x8 bc4 image is 2x2 blocks, the 4x4 level is a single block
+        level0 = os.urandom(32)
+        level1 = os.urandom(8)
+        header = ktx2(139, 8, 8, 2)
+        offset = len(header) + 48
+        index = struct.pack('6Q', offset, 32, 32, offset + 32, 8, 8)
+        data = header + index + level0 + level1
+        texture = self.ctx.texture_from_file(self.write_file('a.ktx2', data))
+        self.assertEqual(texture.dtype, 'bc4')
+        self.assertEqual(texture.read(), level0)
+        self.assertEqual(texture.read(level=1), level1)
+        self.assertEqual(self.ctx.error, 'GL_NO_ERROR')
+
+    def test_ktx2_array(self):
+        layers = os.urandom(4 * 4 * 3)
+        header = ktx2(9, 4, 4, 1, layers=3)
+        offset = len(header) + 24
+        data = header + struct.pack('3Q', offset, len(layers), len(layers)) + layers
+        texture = self.ctx.texture_from_file(self.write_file('array.ktx2', data))
+        self.assertIsInstance(texture, moderngl.TextureArray)
+        self.assertEqual(texture.size, (4, 4, 3))
+        self.assertEqual(texture.read(), layers)
+        self.assertEqual(self.ctx.error, 'GL_NO_ERROR')
+
+    def test_dds(self):
+        # DXT5 is bc3, the 2x2 level still takes a full block
+        level0 = os.urandom(16 * 4)
+        level1 = os.urandom(16)
+        level2 = os.urandom(16)
+        data = dds(0x35545844, 8, 8, 3) + level0 + level1 + level2
+        texture = self.ctx.texture_from_file(self.write_file('a.dds', data))
+        self.assertEqual(texture.dtype, 'bc3')
+        self.assertEqual(texture.read(), level0)
+        self.assertEqual(texture.read(level=2), level2)
+        self.assertEqual(self.ctx.error, 'GL_NO_ERROR')
+
+    def test_truncated(self):
+        data = ktx(0x8058, 4, 4, 1) + struct.pack('I', 64) + bytes(32)
+        with self.assertRaises(moderngl.Error):
+            self.ctx.texture_from_file(self.write_file('truncated.ktx', data))
+
+    def test_counts_out_of_range(self):
+        # A 4x4 texture has 3 levels, the headers are rejected before any image is read
+        with self.assertRaises(moderngl.Error):
+            self.ctx.texture_from_file(self.write_file('levels.ktx', ktx(0x8058, 4, 4, 4) + bytes(64)))
+
+        with self.assertRaises(moderngl.Error):
+            self.ctx.texture_from_file(self.write_file('levels.ktx2', ktx2(37, 4, 4, 0xFFFFFFF) + bytes(64)))
+
+        with self.assertRaises(moderngl.Error):
+            self.ctx.texture_from_file(self.write_file('levels.dds', dds(0x35545844, 4, 4, 0x7FFFFFFF) + bytes(64)))
+
+        with self.assertRaises(moderngl.Error):
+            self.ctx.texture_from_file(self.write_file('layers.ktx2', ktx2(37, 4, 4, 1, layers=0x7FFFFFFF) + bytes(64)))
+
+        with self.assertRaises(moderngl.Error):
+            self.ctx.texture_from_file(self.write_file('faces.ktx', ktx(0x8058, 4, 4, 1, faces=0xFFFFFFFF) + bytes(64)))
+
+    def test_unknown_file(self):
+        with self.assertRaises(moderngl.Error):
+            self.ctx.texture_from_file(self.write_file('a.png', b'\x89PNG\r\n\x1a\n' + bytes(64)))
+
+        with self.assertRaises(moderngl.Error):
+            self.ctx.texture_from_file(os.path.join(self.tempdir, 'missing.ktx'))
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,105 @@
+import struct
+import unittest
+
+import moderngl
+
+from common import get_context
+
+
+class TestCase(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        cls.ctx = get_context()
+
+    def test_texture3d_viewport(self):
+        data = bytes(range(64))
+        texture = self.ctx.texture3d((4, 4, 4), 1, data)
+        expected = b''.join(data[z * 16 + y * 4 + 1:z * 16 + y * 4 + 3] for z in (2, 3) for y in (1, 2))
+        self.assertEqual(texture.read(viewport=(1, 1, 2, 2, 2, 2)), expected)
+        self.assertEqual(texture.read(viewport=(2, 1, 1)), data[0:2])
+
+        buffer = bytearray(10)
+        texture.read_into(buffer, viewport=(1, 1, 2, 2, 2, 2), write_offset=2)
+        self.assertEqual(bytes(buffer[2:]), expected)
+
+        with self.assertRaises(moderngl.Error):
+            texture.read(viewport=(3, 0, 0, 2, 1, 1))
+
+    def test_texture3d_level(self):
+        texture = self.ctx.texture3d((4, 4, 4), 1, levels=3)
+        texture.write(b'\x10' * 8, level=1)
+        texture.write(b'\x20', level=2)
+        self.assertEqual(texture.read(level=1), b'\x10' * 8)
+        self.assertEqual(texture.read(level=2), b'\x20')
+        self.assertEqual(texture.read(viewport=(1, 0, 1, 1, 1, 1), level=1), b'\x10')
+
+        with self.assertRaises(moderngl.Error):
+            texture.read(level=3)
+
+    def test_texture_array_viewport(self):
+        data = struct.pack('12f', *range(12))
+        texture = self.ctx.texture_array((2, 2, 3), 1, data, dtype='f4')
+        self.assertEqual(texture.read(viewport=(0, 1, 1, 2, 1, 2)), struct.pack('4f', 6, 7, 10, 11))
+
+        buffer = self.ctx.buffer(reserve=16)
+        texture.read_into(buffer, viewport=(0, 1, 1, 2, 1, 2))
+        self.assertEqual(buffer.read(), struct.pack('4f', 6, 7, 10, 11))
+
+    def test_texture_array_level(self):
+        texture = self.ctx.texture_array((4, 4, 2), 1, levels=2)
+        texture.write(b'\x01\x02\x03\x04\x05\x06\x07\x08', level=1)
+        self.assertEqual(texture.read(level=1), b'\x01\x02\x03\x04\x05\x06\x07\x08')
+        texture.write(b'\x09', (1, 1, 1, 1, 1, 1), level=1)
+        self.assertEqual(texture.read(viewport=(1, 1, 1), level=1), b'\x01')
+        self.assertEqual(texture.read(viewport=(1, 1, 1, 1, 1, 1), level=1), b'\x09')
+
+    def test_texture_cube(self):
+        texture = self.ctx.texture_cube((4, 4), 1, levels=2)
+        for face in range(6):
+            texture.write(face, bytes([face]) * 16)
+            texture.write(face, bytes([face + 10]) * 4, level=1)
+
+        self.assertEqual(texture.read(4, viewport=(1, 1, 2, 2)), b'\x04' * 4)
+        self.assertEqual(texture.read(5, level=1), b'\x0f' * 4)
+        self.assertEqual(texture.read(2, viewport=(1, 0, 1, 2), level=1), b'\x0c' * 2)
+
+        buffer = bytearray(2)
+        texture.read_into(buffer, 3, viewport=(1, 1), level=1, write_offset=1)
+        self.assertEqual(bytes(buffer), b'\x00\x0d')
+
+        with self.assertRaises(moderngl.Error):
+            texture.read(0, viewport=(0, 0, 3, 3), level=1)
+
+        self.assertEqual(self.ctx.error, 'GL_NO_ERROR')
+
+    def test_negative_level(self):
+        texture3d = self.ctx.texture3d((2, 2, 2), 1)
+        array = self.ctx.texture_array((2, 2, 2), 1)
+        cube = self.ctx.texture_cube((2, 2), 1)
+        buffer = bytearray(8)
+
+        with self.assertRaises(moderngl.Error):
+            texture3d.read(level=-1)
+        with self.assertRaises(moderngl.Error):
+            texture3d.read_into(buffer, level=-1)
+        with self.assertRaises(moderngl.Error):
+            texture3d.write(b'\x00', level=-1)
+        with self.assertRaises(moderngl.Error):
+            array.read(level=-1)
+        with self.assertRaises(moderngl.Error):
+            array.read_into(buffer, level=-1)
+        with self.assertRaises(moderngl.Error):
+            array.write(b'\x00', level=-1)
+        with self.assertRaises(moderngl.Error):
+            cube.read(0, level=-1)
+        with self.assertRaises(moderngl.Error):
+            cube.read_into(buffer, 0, level=-1)
+        with self.assertRaises(moderngl.Error):
+            cube.write(0, b'\x00', level=-1)
+
+        self.assertEqual(self.ctx.error, 'GL_NO_ERROR')
+
+
+if __name__ == '__main__':
+    unittest.main()
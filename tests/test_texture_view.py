@@ -0,0 +1,77 @@
+import struct
+import unittest
+
+import moderngl
+
+from common import get_context
+
+
+class TestCase(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        cls.ctx = get_context()
+        if cls.ctx.version_code < 430:
+            raise unittest.SkipTest('texture views require OpenGL 4.3')
+
+    def test_reinterpret_format(self):
+        texture = self.ctx.texture((4, 4), 4, bytes(range(64)), immutable=True)
+        view = texture.view(dtype='u4', components=1)
+        self.assertEqual(view.dtype, 'u4')
+        self.assertEqual(view.components, 1)
+        self.assertEqual(view.read(), texture.read())
+
+        view.write(struct.pack('I', 0x01020304) * 16)
+        self.assertEqual(texture.read(), b'\x04\x03\x02\x01' * 16)
+        self.assertEqual(self.ctx.error, 'GL_NO_ERROR')
+
+    def test_mip_level(self):
+        texture = self.ctx.texture((4, 4), 4, immutable=True)
+        view = texture.view(levels=(1, 1))
+        self.assertEqual(view.size, (2, 2))
+
+        fbo = self.ctx.framebuffer([view])
+        fbo.clear(1.0, 0.0, 0.0, 1.0)
+        self.assertEqual(texture.read(level=1), b'\xff\x00\x00\xff' * 4)
+        self.assertEqual(texture.read(level=0), bytes(64))
+
+    def test_array_layers(self):
+        array = self.ctx.texture_array((4, 4, 3), 1, bytes(range(48)), immutable=True)
+
+        layer = array.view(layers=2)
+        self.assertIsInstance(layer, moderngl.Texture)
+        self.assertEqual(layer.read(), bytes(range(32, 48)))
+
+        self.ctx.framebuffer([layer]).clear(1.0)
+        self.assertEqual(array.read(), bytes(range(32)) + b'\xff' * 16)
+
+        layers = array.view(layers=(1, 2))
+        self.assertIsInstance(layers, moderngl.TextureArray)
+        self.assertEqual(layers.size, (4, 4, 2))
+        self.assertEqual(layers.read(), bytes(range(16, 32)) + b'\xff' * 16)
+        self.assertEqual(self.ctx.error, 'GL_NO_ERROR')
+
+    def test_bind(self):
+        view = self.ctx.texture((4, 4), 4, immutable=True).view(dtype='u4', components=1)
+        view.use(0)
+        view.bind_to_image(0)
+        self.assertEqual(self.ctx.error, 'GL_NO_ERROR')
+
+    def test_invalid(self):
+        texture = self.ctx.texture((4, 4), 4, immutable=True)
+
+        with self.assertRaises(moderngl.Error):
+            self.ctx.texture((4, 4), 4).view()
+
+        with self.assertRaises(moderngl.Error):
+            texture.view(dtype='f2', components=1)
+
+        with self.assertRaises(moderngl.Error):
+            texture.view(levels=(0, 4))
+
+        with self.assertRaises(moderngl.Error):
+            self.ctx.texture_array((4, 4, 2), 1, immutable=True).view(layers=2)
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,91 @@
+import struct
+import unittest
+
+import moderngl
+
+from common import get_context
+
+
+class TestCase(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        cls.ctx = get_context()
+        cls.prog = cls.ctx.program(
+            vertex_shader='''
+                #version 330
+
+                in vec2 in_vert;
+                out vec4 v_color;
+
+                layout (std140) uniform PerDraw {
+                    vec2 offset;
+                    vec4 color;
+                };
+
+                void main() {
+                    v_color = color;
+                    gl_Position = vec4(in_vert + offset, 0.0, 1.0);
+                }
+            ''',
+            fragment_shader='''
+                #version 330
+
+                in vec4 v_color;
+                out vec4 f_color;
+
+                void main() {
+                    f_color = v_color;
+                }
+            ''',
+        )
+        cls.prog['PerDraw'].binding = 3
+        cls.vbo = cls.ctx.buffer(struct.pack('2f', 0.0, 0.0))
+        cls.vao = cls.ctx.vertex_array(cls.prog, [(cls.vbo, '2f', 'in_vert')])
+
+    def test_stream_records(self):
+        stream = self.ctx.uniform_stream(self.prog['PerDraw'], capacity=64 * 1024)
+        self.assertEqual(stream.binding, 3)
+        self.assertEqual(stream.capacity % stream.record_size, 0)
+        self.assertGreaterEqual(stream.record_size, self.prog['PerDraw'].size)
+
+        offsets = [stream.push({'offset': (0.0, 0.0), 'color': (1.0, 0.0, 0.0, 1.0)}) for _ in range(3)]
+        self.assertEqual(offsets, [0, stream.record_size, stream.record_size * 2])
+
+        num_records = stream.capacity // stream.record_size
+        for _ in range(num_records - 3):
+            stream.push({'offset': (0.0, 0.0), 'color': (1.0, 0.0, 0.0, 1.0)})
+
+        self.assertEqual(stream.push({'offset': (0.0, 0.0), 'color': (1.0, 0.0, 0.0, 1.0)}), 0)
+        stream.release()
+
+    def test_render_binds_current_record(self):
+        fbo = self.ctx.simple_framebuffer((4, 4))
+        fbo.use()
+        fbo.clear()
+
+        stream = self.ctx.uniform_stream(self.prog['PerDraw'], capacity=64 * 1024)
+        self.vao.uniform_stream = stream
+        self.assertIs(self.vao.uniform_stream, stream)
+
+        colors = [(1.0, 0.0, 0.0, 1.0), (0.0, 1.0, 0.0, 1.0), (0.0, 0.0, 1.0, 1.0)]
+        offsets = [(-0.25, -0.25), (0.75, -0.25), (-0.25, 0.75)]
+        for offset, color in zip(offsets, colors):
+            stream.push({'offset': offset, 'color': color})
+            self.vao.render(moderngl.POINTS, vertices=1)
+
+        data = fbo.read(components=4)
+        self.assertEqual(data[(1 * 4 + 1) * 4:(1 * 4 + 1) * 4 + 4], b'\xff\x00\x00\xff')
+        self.assertEqual(data[(1 * 4 + 3) * 4:(1 * 4 + 3) * 4 + 4], b'\x00\xff\x00\xff')
+        self.assertEqual(data[(3 * 4 + 1) * 4:(3 * 4 + 1) * 4 + 4], b'\x00\x00\xff\xff')
+
+        self.vao.uniform_stream = None
+        stream.release()
+
+    def test_capacity_too_small(self):
+        with self.assertRaises(moderngl.Error):
+            self.ctx.uniform_stream(self.prog['PerDraw'], capacity=16)
+
+
+if __name__ == '__main__':
+    unittest.main()
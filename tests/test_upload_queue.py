@@ -0,0 +1,108 @@
+import os
+import unittest
+
+import moderngl
+
+from common import get_context
+
+
+class TestCase(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        cls.ctx = get_context()
+
+    def test_texture(self):
+        queue = self.ctx.upload_queue(1024)
+        texture = self.ctx.texture((4, 4), 4)
+        pixels = os.urandom(64)
+        queue.write(texture, pixels)
+        queue.write(texture, b'\xff' * 16, (2, 2, 2, 2), alignment=4)
+        queue.finish()
+
+        expected = bytearray(pixels)
+        for row in (2, 3):
+            expected[row * 16 + 8:row * 16 + 16] = b'\xff' * 8
+
+        self.assertEqual(texture.read(), expected)
+        self.assertEqual(queue.uploads, 2)
+        self.assertEqual(queue.uploaded_bytes, 80)
+        self.assertEqual(queue.pending, 0)
+        self.assertEqual(self.ctx.error, 'GL_NO_ERROR')
+        queue.release()
+
+    def test_mipmap_level(self):
+        queue = self.ctx.upload_queue(1024)
+        texture = self.ctx.texture((4, 4), 1)
+        texture.build_mipmaps()
+        queue.write(texture, b'\x7f' * 4, level=1)
+        self.assertEqual(texture.read(level=1), b'\x7f' * 4)
+        queue.release()
+
+    def test_other_textures(self):
+        queue = self.ctx.upload_queue(1024)
+
+        texture = self.ctx.texture3d((2, 2, 2), 1)
+        queue.write(texture, bytes(range(8)))
+        self.assertEqual(texture.read(), bytes(range(8)))
+
+        texture = self.ctx.texture_array((2, 2, 3), 1)
+        queue.write(texture, bytes(range(12)))
+        self.assertEqual(texture.read(), bytes(range(12)))
+
+        texture = self.ctx.texture_cube((2, 2), 1, levels=2)
+        queue.write(texture, b'\x01\x02\x03\x04', face=3)
+        self.assertEqual(texture.read(3), b'\x01\x02\x03\x04')
+
+        queue.write(texture, b'\x05', face=3, level=1)
+        self.assertEqual(texture.read(3, level=1), b'\x05')
+
+        self.assertEqual(self.ctx.error, 'GL_NO_ERROR')
+        queue.release()
+
+    def test_ring_wraps(self):
+        # Each 64x64 upload takes a quarter of the ring, the fifth one reuses the first range
+        queue = self.ctx.upload_queue(4 * 4096)
+        texture = self.ctx.texture((64, 64), 1)
+        for i in range(10):
+            queue.write(texture, bytes([i]) * 4096)
+
+        self.assertEqual(texture.read(), b'\x09' * 4096)
+        self.assertEqual(queue.stall_time >= 0.0, True)
+        self.assertLessEqual(queue.pending, 4)
+        self.assertEqual(self.ctx.error, 'GL_NO_ERROR')
+        queue.release()
+
+    def test_data_size(self):
+        queue = self.ctx.upload_queue(256)
+        texture = self.ctx.texture((16, 16), 4)
+
+        with self.assertRaises(moderngl.Error):
+            queue.write(texture, bytes(1024))
+
+        with self.assertRaises(moderngl.Error):
+            queue.write(self.ctx.texture((64, 64), 1), bytes(16))
+
+        queue.release()
+
+    def test_data_size_mismatch(self):
+        # The staging ring is large enough for both, the staged size must still match the viewport
+        queue = self.ctx.upload_queue(4096)
+        texture = self.ctx.texture((16, 16), 4)
+
+        with self.assertRaises(moderngl.Error):
+            queue.write(texture, bytes(512))
+
+        with self.assertRaises(moderngl.Error):
+            queue.write(texture, bytes(1025))
+
+        with self.assertRaises(moderngl.Error):
+            queue.write(texture, bytes(16), viewport=(0, 0, 1, 1))
+
+        queue.write(texture, bytes(16), viewport=(0, 0, 2, 2))
+        queue.finish()
+        queue.release()
+
+
+if __name__ == '__main__':
+    unittest.main()